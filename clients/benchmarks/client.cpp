@@ -26,24 +26,46 @@
 
 // Level1
 #include "testing_axpyi.hpp"
+#include "testing_axpyi_batched.hpp"
 #include "testing_doti.hpp"
+#include "testing_doti_batched.hpp"
 #include "testing_gthr.hpp"
+#include "testing_gthr_batched.hpp"
 #include "testing_gthrz.hpp"
+#include "testing_nrm2i.hpp"
+#include "testing_nrm2i_batched.hpp"
 #include "testing_roti.hpp"
+#include "testing_roti_multi.hpp"
 #include "testing_sctr.hpp"
+#include "testing_sctr_batched.hpp"
+#include "testing_spdoti.hpp"
+#include "testing_spdoti_batched.hpp"
 
 // Level2
 #include "testing_coomv.hpp"
+#include "testing_csr5mv.hpp"
 #include "testing_csrmv.hpp"
+#include "testing_csrmv_merge.hpp"
+#include "testing_csrmv_multi.hpp"
+#include "testing_csrmv_symm.hpp"
+#include "testing_csrmvt.hpp"
 #include "testing_csrsv.hpp"
 #include "testing_ellmv.hpp"
 #include "testing_hybmv.hpp"
+#include "testing_sellcsmv.hpp"
 
 // Level3
 #include "testing_csrmm.hpp"
+#include "testing_csrsm.hpp"
 
 // Preconditioner
+#include "testing_csric0.hpp"
 #include "testing_csrilu0.hpp"
+#include "testing_csrilu0_iter.hpp"
+#include "testing_csrilu0_refactor.hpp"
+#include "testing_csriluk.hpp"
+#include "testing_csrjacobi.hpp"
+#include "testing_csrcheby.hpp"
 
 // Conversion
 #include "testing_coo2csr.hpp"
@@ -71,6 +93,7 @@ int main(int argc, char* argv[])
 
     std::string function;
     char        precision = 's';
+    int         jacobi    = 0;
 
     rocsparse_int device_id;
 
@@ -85,13 +108,28 @@ int main(int argc, char* argv[])
         ("sizen,n",
          po::value<rocsparse_int>(&argus.N)->default_value(128),
          "Specific matrix/vector size testing: SPARSE-1: the length of the "
-         "dense vector. SPARSE-2 & SPARSE-3: the number of columns")
+         "dense vector. SPARSE-2 & SPARSE-3: the number of columns or the number "
+         "of right-hand sides (csrsm).")
+
+        ("sizek,k",
+         po::value<rocsparse_int>(&argus.K)->default_value(128),
+         "Specific matrix size testing: sizek is only applicable to SPARSE-2 "
+         "& SPARSE-3: the number of dense vectors (csrmv_multi), the number "
+         "of columns of the sparse matrix (csrmm), the level of fill (csriluk), "
+         "the number of sweeps (csrilu0_iter, csrjacobi), the polynomial "
+         "degree (csrcheby), the number of rotations (roti_multi), the number "
+         "of non-zero elements of the second sparse vector (spdoti) or the "
+         "sorting window (sellcsmv).")
 
         ("sizennz,z",
          po::value<rocsparse_int>(&argus.nnz)->default_value(32),
          "Specific vector size testing, LEVEL-1: the number of non-zero elements "
          "of the sparse vector.")
 
+        ("batch",
+         po::value<rocsparse_int>(&argus.batch_count)->default_value(1),
+         "Number of sparse vectors of the batch, LEVEL-1 batched functions only.")
+
         ("mtx",
          po::value<std::string>(&argus.filename)->default_value(""), "read from matrix "
          "market (.mtx) format. This will override parameters m, n, and z.")
@@ -111,13 +149,26 @@ int main(int argc, char* argv[])
         ("beta", 
           po::value<double>(&argus.beta)->default_value(0.0), "specifies the scalar beta")
 
+        ("jacobi",
+         po::value<int>(&jacobi)->default_value(0),
+         "Jacobi smoother type (csrjacobi): 0 = point, 1 = l1, 2 = block")
+
+        ("blockdim",
+         po::value<rocsparse_int>(&argus.block_dim)->default_value(1),
+         "dimension of the diagonal blocks of the block Jacobi smoother (csrjacobi) or of "
+         "the block tridiagonal matrix (csrsv)")
+
         ("function,f",
          po::value<std::string>(&function)->default_value("axpyi"),
          "SPARSE function to test. Options:\n"
-         "  Level1: axpyi, doti, gthr, gthrz, roti, sctr\n"
-         "  Level2: coomv, csrmv, csrsv, ellmv, hybmv\n"
-         "  Level3: csrmm\n"
-         "  Preconditioner: csrilu0\n"
+         "  Level1: axpyi, axpyi_batched, doti, doti_batched, spdoti,\n"
+         "          spdoti_batched, nrm2i, nrm2i_batched, gthr,\n"
+         "          gthr_batched, gthrz, roti, roti_multi, sctr, sctr_batched\n"
+         "  Level2: coomv, csrmv, csrmv_merge, csrmv_multi, csrmv_symm,\n"
+         "          csrmvt, csrsv, ellmv, hybmv, csr5mv, sellcsmv\n"
+         "  Level3: csrmm, csrsm\n"
+         "  Preconditioner: csrilu0, csrilu0_iter, csrilu0_refactor,\n"
+         "                  csriluk, csric0, csrjacobi, csrcheby\n"
          "  Conversion: csr2coo, csr2csc, csr2ell,\n"
          "              csr2hyb, coo2csr, ell2csr\n"
          "  Sorting: csrsort, coosort\n"
@@ -155,6 +206,14 @@ int main(int argc, char* argv[])
         return -1;
     }
 
+    if(jacobi < 0 || jacobi > 2)
+    {
+        fprintf(stderr, "Invalid value for --jacobi\n");
+        return -1;
+    }
+
+    argus.jacobi = static_cast<rocsparse_jacobi_type>(jacobi);
+
     // Device Query
     rocsparse_int device_count = query_device_property();
 
@@ -184,6 +243,13 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_axpyi<double>(argus);
     }
+    else if(function == "axpyi_batched")
+    {
+        if(precision == 's')
+            testing_axpyi_batched<float>(argus);
+        else if(precision == 'd')
+            testing_axpyi_batched<double>(argus);
+    }
     else if(function == "doti")
     {
         if(precision == 's')
@@ -191,6 +257,41 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_doti<double>(argus);
     }
+    else if(function == "doti_batched")
+    {
+        if(precision == 's')
+            testing_doti_batched<float>(argus);
+        else if(precision == 'd')
+            testing_doti_batched<double>(argus);
+    }
+    else if(function == "spdoti")
+    {
+        if(precision == 's')
+            testing_spdoti<float>(argus);
+        else if(precision == 'd')
+            testing_spdoti<double>(argus);
+    }
+    else if(function == "spdoti_batched")
+    {
+        if(precision == 's')
+            testing_spdoti_batched<float>(argus);
+        else if(precision == 'd')
+            testing_spdoti_batched<double>(argus);
+    }
+    else if(function == "nrm2i")
+    {
+        if(precision == 's')
+            testing_nrm2i<float>(argus);
+        else if(precision == 'd')
+            testing_nrm2i<double>(argus);
+    }
+    else if(function == "nrm2i_batched")
+    {
+        if(precision == 's')
+            testing_nrm2i_batched<float>(argus);
+        else if(precision == 'd')
+            testing_nrm2i_batched<double>(argus);
+    }
     else if(function == "gthr")
     {
         if(precision == 's')
@@ -198,6 +299,13 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_gthr<double>(argus);
     }
+    else if(function == "gthr_batched")
+    {
+        if(precision == 's')
+            testing_gthr_batched<float>(argus);
+        else if(precision == 'd')
+            testing_gthr_batched<double>(argus);
+    }
     else if(function == "gthrz")
     {
         if(precision == 's')
@@ -212,6 +320,13 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_roti<double>(argus);
     }
+    else if(function == "roti_multi")
+    {
+        if(precision == 's')
+            testing_roti_multi<float>(argus);
+        else if(precision == 'd')
+            testing_roti_multi<double>(argus);
+    }
     else if(function == "sctr")
     {
         if(precision == 's')
@@ -219,6 +334,13 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_sctr<double>(argus);
     }
+    else if(function == "sctr_batched")
+    {
+        if(precision == 's')
+            testing_sctr_batched<float>(argus);
+        else if(precision == 'd')
+            testing_sctr_batched<double>(argus);
+    }
     else if(function == "coomv")
     {
         if(precision == 's')
@@ -226,6 +348,13 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_coomv<double>(argus);
     }
+    else if(function == "csr5mv")
+    {
+        if(precision == 's')
+            testing_csr5mv<float>(argus);
+        else if(precision == 'd')
+            testing_csr5mv<double>(argus);
+    }
     else if(function == "csrmv")
     {
         argus.bswitch = true;
@@ -234,6 +363,36 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_csrmv<double>(argus);
     }
+    else if(function == "csrmv_merge")
+    {
+        if(precision == 's')
+            testing_csrmv_merge<float>(argus);
+        else if(precision == 'd')
+            testing_csrmv_merge<double>(argus);
+    }
+    else if(function == "csrmv_multi")
+    {
+        argus.bswitch = true;
+        if(precision == 's')
+            testing_csrmv_multi<float>(argus);
+        else if(precision == 'd')
+            testing_csrmv_multi<double>(argus);
+    }
+    else if(function == "csrmv_symm")
+    {
+        if(precision == 's')
+            testing_csrmv_symm<float>(argus);
+        else if(precision == 'd')
+            testing_csrmv_symm<double>(argus);
+    }
+    else if(function == "csrmvt")
+    {
+        argus.bswitch = true;
+        if(precision == 's')
+            testing_csrmvt<float>(argus);
+        else if(precision == 'd')
+            testing_csrmvt<double>(argus);
+    }
     else if(function == "csrsv")
     {
         if(precision == 's')
@@ -255,6 +414,13 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_hybmv<double>(argus);
     }
+    else if(function == "sellcsmv")
+    {
+        if(precision == 's')
+            testing_sellcsmv<float>(argus);
+        else if(precision == 'd')
+            testing_sellcsmv<double>(argus);
+    }
     else if(function == "csrmm")
     {
         if(precision == 's')
@@ -262,6 +428,13 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_csrmm<double>(argus);
     }
+    else if(function == "csrsm")
+    {
+        if(precision == 's')
+            testing_csrsm<float>(argus);
+        else if(precision == 'd')
+            testing_csrsm<double>(argus);
+    }
     else if(function == "csrilu0")
     {
         if(precision == 's')
@@ -269,6 +442,48 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_csrilu0<double>(argus);
     }
+    else if(function == "csrilu0_iter")
+    {
+        if(precision == 's')
+            testing_csrilu0_iter<float>(argus);
+        else if(precision == 'd')
+            testing_csrilu0_iter<double>(argus);
+    }
+    else if(function == "csrilu0_refactor")
+    {
+        if(precision == 's')
+            testing_csrilu0_refactor<float>(argus);
+        else if(precision == 'd')
+            testing_csrilu0_refactor<double>(argus);
+    }
+    else if(function == "csriluk")
+    {
+        if(precision == 's')
+            testing_csriluk<float>(argus);
+        else if(precision == 'd')
+            testing_csriluk<double>(argus);
+    }
+    else if(function == "csric0")
+    {
+        if(precision == 's')
+            testing_csric0<float>(argus);
+        else if(precision == 'd')
+            testing_csric0<double>(argus);
+    }
+    else if(function == "csrjacobi")
+    {
+        if(precision == 's')
+            testing_csrjacobi<float>(argus);
+        else if(precision == 'd')
+            testing_csrjacobi<double>(argus);
+    }
+    else if(function == "csrcheby")
+    {
+        if(precision == 's')
+            testing_csrcheby<float>(argus);
+        else if(precision == 'd')
+            testing_csrcheby<double>(argus);
+    }
     else if(function == "csr2coo")
     {
         testing_csr2coo(argus);
@@ -52,6 +52,84 @@ namespace rocsparse
         return rocsparse_daxpyi(handle, nnz, alpha, x_val, x_ind, y, idx_base);
     }
 
+    template <>
+    rocsparse_status rocsparse_axpyi_strided_batched(rocsparse_handle     handle,
+                                                     rocsparse_int        nnz,
+                                                     const float*         alpha,
+                                                     const float*         x_val,
+                                                     rocsparse_int        stride_x,
+                                                     const rocsparse_int* x_ind,
+                                                     rocsparse_int        stride_ind,
+                                                     float*               y,
+                                                     rocsparse_int        stride_y,
+                                                     rocsparse_int        batch_count,
+                                                     rocsparse_index_base idx_base)
+    {
+        return rocsparse_saxpyi_strided_batched(handle,
+                                                nnz,
+                                                alpha,
+                                                x_val,
+                                                stride_x,
+                                                x_ind,
+                                                stride_ind,
+                                                y,
+                                                stride_y,
+                                                batch_count,
+                                                idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_axpyi_strided_batched(rocsparse_handle     handle,
+                                                     rocsparse_int        nnz,
+                                                     const double*        alpha,
+                                                     const double*        x_val,
+                                                     rocsparse_int        stride_x,
+                                                     const rocsparse_int* x_ind,
+                                                     rocsparse_int        stride_ind,
+                                                     double*              y,
+                                                     rocsparse_int        stride_y,
+                                                     rocsparse_int        batch_count,
+                                                     rocsparse_index_base idx_base)
+    {
+        return rocsparse_daxpyi_strided_batched(handle,
+                                                nnz,
+                                                alpha,
+                                                x_val,
+                                                stride_x,
+                                                x_ind,
+                                                stride_ind,
+                                                y,
+                                                stride_y,
+                                                batch_count,
+                                                idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_axpyi_batched(rocsparse_handle            handle,
+                                             rocsparse_int               nnz,
+                                             const float*                alpha,
+                                             const float* const*         x_val,
+                                             const rocsparse_int* const* x_ind,
+                                             float* const*               y,
+                                             rocsparse_int               batch_count,
+                                             rocsparse_index_base        idx_base)
+    {
+        return rocsparse_saxpyi_batched(handle, nnz, alpha, x_val, x_ind, y, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_axpyi_batched(rocsparse_handle            handle,
+                                             rocsparse_int               nnz,
+                                             const double*               alpha,
+                                             const double* const*        x_val,
+                                             const rocsparse_int* const* x_ind,
+                                             double* const*              y,
+                                             rocsparse_int               batch_count,
+                                             rocsparse_index_base        idx_base)
+    {
+        return rocsparse_daxpyi_batched(handle, nnz, alpha, x_val, x_ind, y, batch_count, idx_base);
+    }
+
     template <>
     rocsparse_status rocsparse_doti(rocsparse_handle     handle,
                                     rocsparse_int        nnz,
@@ -76,6 +154,210 @@ namespace rocsparse
         return rocsparse_ddoti(handle, nnz, x_val, x_ind, y, result, idx_base);
     }
 
+    template <>
+    rocsparse_status rocsparse_doti_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const float*         x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    const float*         y,
+                                                    rocsparse_int        stride_y,
+                                                    float*               result,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+    {
+        return rocsparse_sdoti_strided_batched(handle,
+                                               nnz,
+                                               x_val,
+                                               stride_x,
+                                               x_ind,
+                                               stride_ind,
+                                               y,
+                                               stride_y,
+                                               result,
+                                               batch_count,
+                                               idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_doti_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const double*        x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    const double*        y,
+                                                    rocsparse_int        stride_y,
+                                                    double*              result,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+    {
+        return rocsparse_ddoti_strided_batched(handle,
+                                               nnz,
+                                               x_val,
+                                               stride_x,
+                                               x_ind,
+                                               stride_ind,
+                                               y,
+                                               stride_y,
+                                               result,
+                                               batch_count,
+                                               idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_doti_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const float* const*         x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            const float* const*         y,
+                                            float*                      result,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base)
+    {
+        return rocsparse_sdoti_batched(handle, nnz, x_val, x_ind, y, result, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_doti_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const double* const*        x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            const double* const*        y,
+                                            double*                     result,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base)
+    {
+        return rocsparse_ddoti_batched(handle, nnz, x_val, x_ind, y, result, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_spdoti(rocsparse_handle     handle,
+                                      rocsparse_int        nnz_x,
+                                      const float*         x_val,
+                                      const rocsparse_int* x_ind,
+                                      rocsparse_int        nnz_y,
+                                      const float*         y_val,
+                                      const rocsparse_int* y_ind,
+                                      float*               result,
+                                      rocsparse_index_base idx_base)
+    {
+        return rocsparse_sspdoti(
+            handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, result, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_spdoti(rocsparse_handle     handle,
+                                      rocsparse_int        nnz_x,
+                                      const double*        x_val,
+                                      const rocsparse_int* x_ind,
+                                      rocsparse_int        nnz_y,
+                                      const double*        y_val,
+                                      const rocsparse_int* y_ind,
+                                      double*              result,
+                                      rocsparse_index_base idx_base)
+    {
+        return rocsparse_dspdoti(
+            handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, result, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_spdoti_strided_batched(rocsparse_handle     handle,
+                                                      rocsparse_int        nnz_x,
+                                                      const float*         x_val,
+                                                      const rocsparse_int* x_ind,
+                                                      rocsparse_int        stride_x,
+                                                      rocsparse_int        nnz_y,
+                                                      const float*         y_val,
+                                                      const rocsparse_int* y_ind,
+                                                      rocsparse_int        stride_y,
+                                                      float*               result,
+                                                      rocsparse_int        batch_count,
+                                                      rocsparse_index_base idx_base)
+    {
+        return rocsparse_sspdoti_strided_batched(handle,
+                                                 nnz_x,
+                                                 x_val,
+                                                 x_ind,
+                                                 stride_x,
+                                                 nnz_y,
+                                                 y_val,
+                                                 y_ind,
+                                                 stride_y,
+                                                 result,
+                                                 batch_count,
+                                                 idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_spdoti_strided_batched(rocsparse_handle     handle,
+                                                      rocsparse_int        nnz_x,
+                                                      const double*        x_val,
+                                                      const rocsparse_int* x_ind,
+                                                      rocsparse_int        stride_x,
+                                                      rocsparse_int        nnz_y,
+                                                      const double*        y_val,
+                                                      const rocsparse_int* y_ind,
+                                                      rocsparse_int        stride_y,
+                                                      double*              result,
+                                                      rocsparse_int        batch_count,
+                                                      rocsparse_index_base idx_base)
+    {
+        return rocsparse_dspdoti_strided_batched(handle,
+                                                 nnz_x,
+                                                 x_val,
+                                                 x_ind,
+                                                 stride_x,
+                                                 nnz_y,
+                                                 y_val,
+                                                 y_ind,
+                                                 stride_y,
+                                                 result,
+                                                 batch_count,
+                                                 idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_nrm2i(rocsparse_handle handle,
+                                     rocsparse_int    nnz,
+                                     const float*     x_val,
+                                     float*           result)
+    {
+        return rocsparse_snrm2i(handle, nnz, x_val, result);
+    }
+
+    template <>
+    rocsparse_status rocsparse_nrm2i(rocsparse_handle handle,
+                                     rocsparse_int    nnz,
+                                     const double*    x_val,
+                                     double*          result)
+    {
+        return rocsparse_dnrm2i(handle, nnz, x_val, result);
+    }
+
+    template <>
+    rocsparse_status rocsparse_nrm2i_strided_batched(rocsparse_handle handle,
+                                                     rocsparse_int    nnz,
+                                                     const float*     x_val,
+                                                     rocsparse_int    stride_x,
+                                                     float*           result,
+                                                     rocsparse_int    batch_count)
+    {
+        return rocsparse_snrm2i_strided_batched(handle, nnz, x_val, stride_x, result, batch_count);
+    }
+
+    template <>
+    rocsparse_status rocsparse_nrm2i_strided_batched(rocsparse_handle handle,
+                                                     rocsparse_int    nnz,
+                                                     const double*    x_val,
+                                                     rocsparse_int    stride_x,
+                                                     double*          result,
+                                                     rocsparse_int    batch_count)
+    {
+        return rocsparse_dnrm2i_strided_batched(handle, nnz, x_val, stride_x, result, batch_count);
+    }
+
     template <>
     rocsparse_status rocsparse_gthr(rocsparse_handle     handle,
                                     rocsparse_int        nnz,
@@ -98,6 +380,62 @@ namespace rocsparse
         return rocsparse_dgthr(handle, nnz, y, x_val, x_ind, idx_base);
     }
 
+    template <>
+    rocsparse_status rocsparse_gthr_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const float*         y,
+                                                    rocsparse_int        stride_y,
+                                                    float*               x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+    {
+        return rocsparse_sgthr_strided_batched(
+            handle, nnz, y, stride_y, x_val, stride_x, x_ind, stride_ind, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_gthr_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const double*        y,
+                                                    rocsparse_int        stride_y,
+                                                    double*              x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+    {
+        return rocsparse_dgthr_strided_batched(
+            handle, nnz, y, stride_y, x_val, stride_x, x_ind, stride_ind, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_gthr_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const float* const*         y,
+                                            float* const*               x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base)
+    {
+        return rocsparse_sgthr_batched(handle, nnz, y, x_val, x_ind, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_gthr_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const double* const*        y,
+                                            double* const*              x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base)
+    {
+        return rocsparse_dgthr_batched(handle, nnz, y, x_val, x_ind, batch_count, idx_base);
+    }
+
     template <>
     rocsparse_status rocsparse_gthrz(rocsparse_handle     handle,
                                      rocsparse_int        nnz,
@@ -146,6 +484,34 @@ namespace rocsparse
         return rocsparse_droti(handle, nnz, x_val, x_ind, y, c, s, idx_base);
     }
 
+    template <>
+    rocsparse_status rocsparse_roti_multi(rocsparse_handle     handle,
+                                          rocsparse_int        nnz,
+                                          float*               x_val,
+                                          const rocsparse_int* x_ind,
+                                          float*               y,
+                                          rocsparse_int        nrot,
+                                          const float*         c,
+                                          const float*         s,
+                                          rocsparse_index_base idx_base)
+    {
+        return rocsparse_sroti_multi(handle, nnz, x_val, x_ind, y, nrot, c, s, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_roti_multi(rocsparse_handle     handle,
+                                          rocsparse_int        nnz,
+                                          double*              x_val,
+                                          const rocsparse_int* x_ind,
+                                          double*              y,
+                                          rocsparse_int        nrot,
+                                          const double*        c,
+                                          const double*        s,
+                                          rocsparse_index_base idx_base)
+    {
+        return rocsparse_droti_multi(handle, nnz, x_val, x_ind, y, nrot, c, s, idx_base);
+    }
+
     template <>
     rocsparse_status rocsparse_sctr(rocsparse_handle     handle,
                                     rocsparse_int        nnz,
@@ -168,6 +534,62 @@ namespace rocsparse
         return rocsparse_dsctr(handle, nnz, x_val, x_ind, y, idx_base);
     }
 
+    template <>
+    rocsparse_status rocsparse_sctr_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const float*         x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    float*               y,
+                                                    rocsparse_int        stride_y,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+    {
+        return rocsparse_ssctr_strided_batched(
+            handle, nnz, x_val, stride_x, x_ind, stride_ind, y, stride_y, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_sctr_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const double*        x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    double*              y,
+                                                    rocsparse_int        stride_y,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+    {
+        return rocsparse_dsctr_strided_batched(
+            handle, nnz, x_val, stride_x, x_ind, stride_ind, y, stride_y, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_sctr_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const float* const*         x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            float* const*               y,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base)
+    {
+        return rocsparse_ssctr_batched(handle, nnz, x_val, x_ind, y, batch_count, idx_base);
+    }
+
+    template <>
+    rocsparse_status rocsparse_sctr_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const double* const*        x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            double* const*              y,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base)
+    {
+        return rocsparse_dsctr_batched(handle, nnz, x_val, x_ind, y, batch_count, idx_base);
+    }
+
     template <>
     rocsparse_status rocsparse_coomv(rocsparse_handle          handle,
                                      rocsparse_operation       trans,
@@ -302,6 +724,82 @@ namespace rocsparse
                                 y);
     }
 
+    template <>
+    rocsparse_status rocsparse_csrmv_multi(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const float*              x,
+                                           rocsparse_int             ldx,
+                                           const float*              beta,
+                                           float*                    y,
+                                           rocsparse_int             ldy)
+    {
+        return rocsparse_scsrmv_multi(handle,
+                                      trans,
+                                      m,
+                                      n,
+                                      k,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      ldx,
+                                      beta,
+                                      y,
+                                      ldy);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrmv_multi(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const double*             x,
+                                           rocsparse_int             ldx,
+                                           const double*             beta,
+                                           double*                   y,
+                                           rocsparse_int             ldy)
+    {
+        return rocsparse_dcsrmv_multi(handle,
+                                      trans,
+                                      m,
+                                      n,
+                                      k,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      ldx,
+                                      beta,
+                                      y,
+                                      ldy);
+    }
+
     template <>
     rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle          handle,
                                                  rocsparse_operation       trans,
@@ -516,6 +1014,58 @@ namespace rocsparse
         return rocsparse_dhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
     }
 
+    template <>
+    rocsparse_status rocsparse_csr5mv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      const float*                    alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_csr5_mat  csr5,
+                                      const float*                    x,
+                                      const float*                    beta,
+                                      float*                    y)
+    {
+        return rocsparse_scsr5mv(handle, trans, alpha, descr, csr5, x, beta, y);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csr5mv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      const double*                   alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_csr5_mat  csr5,
+                                      const double*                   x,
+                                      const double*                   beta,
+                                      double*                   y)
+    {
+        return rocsparse_dcsr5mv(handle, trans, alpha, descr, csr5, x, beta, y);
+    }
+
+    template <>
+    rocsparse_status rocsparse_sellcsmv(rocsparse_handle           handle,
+                                        rocsparse_operation        trans,
+                                        const float*               alpha,
+                                        const rocsparse_mat_descr  descr,
+                                        const rocsparse_sellcs_mat sell,
+                                        const float*               x,
+                                        const float*               beta,
+                                        float*                     y)
+    {
+        return rocsparse_ssellcsmv(handle, trans, alpha, descr, sell, x, beta, y);
+    }
+
+    template <>
+    rocsparse_status rocsparse_sellcsmv(rocsparse_handle           handle,
+                                        rocsparse_operation        trans,
+                                        const double*              alpha,
+                                        const rocsparse_mat_descr  descr,
+                                        const rocsparse_sellcs_mat sell,
+                                        const double*              x,
+                                        const double*              beta,
+                                        double*                    y)
+    {
+        return rocsparse_dsellcsmv(handle, trans, alpha, descr, sell, x, beta, y);
+    }
+
     template <>
     rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
                                      rocsparse_operation       trans_A,
@@ -592,6 +1142,82 @@ namespace rocsparse
                                 ldc);
     }
 
+    template <>
+    rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const float*              B,
+                                           rocsparse_int             ldb,
+                                           float*                    X,
+                                           rocsparse_int             ldx,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+    {
+        return rocsparse_scsrsm_solve(handle,
+                                      trans,
+                                      m,
+                                      nrhs,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      B,
+                                      ldb,
+                                      X,
+                                      ldx,
+                                      policy,
+                                      temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const double*             B,
+                                           rocsparse_int             ldb,
+                                           double*                   X,
+                                           rocsparse_int             ldx,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+    {
+        return rocsparse_dcsrsm_solve(handle,
+                                      trans,
+                                      m,
+                                      nrhs,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      B,
+                                      ldb,
+                                      X,
+                                      ldx,
+                                      policy,
+                                      temp_buffer);
+    }
+
     template <>
     rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
                                                    rocsparse_int             m,
@@ -706,6 +1332,556 @@ namespace rocsparse
             handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
     }
 
+    template <>
+    rocsparse_status rocsparse_csrilu0_apply(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const float*              alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const float*              x,
+                                             float*                    y,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer)
+    {
+        return rocsparse_scsrilu0_apply(handle,
+                                        m,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        y,
+                                        policy,
+                                        temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_apply(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const double*             alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const double*             x,
+                                             double*                   y,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer)
+    {
+        return rocsparse_dcsrilu0_apply(handle,
+                                        m,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        y,
+                                        policy,
+                                        temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_iter(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int             sweeps,
+                                            float*                    ilu0_val,
+                                            float*                    residual)
+    {
+        return rocsparse_scsrilu0_iter(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       sweeps,
+                                       ilu0_val,
+                                       residual);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_iter(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int             sweeps,
+                                            double*                   ilu0_val,
+                                            double*                   residual)
+    {
+        return rocsparse_dcsrilu0_iter(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       sweeps,
+                                       ilu0_val,
+                                       residual);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_refactor(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                float*                    csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_solve_policy    policy)
+    {
+        return rocsparse_scsrilu0_refactor(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_refactor(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                double*                   csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_solve_policy    policy)
+    {
+        return rocsparse_dcsrilu0_refactor(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle   handle,
+                                                     rocsparse_mat_info info,
+                                                     int                enable_boost,
+                                                     const float*       boost_tol,
+                                                     const float*       boost_val)
+    {
+        return rocsparse_scsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle   handle,
+                                                     rocsparse_mat_info info,
+                                                     int                enable_boost,
+                                                     const double*      boost_tol,
+                                                     const double*      boost_val)
+    {
+        return rocsparse_dcsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       float*                    lu_val,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+    {
+        return rocsparse_scsriluk(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  lu_val,
+                                  policy,
+                                  temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       double*                   lu_val,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+    {
+        return rocsparse_dcsriluk(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  lu_val,
+                                  policy,
+                                  temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  size_t*                   buffer_size)
+    {
+        return rocsparse_scsric0_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  size_t*                   buffer_size)
+    {
+        return rocsparse_dcsric0_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_analysis_policy analysis,
+                                               rocsparse_solve_policy    solve,
+                                               void*                     temp_buffer)
+    {
+        return rocsparse_scsric0_analysis(handle,
+                                          m,
+                                          nnz,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_analysis_policy analysis,
+                                               rocsparse_solve_policy    solve,
+                                               void*                     temp_buffer)
+    {
+        return rocsparse_dcsric0_analysis(handle,
+                                          m,
+                                          nnz,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      float*                    csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_solve_policy    policy,
+                                      void*                     temp_buffer)
+    {
+        return rocsparse_scsric0(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      double*                   csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_solve_policy    policy,
+                                      void*                     temp_buffer)
+    {
+        return rocsparse_dcsric0(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrjacobi_buffer_size(rocsparse_handle          handle,
+                                                     rocsparse_jacobi_type     type,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const float*              csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_int             block_dim,
+                                                     size_t*                   buffer_size)
+    {
+        return rocsparse_scsrjacobi_buffer_size(
+            handle, type, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrjacobi_buffer_size(rocsparse_handle          handle,
+                                                     rocsparse_jacobi_type     type,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const double*             csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_int             block_dim,
+                                                     size_t*                   buffer_size)
+    {
+        return rocsparse_dcsrjacobi_buffer_size(
+            handle, type, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrjacobi_analysis(rocsparse_handle          handle,
+                                                  rocsparse_jacobi_type     type,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             block_dim,
+                                                  void*                     temp_buffer)
+    {
+        return rocsparse_scsrjacobi_analysis(
+            handle, type, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrjacobi_analysis(rocsparse_handle          handle,
+                                                  rocsparse_jacobi_type     type,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             block_dim,
+                                                  void*                     temp_buffer)
+    {
+        return rocsparse_dcsrjacobi_analysis(
+            handle, type, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrjacobi(rocsparse_handle          handle,
+                                         rocsparse_jacobi_type     type,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const float*              omega,
+                                         const rocsparse_mat_descr descr,
+                                         const float*              csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_int             block_dim,
+                                         const float*              b,
+                                         float*                    x,
+                                         rocsparse_int             sweeps,
+                                         void*                     temp_buffer)
+    {
+        return rocsparse_scsrjacobi(handle,
+                                    type,
+                                    m,
+                                    nnz,
+                                    omega,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    block_dim,
+                                    b,
+                                    x,
+                                    sweeps,
+                                    temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrjacobi(rocsparse_handle          handle,
+                                         rocsparse_jacobi_type     type,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const double*             omega,
+                                         const rocsparse_mat_descr descr,
+                                         const double*             csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_int             block_dim,
+                                         const double*             b,
+                                         double*                   x,
+                                         rocsparse_int             sweeps,
+                                         void*                     temp_buffer)
+    {
+        return rocsparse_dcsrjacobi(handle,
+                                    type,
+                                    m,
+                                    nnz,
+                                    omega,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    block_dim,
+                                    b,
+                                    x,
+                                    sweeps,
+                                    temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrcheby_buffer_size(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    size_t*                   buffer_size)
+    {
+        return rocsparse_scsrcheby_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrcheby_buffer_size(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const double*             csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    size_t*                   buffer_size)
+    {
+        return rocsparse_dcsrcheby_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrcheby(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_int             degree,
+                                        const float*              lambda_min,
+                                        const float*              lambda_max,
+                                        const float*              r,
+                                        float*                    z,
+                                        void*                     temp_buffer)
+    {
+        return rocsparse_scsrcheby(handle,
+                                   m,
+                                   nnz,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   degree,
+                                   lambda_min,
+                                   lambda_max,
+                                   r,
+                                   z,
+                                   temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrcheby(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_int             degree,
+                                        const double*             lambda_min,
+                                        const double*             lambda_max,
+                                        const double*             r,
+                                        double*                   z,
+                                        void*                     temp_buffer)
+    {
+        return rocsparse_dcsrcheby(handle,
+                                   m,
+                                   nnz,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   degree,
+                                   lambda_min,
+                                   lambda_max,
+                                   r,
+                                   z,
+                                   temp_buffer);
+    }
+
     template <>
     rocsparse_status rocsparse_csr2csc(rocsparse_handle     handle,
                                        rocsparse_int        m,
@@ -862,6 +2038,62 @@ namespace rocsparse
                                   partition_type);
     }
 
+    template <>
+    rocsparse_status rocsparse_csr2csr5(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_csr5_mat        csr5)
+    {
+        return rocsparse_scsr2csr5(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, csr5);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csr2csr5(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_csr5_mat        csr5)
+    {
+        return rocsparse_dcsr2csr5(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, csr5);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csr2sellcs(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_sellcs_mat      sell,
+                                          rocsparse_int             sigma)
+    {
+        return rocsparse_scsr2sellcs(
+            handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sell, sigma);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csr2sellcs(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_sellcs_mat      sell,
+                                          rocsparse_int             sigma)
+    {
+        return rocsparse_dcsr2sellcs(
+            handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sell, sigma);
+    }
+
     template <>
     rocsparse_status rocsparse_ell2csr(rocsparse_handle          handle,
                                        rocsparse_int             m,
@@ -116,6 +116,26 @@ void unit_check_general(
     }
 }
 
+template <>
+void unit_check_general(rocsparse_int       M,
+                        rocsparse_int       N,
+                        rocsparse_int       lda,
+                        unsigned long long* hCPU,
+                        unsigned long long* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+#else
+            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+#endif
+        }
+    }
+}
+
 /*! \brief Template: gtest unit compare two matrices float/double/complex */
 // Do not put a wrapper over ASSERT_FLOAT_EQ, since assert exit the current function NOT the test
 // case
@@ -39,6 +39,29 @@ namespace rocsparse
                                      T*                   y,
                                      rocsparse_index_base idx_base);
 
+    template <typename T>
+    rocsparse_status rocsparse_axpyi_strided_batched(rocsparse_handle     handle,
+                                                     rocsparse_int        nnz,
+                                                     const T*             alpha,
+                                                     const T*             x_val,
+                                                     rocsparse_int        stride_x,
+                                                     const rocsparse_int* x_ind,
+                                                     rocsparse_int        stride_ind,
+                                                     T*                   y,
+                                                     rocsparse_int        stride_y,
+                                                     rocsparse_int        batch_count,
+                                                     rocsparse_index_base idx_base);
+
+    template <typename T>
+    rocsparse_status rocsparse_axpyi_batched(rocsparse_handle            handle,
+                                             rocsparse_int               nnz,
+                                             const T*                    alpha,
+                                             const T* const*             x_val,
+                                             const rocsparse_int* const* x_ind,
+                                             T* const*                   y,
+                                             rocsparse_int               batch_count,
+                                             rocsparse_index_base        idx_base);
+
     template <typename T>
     rocsparse_status rocsparse_doti(rocsparse_handle     handle,
                                     rocsparse_int        nnz,
@@ -48,6 +71,68 @@ namespace rocsparse
                                     T*                   result,
                                     rocsparse_index_base idx_base);
 
+    template <typename T>
+    rocsparse_status rocsparse_doti_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const T*             x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    const T*             y,
+                                                    rocsparse_int        stride_y,
+                                                    T*                   result,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base);
+
+    template <typename T>
+    rocsparse_status rocsparse_doti_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const T* const*             x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            const T* const*             y,
+                                            T*                          result,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base);
+
+    template <typename T>
+    rocsparse_status rocsparse_spdoti(rocsparse_handle     handle,
+                                      rocsparse_int        nnz_x,
+                                      const T*             x_val,
+                                      const rocsparse_int* x_ind,
+                                      rocsparse_int        nnz_y,
+                                      const T*             y_val,
+                                      const rocsparse_int* y_ind,
+                                      T*                   result,
+                                      rocsparse_index_base idx_base);
+
+    template <typename T>
+    rocsparse_status rocsparse_spdoti_strided_batched(rocsparse_handle     handle,
+                                                      rocsparse_int        nnz_x,
+                                                      const T*             x_val,
+                                                      const rocsparse_int* x_ind,
+                                                      rocsparse_int        stride_x,
+                                                      rocsparse_int        nnz_y,
+                                                      const T*             y_val,
+                                                      const rocsparse_int* y_ind,
+                                                      rocsparse_int        stride_y,
+                                                      T*                   result,
+                                                      rocsparse_int        batch_count,
+                                                      rocsparse_index_base idx_base);
+
+    template <typename T>
+    rocsparse_status rocsparse_nrm2i(rocsparse_handle handle,
+                                     rocsparse_int    nnz,
+                                     const T*         x_val,
+                                     T*               result);
+
+    template <typename T>
+    rocsparse_status rocsparse_nrm2i_strided_batched(rocsparse_handle handle,
+                                                     rocsparse_int    nnz,
+                                                     const T*         x_val,
+                                                     rocsparse_int    stride_x,
+                                                     T*               result,
+                                                     rocsparse_int    batch_count);
+
     template <typename T>
     rocsparse_status rocsparse_gthr(rocsparse_handle     handle,
                                     rocsparse_int        nnz,
@@ -56,6 +141,27 @@ namespace rocsparse
                                     const rocsparse_int* x_ind,
                                     rocsparse_index_base idx_base);
 
+    template <typename T>
+    rocsparse_status rocsparse_gthr_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const T*             y,
+                                                    rocsparse_int        stride_y,
+                                                    T*                   x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base);
+
+    template <typename T>
+    rocsparse_status rocsparse_gthr_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const T* const*             y,
+                                            T* const*                   x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base);
+
     template <typename T>
     rocsparse_status rocsparse_gthrz(rocsparse_handle     handle,
                                      rocsparse_int        nnz,
@@ -74,6 +180,17 @@ namespace rocsparse
                                     const T*             s,
                                     rocsparse_index_base idx_base);
 
+    template <typename T>
+    rocsparse_status rocsparse_roti_multi(rocsparse_handle     handle,
+                                          rocsparse_int        nnz,
+                                          T*                   x_val,
+                                          const rocsparse_int* x_ind,
+                                          T*                   y,
+                                          rocsparse_int        nrot,
+                                          const T*             c,
+                                          const T*             s,
+                                          rocsparse_index_base idx_base);
+
     template <typename T>
     rocsparse_status rocsparse_sctr(rocsparse_handle     handle,
                                     rocsparse_int        nnz,
@@ -82,6 +199,27 @@ namespace rocsparse
                                     T*                   y,
                                     rocsparse_index_base idx_base);
 
+    template <typename T>
+    rocsparse_status rocsparse_sctr_strided_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const T*             x_val,
+                                                    rocsparse_int        stride_x,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        stride_ind,
+                                                    T*                   y,
+                                                    rocsparse_int        stride_y,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base);
+
+    template <typename T>
+    rocsparse_status rocsparse_sctr_batched(rocsparse_handle            handle,
+                                            rocsparse_int               nnz,
+                                            const T* const*             x_val,
+                                            const rocsparse_int* const* x_ind,
+                                            T* const*                   y,
+                                            rocsparse_int               batch_count,
+                                            rocsparse_index_base        idx_base);
+
     template <typename T>
     rocsparse_status rocsparse_coomv(rocsparse_handle          handle,
                                      rocsparse_operation       trans,
@@ -125,6 +263,25 @@ namespace rocsparse
                                      const T*                  beta,
                                      T*                        y);
 
+    template <typename T>
+    rocsparse_status rocsparse_csrmv_multi(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           rocsparse_int             nnz,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const T*                  x,
+                                           rocsparse_int             ldx,
+                                           const T*                  beta,
+                                           T*                        y,
+                                           rocsparse_int             ldy);
+
     template <typename T>
     rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle          handle,
                                                  rocsparse_operation       trans,
@@ -191,6 +348,26 @@ namespace rocsparse
                                      const T*                  beta,
                                      T*                        y);
 
+    template <typename T>
+    rocsparse_status rocsparse_csr5mv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      const T*                  alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_csr5_mat  csr5,
+                                      const T*                  x,
+                                      const T*                  beta,
+                                      T*                        y);
+
+    template <typename T>
+    rocsparse_status rocsparse_sellcsmv(rocsparse_handle           handle,
+                                        rocsparse_operation        trans,
+                                        const T*                   alpha,
+                                        const rocsparse_mat_descr  descr,
+                                        const rocsparse_sellcs_mat sell,
+                                        const T*                   x,
+                                        const T*                   beta,
+                                        T*                         y);
+
     template <typename T>
     rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
                                      rocsparse_operation       trans_A,
@@ -210,6 +387,25 @@ namespace rocsparse
                                      T*                        C,
                                      rocsparse_int             ldc);
 
+    template <typename T>
+    rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnz,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const T*                  B,
+                                           rocsparse_int             ldb,
+                                           T*                        X,
+                                           rocsparse_int             ldx,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer);
+
     template <typename T>
     rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
                                                    rocsparse_int             m,
@@ -246,6 +442,168 @@ namespace rocsparse
                                        rocsparse_solve_policy    policy,
                                        void*                     temp_buffer);
 
+    template <typename T>
+    rocsparse_status rocsparse_csrilu0_apply(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const T*                  alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const T*                  x,
+                                             T*                        y,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrilu0_iter(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int             sweeps,
+                                            T*                        ilu0_val,
+                                            T*                        residual);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrilu0_refactor(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                T*                        csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_solve_policy    policy);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle   handle,
+                                                     rocsparse_mat_info info,
+                                                     int                enable_boost,
+                                                     const T*           boost_tol,
+                                                     const T*           boost_val);
+
+    template <typename T>
+    rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const T*                  csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       T*                        lu_val,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  size_t*                   buffer_size);
+
+    template <typename T>
+    rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_analysis_policy analysis,
+                                               rocsparse_solve_policy    solve,
+                                               void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      T*                        csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_solve_policy    policy,
+                                      void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrjacobi_buffer_size(rocsparse_handle          handle,
+                                                     rocsparse_jacobi_type     type,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_int             block_dim,
+                                                     size_t*                   buffer_size);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrjacobi_analysis(rocsparse_handle          handle,
+                                                  rocsparse_jacobi_type     type,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             block_dim,
+                                                  void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrjacobi(rocsparse_handle          handle,
+                                         rocsparse_jacobi_type     type,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const T*                  omega,
+                                         const rocsparse_mat_descr descr,
+                                         const T*                  csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_int             block_dim,
+                                         const T*                  b,
+                                         T*                        x,
+                                         rocsparse_int             sweeps,
+                                         void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrcheby_buffer_size(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    size_t*                   buffer_size);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrcheby(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const T*                  csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_int             degree,
+                                        const T*                  lambda_min,
+                                        const T*                  lambda_max,
+                                        const T*                  r,
+                                        T*                        z,
+                                        void*                     temp_buffer);
+
     template <typename T>
     rocsparse_status rocsparse_csr2csc(rocsparse_handle     handle,
                                        rocsparse_int        m,
@@ -285,6 +643,27 @@ namespace rocsparse
                                        rocsparse_int             user_ell_width,
                                        rocsparse_hyb_partition   partition_type);
 
+    template <typename T>
+    rocsparse_status rocsparse_csr2csr5(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        const rocsparse_mat_descr descr,
+                                        const T*                  csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_csr5_mat        csr5);
+
+    template <typename T>
+    rocsparse_status rocsparse_csr2sellcs(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_sellcs_mat      sell,
+                                          rocsparse_int             sigma);
+
     template <typename T>
     rocsparse_status rocsparse_ell2csr(rocsparse_handle          handle,
                                        rocsparse_int             m,
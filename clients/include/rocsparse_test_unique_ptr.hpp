@@ -109,6 +109,38 @@ namespace rocsparse_test
         }
     };
 
+    struct csr5_struct
+    {
+        rocsparse_csr5_mat csr5;
+        csr5_struct()
+        {
+            rocsparse_status status = rocsparse_create_csr5_mat(&csr5);
+            verify_rocsparse_status_success(status, "ERROR: csr5_struct constructor");
+        }
+
+        ~csr5_struct()
+        {
+            rocsparse_status status = rocsparse_destroy_csr5_mat(csr5);
+            verify_rocsparse_status_success(status, "ERROR: csr5_struct destructor");
+        }
+    };
+
+    struct sellcs_struct
+    {
+        rocsparse_sellcs_mat sell;
+        sellcs_struct()
+        {
+            rocsparse_status status = rocsparse_create_sellcs_mat(&sell);
+            verify_rocsparse_status_success(status, "ERROR: sellcs_struct constructor");
+        }
+
+        ~sellcs_struct()
+        {
+            rocsparse_status status = rocsparse_destroy_sellcs_mat(sell);
+            verify_rocsparse_status_success(status, "ERROR: sellcs_struct destructor");
+        }
+    };
+
     struct mat_info_struct
     {
         rocsparse_mat_info info;
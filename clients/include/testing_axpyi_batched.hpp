@@ -0,0 +1,399 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_AXPYI_BATCHED_HPP
+#define TESTING_AXPYI_BATCHED_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_axpyi_batched_bad_arg(void)
+{
+    rocsparse_int nnz         = 100;
+    rocsparse_int batch_count = 1;
+    rocsparse_int safe_size   = 100;
+    T             alpha       = 0.6;
+
+    rocsparse_index_base idx_base = rocsparse_index_base_zero;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    auto dxVal_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dxInd_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dxVal_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+    auto dxInd_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int*) * batch_count), device_free};
+    auto dy_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+
+    T*              dxVal       = (T*)dxVal_managed.get();
+    rocsparse_int*  dxInd       = (rocsparse_int*)dxInd_managed.get();
+    T*              dy          = (T*)dy_managed.get();
+    T**             dxVal_array = (T**)dxVal_array_managed.get();
+    rocsparse_int** dxInd_array = (rocsparse_int**)dxInd_array_managed.get();
+    T**             dy_array    = (T**)dy_array_managed.get();
+
+    if(!dxInd || !dxVal || !dy || !dxVal_array || !dxInd_array || !dy_array)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_axpyi_strided_batched
+
+    // testing for(nullptr == dxInd)
+    {
+        rocsparse_int* dxInd_null = nullptr;
+
+        status = rocsparse_axpyi_strided_batched(
+            handle, nnz, &alpha, dxVal, nnz, dxInd_null, nnz, dy, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: xInd is nullptr");
+    }
+    // testing for(nullptr == dxVal)
+    {
+        T* dxVal_null = nullptr;
+
+        status = rocsparse_axpyi_strided_batched(
+            handle, nnz, &alpha, dxVal_null, nnz, dxInd, nnz, dy, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: xVal is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_axpyi_strided_batched(
+            handle, nnz, &alpha, dxVal, nnz, dxInd, nnz, dy_null, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: y is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_axpyi_strided_batched(
+            handle, nnz, d_alpha_null, dxVal, nnz, dxInd, nnz, dy, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(stride < 0)
+    {
+        status = rocsparse_axpyi_strided_batched(
+            handle, nnz, &alpha, dxVal, -1, dxInd, nnz, dy, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: stride_x is invalid");
+    }
+    // testing for(batch_count < 0)
+    {
+        status = rocsparse_axpyi_strided_batched(
+            handle, nnz, &alpha, dxVal, nnz, dxInd, nnz, dy, nnz, -1, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: batch_count is invalid");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_axpyi_strided_batched(
+            handle_null, nnz, &alpha, dxVal, nnz, dxInd, nnz, dy, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_axpyi_batched
+
+    // testing for(nullptr == dxInd)
+    {
+        rocsparse_int** dxInd_null = nullptr;
+
+        status = rocsparse_axpyi_batched(
+            handle, nnz, &alpha, dxVal_array, dxInd_null, dy_array, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: xInd is nullptr");
+    }
+    // testing for(nullptr == dxVal)
+    {
+        T** dxVal_null = nullptr;
+
+        status = rocsparse_axpyi_batched(
+            handle, nnz, &alpha, dxVal_null, dxInd_array, dy_array, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: xVal is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T** dy_null = nullptr;
+
+        status = rocsparse_axpyi_batched(
+            handle, nnz, &alpha, dxVal_array, dxInd_array, dy_null, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: y is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_axpyi_batched(
+            handle, nnz, d_alpha_null, dxVal_array, dxInd_array, dy_array, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(batch_count < 0)
+    {
+        status = rocsparse_axpyi_batched(
+            handle, nnz, &alpha, dxVal_array, dxInd_array, dy_array, -1, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: batch_count is invalid");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_axpyi_batched(
+            handle_null, nnz, &alpha, dxVal_array, dxInd_array, dy_array, batch_count, idx_base);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_axpyi_batched(Arguments argus)
+{
+    rocsparse_int        N           = argus.N;
+    rocsparse_int        nnz         = argus.nnz;
+    rocsparse_int        batch_count = argus.batch_count;
+    rocsparse_int        safe_size   = 100;
+    T                    h_alpha     = argus.alpha;
+    rocsparse_index_base idx_base    = argus.idx_base;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(nnz <= 0 || batch_count <= 0)
+    {
+        auto dxInd_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dxVal_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dxInd = (rocsparse_int*)dxInd_managed.get();
+        T*             dxVal = (T*)dxVal_managed.get();
+        T*             dy    = (T*)dy_managed.get();
+
+        if(!dxInd || !dxVal || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dxInd || !dxVal || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_axpyi_strided_batched(
+            handle, nnz, &h_alpha, dxVal, 0, dxInd, 0, dy, 0, batch_count, idx_base);
+
+        if(nnz < 0 || batch_count < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: nnz < 0 || batch_count < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "nnz == 0 || batch_count == 0");
+        }
+
+        status = rocsparse_axpyi_batched(handle,
+                                         nnz,
+                                         &h_alpha,
+                                         (const T* const*)nullptr,
+                                         (const rocsparse_int* const*)nullptr,
+                                         (T* const*)nullptr,
+                                         batch_count,
+                                         idx_base);
+
+        if(nnz < 0 || batch_count < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: nnz < 0 || batch_count < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "nnz == 0 || batch_count == 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Vectors of the batch are stored consecutively
+    rocsparse_int size_x = nnz * batch_count;
+    rocsparse_int size_y = N * batch_count;
+
+    // Host structures
+    std::vector<rocsparse_int> hxInd(size_x);
+    std::vector<T>             hxVal(size_x);
+    std::vector<T>             hy_1(size_y);
+    std::vector<T>             hy_2(size_y);
+    std::vector<T>             hy_gold(size_y);
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        rocsparse_init_index(hxInd.data() + b * nnz, nnz, 1, N);
+    }
+    rocsparse_init<T>(hxVal, 1, size_x);
+    rocsparse_init<T>(hy_1, 1, size_y);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dxInd_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * size_x), device_free};
+    auto dxVal_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto dxInd_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int*) * batch_count), device_free};
+    auto dxVal_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+    auto dy_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+
+    rocsparse_int*  dxInd       = (rocsparse_int*)dxInd_managed.get();
+    T*              dxVal       = (T*)dxVal_managed.get();
+    T*              dy_1        = (T*)dy_1_managed.get();
+    T*              dy_2        = (T*)dy_2_managed.get();
+    T*              d_alpha     = (T*)d_alpha_managed.get();
+    rocsparse_int** dxInd_array = (rocsparse_int**)dxInd_array_managed.get();
+    T**             dxVal_array = (T**)dxVal_array_managed.get();
+    T**             dy_array    = (T**)dy_array_managed.get();
+
+    if(!dxInd || !dxVal || !dy_1 || !dy_2 || !d_alpha || !dxInd_array || !dxVal_array
+       || !dy_array)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dxInd || !dxVal || !dy_1 || !dy_2 || !d_alpha || "
+                                        "!dxInd_array || !dxVal_array || !dy_array");
+        return rocsparse_status_memory_error;
+    }
+
+    // Pointer arrays refer to the same vectors as the strided batch
+    std::vector<rocsparse_int*> hxInd_array(batch_count);
+    std::vector<T*>             hxVal_array(batch_count);
+    std::vector<T*>             hy_array(batch_count);
+
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        hxInd_array[b] = dxInd + b * nnz;
+        hxVal_array[b] = dxVal + b * nnz;
+        hy_array[b]    = dy_2 + b * N;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dxInd, hxInd.data(), sizeof(rocsparse_int) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dxVal, hxVal.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dxInd_array,
+                              hxInd_array.data(),
+                              sizeof(rocsparse_int*) * batch_count,
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dxVal_array, hxVal_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_array, hy_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+        // ROCSPARSE pointer mode host, strided batch
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_axpyi_strided_batched(
+            handle, nnz, &h_alpha, dxVal, nnz, dxInd, nnz, dy_1, N, batch_count, idx_base));
+
+        // ROCSPARSE pointer mode device, pointer array batch
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_axpyi_batched(
+            handle, nnz, d_alpha, dxVal_array, dxInd_array, dy_array, batch_count, idx_base));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+        // CPU
+        for(rocsparse_int b = 0; b < batch_count; ++b)
+        {
+            for(rocsparse_int i = 0; i < nnz; ++i)
+            {
+                hy_gold[b * N + hxInd[b * nnz + i] - idx_base] += h_alpha * hxVal[b * nnz + i];
+            }
+        }
+
+        unit_check_general(1, size_y, 1, hy_gold.data(), hy_1.data());
+        unit_check_general(1, size_y, 1, hy_gold.data(), hy_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_axpyi_strided_batched(
+                handle, nnz, &h_alpha, dxVal, nnz, dxInd, nnz, dy_1, N, batch_count, idx_base);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_axpyi_strided_batched(
+                handle, nnz, &h_alpha, dxVal, nnz, dxInd, nnz, dy_1, N, batch_count, idx_base);
+        }
+
+        gpu_time_used     = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_gflops = (2.0 * nnz * batch_count) / 1e9 / gpu_time_used * 1e6 * 1;
+        double bandwidth  = (sizeof(rocsparse_int) * nnz + (sizeof(T) * (nnz + N))) * batch_count
+                           / gpu_time_used / 1e3;
+
+        printf("nnz\t\tbatch\talpha\tGFlops\tGB/s\tusec\n");
+        printf("%9d\t%d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               nnz,
+               batch_count,
+               h_alpha,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_AXPYI_BATCHED_HPP
@@ -0,0 +1,506 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSR5MV_HPP
+#define TESTING_CSR5MV_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csr5mv_bad_arg(void)
+{
+    rocsparse_int       n         = 100;
+    rocsparse_int       m         = 100;
+    rocsparse_int       safe_size = 100;
+    T                   alpha     = 0.6;
+    T                   beta      = 0.2;
+    rocsparse_operation transA    = rocsparse_operation_none;
+    rocsparse_status    status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<csr5_struct> unique_ptr_csr5(new csr5_struct);
+    rocsparse_csr5_mat           csr5 = unique_ptr_csr5->csr5;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T*             dval = (T*)dval_managed.get();
+    T*             dx   = (T*)dx_managed.get();
+    T*             dy   = (T*)dy_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csr2csr5
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle, m, n, descr, dval, dptr_null, dcol, csr5);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle, m, n, descr, dval, dptr, dcol_null, csr5);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle, m, n, descr, dval_null, dptr, dcol, csr5);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == csr5)
+    {
+        rocsparse_csr5_mat csr5_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle, m, n, descr, dval, dptr, dcol, csr5_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr5 is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle, m, n, descr_null, dval, dptr, dcol, csr5);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2csr5(handle_null, m, n, descr, dval, dptr, dcol, csr5);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csr5mv
+
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csr5mv(handle, transA, &alpha, descr, csr5, dx_null, &beta, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_csr5mv(handle, transA, &alpha, descr, csr5, dx, &beta, dy_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_csr5mv(handle, transA, d_alpha_null, descr, csr5, dx, &beta, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_csr5mv(handle, transA, &alpha, descr, csr5, dx, d_beta_null, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == csr5)
+    {
+        rocsparse_csr5_mat csr5_null = nullptr;
+
+        status = rocsparse_csr5mv(handle, transA, &alpha, descr, csr5_null, dx, &beta, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr5 is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csr5mv(handle, transA, &alpha, descr_null, csr5, dx, &beta, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr5mv(handle_null, transA, &alpha, descr, csr5, dx, &beta, dy);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csr5mv(Arguments argus)
+{
+    rocsparse_int        safe_size  = 100;
+    rocsparse_int        m          = argus.M;
+    rocsparse_int        n          = argus.N;
+    T                    h_alpha    = argus.alpha;
+    T                    h_beta     = argus.beta;
+    rocsparse_operation  transA     = argus.transA;
+    rocsparse_index_base idx_base   = argus.idx_base;
+    bool                 power_law  = argus.bswitch;
+    std::string          filename   = "";
+    std::string          rocalution = "";
+    rocsparse_status     status;
+
+    if(argus.timing == 1)
+    {
+        if(argus.rocalution != "")
+        {
+            rocalution = argus.rocalution;
+        }
+        else if(argus.filename != "")
+        {
+            filename = argus.filename;
+        }
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    std::unique_ptr<csr5_struct> test_csr5(new csr5_struct);
+    rocsparse_csr5_mat           csr5 = test_csr5->csr5;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T*             dval = (T*)dval_managed.get();
+        T*             dx   = (T*)dx_managed.get();
+        T*             dy   = (T*)dy_managed.get();
+
+        if(!dval || !dptr || !dcol || !dx || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dx || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        // Row pointer array is not initialized, skip conversion if m and n are valid
+        if(m <= 0 || n <= 0)
+        {
+            status = rocsparse_csr2csr5(handle, m, n, descr, dval, dptr, dcol, csr5);
+
+            if(m < 0 || n < 0)
+            {
+                verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0");
+            }
+            else
+            {
+                verify_rocsparse_status_success(status, "m >= 0 && n >= 0");
+            }
+        }
+
+        // Empty CSR5 matrix
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_csr5mv(handle, transA, &h_alpha, descr, csr5, dx, &h_beta, dy);
+        verify_rocsparse_status_success(status, "empty csr5 matrix");
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T>             hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(rocalution != "")
+    {
+        if(read_rocalution_matrix(
+               rocalution.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", rocalution.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
+        nnz   = hcsr_row_ptr[m];
+    }
+    else if(power_law)
+    {
+        // Row i holds n / (i + 1) entries, such that few rows span many tiles
+        hcsr_row_ptr.resize(m + 1);
+        hcsr_row_ptr[0] = idx_base;
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            rocsparse_int row_nnz = std::max(n / (i + 1), 1);
+
+            for(rocsparse_int j = 0; j < row_nnz; ++j)
+            {
+                hcol_ind.push_back(static_cast<rocsparse_int>((int64_t)j * n / row_nnz)
+                                   + idx_base);
+                hval.push_back(random_generator<T>());
+            }
+
+            hcsr_row_ptr[i + 1] = hcsr_row_ptr[i] + row_nnz;
+        }
+
+        nnz = hcsr_row_ptr[m] - idx_base;
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Vector sizes depend on the operation
+    rocsparse_int nx = (transA == rocsparse_operation_none) ? n : m;
+    rocsparse_int ny = (transA == rocsparse_operation_none) ? m : n;
+
+    std::vector<T> hx(nx);
+    std::vector<T> hy_1(ny);
+    std::vector<T> hy_2(ny);
+    std::vector<T> hy_gold(ny);
+
+    rocsparse_init<T>(hx, 1, nx);
+    rocsparse_init<T>(hy_1, 1, ny);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * nx), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ny), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ny), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval    = (T*)dval_managed.get();
+    T*             dx      = (T*)dx_managed.get();
+    T*             dy_1    = (T*)dy_1_managed.get();
+    T*             dy_2    = (T*)dy_2_managed.get();
+    T*             d_alpha = (T*)d_alpha_managed.get();
+    T*             d_beta  = (T*)d_beta_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * nx, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * ny, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Convert CSR matrix to CSR5
+    double gpu_conv_time_used = get_time_us();
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr5(handle, m, n, descr, dval, dptr, dcol, csr5));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    gpu_conv_time_used = (get_time_us() - gpu_conv_time_used) / 1e3;
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ny, hipMemcpyHostToDevice));
+
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csr5mv(handle, transA, &h_alpha, descr, csr5, dx, &h_beta, dy_1));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csr5mv(handle, transA, d_alpha, descr, csr5, dx, d_beta, dy_2));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ny, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ny, hipMemcpyDeviceToHost));
+
+        // CPU
+        double cpu_time_used = get_time_us();
+
+        for(rocsparse_int i = 0; i < ny; ++i)
+        {
+            hy_gold[i] = (h_beta == static_cast<T>(0)) ? static_cast<T>(0) : h_beta * hy_gold[i];
+        }
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+                ++j)
+            {
+                rocsparse_int col = hcol_ind[j] - idx_base;
+
+                if(transA == rocsparse_operation_none)
+                {
+                    hy_gold[i] += h_alpha * hval[j] * hx[col];
+                }
+                else
+                {
+                    hy_gold[col] += h_alpha * hval[j] * hx[i];
+                }
+            }
+        }
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        unit_check_near(1, ny, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, ny, 1, hy_gold.data(), hy_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csr5mv(handle, transA, &h_alpha, descr, csr5, dx, &h_beta, dy_1);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csr5mv(handle, transA, &h_alpha, descr, csr5, dx, &h_beta, dy_1);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used     = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        size_t flops      = (h_alpha != 1.0) ? 3.0 * nnz : 2.0 * nnz;
+        flops             = (h_beta != 0.0) ? flops + ny : flops;
+        double gpu_gflops = flops / gpu_time_used / 1e6;
+        size_t memtrans   = 2.0 * ny + nnz;
+        memtrans          = (h_beta != 0.0) ? memtrans + ny : memtrans;
+        double bandwidth
+            = (memtrans * sizeof(T) + (m + 1 + nnz) * sizeof(rocsparse_int)) / gpu_time_used / 1e6;
+
+        printf("m\t\tn\t\tnnz\t\talpha\tbeta\tGFlops\tGB/s\tmsec\tconv msec\n");
+        printf("%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               h_alpha,
+               h_beta,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used,
+               gpu_conv_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSR5MV_HPP
@@ -0,0 +1,716 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRCHEBY_HPP
+#define TESTING_CSRCHEBY_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csrcheby_bad_arg(void)
+{
+    rocsparse_int    m          = 100;
+    rocsparse_int    nnz        = 100;
+    rocsparse_int    safe_size  = 100;
+    rocsparse_int    degree     = 3;
+    T                lambda_min = 0.5;
+    T                lambda_max = 8.0;
+    size_t           size;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dr_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dz_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval    = (T*)dval_managed.get();
+    T*             dr      = (T*)dr_managed.get();
+    T*             dz      = (T*)dz_managed.get();
+    void*          dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dval || !dptr || !dcol || !dr || !dz || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csrcheby_buffer_size
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrcheby_buffer_size(
+            handle, m, nnz, descr, dval, dptr_null, dcol, info, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrcheby_buffer_size(
+            handle, m, nnz, descr, dval, dptr, dcol_null, info, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrcheby_buffer_size(
+            handle, m, nnz, descr, dval_null, dptr, dcol, info, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == buffer_size)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_csrcheby_buffer_size(
+            handle, m, nnz, descr, dval, dptr, dcol, info, size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrcheby_buffer_size(
+            handle, m, nnz, descr_null, dval, dptr, dcol, info, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrcheby_buffer_size(
+            handle, m, nnz, descr, dval, dptr, dcol, info_null, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrcheby_buffer_size(
+            handle_null, m, nnz, descr, dval, dptr, dcol, info, &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrcheby
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr_null,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol_null,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval_null,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dr)
+    {
+        T* dr_null = nullptr;
+
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr_null,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dr is nullptr");
+    }
+    // testing for(nullptr == dz)
+    {
+        T* dz_null = nullptr;
+
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz_null,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dz is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr_null,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info_null,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrcheby(handle_null,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(degree < 0)
+    {
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    -1,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_size(status, "Error: degree is invalid");
+    }
+    // testing for missing csrmv analysis
+    {
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: analysis has not been performed");
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrcheby(Arguments argus)
+{
+    rocsparse_int        safe_size  = 100;
+    rocsparse_int        m          = argus.M;
+    rocsparse_int        degree     = argus.K;
+    rocsparse_index_base idx_base   = argus.idx_base;
+    T                    lambda_min = argus.alpha;
+    T                    lambda_max = argus.beta;
+    std::string          binfile    = "";
+    std::string          filename   = "";
+    rocsparse_status     status;
+    size_t               size;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m       = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nnz <= 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dr_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dz_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dbuffer_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+        T*             dval    = (T*)dval_managed.get();
+        T*             dr      = (T*)dr_managed.get();
+        T*             dz      = (T*)dz_managed.get();
+        void*          dbuffer = (void*)dbuffer_managed.get();
+
+        if(!dval || !dptr || !dcol || !dr || !dz || !dbuffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dr || !dz || !dbuffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Test rocsparse_csrcheby_buffer_size
+        status
+            = rocsparse_csrcheby_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, info, &size);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csrcheby
+        status = rocsparse_csrcheby(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    dval,
+                                    dptr,
+                                    dcol,
+                                    info,
+                                    degree,
+                                    &lambda_min,
+                                    &lambda_max,
+                                    dr,
+                                    dz,
+                                    dbuffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m   = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz = hcsr_row_ptr[m];
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Right-hand side
+    std::vector<T> hr(m);
+    std::vector<T> hz_gold(m);
+
+    rocsparse_init<T>(hr, 1, m);
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dr_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dz_1_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dz_2_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_min_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_max_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr  = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol  = (rocsparse_int*)dcol_managed.get();
+    T*             dval  = (T*)dval_managed.get();
+    T*             dr    = (T*)dr_managed.get();
+    T*             dz_1  = (T*)dz_1_managed.get();
+    T*             dz_2  = (T*)dz_2_managed.get();
+    T*             d_min = (T*)d_min_managed.get();
+    T*             d_max = (T*)d_max_managed.get();
+
+    if(!dval || !dptr || !dcol || !dr || !dz_1 || !dz_2 || !d_min || !d_max)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dr || !dz_1 || "
+                                        "!dz_2 || !d_min || !d_max");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dr, hr.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // csrmv analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, m, nnz, descr, dval, dptr, dcol, info));
+
+    // Obtain csrcheby buffer size
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrcheby_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, info, &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(d_min, &lambda_min, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_max, &lambda_max, sizeof(T), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcheby(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 dval,
+                                                 dptr,
+                                                 dcol,
+                                                 info,
+                                                 degree,
+                                                 &lambda_min,
+                                                 &lambda_max,
+                                                 dr,
+                                                 dz_1,
+                                                 dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcheby(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 dval,
+                                                 dptr,
+                                                 dcol,
+                                                 info,
+                                                 degree,
+                                                 d_min,
+                                                 d_max,
+                                                 dr,
+                                                 dz_2,
+                                                 dbuffer));
+
+        // Copy output from device to CPU
+        std::vector<T> hz_1(m);
+        std::vector<T> hz_2(m);
+        CHECK_HIP_ERROR(hipMemcpy(hz_1.data(), dz_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hz_2.data(), dz_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // Host csrcheby
+        csrcheby(m,
+                 hcsr_row_ptr.data(),
+                 hcsr_col_ind.data(),
+                 hcsr_val.data(),
+                 degree,
+                 lambda_min,
+                 lambda_max,
+                 hr.data(),
+                 hz_gold.data(),
+                 idx_base);
+
+        unit_check_near(1, m, 1, hz_gold.data(), hz_1.data());
+        unit_check_near(1, m, 1, hz_gold.data(), hz_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrcheby(handle,
+                               m,
+                               nnz,
+                               descr,
+                               dval,
+                               dptr,
+                               dcol,
+                               info,
+                               degree,
+                               &lambda_min,
+                               &lambda_max,
+                               dr,
+                               dz_1,
+                               dbuffer);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrcheby(handle,
+                               m,
+                               nnz,
+                               descr,
+                               dval,
+                               dptr,
+                               dcol,
+                               info,
+                               degree,
+                               &lambda_min,
+                               &lambda_max,
+                               dr,
+                               dz_1,
+                               dbuffer);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Each step after the first reads the matrix, r, z and d and writes d and z
+        size_t bytes = sizeof(rocsparse_int) * (m + 1 + nnz) + sizeof(T) * (nnz + 5 * m);
+
+        double bandwidth = (degree - 1) * bytes / gpu_time_used / 1e6;
+
+        printf("m\t\tnnz\t\tdegree\tGB/s\tmsec\n");
+        printf("%8d\t%9d\t%d\t%0.2lf\t%0.2lf\n", m, nnz, degree, bandwidth, gpu_time_used);
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info));
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRCHEBY_HPP
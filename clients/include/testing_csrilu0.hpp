@@ -253,6 +253,102 @@ void testing_csrilu0_bad_arg(void)
         verify_rocsparse_status_invalid_handle(status);
     }
 
+    // testing rocsparse_csrilu0_apply
+    T h_alpha = static_cast<T>(1);
+
+    auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+
+    if(!dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, &h_alpha, descr, dval, dptr_null, dcol, info, dx, dy, solve, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, &h_alpha, descr, dval, dptr, dcol_null, info, dx, dy, solve, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, &h_alpha, descr, dval_null, dptr, dcol, info, dx, dy, solve, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, d_alpha_null, descr, dval, dptr, dcol, info, dx, dy, solve, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, &h_alpha, descr, dval, dptr, dcol, info, dx_null, dy, solve, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, &h_alpha, descr, dval, dptr, dcol, info, dx, dy_null, solve, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, &h_alpha, descr, dval, dptr, dcol, info, dx, dy, solve, dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, &h_alpha, descr_null, dval, dptr, dcol, info, dx, dy, solve, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle, m, nnz, &h_alpha, descr, dval, dptr, dcol, info_null, dx, dy, solve, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrilu0_apply(
+            handle_null, m, nnz, &h_alpha, descr, dval, dptr, dcol, info, dx, dy, solve, dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
     // testing rocsparse_csrilu0_zero_pivot
     rocsparse_int position;
 
@@ -587,6 +683,143 @@ rocsparse_status testing_csrilu0(Arguments argus)
         }
 
         unit_check_general(1, nnz, 1, hcsr_val.data(), result.data());
+
+        // Apply the preconditioner, L * U * y = alpha * x
+        std::unique_ptr<descr_struct> unique_ptr_descr_lower(new descr_struct);
+        rocsparse_mat_descr           descr_lower = unique_ptr_descr_lower->descr;
+
+        std::unique_ptr<descr_struct> unique_ptr_descr_upper(new descr_struct);
+        rocsparse_mat_descr           descr_upper = unique_ptr_descr_upper->descr;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_lower, idx_base));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_lower, rocsparse_fill_mode_lower));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr_lower, rocsparse_diag_type_unit));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_upper, idx_base));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_upper, rocsparse_fill_mode_upper));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_mat_diag_type(descr_upper, rocsparse_diag_type_non_unit));
+
+        T h_alpha = static_cast<T>(2.3);
+
+        std::vector<T> hx(m);
+        std::vector<T> hz(m);
+        std::vector<T> hy_1(m);
+        std::vector<T> hy_2(m);
+        std::vector<T> hy_gold(m);
+
+        rocsparse_init<T>(hx, 1, m);
+
+        auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+        auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+        auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+        auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+        T* dx      = (T*)dx_managed.get();
+        T* dy_1    = (T*)dy_1_managed.get();
+        T* dy_2    = (T*)dy_2_managed.get();
+        T* d_alpha = (T*)d_alpha_managed.get();
+
+        if(!dx || !dy_1 || !dy_2 || !d_alpha)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dx || !dy_1 || !dy_2 || !d_alpha");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+        // Analysis of both triangular factors
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                       rocsparse_operation_none,
+                                                       m,
+                                                       nnz,
+                                                       descr_lower,
+                                                       dval,
+                                                       dptr,
+                                                       dcol,
+                                                       info,
+                                                       rocsparse_analysis_policy_reuse,
+                                                       rocsparse_solve_policy_auto,
+                                                       dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                       rocsparse_operation_none,
+                                                       m,
+                                                       nnz,
+                                                       descr_upper,
+                                                       dval,
+                                                       dptr,
+                                                       dcol,
+                                                       info,
+                                                       rocsparse_analysis_policy_reuse,
+                                                       rocsparse_solve_policy_auto,
+                                                       dbuffer));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_apply(handle,
+                                                      m,
+                                                      nnz,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dval,
+                                                      dptr,
+                                                      dcol,
+                                                      info,
+                                                      dx,
+                                                      dy_1,
+                                                      rocsparse_solve_policy_auto,
+                                                      dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_apply(handle,
+                                                      m,
+                                                      nnz,
+                                                      d_alpha,
+                                                      descr,
+                                                      dval,
+                                                      dptr,
+                                                      dcol,
+                                                      info,
+                                                      dx,
+                                                      dy_2,
+                                                      rocsparse_solve_policy_auto,
+                                                      dbuffer));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // Host lower and upper solve
+        hipDeviceProp_t prop;
+        hipGetDeviceProperties(&prop, 0);
+
+        lsolve(m,
+               hcsr_row_ptr.data(),
+               hcsr_col_ind.data(),
+               hcsr_val.data(),
+               h_alpha,
+               hx.data(),
+               hz.data(),
+               idx_base,
+               rocsparse_diag_type_unit,
+               prop.warpSize);
+        usolve(m,
+               hcsr_row_ptr.data(),
+               hcsr_col_ind.data(),
+               hcsr_val.data(),
+               static_cast<T>(1),
+               hz.data(),
+               hy_gold.data(),
+               idx_base,
+               rocsparse_diag_type_non_unit,
+               prop.warpSize);
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr_lower, info));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr_upper, info));
     }
 
     if(argus.timing)
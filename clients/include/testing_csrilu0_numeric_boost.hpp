@@ -0,0 +1,342 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRILU0_NUMERIC_BOOST_HPP
+#define TESTING_CSRILU0_NUMERIC_BOOST_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cmath>
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csrilu0_numeric_boost_bad_arg(void)
+{
+    T                boost_tol = static_cast<T>(0.1);
+    T                boost_val = static_cast<T>(1);
+    rocsparse_int    count;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    // testing rocsparse_csrilu0_numeric_boost
+
+    // testing for(nullptr == boost_tol)
+    {
+        T* boost_tol_null = nullptr;
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info, 1, boost_tol_null, &boost_val);
+        verify_rocsparse_status_invalid_pointer(status, "Error: boost_tol is nullptr");
+    }
+    // testing for(nullptr == boost_val)
+    {
+        T* boost_val_null = nullptr;
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info, 1, &boost_tol, boost_val_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: boost_val is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info_null, 1, &boost_tol, &boost_val);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrilu0_numeric_boost(handle_null, info, 1, &boost_tol, &boost_val);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(boost_tol < 0)
+    {
+        T boost_tol_neg = static_cast<T>(-1);
+
+        status = rocsparse_csrilu0_numeric_boost(handle, info, 1, &boost_tol_neg, &boost_val);
+        verify_rocsparse_status_invalid_value(status, "Error: boost_tol is negative");
+    }
+
+    // testing rocsparse_csrilu0_boost_count
+
+    // testing for(nullptr == count)
+    {
+        rocsparse_int* count_null = nullptr;
+
+        status = rocsparse_csrilu0_boost_count(handle, info, count_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: count is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrilu0_boost_count(handle, info_null, &count);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrilu0_boost_count(handle_null, info, &count);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrilu0_numeric_boost(Arguments argus)
+{
+    rocsparse_int        safe_size = 100;
+    rocsparse_int        m         = argus.M;
+    rocsparse_index_base idx_base  = argus.idx_base;
+    T                    boost_tol = static_cast<T>(argus.alpha);
+    T                    boost_val = static_cast<T>(argus.beta);
+    std::string          binfile   = "";
+    size_t               size;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99)
+    {
+        binfile = argus.filename;
+        m       = safe_size;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nnz <= 0)
+    {
+        // Boosting can be enabled without any factorization
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrilu0_numeric_boost(handle, info, 1, &boost_tol, &boost_val));
+
+        // Boost count should be 0
+        rocsparse_int count;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_boost_count(handle, info, &count));
+
+        rocsparse_int res = 0;
+        unit_check_general(1, 1, 1, &res, &count);
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m   = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz = hcsr_row_ptr[m];
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        gen_matrix_coo(m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed        = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto d_boost_tol_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_boost_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_count_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+
+    rocsparse_int* dptr        = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol        = (rocsparse_int*)dcol_managed.get();
+    T*             dval        = (T*)dval_managed.get();
+    T*             d_boost_tol = (T*)d_boost_tol_managed.get();
+    T*             d_boost_val = (T*)d_boost_val_managed.get();
+    rocsparse_int* d_count     = (rocsparse_int*)d_count_managed.get();
+
+    if(!dval || !dptr || !dcol || !d_boost_tol || !d_boost_val || !d_count)
+    {
+        verify_rocsparse_status_success(
+            rocsparse_status_memory_error,
+            "!dval || !dptr || !dcol || !d_boost_tol || !d_boost_val || !d_count");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_boost_tol, &boost_tol, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_boost_val, &boost_val, sizeof(T), hipMemcpyHostToDevice));
+
+    // Obtain csrilu0 buffer size
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrilu0_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, info, &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    // csrilu0 analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     dval,
+                                                     dptr,
+                                                     dcol,
+                                                     info,
+                                                     rocsparse_analysis_policy_reuse,
+                                                     rocsparse_solve_policy_auto,
+                                                     dbuffer));
+
+    if(argus.unit_check)
+    {
+        // Enable boosting, pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrilu0_numeric_boost(handle, info, 1, d_boost_tol, d_boost_val));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(
+            handle, m, nnz, descr, dval, dptr, dcol, info, rocsparse_solve_policy_auto, dbuffer));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_boost_count(handle, info, d_count));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int hposition;
+        rocsparse_csrilu0_zero_pivot(handle, info, &hposition);
+
+        rocsparse_int hcount_1;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_boost_count(handle, info, &hcount_1));
+
+        // Copy output from device to CPU
+        rocsparse_int  hcount_2;
+        std::vector<T> result(nnz);
+        CHECK_HIP_ERROR(hipMemcpy(result.data(), dval, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hcount_2, d_count, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Host csrilu0 with boosting
+        rocsparse_int count_gold    = 0;
+        rocsparse_int position_gold = csrilu0(m,
+                                              hcsr_row_ptr.data(),
+                                              hcsr_col_ind.data(),
+                                              hcsr_val.data(),
+                                              idx_base,
+                                              true,
+                                              boost_tol,
+                                              boost_val,
+                                              &count_gold);
+
+        unit_check_general(1, 1, 1, &position_gold, &hposition);
+        unit_check_general(1, 1, 1, &hcount_1, &hcount_2);
+
+        // The host factorization stops at the first zero pivot
+        if(hposition != -1)
+        {
+            return rocsparse_status_success;
+        }
+
+        unit_check_general(1, 1, 1, &count_gold, &hcount_1);
+        unit_check_general(1, nnz, 1, hcsr_val.data(), result.data());
+
+        // Disable boosting, the boost count of the last boosted factorization is kept
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrilu0_numeric_boost<T>(handle, info, 0, nullptr, nullptr));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_boost_count(handle, info, &hcount_2));
+        unit_check_general(1, 1, 1, &hcount_1, &hcount_2);
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRILU0_NUMERIC_BOOST_HPP
@@ -0,0 +1,740 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRJACOBI_HPP
+#define TESTING_CSRJACOBI_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csrjacobi_bad_arg(void)
+{
+    rocsparse_int         m         = 100;
+    rocsparse_int         nnz       = 100;
+    rocsparse_int         safe_size = 100;
+    rocsparse_int         block_dim = 4;
+    rocsparse_int         sweeps    = 2;
+    rocsparse_jacobi_type type      = rocsparse_jacobi_type_block;
+    T                     omega     = 1.0;
+    size_t                size;
+    rocsparse_status      status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto db_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval    = (T*)dval_managed.get();
+    T*             db      = (T*)db_managed.get();
+    T*             dx      = (T*)dx_managed.get();
+    void*          dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dval || !dptr || !dcol || !db || !dx || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csrjacobi_buffer_size
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrjacobi_buffer_size(
+            handle, type, m, nnz, descr, dval, dptr_null, dcol, block_dim, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrjacobi_buffer_size(
+            handle, type, m, nnz, descr, dval, dptr, dcol_null, block_dim, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrjacobi_buffer_size(
+            handle, type, m, nnz, descr, dval_null, dptr, dcol, block_dim, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == buffer_size)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_csrjacobi_buffer_size(
+            handle, type, m, nnz, descr, dval, dptr, dcol, block_dim, size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrjacobi_buffer_size(
+            handle, type, m, nnz, descr_null, dval, dptr, dcol, block_dim, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrjacobi_buffer_size(
+            handle_null, type, m, nnz, descr, dval, dptr, dcol, block_dim, &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for invalid block_dim
+    {
+        status = rocsparse_csrjacobi_buffer_size(
+            handle, type, m, nnz, descr, dval, dptr, dcol, 0, &size);
+        verify_rocsparse_status_invalid_size(status, "Error: block_dim is invalid");
+
+        status = rocsparse_csrjacobi_buffer_size(
+            handle, type, m, nnz, descr, dval, dptr, dcol, 9, &size);
+        verify_rocsparse_status_invalid_size(status, "Error: block_dim is invalid");
+    }
+
+    // testing rocsparse_csrjacobi_analysis
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrjacobi_analysis(
+            handle, type, m, nnz, descr, dval, dptr_null, dcol, block_dim, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrjacobi_analysis(
+            handle, type, m, nnz, descr, dval, dptr, dcol_null, block_dim, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrjacobi_analysis(
+            handle, type, m, nnz, descr, dval_null, dptr, dcol, block_dim, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrjacobi_analysis(
+            handle, type, m, nnz, descr, dval, dptr, dcol, block_dim, dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrjacobi_analysis(
+            handle, type, m, nnz, descr_null, dval, dptr, dcol, block_dim, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrjacobi_analysis(
+            handle_null, type, m, nnz, descr, dval, dptr, dcol, block_dim, dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrjacobi
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrjacobi(handle,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &omega,
+                                     descr,
+                                     dval,
+                                     dptr_null,
+                                     dcol,
+                                     block_dim,
+                                     db,
+                                     dx,
+                                     sweeps,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrjacobi(handle,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &omega,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol_null,
+                                     block_dim,
+                                     db,
+                                     dx,
+                                     sweeps,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrjacobi(handle,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &omega,
+                                     descr,
+                                     dval_null,
+                                     dptr,
+                                     dcol,
+                                     block_dim,
+                                     db,
+                                     dx,
+                                     sweeps,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == db)
+    {
+        T* db_null = nullptr;
+
+        status = rocsparse_csrjacobi(handle,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &omega,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     block_dim,
+                                     db_null,
+                                     dx,
+                                     sweeps,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: db is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csrjacobi(handle,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &omega,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     block_dim,
+                                     db,
+                                     dx_null,
+                                     sweeps,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrjacobi(handle,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &omega,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     block_dim,
+                                     db,
+                                     dx,
+                                     sweeps,
+                                     dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrjacobi(handle,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &omega,
+                                     descr_null,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     block_dim,
+                                     db,
+                                     dx,
+                                     sweeps,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrjacobi(handle_null,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &omega,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     block_dim,
+                                     db,
+                                     dx,
+                                     sweeps,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(sweeps < 0)
+    {
+        status = rocsparse_csrjacobi(
+            handle, type, m, nnz, &omega, descr, dval, dptr, dcol, block_dim, db, dx, -1, dbuffer);
+        verify_rocsparse_status_invalid_size(status, "Error: sweeps is invalid");
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrjacobi(Arguments argus)
+{
+    rocsparse_int         safe_size = 100;
+    rocsparse_int         m         = argus.M;
+    rocsparse_int         sweeps    = argus.K;
+    rocsparse_int         block_dim = argus.block_dim;
+    rocsparse_jacobi_type type      = argus.jacobi;
+    rocsparse_index_base  idx_base  = argus.idx_base;
+    T                     h_omega   = argus.alpha;
+    std::string           binfile   = "";
+    std::string           filename  = "";
+    rocsparse_status      status;
+    size_t                size;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m       = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nnz <= 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto db_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dbuffer_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+        T*             dval    = (T*)dval_managed.get();
+        T*             db      = (T*)db_managed.get();
+        T*             dx      = (T*)dx_managed.get();
+        void*          dbuffer = (void*)dbuffer_managed.get();
+
+        if(!dval || !dptr || !dcol || !db || !dx || !dbuffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !db || !dx || !dbuffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Test rocsparse_csrjacobi_buffer_size
+        status = rocsparse_csrjacobi_buffer_size(
+            handle, type, m, nnz, descr, dval, dptr, dcol, block_dim, &size);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csrjacobi_analysis
+        status = rocsparse_csrjacobi_analysis(
+            handle, type, m, nnz, descr, dval, dptr, dcol, block_dim, dbuffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csrjacobi
+        status = rocsparse_csrjacobi(handle,
+                                     type,
+                                     m,
+                                     nnz,
+                                     &h_omega,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     block_dim,
+                                     db,
+                                     dx,
+                                     sweeps,
+                                     dbuffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m   = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz = hcsr_row_ptr[m];
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Right-hand side and initial guess
+    std::vector<T> hb(m);
+    std::vector<T> hx(m);
+
+    rocsparse_init<T>(hb, 1, m);
+    rocsparse_init<T>(hx, 1, m);
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto db_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_omega_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval    = (T*)dval_managed.get();
+    T*             db      = (T*)db_managed.get();
+    T*             dx_1    = (T*)dx_1_managed.get();
+    T*             dx_2    = (T*)dx_2_managed.get();
+    T*             d_omega = (T*)d_omega_managed.get();
+
+    if(!dval || !dptr || !dcol || !db || !dx_1 || !dx_2 || !d_omega)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !db || !dx_1 || "
+                                        "!dx_2 || !d_omega");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_1, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Obtain csrjacobi buffer size
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrjacobi_buffer_size(
+        handle, type, m, nnz, descr, dval, dptr, dcol, block_dim, &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    // csrjacobi analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrjacobi_analysis(
+        handle, type, m, nnz, descr, dval, dptr, dcol, block_dim, dbuffer));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dx_2, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_omega, &h_omega, sizeof(T), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrjacobi(handle,
+                                                  type,
+                                                  m,
+                                                  nnz,
+                                                  &h_omega,
+                                                  descr,
+                                                  dval,
+                                                  dptr,
+                                                  dcol,
+                                                  block_dim,
+                                                  db,
+                                                  dx_1,
+                                                  sweeps,
+                                                  dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrjacobi(handle,
+                                                  type,
+                                                  m,
+                                                  nnz,
+                                                  d_omega,
+                                                  descr,
+                                                  dval,
+                                                  dptr,
+                                                  dcol,
+                                                  block_dim,
+                                                  db,
+                                                  dx_2,
+                                                  sweeps,
+                                                  dbuffer));
+
+        // Copy output from device to CPU
+        std::vector<T> hx_1(m);
+        std::vector<T> hx_2(m);
+        CHECK_HIP_ERROR(hipMemcpy(hx_1.data(), dx_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hx_2.data(), dx_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // Host csrjacobi
+        csrjacobi(type,
+                  m,
+                  hcsr_row_ptr.data(),
+                  hcsr_col_ind.data(),
+                  hcsr_val.data(),
+                  block_dim,
+                  h_omega,
+                  hb.data(),
+                  hx.data(),
+                  sweeps,
+                  idx_base);
+
+        unit_check_near(1, m, 1, hx.data(), hx_1.data());
+        unit_check_near(1, m, 1, hx.data(), hx_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrjacobi(handle,
+                                type,
+                                m,
+                                nnz,
+                                &h_omega,
+                                descr,
+                                dval,
+                                dptr,
+                                dcol,
+                                block_dim,
+                                db,
+                                dx_1,
+                                sweeps,
+                                dbuffer);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrjacobi(handle,
+                                type,
+                                m,
+                                nnz,
+                                &h_omega,
+                                descr,
+                                dval,
+                                dptr,
+                                dcol,
+                                block_dim,
+                                db,
+                                dx_1,
+                                sweeps,
+                                dbuffer);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Each sweep reads the matrix, b, x and the scaling once and writes the iterate
+        size_t nscale = m;
+
+        if(type == rocsparse_jacobi_type_block)
+        {
+            nscale = static_cast<size_t>((m - 1) / block_dim + 1) * block_dim * block_dim;
+        }
+
+        size_t bytes = sizeof(rocsparse_int) * (m + 1 + nnz) + sizeof(T) * (nnz + 3 * m + nscale);
+
+        double bandwidth = sweeps * bytes / gpu_time_used / 1e6;
+
+        printf("m\t\tnnz\t\ttype\tsweeps\tGB/s\tmsec\n");
+        printf("%8d\t%9d\t%d\t%d\t%0.2lf\t%0.2lf\n",
+               m,
+               nnz,
+               type,
+               sweeps,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRJACOBI_HPP
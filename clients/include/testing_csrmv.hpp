@@ -31,6 +31,7 @@
 #include "utility.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <rocsparse.h>
 #include <string>
 
@@ -528,6 +529,7 @@ rocsparse_status testing_csrmv(Arguments argus)
     std::vector<T> hx(n);
     std::vector<T> hy_1(m);
     std::vector<T> hy_2(m);
+    std::vector<T> hy_3(m);
     std::vector<T> hy_gold(m);
 
     rocsparse_init<T>(hx, 1, n);
@@ -535,6 +537,7 @@ rocsparse_status testing_csrmv(Arguments argus)
 
     // copy vector is easy in STL; hy_gold = hx: save a copy in hy_gold which will be output of CPU
     hy_2    = hy_1;
+    hy_3    = hy_1;
     hy_gold = hy_1;
 
     // allocate memory on device
@@ -709,6 +712,64 @@ rocsparse_status testing_csrmv(Arguments argus)
         {
             unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
             unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+
+            // Row blocks computed on the host
+            size_t blob_size_host;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_mat_info_serialize(handle, info, &blob_size_host, nullptr));
+
+            std::vector<char> blob_host(blob_size_host);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_mat_info_serialize(handle, info, &blob_size_host, blob_host.data()));
+
+            // Row blocks computed on the device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_analysis_mode(handle, rocsparse_analysis_mode_device));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrmv_analysis(handle, transA, m, n, nnz, descr, dval, dptr, dcol, info));
+
+            size_t blob_size_device;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_mat_info_serialize(handle, info, &blob_size_device, nullptr));
+
+            std::vector<char> blob_device(blob_size_device);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_mat_info_serialize(handle, info, &blob_size_device, blob_device.data()));
+
+            // Both analysis modes must gather identical row blocks. All sections of the
+            // blob are aligned to rocsparse_int, and the long rows synchronization flag
+            // is cleared on serialization.
+            unit_check_general(1, 1, 1, &blob_size_host, &blob_size_device);
+            unit_check_general(1,
+                               blob_size_host / sizeof(rocsparse_int),
+                               1,
+                               reinterpret_cast<rocsparse_int*>(blob_host.data()),
+                               reinterpret_cast<rocsparse_int*>(blob_device.data()));
+
+            CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_3.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                                  transA,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dval,
+                                                  dptr,
+                                                  dcol,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy_1));
+
+            CHECK_HIP_ERROR(hipMemcpy(hy_3.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+            unit_check_near(1, m, 1, hy_gold.data(), hy_3.data());
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_analysis_mode(handle, rocsparse_analysis_mode_host));
         }
         else
         {
@@ -781,6 +842,46 @@ rocsparse_status testing_csrmv(Arguments argus)
                gpu_gflops,
                bandwidth,
                gpu_time_used);
+
+        if(adaptive)
+        {
+            // Time csrmv analysis on host and device
+            int number_analysis_calls = std::max(number_hot_calls / 10, 1);
+
+            double analysis_time_used[2];
+
+            for(int mode = 0; mode < 2; ++mode)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_mode(
+                    handle,
+                    mode == 0 ? rocsparse_analysis_mode_host : rocsparse_analysis_mode_device));
+
+                analysis_time_used[mode] = get_time_us();
+
+                for(int iter = 0; iter < number_analysis_calls; ++iter)
+                {
+                    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info));
+                    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+                        handle, transA, m, n, nnz, descr, dval, dptr, dcol, info));
+                }
+
+                CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+                // Convert to miliseconds per call
+                analysis_time_used[mode] = (get_time_us() - analysis_time_used[mode])
+                                           / (number_analysis_calls * 1e3);
+            }
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_analysis_mode(handle, rocsparse_analysis_mode_host));
+
+            printf("m\t\tnnz\t\thost analysis msec\tdevice analysis msec\n");
+            printf("%8d\t%9d\t%0.2lf\t\t\t%0.2lf\n",
+                   m,
+                   nnz,
+                   analysis_time_used[0],
+                   analysis_time_used[1]);
+        }
     }
 
     if(adaptive)
@@ -791,4 +892,163 @@ rocsparse_status testing_csrmv(Arguments argus)
     return rocsparse_status_success;
 }
 
+// Generates an irregular CSR row pointer array, mixing runs of empty, short, medium and
+// long rows with single very long rows. The runs are at most 512 rows long, such that
+// the chunk boundaries of the host and device analysis fall into all kinds of runs.
+static rocsparse_int gen_csrmv_row_blocks_pattern(rocsparse_int               m,
+                                                  rocsparse_index_base        idx_base,
+                                                  std::vector<rocsparse_int>& row_ptr)
+{
+    row_ptr.resize(m + 1);
+    row_ptr[0] = idx_base;
+
+    rocsparse_int max_row_nnz = 0;
+
+    for(rocsparse_int i = 0; i < m;)
+    {
+        rocsparse_int run = 1 + rand() % 512;
+        rocsparse_int min_nnz;
+        rocsparse_int max_nnz;
+
+        switch(rand() % 6)
+        {
+        case 0: min_nnz = max_nnz = 0; break;
+        case 1: min_nnz = 1, max_nnz = 31; break;
+        case 2: min_nnz = 32, max_nnz = 128; break;
+        case 3: min_nnz = 129, max_nnz = 1000; break;
+        case 4: min_nnz = 0, max_nnz = 300; break;
+        default: run = 1, min_nnz = 3072, max_nnz = 20000; break;
+        }
+
+        for(rocsparse_int j = 0; j < run && i < m; ++j, ++i)
+        {
+            rocsparse_int row_nnz = min_nnz + rand() % (max_nnz - min_nnz + 1);
+
+            row_ptr[i + 1] = row_ptr[i] + row_nnz;
+            max_row_nnz    = std::max(max_row_nnz, row_nnz);
+        }
+    }
+
+    return max_row_nnz;
+}
+
+// Serializes the row blocks of csrmv meta data. The row blocks are the last entries
+// of a blob that only holds csrmv meta data.
+static rocsparse_status serialize_csrmv_row_blocks(rocsparse_handle                 handle,
+                                                   rocsparse_mat_info               info,
+                                                   size_t                           entries,
+                                                   std::vector<unsigned long long>& row_blocks)
+{
+    size_t blob_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(handle, info, &blob_size, nullptr));
+
+    std::vector<char> blob(blob_size);
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(handle, info, &blob_size, blob.data()));
+
+    row_blocks.resize(entries);
+
+    if(blob_size >= sizeof(unsigned long long) * entries)
+    {
+        std::memcpy(row_blocks.data(),
+                    blob.data() + blob_size - sizeof(unsigned long long) * entries,
+                    sizeof(unsigned long long) * entries);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status testing_csrmv_row_blocks(Arguments argus)
+{
+    rocsparse_int        m        = argus.M;
+    rocsparse_index_base idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Irregular sparsity pattern
+    std::vector<rocsparse_int> hcsr_row_ptr;
+
+    srand(12345ULL);
+    rocsparse_int n   = std::max(gen_csrmv_row_blocks_pattern(m, idx_base, hcsr_row_ptr), 1);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<rocsparse_int> hcsr_col_ind(nnz);
+    std::vector<T>             hcsr_val(nnz, static_cast<T>(1));
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            hcsr_col_ind[j] = j - (hcsr_row_ptr[i] - idx_base) + idx_base;
+        }
+    }
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T*             dval = (T*)dval_managed.get();
+
+    if(!dval || !dptr || !dcol)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Serial reference
+    std::vector<unsigned long long> row_blocks_gold;
+    host_csrmv_row_blocks(m, hcsr_row_ptr.data(), row_blocks_gold);
+
+    size_t entries = row_blocks_gold.size();
+
+    // Chunked row blocks computed on the host
+    std::vector<unsigned long long> row_blocks_host;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_mode(handle, rocsparse_analysis_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, n, nnz, descr, dval, dptr, dcol, info));
+
+    CHECK_ROCSPARSE_ERROR(serialize_csrmv_row_blocks(handle, info, entries, row_blocks_host));
+
+    // Chunked row blocks computed on the device
+    std::vector<unsigned long long> row_blocks_device;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_mode(handle, rocsparse_analysis_mode_device));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, n, nnz, descr, dval, dptr, dcol, info));
+
+    CHECK_ROCSPARSE_ERROR(serialize_csrmv_row_blocks(handle, info, entries, row_blocks_device));
+
+    // Row blocks must be identical to the serial reference
+    unit_check_general(1, entries, 1, row_blocks_gold.data(), row_blocks_host.data());
+    unit_check_general(1, entries, 1, row_blocks_gold.data(), row_blocks_device.data());
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info));
+
+    return rocsparse_status_success;
+}
+
 #endif // TESTING_CSRMV_HPP
@@ -0,0 +1,762 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMV_MULTI_HPP
+#define TESTING_CSRMV_MULTI_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cmath>
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csrmv_multi_bad_arg(void)
+{
+    rocsparse_int       n         = 100;
+    rocsparse_int       m         = 100;
+    rocsparse_int       k         = 2;
+    rocsparse_int       nnz       = 100;
+    rocsparse_int       ldx       = n;
+    rocsparse_int       ldy       = m;
+    rocsparse_int       safe_size = 100;
+    T                   alpha     = 0.6;
+    T                   beta      = 0.2;
+    rocsparse_operation transA    = rocsparse_operation_none;
+    rocsparse_status    status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size * k), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size * k), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T*             dval = (T*)dval_managed.get();
+    T*             dx   = (T*)dx_managed.get();
+    T*             dy   = (T*)dy_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr_null,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol_null,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval_null,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx_null,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy_null,
+                                       ldy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       d_alpha_null,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       d_beta_null,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr_null,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrmv_multi(handle_null,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(ldx < n)
+    {
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       n - 1,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_size(status, "Error: ldx < n");
+    }
+    // testing for(ldy < m)
+    {
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       m - 1);
+        verify_rocsparse_status_invalid_size(status, "Error: ldy < m");
+    }
+    // testing for(k < 0)
+    {
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       -1,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       ldx,
+                                       &beta,
+                                       dy,
+                                       ldy);
+        verify_rocsparse_status_invalid_size(status, "Error: k < 0");
+    }
+}
+
+template <typename T>
+static T csrmv_multi_two_sum(T x, T y, T* sumk_err)
+{
+    T sumk_s = x + y;
+    T bp     = sumk_s - x;
+    (*sumk_err) += ((x - (sumk_s - bp)) + (y - bp));
+    return sumk_s;
+}
+
+template <typename T>
+rocsparse_status testing_csrmv_multi(Arguments argus)
+{
+    rocsparse_int        safe_size  = 100;
+    rocsparse_int        m          = argus.M;
+    rocsparse_int        n          = argus.N;
+    rocsparse_int        k          = argus.K;
+    T                    h_alpha    = argus.alpha;
+    T                    h_beta     = argus.beta;
+    rocsparse_operation  transA     = argus.transA;
+    rocsparse_index_base idx_base   = argus.idx_base;
+    bool                 adaptive   = argus.bswitch;
+    std::string          binfile    = "";
+    std::string          filename   = "";
+    std::string          rocalution = "";
+    rocsparse_status     status;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && n == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        if(argus.rocalution != "")
+        {
+            rocalution = argus.rocalution;
+        }
+        else if(argus.filename != "")
+        {
+            filename = argus.filename;
+        }
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = nullptr;
+
+    if(adaptive)
+    {
+        info = unique_ptr_mat_info->info;
+    }
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || k <= 0 || nnz <= 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T*             dval = (T*)dval_managed.get();
+        T*             dx   = (T*)dx_managed.get();
+        T*             dy   = (T*)dy_managed.get();
+
+        if(!dval || !dptr || !dcol || !dx || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dx || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_csrmv_multi(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       k,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       info,
+                                       dx,
+                                       std::max(n, 1),
+                                       &h_beta,
+                                       dy,
+                                       std::max(m, 1));
+
+        if(m < 0 || n < 0 || k < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status,
+                                                 "Error: m < 0 || n < 0 || k < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && k >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T>             hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(rocalution != "")
+    {
+        if(read_rocalution_matrix(
+               rocalution.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", rocalution.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
+        nnz   = hcsr_row_ptr[m];
+    }
+    else
+    {
+        if(filename != "")
+        {
+            if(read_mtx_matrix(filename.c_str(), m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Padded leading dimensions to test strided access
+    rocsparse_int ldx = n + 3;
+    rocsparse_int ldy = m + 5;
+
+    std::vector<T> hx(ldx * k);
+    std::vector<T> hy_1(ldy * k);
+    std::vector<T> hy_2(ldy * k);
+    std::vector<T> hy_gold(ldy * k);
+
+    rocsparse_init<T>(hx, 1, ldx * k);
+    rocsparse_init<T>(hy_1, 1, ldy * k);
+
+    // copy vector is easy in STL; hy_gold = hy_1: save a copy in hy_gold which will be output of CPU
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldx * k), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldy * k), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldy * k), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval    = (T*)dval_managed.get();
+    T*             dx      = (T*)dx_managed.get();
+    T*             dy_1    = (T*)dy_1_managed.get();
+    T*             dy_2    = (T*)dy_2_managed.get();
+    T*             d_alpha = (T*)d_alpha_managed.get();
+    T*             d_beta  = (T*)d_beta_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * ldx * k, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * ldy * k, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(adaptive)
+    {
+        // csrmv analysis
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis(handle, transA, m, n, nnz, descr, dval, dptr, dcol, info));
+    }
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ldy * k, hipMemcpyHostToDevice));
+
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_multi(handle,
+                                                    transA,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dval,
+                                                    dptr,
+                                                    dcol,
+                                                    info,
+                                                    dx,
+                                                    ldx,
+                                                    &h_beta,
+                                                    dy_1,
+                                                    ldy));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_multi(handle,
+                                                    transA,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    nnz,
+                                                    d_alpha,
+                                                    descr,
+                                                    dval,
+                                                    dptr,
+                                                    dcol,
+                                                    info,
+                                                    dx,
+                                                    ldx,
+                                                    d_beta,
+                                                    dy_2,
+                                                    ldy));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ldy * k, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ldy * k, hipMemcpyDeviceToHost));
+
+        // CPU - compensated summation, the GPU reduction order depends on the algorithm
+        double cpu_time_used = get_time_us();
+
+        for(rocsparse_int v = 0; v < k; ++v)
+        {
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                T sum = h_beta * hy_gold[v * ldy + i];
+                T err = static_cast<T>(0);
+
+                for(rocsparse_int j = hcsr_row_ptr[i] - idx_base;
+                    j < hcsr_row_ptr[i + 1] - idx_base;
+                    ++j)
+                {
+                    sum = csrmv_multi_two_sum(
+                        sum, h_alpha * hval[j] * hx[v * ldx + hcol_ind[j] - idx_base], &err);
+                }
+
+                hy_gold[v * ldy + i] = (T)(sum + err);
+            }
+        }
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        // Padding entries must remain untouched, thus the full arrays are compared
+        unit_check_near(1, ldy * k, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, ldy * k, 1, hy_gold.data(), hy_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrmv_multi(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  k,
+                                  nnz,
+                                  &h_alpha,
+                                  descr,
+                                  dval,
+                                  dptr,
+                                  dcol,
+                                  info,
+                                  dx,
+                                  ldx,
+                                  &h_beta,
+                                  dy_1,
+                                  ldy);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrmv_multi(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  k,
+                                  nnz,
+                                  &h_alpha,
+                                  descr,
+                                  dval,
+                                  dptr,
+                                  dcol,
+                                  info,
+                                  dx,
+                                  ldx,
+                                  &h_beta,
+                                  dy_1,
+                                  ldy);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used     = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        size_t flops      = (h_alpha != 1.0) ? 3.0 * nnz * k : 2.0 * nnz * k;
+        flops             = (h_beta != 0.0) ? flops + m * k : flops;
+        double gpu_gflops = flops / gpu_time_used / 1e6;
+        size_t memtrans   = (2.0 * m + nnz) * k;
+        memtrans          = (h_beta != 0.0) ? memtrans + m * k : memtrans;
+        double bandwidth
+            = (memtrans * sizeof(T) + (m + 1 + nnz) * sizeof(rocsparse_int)) / gpu_time_used / 1e6;
+
+        printf("m\t\tn\t\tk\tnnz\t\talpha\tbeta\tGFlops\tGB/s\tmsec\n");
+        printf("%8d\t%8d\t%4d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               k,
+               nnz,
+               h_alpha,
+               h_beta,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    if(adaptive)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRMV_MULTI_HPP
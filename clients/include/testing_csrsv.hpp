@@ -653,6 +653,11 @@ rocsparse_status testing_csrsv(Arguments argus)
         m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
         nnz   = hcsr_row_ptr[m];
     }
+    else if(argus.block_dim > 1)
+    {
+        nnz = gen_block_tridiagonal(
+            m, argus.block_dim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    }
     else
     {
         std::vector<rocsparse_int> hcoo_row_ind;
@@ -821,7 +826,20 @@ rocsparse_status testing_csrsv(Arguments argus)
         double cpu_time_used = get_time_us();
 
         rocsparse_int position_gold;
-        if(fill_mode == rocsparse_fill_mode_lower)
+        if(trans == rocsparse_operation_transpose)
+        {
+            position_gold = csrsv_trans(m,
+                                        hcsr_row_ptr.data(),
+                                        hcsr_col_ind.data(),
+                                        hcsr_val.data(),
+                                        h_alpha,
+                                        hx.data(),
+                                        hy_gold.data(),
+                                        idx_base,
+                                        fill_mode,
+                                        diag_type);
+        }
+        else if(fill_mode == rocsparse_fill_mode_lower)
         {
             position_gold = lsolve(m,
                                    hcsr_row_ptr.data(),
@@ -869,6 +887,67 @@ rocsparse_status testing_csrsv(Arguments argus)
 
         unit_check_near(1, n, 1, hy_gold.data(), hy_1.data());
         unit_check_near(1, n, 1, hy_gold.data(), hy_2.data());
+
+        // Same sparsity pattern in freshly allocated buffers must re-use the meta data
+        auto dptr_2_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+        auto dcol_2_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+
+        rocsparse_int* dptr_2 = (rocsparse_int*)dptr_2_managed.get();
+        rocsparse_int* dcol_2 = (rocsparse_int*)dcol_2_managed.get();
+
+        if(!dptr_2 || !dcol_2)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!dptr_2 || !dcol_2");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            dptr_2, dptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol_2, dcol, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                       trans,
+                                                       m,
+                                                       nnz,
+                                                       descr,
+                                                       dval,
+                                                       dptr_2,
+                                                       dcol_2,
+                                                       info,
+                                                       rocsparse_analysis_policy_reuse,
+                                                       rocsparse_solve_policy_auto,
+                                                       dbuffer));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                    trans,
+                                                    m,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dval,
+                                                    dptr_2,
+                                                    dcol_2,
+                                                    info,
+                                                    dx,
+                                                    dy_2,
+                                                    rocsparse_solve_policy_auto,
+                                                    dbuffer));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * n, hipMemcpyDeviceToHost));
+
+        // Transposed solves accumulate in arbitrary order
+        if(trans == rocsparse_operation_none)
+        {
+            unit_check_general(1, n, 1, hy_1.data(), hy_2.data());
+        }
+        else
+        {
+            unit_check_near(1, n, 1, hy_1.data(), hy_2.data());
+        }
     }
 
     if(argus.timing)
@@ -208,6 +208,16 @@ rocsparse_status testing_doti(Arguments argus)
         // copy output from device to CPU^
         CHECK_HIP_ERROR(hipMemcpy(&hresult_2, dresult_2, sizeof(T), hipMemcpyDeviceToHost));
 
+        // ROCSPARSE pointer mode host with pinned result, completes asynchronously
+        T* hresult_3;
+        CHECK_HIP_ERROR(hipHostMalloc(&hresult_3, sizeof(T)));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_result_mode(handle, rocsparse_result_mode_async));
+        CHECK_ROCSPARSE_ERROR(rocsparse_doti(handle, nnz, dx_val, dx_ind, dy, hresult_3, idx_base));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_result_mode(handle, rocsparse_result_mode_blocking));
+
         // CPU
         double cpu_time_used = get_time_us();
 
@@ -223,6 +233,9 @@ rocsparse_status testing_doti(Arguments argus)
         // unit check and norm check can not be interchanged their order
         unit_check_general(1, 1, 1, &hresult_gold, &hresult_1);
         unit_check_general(1, 1, 1, &hresult_gold, &hresult_2);
+        unit_check_general(1, 1, 1, &hresult_gold, hresult_3);
+
+        CHECK_HIP_ERROR(hipHostFree(hresult_3));
     }
 
     if(argus.timing)
@@ -0,0 +1,416 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_DOTI_BATCHED_HPP
+#define TESTING_DOTI_BATCHED_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_doti_batched_bad_arg(void)
+{
+    rocsparse_int nnz         = 100;
+    rocsparse_int batch_count = 1;
+    rocsparse_int safe_size   = 100;
+    T             result;
+
+    rocsparse_index_base idx_base = rocsparse_index_base_zero;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    auto dxVal_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dxInd_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dxVal_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+    auto dxInd_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int*) * batch_count), device_free};
+    auto dy_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+
+    T*              dxVal       = (T*)dxVal_managed.get();
+    rocsparse_int*  dxInd       = (rocsparse_int*)dxInd_managed.get();
+    T*              dy          = (T*)dy_managed.get();
+    T**             dxVal_array = (T**)dxVal_array_managed.get();
+    rocsparse_int** dxInd_array = (rocsparse_int**)dxInd_array_managed.get();
+    T**             dy_array    = (T**)dy_array_managed.get();
+
+    if(!dxInd || !dxVal || !dy || !dxVal_array || !dxInd_array || !dy_array)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_doti_strided_batched
+
+    // testing for(nullptr == dxInd)
+    {
+        rocsparse_int* dxInd_null = nullptr;
+
+        status = rocsparse_doti_strided_batched(
+            handle, nnz, dxVal, nnz, dxInd_null, nnz, dy, nnz, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: xInd is nullptr");
+    }
+    // testing for(nullptr == dxVal)
+    {
+        T* dxVal_null = nullptr;
+
+        status = rocsparse_doti_strided_batched(
+            handle, nnz, dxVal_null, nnz, dxInd, nnz, dy, nnz, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: xVal is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_doti_strided_batched(
+            handle, nnz, dxVal, nnz, dxInd, nnz, dy_null, nnz, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: y is nullptr");
+    }
+    // testing for(nullptr == result)
+    {
+        T* result_null = nullptr;
+
+        status = rocsparse_doti_strided_batched(
+            handle, nnz, dxVal, nnz, dxInd, nnz, dy, nnz, result_null, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: result is nullptr");
+    }
+    // testing for(stride < 0)
+    {
+        status = rocsparse_doti_strided_batched(
+            handle, nnz, dxVal, nnz, dxInd, -1, dy, nnz, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: stride_ind is invalid");
+    }
+    // testing for(batch_count < 0)
+    {
+        status = rocsparse_doti_strided_batched(
+            handle, nnz, dxVal, nnz, dxInd, nnz, dy, nnz, &result, -1, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: batch_count is invalid");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_doti_strided_batched(
+            handle_null, nnz, dxVal, nnz, dxInd, nnz, dy, nnz, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_doti_batched
+
+    // testing for(nullptr == dxInd)
+    {
+        rocsparse_int** dxInd_null = nullptr;
+
+        status = rocsparse_doti_batched(
+            handle, nnz, dxVal_array, dxInd_null, dy_array, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: xInd is nullptr");
+    }
+    // testing for(nullptr == dxVal)
+    {
+        T** dxVal_null = nullptr;
+
+        status = rocsparse_doti_batched(
+            handle, nnz, dxVal_null, dxInd_array, dy_array, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: xVal is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T** dy_null = nullptr;
+
+        status = rocsparse_doti_batched(
+            handle, nnz, dxVal_array, dxInd_array, dy_null, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: y is nullptr");
+    }
+    // testing for(nullptr == result)
+    {
+        T* result_null = nullptr;
+
+        status = rocsparse_doti_batched(
+            handle, nnz, dxVal_array, dxInd_array, dy_array, result_null, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: result is nullptr");
+    }
+    // testing for(batch_count < 0)
+    {
+        status = rocsparse_doti_batched(
+            handle, nnz, dxVal_array, dxInd_array, dy_array, &result, -1, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: batch_count is invalid");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_doti_batched(
+            handle_null, nnz, dxVal_array, dxInd_array, dy_array, &result, batch_count, idx_base);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_doti_batched(Arguments argus)
+{
+    rocsparse_int        N           = argus.N;
+    rocsparse_int        nnz         = argus.nnz;
+    rocsparse_int        batch_count = argus.batch_count;
+    rocsparse_int        safe_size   = 100;
+    rocsparse_index_base idx_base    = argus.idx_base;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(nnz <= 0 || batch_count <= 0)
+    {
+        auto dxInd_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dxVal_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dxInd = (rocsparse_int*)dxInd_managed.get();
+        T*             dxVal = (T*)dxVal_managed.get();
+        T*             dy    = (T*)dy_managed.get();
+
+        if(!dxInd || !dxVal || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dxInd || !dxVal || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        T result;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_doti_strided_batched(
+            handle, nnz, dxVal, 0, dxInd, 0, dy, 0, &result, batch_count, idx_base);
+
+        if(nnz < 0 || batch_count < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: nnz < 0 || batch_count < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "nnz == 0 || batch_count == 0");
+        }
+
+        status = rocsparse_doti_batched(handle,
+                                        nnz,
+                                        (const T* const*)nullptr,
+                                        (const rocsparse_int* const*)nullptr,
+                                        (const T* const*)nullptr,
+                                        &result,
+                                        batch_count,
+                                        idx_base);
+
+        if(nnz < 0 || batch_count < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: nnz < 0 || batch_count < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "nnz == 0 || batch_count == 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Vectors of the batch are stored consecutively
+    rocsparse_int size_x = nnz * batch_count;
+    rocsparse_int size_y = N * batch_count;
+
+    // Host structures
+    std::vector<rocsparse_int> hxInd(size_x);
+    std::vector<T>             hxVal(size_x);
+    std::vector<T>             hy(size_y);
+    std::vector<T>             hresult_1(batch_count);
+    std::vector<T>             hresult_2(batch_count);
+    std::vector<T>             hresult_gold(batch_count);
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        rocsparse_init_index(hxInd.data() + b * nnz, nnz, 1, N);
+    }
+    rocsparse_init<T>(hxVal, 1, size_x);
+    rocsparse_init<T>(hy, 1, size_y);
+
+    // allocate memory on device
+    auto dxInd_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * size_x), device_free};
+    auto dxVal_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dy_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+    auto dresult_2_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T) * batch_count), device_free};
+    auto dxInd_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int*) * batch_count), device_free};
+    auto dxVal_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+    auto dy_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+
+    rocsparse_int*  dxInd       = (rocsparse_int*)dxInd_managed.get();
+    T*              dxVal       = (T*)dxVal_managed.get();
+    T*              dy          = (T*)dy_managed.get();
+    T*              dresult_2   = (T*)dresult_2_managed.get();
+    rocsparse_int** dxInd_array = (rocsparse_int**)dxInd_array_managed.get();
+    T**             dxVal_array = (T**)dxVal_array_managed.get();
+    T**             dy_array    = (T**)dy_array_managed.get();
+
+    if(!dxInd || !dxVal || !dy || !dresult_2 || !dxInd_array || !dxVal_array || !dy_array)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dxInd || !dxVal || !dy || !dresult_2 || "
+                                        "!dxInd_array || !dxVal_array || !dy_array");
+        return rocsparse_status_memory_error;
+    }
+
+    // Pointer arrays refer to the same vectors as the strided batch
+    std::vector<rocsparse_int*> hxInd_array(batch_count);
+    std::vector<T*>             hxVal_array(batch_count);
+    std::vector<T*>             hy_array(batch_count);
+
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        hxInd_array[b] = dxInd + b * nnz;
+        hxVal_array[b] = dxVal + b * nnz;
+        hy_array[b]    = dy + b * N;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dxInd, hxInd.data(), sizeof(rocsparse_int) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dxVal, hxVal.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dxInd_array,
+                              hxInd_array.data(),
+                              sizeof(rocsparse_int*) * batch_count,
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dxVal_array, hxVal_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_array, hy_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host, strided batch
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_doti_strided_batched(handle,
+                                                             nnz,
+                                                             dxVal,
+                                                             nnz,
+                                                             dxInd,
+                                                             nnz,
+                                                             dy,
+                                                             N,
+                                                             hresult_1.data(),
+                                                             batch_count,
+                                                             idx_base));
+
+        // ROCSPARSE pointer mode device, pointer array batch
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_doti_batched(
+            handle, nnz, dxVal_array, dxInd_array, dy_array, dresult_2, batch_count, idx_base));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(
+            hresult_2.data(), dresult_2, sizeof(T) * batch_count, hipMemcpyDeviceToHost));
+
+        // ROCSPARSE pointer mode host with pinned results, completes asynchronously
+        T* hresult_3;
+        CHECK_HIP_ERROR(hipHostMalloc(&hresult_3, sizeof(T) * batch_count));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_result_mode(handle, rocsparse_result_mode_async));
+        CHECK_ROCSPARSE_ERROR(rocsparse_doti_batched(
+            handle, nnz, dxVal_array, dxInd_array, dy_array, hresult_3, batch_count, idx_base));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_result_mode(handle, rocsparse_result_mode_blocking));
+
+        // CPU
+        for(rocsparse_int b = 0; b < batch_count; ++b)
+        {
+            hresult_gold[b] = static_cast<T>(0);
+            for(rocsparse_int i = 0; i < nnz; ++i)
+            {
+                hresult_gold[b] += hy[b * N + hxInd[b * nnz + i] - idx_base] * hxVal[b * nnz + i];
+            }
+        }
+
+        unit_check_near(1, batch_count, 1, hresult_gold.data(), hresult_1.data());
+        unit_check_near(1, batch_count, 1, hresult_gold.data(), hresult_2.data());
+        unit_check_near(1, batch_count, 1, hresult_gold.data(), hresult_3);
+
+        CHECK_HIP_ERROR(hipHostFree(hresult_3));
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_doti_strided_batched(
+                handle, nnz, dxVal, nnz, dxInd, nnz, dy, N, dresult_2, batch_count, idx_base);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_doti_strided_batched(
+                handle, nnz, dxVal, nnz, dxInd, nnz, dy, N, dresult_2, batch_count, idx_base);
+        }
+
+        gpu_time_used     = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_gflops = (2.0 * nnz * batch_count) / 1e9 / gpu_time_used * 1e6 * 1;
+        double bandwidth  = (sizeof(rocsparse_int) * nnz + sizeof(T) * (2 * nnz + 1)) * batch_count
+                           / gpu_time_used / 1e3;
+
+        printf("nnz\t\tbatch\tGFlops\tGB/s\tusec\n");
+        printf("%9d\t%d\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               nnz,
+               batch_count,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_DOTI_BATCHED_HPP
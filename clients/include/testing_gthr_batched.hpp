@@ -0,0 +1,360 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_GTHR_BATCHED_HPP
+#define TESTING_GTHR_BATCHED_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_gthr_batched_bad_arg(void)
+{
+    rocsparse_int nnz         = 100;
+    rocsparse_int batch_count = 1;
+    rocsparse_int safe_size   = 100;
+
+    rocsparse_index_base idx_base = rocsparse_index_base_zero;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    auto dx_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_ind_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_val_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+    auto dx_ind_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int*) * batch_count), device_free};
+    auto dy_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+
+    T*              dx_val       = (T*)dx_val_managed.get();
+    rocsparse_int*  dx_ind       = (rocsparse_int*)dx_ind_managed.get();
+    T*              dy           = (T*)dy_managed.get();
+    T**             dx_val_array = (T**)dx_val_array_managed.get();
+    rocsparse_int** dx_ind_array = (rocsparse_int**)dx_ind_array_managed.get();
+    T**             dy_array     = (T**)dy_array_managed.get();
+
+    if(!dx_ind || !dx_val || !dy || !dx_val_array || !dx_ind_array || !dy_array)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_gthr_strided_batched
+
+    // testing for(nullptr == dx_ind)
+    {
+        rocsparse_int* dx_ind_null = nullptr;
+
+        status = rocsparse_gthr_strided_batched(
+            handle, nnz, dy, nnz, dx_val, nnz, dx_ind_null, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: x_ind is nullptr");
+    }
+    // testing for(nullptr == dx_val)
+    {
+        T* dx_val_null = nullptr;
+
+        status = rocsparse_gthr_strided_batched(
+            handle, nnz, dy, nnz, dx_val_null, nnz, dx_ind, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: x_val is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_gthr_strided_batched(
+            handle, nnz, dy_null, nnz, dx_val, nnz, dx_ind, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: y is nullptr");
+    }
+    // testing for(stride < 0)
+    {
+        status = rocsparse_gthr_strided_batched(
+            handle, nnz, dy, -1, dx_val, nnz, dx_ind, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: stride_y is invalid");
+    }
+    // testing for(batch_count < 0)
+    {
+        status = rocsparse_gthr_strided_batched(
+            handle, nnz, dy, nnz, dx_val, nnz, dx_ind, nnz, -1, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: batch_count is invalid");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_gthr_strided_batched(
+            handle_null, nnz, dy, nnz, dx_val, nnz, dx_ind, nnz, batch_count, idx_base);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_gthr_batched
+
+    // testing for(nullptr == dx_ind)
+    {
+        rocsparse_int** dx_ind_null = nullptr;
+
+        status = rocsparse_gthr_batched(
+            handle, nnz, dy_array, dx_val_array, dx_ind_null, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: x_ind is nullptr");
+    }
+    // testing for(nullptr == dx_val)
+    {
+        T** dx_val_null = nullptr;
+
+        status = rocsparse_gthr_batched(
+            handle, nnz, dy_array, dx_val_null, dx_ind_array, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: x_val is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T** dy_null = nullptr;
+
+        status = rocsparse_gthr_batched(
+            handle, nnz, dy_null, dx_val_array, dx_ind_array, batch_count, idx_base);
+        verify_rocsparse_status_invalid_pointer(status, "Error: y is nullptr");
+    }
+    // testing for(batch_count < 0)
+    {
+        status = rocsparse_gthr_batched(
+            handle, nnz, dy_array, dx_val_array, dx_ind_array, -1, idx_base);
+        verify_rocsparse_status_invalid_size(status, "Error: batch_count is invalid");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_gthr_batched(
+            handle_null, nnz, dy_array, dx_val_array, dx_ind_array, batch_count, idx_base);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_gthr_batched(Arguments argus)
+{
+    rocsparse_int        N           = argus.N;
+    rocsparse_int        nnz         = argus.nnz;
+    rocsparse_int        batch_count = argus.batch_count;
+    rocsparse_int        safe_size   = 100;
+    rocsparse_index_base idx_base    = argus.idx_base;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(nnz <= 0 || batch_count <= 0)
+    {
+        auto dx_ind_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dx_val_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dx_ind = (rocsparse_int*)dx_ind_managed.get();
+        T*             dx_val = (T*)dx_val_managed.get();
+        T*             dy     = (T*)dy_managed.get();
+
+        if(!dx_ind || !dx_val || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dx_ind || !dx_val || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        status = rocsparse_gthr_strided_batched(
+            handle, nnz, dy, 0, dx_val, 0, dx_ind, 0, batch_count, idx_base);
+
+        if(nnz < 0 || batch_count < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: nnz < 0 || batch_count < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "nnz == 0 || batch_count == 0");
+        }
+
+        status = rocsparse_gthr_batched(handle,
+                                        nnz,
+                                        (const T* const*)nullptr,
+                                        (T* const*)nullptr,
+                                        (const rocsparse_int* const*)nullptr,
+                                        batch_count,
+                                        idx_base);
+
+        if(nnz < 0 || batch_count < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: nnz < 0 || batch_count < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "nnz == 0 || batch_count == 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Vectors of the batch are stored consecutively
+    rocsparse_int size_x = nnz * batch_count;
+    rocsparse_int size_y = N * batch_count;
+
+    // Host structures
+    std::vector<rocsparse_int> hx_ind(size_x);
+    std::vector<T>             hx_val_1(size_x);
+    std::vector<T>             hx_val_2(size_x);
+    std::vector<T>             hx_val_gold(size_x);
+    std::vector<T>             hy(size_y);
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        rocsparse_init_index(hx_ind.data() + b * nnz, nnz, 1, N);
+    }
+    rocsparse_init<T>(hy, 1, size_y);
+
+    // allocate memory on device
+    auto dx_ind_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * size_x), device_free};
+    auto dx_val_1_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dx_val_2_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dy_managed       = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+    auto dx_ind_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int*) * batch_count), device_free};
+    auto dx_val_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+    auto dy_array_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T*) * batch_count), device_free};
+
+    rocsparse_int*  dx_ind       = (rocsparse_int*)dx_ind_managed.get();
+    T*              dx_val_1     = (T*)dx_val_1_managed.get();
+    T*              dx_val_2     = (T*)dx_val_2_managed.get();
+    T*              dy           = (T*)dy_managed.get();
+    rocsparse_int** dx_ind_array = (rocsparse_int**)dx_ind_array_managed.get();
+    T**             dx_val_array = (T**)dx_val_array_managed.get();
+    T**             dy_array     = (T**)dy_array_managed.get();
+
+    if(!dx_ind || !dx_val_1 || !dx_val_2 || !dy || !dx_ind_array || !dx_val_array || !dy_array)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dx_ind || !dx_val_1 || !dx_val_2 || !dy || "
+                                        "!dx_ind_array || !dx_val_array || !dy_array");
+        return rocsparse_status_memory_error;
+    }
+
+    // Pointer arrays refer to the same vectors as the strided batch
+    std::vector<rocsparse_int*> hx_ind_array(batch_count);
+    std::vector<T*>             hx_val_array(batch_count);
+    std::vector<T*>             hy_array(batch_count);
+
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        hx_ind_array[b] = dx_ind + b * nnz;
+        hx_val_array[b] = dx_val_2 + b * nnz;
+        hy_array[b]     = dy + b * N;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_ind, hx_ind.data(), sizeof(rocsparse_int) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind_array,
+                              hx_ind_array.data(),
+                              sizeof(rocsparse_int*) * batch_count,
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dx_val_array, hx_val_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_array, hy_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // Strided batch
+        CHECK_ROCSPARSE_ERROR(rocsparse_gthr_strided_batched(
+            handle, nnz, dy, N, dx_val_1, nnz, dx_ind, nnz, batch_count, idx_base));
+
+        // Pointer array batch
+        CHECK_ROCSPARSE_ERROR(rocsparse_gthr_batched(
+            handle, nnz, dy_array, dx_val_array, dx_ind_array, batch_count, idx_base));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(
+            hipMemcpy(hx_val_1.data(), dx_val_1, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hx_val_2.data(), dx_val_2, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+
+        // CPU
+        for(rocsparse_int b = 0; b < batch_count; ++b)
+        {
+            for(rocsparse_int i = 0; i < nnz; ++i)
+            {
+                hx_val_gold[b * nnz + i] = hy[b * N + hx_ind[b * nnz + i] - idx_base];
+            }
+        }
+
+        unit_check_general(1, size_x, 1, hx_val_gold.data(), hx_val_1.data());
+        unit_check_general(1, size_x, 1, hx_val_gold.data(), hx_val_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_gthr_strided_batched(
+                handle, nnz, dy, N, dx_val_1, nnz, dx_ind, nnz, batch_count, idx_base);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_gthr_strided_batched(
+                handle, nnz, dy, N, dx_val_1, nnz, dx_ind, nnz, batch_count, idx_base);
+        }
+
+        gpu_time_used    = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double bandwidth = (sizeof(rocsparse_int) * nnz + sizeof(T) * 2.0 * nnz) * batch_count
+                           / gpu_time_used / 1e3;
+
+        printf("nnz\t\tbatch\tGB/s\tusec\n");
+        printf("%9d\t%d\t%0.2lf\t%0.2lf\n", nnz, batch_count, bandwidth, gpu_time_used);
+    }
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_GTHR_BATCHED_HPP
@@ -0,0 +1,548 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_MAT_INFO_SERIALIZE_HPP
+#define TESTING_MAT_INFO_SERIALIZE_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cstring>
+#include <rocsparse.h>
+#include <vector>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+void testing_mat_info_serialize_bad_arg(void)
+{
+    rocsparse_int      m         = 100;
+    rocsparse_int      nnz       = 100;
+    rocsparse_int      safe_size = 100;
+    size_t             size      = 0;
+    unsigned long long hash;
+    rocsparse_status   status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+
+    if(!dptr || !dcol)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    std::vector<char> blob(safe_size, 0);
+
+    // testing rocsparse_csr_structure_hash
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csr_structure_hash(handle, m, nnz, dptr_null, dcol, &hash);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csr_structure_hash(handle, m, nnz, dptr, dcol_null, &hash);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == hash)
+    {
+        unsigned long long* hash_null = nullptr;
+
+        status = rocsparse_csr_structure_hash(handle, m, nnz, dptr, dcol, hash_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: hash is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr_structure_hash(handle_null, m, nnz, dptr, dcol, &hash);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_mat_info_serialize
+
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_mat_info_serialize(handle, info_null, &size, nullptr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == size)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_mat_info_serialize(handle, info, size_null, nullptr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_mat_info_serialize(handle_null, info, &size, nullptr);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for empty info
+    {
+        status = rocsparse_mat_info_serialize(handle, info, &size, nullptr);
+        verify_rocsparse_status_invalid_value(status, "Error: info is empty");
+    }
+
+    // testing rocsparse_mat_info_deserialize
+
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_mat_info_deserialize(
+            handle, m, nnz, descr_null, dptr, dcol, blob.size(), blob.data(), info);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_mat_info_deserialize(
+            handle, m, nnz, descr, dptr_null, dcol, blob.size(), blob.data(), info);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_mat_info_deserialize(
+            handle, m, nnz, descr, dptr, dcol_null, blob.size(), blob.data(), info);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == blob)
+    {
+        void* blob_null = nullptr;
+
+        status = rocsparse_mat_info_deserialize(
+            handle, m, nnz, descr, dptr, dcol, blob.size(), blob_null, info);
+        verify_rocsparse_status_invalid_pointer(status, "Error: blob is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_mat_info_deserialize(
+            handle, m, nnz, descr, dptr, dcol, blob.size(), blob.data(), info_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_mat_info_deserialize(
+            handle_null, m, nnz, descr, dptr, dcol, blob.size(), blob.data(), info);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for invalid blob size
+    {
+        status = rocsparse_mat_info_deserialize(
+            handle, m, nnz, descr, dptr, dcol, 4, blob.data(), info);
+        verify_rocsparse_status_invalid_size(status, "Error: size is too small");
+    }
+    // testing for invalid blob
+    {
+        status = rocsparse_mat_info_deserialize(
+            handle, m, nnz, descr, dptr, dcol, blob.size(), blob.data(), info);
+        verify_rocsparse_status_invalid_value(status, "Error: blob is invalid");
+    }
+}
+
+template <typename T>
+rocsparse_status testing_mat_info_serialize(Arguments argus)
+{
+    rocsparse_int        safe_size = 100;
+    rocsparse_int        ndim      = argus.M;
+    rocsparse_index_base idx_base  = argus.idx_base;
+    T                    h_alpha   = 1.0;
+    T                    h_beta    = 0.0;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr_L(new descr_struct);
+    rocsparse_mat_descr           descr_L = test_descr_L->descr;
+
+    std::unique_ptr<descr_struct> test_descr_U(new descr_struct);
+    rocsparse_mat_descr           descr_U = test_descr_U->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_info_1(new mat_info_struct);
+    rocsparse_mat_info               info_1 = unique_ptr_info_1->info;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_info_2(new mat_info_struct);
+    rocsparse_mat_info               info_2 = unique_ptr_info_2->info;
+
+    // Set matrix index base and fill modes
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_L, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_U, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper));
+
+    // Argument sanity check before allocating invalid memory
+    if(ndim <= 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+
+        if(!dptr || !dcol)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!dptr || !dcol");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_HIP_ERROR(hipMemset(dptr, 0, sizeof(rocsparse_int) * safe_size));
+
+        unsigned long long hash;
+        status = rocsparse_csr_structure_hash(handle, ndim, 0, dptr, dcol, &hash);
+
+        if(ndim < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    // Sample initial matrix on CPU
+    rocsparse_int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hx(m);
+    rocsparse_init<T>(hx, 1, m);
+
+    // Same sparsity pattern, but with a single column index moved
+    std::vector<rocsparse_int> hcsr_col_ind_mod = hcsr_col_ind;
+    std::swap(hcsr_col_ind_mod[0], hcsr_col_ind_mod[nnz - 1]);
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcol_mod_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_1_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_2_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed     = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_1_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dptr     = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol     = (rocsparse_int*)dcol_managed.get();
+    rocsparse_int* dcol_mod = (rocsparse_int*)dcol_mod_managed.get();
+    T*             dval_1   = (T*)dval_1_managed.get();
+    T*             dval_2   = (T*)dval_2_managed.get();
+    T*             dx       = (T*)dx_managed.get();
+    T*             dy_1     = (T*)dy_1_managed.get();
+    T*             dy_2     = (T*)dy_2_managed.get();
+
+    if(!dval_1 || !dval_2 || !dptr || !dcol || !dcol_mod || !dx || !dy_1 || !dy_2)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval_1 || !dval_2 || !dptr || !dcol || !dcol_mod || "
+                                        "!dx || !dy_1 || !dy_2");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol_mod, hcsr_col_ind_mod.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_1, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_2, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t size_L;
+    size_t size_U;
+    size_t size_ilu0;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size(handle,
+                                                      rocsparse_operation_none,
+                                                      m,
+                                                      nnz,
+                                                      descr_L,
+                                                      dval_1,
+                                                      dptr,
+                                                      dcol,
+                                                      info_1,
+                                                      &size_L));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size(handle,
+                                                      rocsparse_operation_none,
+                                                      m,
+                                                      nnz,
+                                                      descr_U,
+                                                      dval_1,
+                                                      dptr,
+                                                      dcol,
+                                                      info_1,
+                                                      &size_U));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size(
+        handle, m, nnz, descr_L, dval_1, dptr, dcol, info_1, &size_ilu0));
+
+    size_t size = std::max(size_L, std::max(size_U, size_ilu0));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    // Perform the analysis on info_1
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, m, nnz, descr_L, dval_1, dptr, dcol, info_1));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr_L,
+                                                     dval_1,
+                                                     dptr,
+                                                     dcol,
+                                                     info_1,
+                                                     rocsparse_analysis_policy_force,
+                                                     rocsparse_solve_policy_auto,
+                                                     dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   nnz,
+                                                   descr_L,
+                                                   dval_1,
+                                                   dptr,
+                                                   dcol,
+                                                   info_1,
+                                                   rocsparse_analysis_policy_reuse,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   nnz,
+                                                   descr_U,
+                                                   dval_1,
+                                                   dptr,
+                                                   dcol,
+                                                   info_1,
+                                                   rocsparse_analysis_policy_force,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+
+    // Serialize info_1
+    size_t blob_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(handle, info_1, &blob_size, nullptr));
+
+    std::vector<char> blob_1(blob_size);
+    std::vector<char> blob_2(blob_size);
+
+    // Too small blob
+    size   = blob_size - 1;
+    status = rocsparse_mat_info_serialize(handle, info_1, &size, blob_1.data());
+    verify_rocsparse_status_invalid_size(status, "Error: size is too small");
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(handle, info_1, &blob_size, blob_1.data()));
+
+    // Deserialize with a different sparsity pattern must fail
+    status = rocsparse_mat_info_deserialize(
+        handle, m, nnz, descr_L, dptr, dcol_mod, blob_size, blob_1.data(), info_2);
+    verify_rocsparse_status_invalid_value(status, "Error: hash mismatch");
+
+    // Deserialize with a different size must fail
+    status = rocsparse_mat_info_deserialize(
+        handle, m - 1, nnz, descr_L, dptr, dcol, blob_size, blob_1.data(), info_2);
+    verify_rocsparse_status_invalid_size(status, "Error: m mismatch");
+
+    // Deserialize a truncated blob must fail
+    status = rocsparse_mat_info_deserialize(
+        handle, m, nnz, descr_L, dptr, dcol, blob_size - 1, blob_1.data(), info_2);
+    verify_rocsparse_status_invalid_size(status, "Error: blob is truncated");
+
+    // Deserialize a corrupt blob must fail
+    blob_2 = blob_1;
+    blob_2[blob_size - 1] ^= 1;
+
+    status = rocsparse_mat_info_deserialize(
+        handle, m, nnz, descr_L, dptr, dcol, blob_size, blob_2.data(), info_2);
+    verify_rocsparse_status_invalid_value(status, "Error: blob is corrupt");
+
+    // Deserialize into info_2
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_deserialize(
+        handle, m, nnz, descr_L, dptr, dcol, blob_size, blob_1.data(), info_2));
+
+    // csrmv with original and restored meta data
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+
+    for(int i = 0; i < 2; ++i)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                              rocsparse_operation_none,
+                                              m,
+                                              m,
+                                              nnz,
+                                              &h_alpha,
+                                              descr_L,
+                                              dval_1,
+                                              dptr,
+                                              dcol,
+                                              info_1,
+                                              dx,
+                                              &h_beta,
+                                              dy_1));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                              rocsparse_operation_none,
+                                              m,
+                                              m,
+                                              nnz,
+                                              &h_alpha,
+                                              descr_L,
+                                              dval_1,
+                                              dptr,
+                                              dcol,
+                                              info_2,
+                                              dx,
+                                              &h_beta,
+                                              dy_2));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, m, 1, hy_1.data(), hy_2.data());
+
+    // csrsv with original and restored meta data
+    rocsparse_mat_descr descr[2] = {descr_L, descr_U};
+
+    for(int i = 0; i < 2; ++i)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                    rocsparse_operation_none,
+                                                    m,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    descr[i],
+                                                    dval_1,
+                                                    dptr,
+                                                    dcol,
+                                                    info_1,
+                                                    dx,
+                                                    dy_1,
+                                                    rocsparse_solve_policy_auto,
+                                                    dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                    rocsparse_operation_none,
+                                                    m,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    descr[i],
+                                                    dval_1,
+                                                    dptr,
+                                                    dcol,
+                                                    info_2,
+                                                    dx,
+                                                    dy_2,
+                                                    rocsparse_solve_policy_auto,
+                                                    dbuffer));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        unit_check_general(1, m, 1, hy_1.data(), hy_2.data());
+    }
+
+    // csrilu0 with original and restored meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(
+        handle, m, nnz, descr_L, dval_1, dptr, dcol, info_1, rocsparse_solve_policy_auto, dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(
+        handle, m, nnz, descr_L, dval_2, dptr, dcol, info_2, rocsparse_solve_policy_auto, dbuffer));
+
+    std::vector<T> hval_1(nnz);
+    std::vector<T> hval_2(nnz);
+
+    CHECK_HIP_ERROR(hipMemcpy(hval_1.data(), dval_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hval_2.data(), dval_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, nnz, 1, hval_1.data(), hval_2.data());
+
+    // Serializing the restored meta data must reproduce the original blob
+    size = blob_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_serialize(handle, info_2, &size, blob_2.data()));
+
+    rocsparse_int blob_equal = (std::memcmp(blob_1.data(), blob_2.data(), blob_size) == 0);
+    rocsparse_int blob_gold  = 1;
+
+    unit_check_general(1, 1, 1, &blob_size, &size);
+    unit_check_general(1, 1, 1, &blob_gold, &blob_equal);
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_MAT_INFO_SERIALIZE_HPP
@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_NRM2I_BATCHED_HPP
+#define TESTING_NRM2I_BATCHED_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cmath>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_nrm2i_batched_bad_arg(void)
+{
+    rocsparse_int nnz         = 100;
+    rocsparse_int batch_count = 1;
+    rocsparse_int safe_size   = 100;
+
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    auto dx_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    T* dx_val = (T*)dx_val_managed.get();
+
+    if(!dx_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    T result;
+
+    // testing for (nullptr == dx_val)
+    {
+        T* dx_val_null = nullptr;
+
+        status
+            = rocsparse_nrm2i_strided_batched(handle, nnz, dx_val_null, nnz, &result, batch_count);
+        verify_rocsparse_status_invalid_pointer(status, "Error: x_val is nullptr");
+    }
+
+    // testing for (nullptr == result)
+    {
+        T* result_null = nullptr;
+
+        status
+            = rocsparse_nrm2i_strided_batched(handle, nnz, dx_val, nnz, result_null, batch_count);
+        verify_rocsparse_status_invalid_pointer(status, "Error: result is nullptr");
+    }
+
+    // testing for (stride < 0)
+    {
+        status = rocsparse_nrm2i_strided_batched(handle, nnz, dx_val, -1, &result, batch_count);
+        verify_rocsparse_status_invalid_size(status, "Error: stride_x is invalid");
+    }
+
+    // testing for (batch_count < 0)
+    {
+        status = rocsparse_nrm2i_strided_batched(handle, nnz, dx_val, nnz, &result, -1);
+        verify_rocsparse_status_invalid_size(status, "Error: batch_count is invalid");
+    }
+
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status
+            = rocsparse_nrm2i_strided_batched(handle_null, nnz, dx_val, nnz, &result, batch_count);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_nrm2i_batched(Arguments argus)
+{
+    rocsparse_int    nnz         = argus.nnz;
+    rocsparse_int    batch_count = argus.batch_count;
+    rocsparse_int    safe_size   = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(nnz <= 0 || batch_count <= 0)
+    {
+        auto dx_val_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        T* dx_val = (T*)dx_val_managed.get();
+
+        if(!dx_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!dx_val");
+            return rocsparse_status_memory_error;
+        }
+
+        T result;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_nrm2i_strided_batched(handle, nnz, dx_val, 0, &result, batch_count);
+
+        if(nnz < 0 || batch_count < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: nnz < 0 || batch_count < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "nnz == 0 || batch_count == 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Vectors of the batch are stored consecutively
+    rocsparse_int size_x = nnz * batch_count;
+
+    // Host structures
+    std::vector<T> hx_val(size_x);
+    std::vector<T> hresult_1(batch_count);
+    std::vector<T> hresult_2(batch_count);
+    std::vector<T> hresult_gold(batch_count);
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    rocsparse_init<T>(hx_val, 1, size_x);
+
+    // allocate memory on device
+    auto dx_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dresult_2_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(T) * batch_count), device_free};
+
+    T* dx_val    = (T*)dx_val_managed.get();
+    T* dresult_2 = (T*)dresult_2_managed.get();
+
+    if(!dx_val || !dresult_2)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dx_val || !dresult_2");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_nrm2i_strided_batched(
+            handle, nnz, dx_val, nnz, hresult_1.data(), batch_count));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_nrm2i_strided_batched(handle, nnz, dx_val, nnz, dresult_2, batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(
+            hresult_2.data(), dresult_2, sizeof(T) * batch_count, hipMemcpyDeviceToHost));
+
+        // CPU
+        for(rocsparse_int b = 0; b < batch_count; ++b)
+        {
+            hresult_gold[b] = static_cast<T>(0);
+            for(rocsparse_int i = 0; i < nnz; ++i)
+            {
+                hresult_gold[b] += hx_val[b * nnz + i] * hx_val[b * nnz + i];
+            }
+
+            hresult_gold[b] = std::sqrt(hresult_gold[b]);
+        }
+
+        unit_check_near(1, batch_count, 1, hresult_gold.data(), hresult_1.data());
+        unit_check_near(1, batch_count, 1, hresult_gold.data(), hresult_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        for(rocsparse_int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_nrm2i_strided_batched(handle, nnz, dx_val, nnz, dresult_2, batch_count);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_nrm2i_strided_batched(handle, nnz, dx_val, nnz, dresult_2, batch_count);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        gpu_time_used    = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double bandwidth = (sizeof(T) * size_x) / gpu_time_used / 1e3;
+
+        printf("nnz\t\tbatch\tGB/s\tusec\n");
+        printf("%9d\t%d\t%0.2lf\t%0.2lf\n", nnz, batch_count, bandwidth, gpu_time_used);
+    }
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_NRM2I_BATCHED_HPP
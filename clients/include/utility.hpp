@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <fstream>
 #include <hip/hip_runtime_api.h>
+#include <map>
 #include <math.h>
 #include <rocsparse.h>
 #include <sstream>
@@ -239,6 +240,54 @@ rocsparse_int gen_2d_laplacian(rocsparse_int               ndim,
     return n;
 }
 
+/* ============================================================================================ */
+/*! \brief  Generate block diagonal matrix with tridiagonal blocks of size block_dim in CSR
+ *  format. Its triangular parts have at most block_dim levels, each of width m / block_dim */
+template <typename T>
+rocsparse_int gen_block_tridiagonal(rocsparse_int               m,
+                                    rocsparse_int               block_dim,
+                                    std::vector<rocsparse_int>& rowptr,
+                                    std::vector<rocsparse_int>& col,
+                                    std::vector<T>&             val,
+                                    rocsparse_index_base        idx_base)
+{
+    rowptr.resize(m + 1);
+    col.resize(m * 3);
+    val.resize(m * 3);
+
+    rocsparse_int nnz = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rowptr[i] = nnz + idx_base;
+
+        // if not first row of the block, connect with left neighbor
+        if(i % block_dim != 0)
+        {
+            col[nnz] = i - 1 + idx_base;
+            val[nnz] = static_cast<T>(-1);
+            ++nnz;
+        }
+        // element itself
+        col[nnz] = i + idx_base;
+        val[nnz] = static_cast<T>(4);
+        ++nnz;
+        // if not last row of the block, connect with right neighbor
+        if(i % block_dim != block_dim - 1 && i != m - 1)
+        {
+            col[nnz] = i + 1 + idx_base;
+            val[nnz] = static_cast<T>(-1);
+            ++nnz;
+        }
+    }
+    rowptr[m] = nnz + idx_base;
+
+    col.resize(nnz);
+    val.resize(nnz);
+
+    return nnz;
+}
+
 /* ============================================================================================ */
 /*! \brief  Generate a random sparse matrix in COO format */
 template <typename T>
@@ -674,14 +723,19 @@ rocsparse_int read_rocalution_matrix(const char*                 filename,
 
 /* ============================================================================================ */
 /*! \brief  Compute incomplete LU factorization without fill-ins and no pivoting using CSR
- *  matrix storage format.
+ *  matrix storage format. If boost is set, pivots with magnitude less or equal to boost_tol
+ *  are replaced by boost_val and counted in boost_count.
  */
 template <typename T>
 rocsparse_int csrilu0(rocsparse_int        m,
                       const rocsparse_int* ptr,
                       const rocsparse_int* col,
                       T*                   val,
-                      rocsparse_index_base idx_base)
+                      rocsparse_index_base idx_base,
+                      bool                 boost       = false,
+                      T                    boost_tol   = static_cast<T>(0),
+                      T                    boost_val   = static_cast<T>(0),
+                      rocsparse_int*       boost_count = nullptr)
 {
     // pointer of upper part of each row
     std::vector<rocsparse_int> diag_offset(m);
@@ -755,6 +809,13 @@ rocsparse_int csrilu0(rocsparse_int        m,
         // set diagonal pointer to diagonal element
         diag_offset[ai] = j;
 
+        // boost tiny pivot
+        if(boost && std::abs(val[j]) <= boost_tol)
+        {
+            val[j] = boost_val;
+            ++*boost_count;
+        }
+
         // clear nnz entries
         for(j = row_start; j < row_end; ++j)
         {
@@ -765,6 +826,666 @@ rocsparse_int csrilu0(rocsparse_int        m,
     return -1;
 }
 
+/* ============================================================================================ */
+/*! \brief  Serial reference of the CSR-Adaptive row blocks, that are gathered by
+ *  rocsparse_csrmv_analysis(). Each entry holds the first row of a row block in its upper
+ *  32 bits and the number of threads per row or the workgroup id in its lower bits. The
+ *  last entry terminates the last row block.
+ */
+inline void host_csrmv_row_blocks(rocsparse_int                    m,
+                                  const rocsparse_int*             ptr,
+                                  std::vector<unsigned long long>& row_blocks)
+{
+    const unsigned long long block_size       = 1024;
+    const unsigned long long block_multiplier = 3;
+    const unsigned long long rows_for_vector  = 1;
+    const unsigned long long wg_bits          = 24;
+    const unsigned long long row_bits         = 32;
+    const unsigned long long wg_size          = 256;
+
+    // Number of threads that reduce each row of a row block with num_rows rows
+    auto threads_for_reduction = [&](unsigned long long num_rows) {
+        unsigned long long threads = wg_size;
+        for(unsigned long long r = 1; r < num_rows; r *= 2)
+        {
+            threads /= 2;
+        }
+        return threads;
+    };
+
+    // Closes the current row block at row, reduced by threads if it holds more rows
+    // than rows_for_vector
+    auto close_block = [&](unsigned long long row, unsigned long long rows) {
+        if(rows > rows_for_vector)
+        {
+            row_blocks.back() |= threads_for_reduction(rows);
+        }
+        row_blocks.push_back(row << (64 - row_bits));
+    };
+
+    row_blocks.assign(1, 0);
+
+    unsigned long long sum    = 0;
+    unsigned long long last_i = 0;
+    unsigned long long i;
+
+    rocsparse_int consecutive_long_rows = 0;
+
+    for(i = 1; i <= static_cast<unsigned long long>(m); ++i)
+    {
+        rocsparse_int row_length = ptr[i] - ptr[i - 1];
+        sum += row_length;
+
+        // Do not mix short and long rows in a row block
+        if(row_length > 128)
+        {
+            ++consecutive_long_rows;
+        }
+        else if(consecutive_long_rows > 0)
+        {
+            consecutive_long_rows = (row_length < 32) ? -1 : consecutive_long_rows + 1;
+        }
+
+        // Cut off the short rows before a long row
+        if(consecutive_long_rows == 1)
+        {
+            if(i - last_i > 1)
+            {
+                close_block(i - 1, i - 1 - last_i);
+
+                last_i = i - 1;
+                sum    = row_length;
+            }
+        }
+        // Cut off the long rows before a short row
+        else if(consecutive_long_rows == -1)
+        {
+            close_block(i - 1, i - 1 - last_i);
+
+            last_i                = i - 1;
+            sum                   = row_length;
+            consecutive_long_rows = 0;
+        }
+
+        if(i - last_i == 1 && sum > block_size)
+        {
+            // A single long row is split across multiple workgroups
+            unsigned long long num_wg
+                = std::min((row_length - 1) / (block_multiplier * block_size) + 1,
+                           1ULL << wg_bits);
+
+            for(unsigned long long w = 1; w < num_wg; ++w)
+            {
+                row_blocks.push_back(((i - 1) << (64 - row_bits)) | w);
+            }
+
+            row_blocks.push_back(i << (64 - row_bits));
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        else if(i - last_i > 1 && sum > block_size)
+        {
+            // This row does not fit, back off one
+            --i;
+
+            close_block(i, i - last_i);
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        else if(sum == block_size)
+        {
+            close_block(i, i - last_i);
+
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+    }
+
+    // Close the last row block, if it has not been closed by the last row. The number
+    // of rows counts one past the last row, as in the original CSR-Adaptive analysis.
+    if((row_blocks.back() >> (64 - row_bits)) != static_cast<unsigned long long>(m))
+    {
+        if(m - last_i > rows_for_vector)
+        {
+            row_blocks.back() |= threads_for_reduction(i - last_i);
+        }
+        row_blocks.push_back(static_cast<unsigned long long>(m) << (64 - row_bits));
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute the number of fixed-point sweeps, after which the iterative incomplete LU
+ *  factorization without fill-ins is exact. This is the depth of the dependency graph of the
+ *  entries of L and U, where all entries of A are taken as initial guess.
+ */
+inline rocsparse_int csrilu0_iter_depth(rocsparse_int        m,
+                                        const rocsparse_int* ptr,
+                                        const rocsparse_int* col,
+                                        rocsparse_index_base idx_base)
+{
+    std::vector<rocsparse_int> level(ptr[m] - idx_base, 0);
+    std::vector<rocsparse_int> diag_offset(m, -1);
+
+    rocsparse_int depth = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_start = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        for(rocsparse_int j = row_start; j < row_end; ++j)
+        {
+            rocsparse_int col_j = col[j] - idx_base;
+            rocsparse_int lev   = -1;
+
+            // Dependencies on entries of L of row i and entries of U of column col_j
+            for(rocsparse_int k = row_start; k < row_end && col[k] - idx_base < std::min(i, col_j);
+                ++k)
+            {
+                rocsparse_int col_k = col[k] - idx_base;
+
+                const rocsparse_int* begin = col + ptr[col_k] - idx_base;
+                const rocsparse_int* end   = col + ptr[col_k + 1] - idx_base;
+                const rocsparse_int* pos   = std::lower_bound(begin, end, col[j]);
+
+                if(pos != end && *pos == col[j])
+                {
+                    lev = std::max(lev, std::max(level[k], level[pos - col]));
+                }
+            }
+
+            // Entries of L depend on the diagonal entry of U
+            if(col_j < i && diag_offset[col_j] != -1)
+            {
+                lev = std::max(lev, level[diag_offset[col_j]]);
+            }
+
+            if(col_j == i)
+            {
+                diag_offset[i] = j;
+            }
+
+            level[j] = lev + 1;
+            depth    = std::max(depth, level[j]);
+        }
+    }
+
+    return depth;
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute the residual norm ||A - LU||_F of an incomplete LU factorization without
+ *  fill-ins, restricted to the sparsity pattern of A.
+ */
+template <typename T>
+T csrilu0_iter_residual(rocsparse_int        m,
+                        const rocsparse_int* ptr,
+                        const rocsparse_int* col,
+                        const T*             val,
+                        const T*             ilu0_val,
+                        rocsparse_index_base idx_base)
+{
+    std::vector<rocsparse_int> diag_offset(m, -1);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            if(col[j] - idx_base == i)
+            {
+                diag_offset[i] = j;
+            }
+        }
+    }
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_start = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        for(rocsparse_int j = row_start; j < row_end; ++j)
+        {
+            rocsparse_int col_j = col[j] - idx_base;
+
+            // Entry of LU, where L has unit diagonal
+            T lu = ilu0_val[j];
+
+            if(col_j < i)
+            {
+                lu *= (diag_offset[col_j] == -1) ? static_cast<T>(0) : ilu0_val[diag_offset[col_j]];
+            }
+
+            for(rocsparse_int k = row_start; k < row_end && col[k] - idx_base < std::min(i, col_j);
+                ++k)
+            {
+                rocsparse_int col_k = col[k] - idx_base;
+
+                const rocsparse_int* begin = col + ptr[col_k] - idx_base;
+                const rocsparse_int* end   = col + ptr[col_k + 1] - idx_base;
+                const rocsparse_int* pos   = std::lower_bound(begin, end, col[j]);
+
+                if(pos != end && *pos == col[j])
+                {
+                    lu = std::fma(ilu0_val[k], ilu0_val[pos - col], lu);
+                }
+            }
+
+            sum = std::fma(val[j] - lu, val[j] - lu, sum);
+        }
+    }
+
+    return std::sqrt(sum);
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute incomplete LU factorization with level of fill k and no pivoting using
+ *  CSR matrix storage format. The sparsity pattern of the factorized matrix is returned in
+ *  lu_ptr and lu_col, its values in lu_val.
+ */
+template <typename T>
+rocsparse_int csriluk(rocsparse_int               m,
+                      const rocsparse_int*        ptr,
+                      const rocsparse_int*        col,
+                      const T*                    val,
+                      rocsparse_int               fill_level,
+                      rocsparse_index_base        idx_base,
+                      std::vector<rocsparse_int>& lu_ptr,
+                      std::vector<rocsparse_int>& lu_col,
+                      std::vector<T>&             lu_val)
+{
+    // level of fill of each entry of the factorized matrix
+    std::vector<rocsparse_int> lu_lev;
+
+    lu_ptr.resize(m + 1);
+    lu_ptr[0] = idx_base;
+
+    lu_col.clear();
+    lu_val.clear();
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        // column index and level of fill of each entry of row i
+        std::map<rocsparse_int, rocsparse_int> row;
+
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            row[col[j] - idx_base] = 0;
+        }
+
+        // eliminate the lower part, entries inserted behind k are visited later on
+        for(auto it = row.begin(); it != row.end() && it->first < i; ++it)
+        {
+            rocsparse_int k = it->first;
+
+            for(rocsparse_int j = lu_ptr[k] - idx_base; j < lu_ptr[k + 1] - idx_base; ++j)
+            {
+                rocsparse_int col_j = lu_col[j] - idx_base;
+
+                if(col_j <= k)
+                {
+                    continue;
+                }
+
+                rocsparse_int lev = it->second + lu_lev[j] + 1;
+
+                if(lev > fill_level)
+                {
+                    continue;
+                }
+
+                auto entry = row.find(col_j);
+
+                if(entry == row.end())
+                {
+                    row[col_j] = lev;
+                }
+                else
+                {
+                    entry->second = std::min(entry->second, lev);
+                }
+            }
+        }
+
+        for(auto it = row.begin(); it != row.end(); ++it)
+        {
+            lu_col.push_back(it->first + idx_base);
+            lu_lev.push_back(it->second);
+        }
+
+        lu_ptr[i + 1] = lu_col.size() + idx_base;
+    }
+
+    // scatter the values of A into the factorized sparsity pattern
+    lu_val.resize(lu_col.size(), static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int k = lu_ptr[i] - idx_base;
+
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            while(lu_col[k] != col[j])
+            {
+                ++k;
+            }
+
+            lu_val[k] = val[j];
+        }
+    }
+
+    return csrilu0(m, lu_ptr.data(), lu_col.data(), lu_val.data(), idx_base);
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute incomplete Cholesky factorization without fill-ins and no pivoting using
+ *  CSR matrix storage format. Only the lower triangular part is referenced and overwritten.
+ */
+template <typename T>
+rocsparse_int csric0(rocsparse_int        m,
+                     const rocsparse_int* ptr,
+                     const rocsparse_int* col,
+                     T*                   val,
+                     rocsparse_index_base idx_base)
+{
+    // pointer of diagonal entry of each row
+    std::vector<rocsparse_int> diag_offset(m, -1);
+    std::vector<rocsparse_int> nnz_entries(m, -1);
+
+    for(rocsparse_int ai = 0; ai < m; ++ai)
+    {
+        // ai-th row entries
+        rocsparse_int row_start = ptr[ai] - idx_base;
+        rocsparse_int row_end   = ptr[ai + 1] - idx_base;
+        rocsparse_int j;
+
+        // nnz position of the lower part of ai-th row in val array
+        for(j = row_start; j < row_end && col[j] - idx_base <= ai; ++j)
+        {
+            nnz_entries[col[j] - idx_base] = j;
+        }
+
+        if(nnz_entries[ai] == -1)
+        {
+            // Structural zero diagonal
+            return ai + idx_base;
+        }
+
+        T row_sum = static_cast<T>(0);
+
+        // loop over strictly lower nnz entries of ai-th row
+        for(j = row_start; j < nnz_entries[ai]; ++j)
+        {
+            rocsparse_int col_j  = col[j] - idx_base;
+            rocsparse_int diag_j = diag_offset[col_j];
+
+            if(val[diag_j] == static_cast<T>(0))
+            {
+                // Numerical zero diagonal
+                return col_j + idx_base;
+            }
+
+            // inner product of ai-th row and col_j-th row left of col_j
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int k = ptr[col_j] - idx_base; k < diag_j; ++k)
+            {
+                rocsparse_int idx = nnz_entries[col[k] - idx_base];
+
+                if(idx != -1)
+                {
+                    sum = std::fma(val[idx], val[k], sum);
+                }
+            }
+
+            val[j]  = (val[j] - sum) / val[diag_j];
+            row_sum = std::fma(val[j], val[j], row_sum);
+        }
+
+        T diag = val[j] - row_sum;
+
+        if(diag <= static_cast<T>(0))
+        {
+            // Matrix is not positive definite
+            return ai + idx_base;
+        }
+
+        val[j] = std::sqrt(diag);
+
+        // set diagonal pointer to diagonal element
+        diag_offset[ai] = j;
+
+        // clear nnz entries
+        for(j = row_start; j <= diag_offset[ai]; ++j)
+        {
+            nnz_entries[col[j] - idx_base] = -1;
+        }
+    }
+
+    return -1;
+}
+
+/* ============================================================================================ */
+/*! \brief  Damped point, l1 or block Jacobi smoother using CSR storage format. The trailing
+ *  diagonal block is padded with the identity. Rows with zero scaling and rows of singular
+ *  blocks are not updated.
+ */
+template <typename T>
+void csrjacobi(rocsparse_jacobi_type type,
+               rocsparse_int         m,
+               const rocsparse_int*  ptr,
+               const rocsparse_int*  col,
+               const T*              val,
+               rocsparse_int         block_dim,
+               T                     omega,
+               const T*              b,
+               T*                    x,
+               rocsparse_int         sweeps,
+               rocsparse_index_base  idx_base)
+{
+    rocsparse_int bd = (type == rocsparse_jacobi_type_block) ? block_dim : 1;
+    rocsparse_int nb = (m - 1) / bd + 1;
+
+    // Inverse diagonal blocks in row major order
+    std::vector<T> inv(nb * bd * bd, static_cast<T>(0));
+
+    for(rocsparse_int blk = 0; blk < nb; ++blk)
+    {
+        rocsparse_int offset = blk * bd;
+
+        std::vector<T> a(bd * bd, static_cast<T>(0));
+        std::vector<T> c(bd * bd, static_cast<T>(0));
+
+        for(rocsparse_int i = 0; i < bd; ++i)
+        {
+            c[i * bd + i] = static_cast<T>(1);
+
+            rocsparse_int row = offset + i;
+
+            if(row >= m)
+            {
+                a[i * bd + i] = static_cast<T>(1);
+                continue;
+            }
+
+            for(rocsparse_int j = ptr[row] - idx_base; j < ptr[row + 1] - idx_base; ++j)
+            {
+                if(type == rocsparse_jacobi_type_l1)
+                {
+                    a[0] += std::abs(val[j]);
+                    continue;
+                }
+
+                rocsparse_int k = col[j] - idx_base - offset;
+
+                if(k >= 0 && k < bd)
+                {
+                    a[i * bd + k] += val[j];
+                }
+            }
+        }
+
+        bool singular = false;
+
+        // Gauss-Jordan elimination with partial pivoting
+        for(rocsparse_int k = 0; k < bd && !singular; ++k)
+        {
+            rocsparse_int p = k;
+
+            for(rocsparse_int i = k + 1; i < bd; ++i)
+            {
+                if(std::abs(a[i * bd + k]) > std::abs(a[p * bd + k]))
+                {
+                    p = i;
+                }
+            }
+
+            if(a[p * bd + k] == static_cast<T>(0))
+            {
+                singular = true;
+                break;
+            }
+
+            for(rocsparse_int l = 0; l < bd; ++l)
+            {
+                std::swap(a[k * bd + l], a[p * bd + l]);
+                std::swap(c[k * bd + l], c[p * bd + l]);
+            }
+
+            T scale = static_cast<T>(1) / a[k * bd + k];
+
+            for(rocsparse_int l = 0; l < bd; ++l)
+            {
+                a[k * bd + l] *= scale;
+                c[k * bd + l] *= scale;
+            }
+
+            for(rocsparse_int i = 0; i < bd; ++i)
+            {
+                if(i == k)
+                {
+                    continue;
+                }
+
+                T factor = a[i * bd + k];
+
+                for(rocsparse_int l = 0; l < bd; ++l)
+                {
+                    a[i * bd + l] = std::fma(-factor, a[k * bd + l], a[i * bd + l]);
+                    c[i * bd + l] = std::fma(-factor, c[k * bd + l], c[i * bd + l]);
+                }
+            }
+        }
+
+        if(!singular)
+        {
+            for(rocsparse_int i = 0; i < bd * bd; ++i)
+            {
+                inv[offset * bd + i] = c[i];
+            }
+        }
+    }
+
+    std::vector<T> res(m);
+
+    for(rocsparse_int iter = 0; iter < sweeps; ++iter)
+    {
+        // Residual
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+            {
+                sum = std::fma(val[j], x[col[j] - idx_base], sum);
+            }
+
+            res[i] = b[i] - sum;
+        }
+
+        // Update
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            rocsparse_int offset = (i / bd) * bd;
+
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int k = 0; k < bd && offset + k < m; ++k)
+            {
+                sum = std::fma(inv[i * bd + k], res[offset + k], sum);
+            }
+
+            x[i] = std::fma(omega, sum, x[i]);
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Chebyshev polynomial preconditioner z = p(A) * r using CSR storage format, where
+ *  p(A) is obtained by degree steps of the Chebyshev iteration with zero initial guess.
+ */
+template <typename T>
+void csrcheby(rocsparse_int        m,
+              const rocsparse_int* ptr,
+              const rocsparse_int* col,
+              const T*             val,
+              rocsparse_int        degree,
+              T                    lambda_min,
+              T                    lambda_max,
+              const T*             r,
+              T*                   z,
+              rocsparse_index_base idx_base)
+{
+    T theta = (lambda_max + lambda_min) / static_cast<T>(2);
+    T delta = (lambda_max - lambda_min) / static_cast<T>(2);
+    T sigma = theta / delta;
+    T rho   = static_cast<T>(1) / sigma;
+
+    std::vector<T> d(m);
+    std::vector<T> res(m);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        d[i] = r[i] / theta;
+        z[i] = d[i];
+    }
+
+    for(rocsparse_int k = 1; k < degree; ++k)
+    {
+        T rho_next = static_cast<T>(1) / (static_cast<T>(2) * sigma - rho);
+        T c1       = rho_next * rho;
+        T c2       = static_cast<T>(2) * rho_next / delta;
+
+        rho = rho_next;
+
+        // Residual
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+            {
+                sum = std::fma(val[j], z[col[j] - idx_base], sum);
+            }
+
+            res[i] = r[i] - sum;
+        }
+
+        // Update
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            d[i] = std::fma(c1, d[i], c2 * res[i]);
+            z[i] += d[i];
+        }
+    }
+}
+
 /* ============================================================================================ */
 /*! \brief  Sparse triangular lower solve using CSR storage format. */
 template <typename T>
@@ -975,6 +1696,80 @@ rocsparse_int usolve(rocsparse_int        m,
     return -1;
 }
 
+/* ============================================================================================ */
+/*! \brief  Sparse triangular transposed solve using CSR storage format. */
+template <typename T>
+rocsparse_int csrsv_trans(rocsparse_int        m,
+                          const rocsparse_int* ptr,
+                          const rocsparse_int* col,
+                          const T*             val,
+                          T                    alpha,
+                          const T*             x,
+                          T*                   y,
+                          rocsparse_index_base idx_base,
+                          rocsparse_fill_mode  fill_mode,
+                          rocsparse_diag_type  diag_type)
+{
+    rocsparse_int pivot = std::numeric_limits<rocsparse_int>::max();
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        y[i] = alpha * x[i];
+    }
+
+    // The transpose of a lower triangular matrix is upper triangular and vice versa
+    for(rocsparse_int k = 0; k < m; ++k)
+    {
+        rocsparse_int i = (fill_mode == rocsparse_fill_mode_lower) ? m - 1 - k : k;
+
+        rocsparse_int row_begin = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            rocsparse_int diag = -1;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                if(col[j] - idx_base == i)
+                {
+                    diag = j;
+                    break;
+                }
+            }
+
+            if(diag == -1 || val[diag] == static_cast<T>(0))
+            {
+                // Structural or numerical zero
+                pivot = std::min(pivot, i + idx_base);
+            }
+            else
+            {
+                y[i] *= static_cast<T>(1) / val[diag];
+            }
+        }
+
+        // Scatter the contribution of row i to all rows that depend on it
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col_j = col[j] - idx_base;
+
+            if((fill_mode == rocsparse_fill_mode_lower && col_j < i)
+               || (fill_mode == rocsparse_fill_mode_upper && col_j > i))
+            {
+                y[col_j] = std::fma(-val[j], y[i], y[col_j]);
+            }
+        }
+    }
+
+    if(pivot != std::numeric_limits<rocsparse_int>::max())
+    {
+        return pivot;
+    }
+
+    return -1;
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -1034,15 +1829,18 @@ public:
     rocsparse_diag_type       diag_type = rocsparse_diag_type_non_unit;
     rocsparse_fill_mode       fill_mode = rocsparse_fill_mode_lower;
     rocsparse_analysis_policy analysis  = rocsparse_analysis_policy_reuse;
+    rocsparse_jacobi_type     jacobi    = rocsparse_jacobi_type_point;
 
     rocsparse_int norm_check = 0;
     rocsparse_int unit_check = 1;
     rocsparse_int timing     = 0;
 
-    rocsparse_int iters     = 10;
-    rocsparse_int laplacian = 0;
-    rocsparse_int ell_width = 0;
-    rocsparse_int temp      = 0;
+    rocsparse_int iters       = 10;
+    rocsparse_int laplacian   = 0;
+    rocsparse_int ell_width   = 0;
+    rocsparse_int temp        = 0;
+    rocsparse_int block_dim   = 1;
+    rocsparse_int batch_count = 1;
 
     std::string filename   = "";
     std::string rocalution = "";
@@ -1070,15 +1868,18 @@ public:
         this->diag_type = rhs.diag_type;
         this->fill_mode = rhs.fill_mode;
         this->analysis  = rhs.analysis;
+        this->jacobi    = rhs.jacobi;
 
         this->norm_check = rhs.norm_check;
         this->unit_check = rhs.unit_check;
         this->timing     = rhs.timing;
 
-        this->iters     = rhs.iters;
-        this->laplacian = rhs.laplacian;
-        this->ell_width = rhs.ell_width;
-        this->temp      = rhs.temp;
+        this->iters       = rhs.iters;
+        this->laplacian   = rhs.laplacian;
+        this->ell_width   = rhs.ell_width;
+        this->temp        = rhs.temp;
+        this->block_dim   = rhs.block_dim;
+        this->batch_count = rhs.batch_count;
 
         this->filename   = rhs.filename;
         this->rocalution = rhs.rocalution;
@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csr5mv.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef rocsparse_operation  op;
+
+typedef std::tuple<int, int, double, double, base, op, bool> csr5mv_tuple;
+
+int csr5mv_M_range[] = {-1, 0, 1, 500, 7111, 83472};
+int csr5mv_N_range[] = {-3, 0, 17, 842, 4441};
+
+std::vector<double> csr5mv_alpha_range = {2.0, 3.0};
+std::vector<double> csr5mv_beta_range  = {0.0, 1.0};
+
+base csr5mv_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+op   csr5mv_op_range[]      = {rocsparse_operation_none, rocsparse_operation_transpose};
+
+bool csr5mv_power_law[] = {false, true};
+
+class parameterized_csr5mv : public testing::TestWithParam<csr5mv_tuple>
+{
+protected:
+    parameterized_csr5mv() {}
+    virtual ~parameterized_csr5mv() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csr5mv_arguments(csr5mv_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.alpha    = std::get<2>(tup);
+    arg.beta     = std::get<3>(tup);
+    arg.idx_base = std::get<4>(tup);
+    arg.transA   = std::get<5>(tup);
+    arg.bswitch  = std::get<6>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(csr5mv_bad_arg, csr5mv_float)
+{
+    testing_csr5mv_bad_arg<float>();
+}
+
+TEST_P(parameterized_csr5mv, csr5mv_float)
+{
+    Arguments arg = setup_csr5mv_arguments(GetParam());
+
+    rocsparse_status status = testing_csr5mv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr5mv, csr5mv_double)
+{
+    Arguments arg = setup_csr5mv_arguments(GetParam());
+
+    rocsparse_status status = testing_csr5mv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csr5mv,
+                        parameterized_csr5mv,
+                        testing::Combine(testing::ValuesIn(csr5mv_M_range),
+                                         testing::ValuesIn(csr5mv_N_range),
+                                         testing::ValuesIn(csr5mv_alpha_range),
+                                         testing::ValuesIn(csr5mv_beta_range),
+                                         testing::ValuesIn(csr5mv_idxbase_range),
+                                         testing::ValuesIn(csr5mv_op_range),
+                                         testing::ValuesIn(csr5mv_power_law)));
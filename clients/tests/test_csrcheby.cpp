@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrcheby.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <string>
+#include <vector>
+
+typedef rocsparse_index_base       base;
+typedef std::tuple<int, int, base>   csrcheby_tuple;
+
+int csrcheby_M_range[] = {-1, 0, 10, 33};
+int csrcheby_K_range[] = {1, 2, 5};
+
+base csrcheby_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_csrcheby : public testing::TestWithParam<csrcheby_tuple>
+{
+protected:
+    parameterized_csrcheby() {}
+    virtual ~parameterized_csrcheby() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrcheby_arguments(csrcheby_tuple tup)
+{
+    // Positive sizes are used as dimension of a 2D laplacian, whose
+    // spectrum is enclosed by [0, 8]
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.K         = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.alpha     = 0.25;
+    arg.beta      = 8.0;
+    arg.laplacian = std::max(arg.M, 0);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csrcheby_bad_arg, csrcheby_float)
+{
+    testing_csrcheby_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrcheby, csrcheby_float)
+{
+    Arguments arg = setup_csrcheby_arguments(GetParam());
+
+    rocsparse_status status = testing_csrcheby<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrcheby, csrcheby_double)
+{
+    Arguments arg = setup_csrcheby_arguments(GetParam());
+
+    rocsparse_status status = testing_csrcheby<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrcheby,
+                        parameterized_csrcheby,
+                        testing::Combine(testing::ValuesIn(csrcheby_M_range),
+                                         testing::ValuesIn(csrcheby_K_range),
+                                         testing::ValuesIn(csrcheby_idxbase_range)));
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrilu0_iter.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+typedef rocsparse_index_base               base;
+typedef std::tuple<int, int, base>         csrilu0_iter_tuple;
+typedef std::tuple<int, base, std::string> csrilu0_iter_bin_tuple;
+
+int csrilu0_iter_M_range[] = {-1, 0, 10, 32};
+int csrilu0_iter_K_range[] = {1, 5, 100};
+
+base csrilu0_iter_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+int csrilu0_iter_K_range_bin[] = {10};
+
+std::string csrilu0_iter_bin[] = {"nos1.bin",
+                                  "nos2.bin",
+                                  "nos3.bin",
+                                  "nos4.bin",
+                                  "nos5.bin",
+                                  "nos6.bin",
+                                  "nos7.bin"};
+
+class parameterized_csrilu0_iter : public testing::TestWithParam<csrilu0_iter_tuple>
+{
+protected:
+    parameterized_csrilu0_iter() {}
+    virtual ~parameterized_csrilu0_iter() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrilu0_iter_bin : public testing::TestWithParam<csrilu0_iter_bin_tuple>
+{
+protected:
+    parameterized_csrilu0_iter_bin() {}
+    virtual ~parameterized_csrilu0_iter_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrilu0_iter_arguments(csrilu0_iter_tuple tup)
+{
+    // Positive sizes are used as dimension of a 2D laplacian
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.K         = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.laplacian = std::max(arg.M, 0);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_csrilu0_iter_arguments(csrilu0_iter_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.K        = std::get<0>(tup);
+    arg.idx_base = std::get<1>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<2>(tup);
+
+    // Get current executables absolute path
+    char    path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "../matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrilu0_iter_bad_arg, csrilu0_iter_float)
+{
+    testing_csrilu0_iter_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrilu0_iter, csrilu0_iter_float)
+{
+    Arguments arg = setup_csrilu0_iter_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_iter<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0_iter, csrilu0_iter_double)
+{
+    Arguments arg = setup_csrilu0_iter_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_iter<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0_iter_bin, csrilu0_iter_bin_float)
+{
+    Arguments arg = setup_csrilu0_iter_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_iter<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0_iter_bin, csrilu0_iter_bin_double)
+{
+    Arguments arg = setup_csrilu0_iter_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_iter<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrilu0_iter,
+                        parameterized_csrilu0_iter,
+                        testing::Combine(testing::ValuesIn(csrilu0_iter_M_range),
+                                         testing::ValuesIn(csrilu0_iter_K_range),
+                                         testing::ValuesIn(csrilu0_iter_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(csrilu0_iter_bin,
+                        parameterized_csrilu0_iter_bin,
+                        testing::Combine(testing::ValuesIn(csrilu0_iter_K_range_bin),
+                                         testing::ValuesIn(csrilu0_iter_idxbase_range),
+                                         testing::ValuesIn(csrilu0_iter_bin)));
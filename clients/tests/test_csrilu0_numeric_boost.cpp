@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrilu0_numeric_boost.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <vector>
+
+typedef rocsparse_index_base          base;
+typedef std::tuple<int, double, base> csrilu0_numeric_boost_tuple;
+
+int    csrilu0_numeric_boost_M_range[]   = {-1, 0, 10, 32};
+double csrilu0_numeric_boost_tol_range[] = {0.0, 3.8, 10.0};
+
+base csrilu0_numeric_boost_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_csrilu0_numeric_boost
+    : public testing::TestWithParam<csrilu0_numeric_boost_tuple>
+{
+protected:
+    parameterized_csrilu0_numeric_boost() {}
+    virtual ~parameterized_csrilu0_numeric_boost() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrilu0_numeric_boost_arguments(csrilu0_numeric_boost_tuple tup)
+{
+    // Positive sizes are used as dimension of a 2D laplacian, where pivots are
+    // replaced by the initial diagonal value
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.alpha     = std::get<1>(tup);
+    arg.beta      = 4.0;
+    arg.idx_base  = std::get<2>(tup);
+    arg.laplacian = std::max(arg.M, 0);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csrilu0_numeric_boost_bad_arg, csrilu0_numeric_boost_float)
+{
+    testing_csrilu0_numeric_boost_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrilu0_numeric_boost, csrilu0_numeric_boost_float)
+{
+    Arguments arg = setup_csrilu0_numeric_boost_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_numeric_boost<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0_numeric_boost, csrilu0_numeric_boost_double)
+{
+    Arguments arg = setup_csrilu0_numeric_boost_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_numeric_boost<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrilu0_numeric_boost,
+                        parameterized_csrilu0_numeric_boost,
+                        testing::Combine(testing::ValuesIn(csrilu0_numeric_boost_M_range),
+                                         testing::ValuesIn(csrilu0_numeric_boost_tol_range),
+                                         testing::ValuesIn(csrilu0_numeric_boost_idxbase_range)));
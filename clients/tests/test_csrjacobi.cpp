@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrjacobi.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+typedef rocsparse_index_base                       base;
+typedef rocsparse_jacobi_type                      jacobi;
+typedef std::tuple<int, int, jacobi, int, base>    csrjacobi_tuple;
+typedef std::tuple<jacobi, int, base, std::string> csrjacobi_bin_tuple;
+
+int csrjacobi_M_range[] = {-1, 0, 10, 33};
+int csrjacobi_K_range[] = {1, 2, 5};
+
+jacobi csrjacobi_type_range[] = {rocsparse_jacobi_type_point,
+                                 rocsparse_jacobi_type_l1,
+                                 rocsparse_jacobi_type_block};
+
+int csrjacobi_blockdim_range[] = {1, 3, 8};
+
+base csrjacobi_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+int csrjacobi_blockdim_range_bin[] = {4};
+
+std::string csrjacobi_bin[] = {"nos1.bin",
+                               "nos2.bin",
+                               "nos3.bin",
+                               "nos4.bin",
+                               "nos5.bin",
+                               "nos6.bin",
+                               "nos7.bin"};
+
+class parameterized_csrjacobi : public testing::TestWithParam<csrjacobi_tuple>
+{
+protected:
+    parameterized_csrjacobi() {}
+    virtual ~parameterized_csrjacobi() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrjacobi_bin : public testing::TestWithParam<csrjacobi_bin_tuple>
+{
+protected:
+    parameterized_csrjacobi_bin() {}
+    virtual ~parameterized_csrjacobi_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrjacobi_arguments(csrjacobi_tuple tup)
+{
+    // Positive sizes are used as dimension of a 2D laplacian
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.K         = std::get<1>(tup);
+    arg.jacobi    = std::get<2>(tup);
+    arg.block_dim = std::get<3>(tup);
+    arg.idx_base  = std::get<4>(tup);
+    arg.alpha     = 0.8;
+    arg.laplacian = std::max(arg.M, 0);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_csrjacobi_arguments(csrjacobi_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.K         = 2;
+    arg.jacobi    = std::get<0>(tup);
+    arg.block_dim = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.alpha     = 0.8;
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<3>(tup);
+
+    // Get current executables absolute path
+    char    path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "../matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrjacobi_bad_arg, csrjacobi_float)
+{
+    testing_csrjacobi_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrjacobi, csrjacobi_float)
+{
+    Arguments arg = setup_csrjacobi_arguments(GetParam());
+
+    rocsparse_status status = testing_csrjacobi<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrjacobi, csrjacobi_double)
+{
+    Arguments arg = setup_csrjacobi_arguments(GetParam());
+
+    rocsparse_status status = testing_csrjacobi<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrjacobi_bin, csrjacobi_bin_float)
+{
+    Arguments arg = setup_csrjacobi_arguments(GetParam());
+
+    rocsparse_status status = testing_csrjacobi<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrjacobi_bin, csrjacobi_bin_double)
+{
+    Arguments arg = setup_csrjacobi_arguments(GetParam());
+
+    rocsparse_status status = testing_csrjacobi<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrjacobi,
+                        parameterized_csrjacobi,
+                        testing::Combine(testing::ValuesIn(csrjacobi_M_range),
+                                         testing::ValuesIn(csrjacobi_K_range),
+                                         testing::ValuesIn(csrjacobi_type_range),
+                                         testing::ValuesIn(csrjacobi_blockdim_range),
+                                         testing::ValuesIn(csrjacobi_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(csrjacobi_bin,
+                        parameterized_csrjacobi_bin,
+                        testing::Combine(testing::ValuesIn(csrjacobi_type_range),
+                                         testing::ValuesIn(csrjacobi_blockdim_range_bin),
+                                         testing::ValuesIn(csrjacobi_idxbase_range),
+                                         testing::ValuesIn(csrjacobi_bin)));
@@ -33,8 +33,9 @@
 typedef rocsparse_index_base                                base;
 typedef std::tuple<int, int, double, double, base, bool>    csrmv_tuple;
 typedef std::tuple<double, double, base, std::string, bool> csrmv_bin_tuple;
+typedef std::tuple<int, base>                               csrmv_row_blocks_tuple;
 
-int csr_M_range[] = {-1, 0, 500, 7111};
+int csr_M_range[] = {-1, 0, 500, 7111, 83472};
 int csr_N_range[] = {-3, 0, 842, 4441};
 
 std::vector<double> csr_alpha_range = {2.0, 3.0};
@@ -64,6 +65,9 @@ std::string csr_bin[] = {"rma10.bin",
 
 bool csr_adaptive[] = {false, true};
 
+// Irregular sparsity patterns with a single and multiple analysis chunks
+int csr_row_blocks_M_range[] = {1, 511, 4097, 20000, 100000};
+
 class parameterized_csrmv : public testing::TestWithParam<csrmv_tuple>
 {
 protected:
@@ -82,6 +86,15 @@ protected:
     virtual void TearDown() {}
 };
 
+class parameterized_csrmv_row_blocks : public testing::TestWithParam<csrmv_row_blocks_tuple>
+{
+protected:
+    parameterized_csrmv_row_blocks() {}
+    virtual ~parameterized_csrmv_row_blocks() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
 Arguments setup_csrmv_arguments(csrmv_tuple tup)
 {
     Arguments arg;
@@ -127,6 +140,15 @@ Arguments setup_csrmv_arguments(csrmv_bin_tuple tup)
     return arg;
 }
 
+Arguments setup_csrmv_arguments(csrmv_row_blocks_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.idx_base = std::get<1>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
 TEST(csrmv_bad_arg, csrmv_float)
 {
     testing_csrmv_bad_arg<float>();
@@ -164,6 +186,14 @@ TEST_P(parameterized_csrmv_bin, csrmv_bin_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrmv_row_blocks, csrmv_row_blocks_float)
+{
+    Arguments arg = setup_csrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_row_blocks<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 INSTANTIATE_TEST_CASE_P(csrmv,
                         parameterized_csrmv,
                         testing::Combine(testing::ValuesIn(csr_M_range),
@@ -180,3 +210,8 @@ INSTANTIATE_TEST_CASE_P(csrmv_bin,
                                          testing::ValuesIn(csr_idxbase_range),
                                          testing::ValuesIn(csr_bin),
                                          testing::ValuesIn(csr_adaptive)));
+
+INSTANTIATE_TEST_CASE_P(csrmv_row_blocks,
+                        parameterized_csrmv_row_blocks,
+                        testing::Combine(testing::ValuesIn(csr_row_blocks_M_range),
+                                         testing::ValuesIn(csr_idxbase_range)));
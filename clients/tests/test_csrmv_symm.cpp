@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrmv_symm.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef rocsparse_operation  op;
+typedef rocsparse_fill_mode  fill;
+
+typedef std::tuple<int, double, double, base, op, fill> csrmv_symm_tuple;
+
+int csrmv_symm_M_range[] = {-1, 0, 50, 647, 7111, 50000};
+
+std::vector<double> csrmv_symm_alpha_range = {2.0, 3.0};
+std::vector<double> csrmv_symm_beta_range  = {0.0, 1.0};
+
+base csrmv_symm_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+op   csrmv_symm_op_range[]      = {rocsparse_operation_none, rocsparse_operation_transpose};
+fill csrmv_symm_fill_range[]    = {rocsparse_fill_mode_lower, rocsparse_fill_mode_upper};
+
+class parameterized_csrmv_symm : public testing::TestWithParam<csrmv_symm_tuple>
+{
+protected:
+    parameterized_csrmv_symm() {}
+    virtual ~parameterized_csrmv_symm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmv_symm_arguments(csrmv_symm_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.alpha     = std::get<1>(tup);
+    arg.beta      = std::get<2>(tup);
+    arg.idx_base  = std::get<3>(tup);
+    arg.transA    = std::get<4>(tup);
+    arg.fill_mode = std::get<5>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csrmv_symm_bad_arg, csrmv_symm_float)
+{
+    testing_csrmv_symm_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrmv_symm, csrmv_symm_float)
+{
+    Arguments arg = setup_csrmv_symm_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_symm<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_symm, csrmv_symm_double)
+{
+    Arguments arg = setup_csrmv_symm_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_symm<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrmv_symm,
+                        parameterized_csrmv_symm,
+                        testing::Combine(testing::ValuesIn(csrmv_symm_M_range),
+                                         testing::ValuesIn(csrmv_symm_alpha_range),
+                                         testing::ValuesIn(csrmv_symm_beta_range),
+                                         testing::ValuesIn(csrmv_symm_idxbase_range),
+                                         testing::ValuesIn(csrmv_symm_op_range),
+                                         testing::ValuesIn(csrmv_symm_fill_range)));
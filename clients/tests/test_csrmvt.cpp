@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrmvt.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <vector>
+
+typedef rocsparse_index_base                             base;
+typedef std::tuple<int, int, double, double, base, bool> csrmvt_tuple;
+
+int csrmvt_M_range[] = {-1, 0, 500, 7111, 83472};
+int csrmvt_N_range[] = {-3, 0, 17, 842, 4441};
+
+std::vector<double> csrmvt_alpha_range = {2.0, 3.0};
+std::vector<double> csrmvt_beta_range  = {0.0, 1.0};
+
+base csrmvt_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+bool csrmvt_analysis[] = {false, true};
+
+class parameterized_csrmvt : public testing::TestWithParam<csrmvt_tuple>
+{
+protected:
+    parameterized_csrmvt() {}
+    virtual ~parameterized_csrmvt() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmvt_arguments(csrmvt_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.alpha    = std::get<2>(tup);
+    arg.beta     = std::get<3>(tup);
+    arg.idx_base = std::get<4>(tup);
+    arg.bswitch  = std::get<5>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(csrmvt_bad_arg, csrmvt_float)
+{
+    testing_csrmvt_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrmvt, csrmvt_float)
+{
+    Arguments arg = setup_csrmvt_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmvt<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmvt, csrmvt_double)
+{
+    Arguments arg = setup_csrmvt_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmvt<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrmvt,
+                        parameterized_csrmvt,
+                        testing::Combine(testing::ValuesIn(csrmvt_M_range),
+                                         testing::ValuesIn(csrmvt_N_range),
+                                         testing::ValuesIn(csrmvt_alpha_range),
+                                         testing::ValuesIn(csrmvt_beta_range),
+                                         testing::ValuesIn(csrmvt_idxbase_range),
+                                         testing::ValuesIn(csrmvt_analysis)));
@@ -36,14 +36,19 @@ typedef rocsparse_diag_type  diag;
 typedef rocsparse_fill_mode  fill;
 
 typedef std::tuple<int, double, base, op, diag, fill>         csrsv_tuple;
+typedef std::tuple<int, int, base, op, fill>                  csrsv_block_tuple;
 typedef std::tuple<double, base, op, diag, fill, std::string> csrsv_bin_tuple;
 
 int csrsv_M_range[] = {-1, 0, 50, 647};
 
+// Wide and shallow block tridiagonal matrices, to exercise level scheduling
+int csrsv_block_M_range[]   = {50000};
+int csrsv_block_dim_range[] = {8, 32};
+
 double csrsv_alpha_range[] = {1.0, 2.3, -3.7};
 
 base csrsv_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
-op   csrsv_op_range[]      = {rocsparse_operation_none};
+op   csrsv_op_range[]      = {rocsparse_operation_none, rocsparse_operation_transpose};
 diag csrsv_diag_range[]    = {rocsparse_diag_type_non_unit};
 fill csrsv_fill_range[]    = {rocsparse_fill_mode_lower, rocsparse_fill_mode_upper};
 
@@ -71,6 +76,15 @@ protected:
     virtual void TearDown() {}
 };
 
+class parameterized_csrsv_block : public testing::TestWithParam<csrsv_block_tuple>
+{
+protected:
+    parameterized_csrsv_block() {}
+    virtual ~parameterized_csrsv_block() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
 class parameterized_csrsv_bin : public testing::TestWithParam<csrsv_bin_tuple>
 {
 protected:
@@ -93,6 +107,20 @@ Arguments setup_csrsv_arguments(csrsv_tuple tup)
     return arg;
 }
 
+Arguments setup_csrsv_arguments(csrsv_block_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.block_dim = std::get<1>(tup);
+    arg.alpha     = 1.0;
+    arg.idx_base  = std::get<2>(tup);
+    arg.transA    = std::get<3>(tup);
+    arg.diag_type = rocsparse_diag_type_non_unit;
+    arg.fill_mode = std::get<4>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
 Arguments setup_csrsv_arguments(csrsv_bin_tuple tup)
 {
     Arguments arg;
@@ -146,6 +174,22 @@ TEST_P(parameterized_csrsv, csrsv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrsv_block, csrsv_block_float)
+{
+    Arguments arg = setup_csrsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrsv_block, csrsv_block_double)
+{
+    Arguments arg = setup_csrsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csrsv_bin, csrsv_bin_float)
 {
     Arguments arg = setup_csrsv_arguments(GetParam());
@@ -171,6 +215,14 @@ INSTANTIATE_TEST_CASE_P(csrsv,
                                          testing::ValuesIn(csrsv_diag_range),
                                          testing::ValuesIn(csrsv_fill_range)));
 
+INSTANTIATE_TEST_CASE_P(csrsv_block,
+                        parameterized_csrsv_block,
+                        testing::Combine(testing::ValuesIn(csrsv_block_M_range),
+                                         testing::ValuesIn(csrsv_block_dim_range),
+                                         testing::ValuesIn(csrsv_idxbase_range),
+                                         testing::ValuesIn(csrsv_op_range),
+                                         testing::ValuesIn(csrsv_fill_range)));
+
 INSTANTIATE_TEST_CASE_P(csrsv_bin,
                         parameterized_csrsv_bin,
                         testing::Combine(testing::ValuesIn(csrsv_alpha_range),
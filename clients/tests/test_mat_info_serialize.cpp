@@ -0,0 +1,80 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_mat_info_serialize.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <vector>
+
+typedef rocsparse_index_base  base;
+typedef std::tuple<int, base> mat_info_serialize_tuple;
+
+int mat_info_serialize_dim_range[] = {-1, 0, 5, 37, 150};
+
+base mat_info_serialize_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_mat_info_serialize : public testing::TestWithParam<mat_info_serialize_tuple>
+{
+protected:
+    parameterized_mat_info_serialize() {}
+    virtual ~parameterized_mat_info_serialize() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_mat_info_serialize_arguments(mat_info_serialize_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.idx_base = std::get<1>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(mat_info_serialize_bad_arg, mat_info_serialize)
+{
+    testing_mat_info_serialize_bad_arg();
+}
+
+TEST_P(parameterized_mat_info_serialize, mat_info_serialize_float)
+{
+    Arguments arg = setup_mat_info_serialize_arguments(GetParam());
+
+    rocsparse_status status = testing_mat_info_serialize<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_mat_info_serialize, mat_info_serialize_double)
+{
+    Arguments arg = setup_mat_info_serialize_arguments(GetParam());
+
+    rocsparse_status status = testing_mat_info_serialize<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(mat_info_serialize,
+                        parameterized_mat_info_serialize,
+                        testing::Combine(testing::ValuesIn(mat_info_serialize_dim_range),
+                                         testing::ValuesIn(mat_info_serialize_idxbase_range)));
@@ -0,0 +1,78 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_nrm2i_batched.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <vector>
+
+typedef std::tuple<int, int> nrm2i_batched_tuple;
+
+int nrm2i_batched_nnz_range[]   = {-1, 0, 5, 50, 500};
+int nrm2i_batched_batch_range[] = {-1, 0, 1, 100};
+
+class parameterized_nrm2i_batched : public testing::TestWithParam<nrm2i_batched_tuple>
+{
+protected:
+    parameterized_nrm2i_batched() {}
+    virtual ~parameterized_nrm2i_batched() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_nrm2i_batched_arguments(nrm2i_batched_tuple tup)
+{
+    Arguments arg;
+    arg.nnz         = std::get<0>(tup);
+    arg.batch_count = std::get<1>(tup);
+    arg.timing      = 0;
+    return arg;
+}
+
+TEST(nrm2i_batched_bad_arg, nrm2i_batched_float)
+{
+    testing_nrm2i_batched_bad_arg<float>();
+}
+
+TEST_P(parameterized_nrm2i_batched, nrm2i_batched_float)
+{
+    Arguments arg = setup_nrm2i_batched_arguments(GetParam());
+
+    rocsparse_status status = testing_nrm2i_batched<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_nrm2i_batched, nrm2i_batched_double)
+{
+    Arguments arg = setup_nrm2i_batched_arguments(GetParam());
+
+    rocsparse_status status = testing_nrm2i_batched<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(nrm2i_batched,
+                        parameterized_nrm2i_batched,
+                        testing::Combine(testing::ValuesIn(nrm2i_batched_nnz_range),
+                                         testing::ValuesIn(nrm2i_batched_batch_range)));
@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_roti_multi.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <vector>
+
+typedef rocsparse_index_base            base;
+typedef std::tuple<int, int, int, base> roti_multi_tuple;
+
+int roti_multi_N_range[]    = {12000, 15332};
+int roti_multi_nnz_range[]  = {-1, 0, 5, 500, 7111};
+int roti_multi_nrot_range[] = {-1, 0, 1, 37, 600};
+
+base roti_multi_idx_base_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_roti_multi : public testing::TestWithParam<roti_multi_tuple>
+{
+protected:
+    parameterized_roti_multi() {}
+    virtual ~parameterized_roti_multi() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_roti_multi_arguments(roti_multi_tuple tup)
+{
+    Arguments arg;
+    arg.N        = std::get<0>(tup);
+    arg.nnz      = std::get<1>(tup);
+    arg.K        = std::get<2>(tup);
+    arg.idx_base = std::get<3>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(roti_multi_bad_arg, roti_multi_float)
+{
+    testing_roti_multi_bad_arg<float>();
+}
+
+TEST_P(parameterized_roti_multi, roti_multi_float)
+{
+    Arguments arg = setup_roti_multi_arguments(GetParam());
+
+    rocsparse_status status = testing_roti_multi<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_roti_multi, roti_multi_double)
+{
+    Arguments arg = setup_roti_multi_arguments(GetParam());
+
+    rocsparse_status status = testing_roti_multi<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(roti_multi,
+                        parameterized_roti_multi,
+                        testing::Combine(testing::ValuesIn(roti_multi_N_range),
+                                         testing::ValuesIn(roti_multi_nnz_range),
+                                         testing::ValuesIn(roti_multi_nrot_range),
+                                         testing::ValuesIn(roti_multi_idx_base_range)));
@@ -173,6 +173,201 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle        handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify analysis mode
+ *
+ *  \details
+ *  \p rocsparse_set_analysis_mode specifies the analysis mode to be used by the
+ *  rocSPARSE library context and all subsequent function calls. By default, analysis
+ *  meta data is computed on the host. Valid analysis modes are
+ *  \ref rocsparse_analysis_mode_host or \ref rocsparse_analysis_mode_device.
+ *
+ *  \note
+ *  Currently, only rocsparse_scsrmv_analysis() and rocsparse_dcsrmv_analysis() are
+ *  affected by the analysis mode.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  analysis_mode   the analysis mode to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p analysis_mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_analysis_mode(rocsparse_handle        handle,
+                                             rocsparse_analysis_mode analysis_mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current analysis mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_analysis_mode gets the rocSPARSE library context analysis mode
+ *  which is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  analysis_mode   the analysis mode that is currently used by the rocSPARSE library
+ *                  context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p analysis_mode pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_analysis_mode(rocsparse_handle         handle,
+                                             rocsparse_analysis_mode* analysis_mode);
+
+/*! \ingroup aux_module
+ *  \brief Specify analysis policy
+ *
+ *  \details
+ *  \p rocsparse_set_analysis_policy specifies the analysis policy to be used by all
+ *  subsequent calls to analysis functions that do not take a
+ *  \ref rocsparse_analysis_policy argument. By default, meta data is always re-built
+ *  (\ref rocsparse_analysis_policy_force). With \ref rocsparse_analysis_policy_reuse,
+ *  meta data is re-used for matrices with the same sparsity pattern, which is
+ *  identified by a structural hash of the sparse matrix. Computing the hash requires
+ *  a host synchronization. As different sparsity patterns may share the same hash,
+ *  re-use is a probabilistic match, see \ref rocsparse_analysis_policy.
+ *
+ *  \note
+ *  Currently, only rocsparse_scsrmv_analysis(), rocsparse_dcsrmv_analysis() and
+ *  rocsparse_csriluk_symbolic() are affected by the analysis policy.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  policy          the analysis policy to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p policy is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_analysis_policy(rocsparse_handle          handle,
+                                               rocsparse_analysis_policy policy);
+
+/*! \ingroup aux_module
+ *  \brief Get current analysis policy from library context
+ *
+ *  \details
+ *  \p rocsparse_get_analysis_policy gets the rocSPARSE library context analysis policy
+ *  which is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  policy          the analysis policy that is currently used by the rocSPARSE library
+ *                  context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p policy pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_analysis_policy(rocsparse_handle           handle,
+                                               rocsparse_analysis_policy* policy);
+
+/*! \ingroup aux_module
+ *  \brief Specify result mode
+ *
+ *  \details
+ *  \p rocsparse_set_result_mode specifies whether reductions return their result
+ *  asynchronously in \ref rocsparse_pointer_mode_host, for all subsequent function
+ *  calls. By default, these functions block until the result is available
+ *  (\ref rocsparse_result_mode_blocking). In \ref rocsparse_result_mode_async, the
+ *  result is copied asynchronously and the stream associated with \p handle must be
+ *  synchronized before the result is accessed. The result should then be stored in
+ *  pinned host memory, e.g. allocated with hipHostMalloc(), as copies to pageable host
+ *  memory may still block.
+ *
+ *  \note
+ *  Currently, only the dot products rocsparse_sdoti(), rocsparse_ddoti(),
+ *  rocsparse_sspdoti() and rocsparse_dspdoti(), the norms rocsparse_snrm2i() and
+ *  rocsparse_dnrm2i(), and their batched variants are affected by the result mode.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  mode            the result mode to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_result_mode(rocsparse_handle handle, rocsparse_result_mode mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current result mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_result_mode gets the rocSPARSE library context result mode
+ *  which is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  mode            the result mode that is currently used by the rocSPARSE library
+ *                  context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p mode pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_result_mode(rocsparse_handle handle, rocsparse_result_mode* mode);
+
+/*! \ingroup aux_module
+ *  \brief Specify csrmv algorithm
+ *
+ *  \details
+ *  \p rocsparse_set_csrmv_alg specifies the algorithm to be used by rocsparse_csrmv()
+ *  for all subsequent function calls, if no analysis meta data is available. Valid
+ *  algorithms are \ref rocsparse_csrmv_alg_auto, \ref rocsparse_csrmv_alg_row or
+ *  \ref rocsparse_csrmv_alg_merge.
+ *
+ *  \note
+ *  Without analysis meta data, the distribution of the row lengths is unknown. Thus,
+ *  \ref rocsparse_csrmv_alg_auto always uses the row based algorithm. For matrices
+ *  with highly irregular row lengths, \ref rocsparse_csrmv_alg_merge should be
+ *  selected explicitly.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  alg             the csrmv algorithm to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p alg is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_csrmv_alg(rocsparse_handle handle, rocsparse_csrmv_alg alg);
+
+/*! \ingroup aux_module
+ *  \brief Get current csrmv algorithm from library context
+ *
+ *  \details
+ *  \p rocsparse_get_csrmv_alg gets the rocSPARSE library context csrmv algorithm
+ *  which is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  alg             the csrmv algorithm that is currently used by the rocSPARSE library
+ *                  context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p alg pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_csrmv_alg(rocsparse_handle handle, rocsparse_csrmv_alg* alg);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
@@ -435,6 +630,72 @@ rocsparse_status rocsparse_create_hyb_mat(rocsparse_hyb_mat* hyb);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb);
 
+/*! \ingroup aux_module
+ *  \brief Create a \p CSR5 matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_csr5_mat creates a structure that holds the matrix in \p CSR5
+ *  storage format. It should be destroyed at the end using
+ *  rocsparse_destroy_csr5_mat().
+ *
+ *  @param[inout]
+ *  csr5 the pointer to the CSR5 matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p csr5 pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_csr5_mat(rocsparse_csr5_mat* csr5);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p CSR5 matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_csr5_mat destroys a \p CSR5 structure.
+ *
+ *  @param[in]
+ *  csr5 the CSR5 matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p csr5 pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_csr5_mat(rocsparse_csr5_mat csr5);
+
+/*! \ingroup aux_module
+ *  \brief Create a \p SELL-C-sigma matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_sellcs_mat creates a structure that holds the matrix in
+ *  \p SELL-C-sigma storage format. It should be destroyed at the end using
+ *  rocsparse_destroy_sellcs_mat().
+ *
+ *  @param[inout]
+ *  sell the pointer to the SELL-C-sigma matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p sell pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_sellcs_mat(rocsparse_sellcs_mat* sell);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p SELL-C-sigma matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_sellcs_mat destroys a \p SELL-C-sigma structure.
+ *
+ *  @param[in]
+ *  sell the SELL-C-sigma matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p sell pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_sellcs_mat(rocsparse_sellcs_mat sell);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix info structure
  *
@@ -468,6 +729,161 @@ rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
 
+/*! \ingroup aux_module
+ *  \brief Compute the structural hash of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csr_structure_hash computes a 64 bit hash of the sparsity pattern
+ *  of a sparse CSR matrix, given by \p csr_row_ptr and \p csr_col_ind. The hash
+ *  can be used to identify matrices that share the same sparsity pattern, e.g. to
+ *  look up previously serialized analysis meta data.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  hash        pointer to the structural hash on the host.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *              \p hash pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_structure_hash(rocsparse_handle     handle,
+                                              rocsparse_int        m,
+                                              rocsparse_int        nnz,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              unsigned long long*  hash);
+
+/*! \ingroup aux_module
+ *  \brief Serialize the analysis meta data of a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_mat_info_serialize writes the meta data that has been gathered by
+ *  rocsparse_csrmv_analysis(), rocsparse_csrsv_analysis() and
+ *  rocsparse_csrilu0_analysis() into a versioned binary blob. The blob is keyed on
+ *  the structural hash of the sparse CSR matrix and can be stored, e.g. on disk, and
+ *  restored using rocsparse_mat_info_deserialize() to skip the analysis in
+ *  subsequent runs. If \p blob is a null pointer, the required size of the blob is
+ *  returned in \p size.
+ *
+ *  \note
+ *  Not all meta data is serialized. The meta data of symmetric and Hermitian
+ *  csrmv, rocsparse_csric0_analysis(), rocsparse_csriluk_symbolic() and
+ *  rocsparse_csrilu0_refactor_analysis() is omitted from the blob. After
+ *  deserialization, the corresponding analysis routines have to be run again.
+ *
+ *  \note
+ *  The blob is stored in host byte order and is only valid for the rocSPARSE
+ *  version that created it.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the analysis meta data.
+ *  @param[inout]
+ *  size        size of \p blob in bytes. On return, the number of bytes required
+ *              to hold the serialized meta data.
+ *  @param[out]
+ *  blob        host buffer of \p size bytes, or a null pointer.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p info or \p size pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p size is too small to hold the blob.
+ *  \retval rocsparse_status_invalid_value \p info does not hold any analysis meta
+ *              data, or the meta data belongs to different matrices.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_serialize(rocsparse_handle         handle,
+                                              const rocsparse_mat_info info,
+                                              size_t*                  size,
+                                              void*                    blob);
+
+/*! \ingroup aux_module
+ *  \brief Restore the analysis meta data of a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_mat_info_deserialize restores the meta data that has been written
+ *  by rocsparse_mat_info_serialize(). The structural hash of the given sparse CSR
+ *  matrix is verified against the hash stored in the blob, such that meta data of
+ *  a different sparsity pattern is rejected. Corrupt or truncated blobs are detected
+ *  by a checksum of the blob, and the meta data is verified against the sparse CSR
+ *  matrix before it is restored. Any meta data that is already present in \p info
+ *  is replaced. A rejected blob leaves \p info unchanged. If restoring the meta
+ *  data fails, e.g. due to a memory error, all serializable meta data is removed
+ *  from \p info. After successful completion, \p info can be passed to
+ *  all routines that require the corresponding analysis, without calling the
+ *  analysis routines. Meta data that is not serialized, see
+ *  rocsparse_mat_info_serialize(), is not restored and its analysis has to be run
+ *  again.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  size        size of \p blob in bytes.
+ *  @param[in]
+ *  blob        host buffer holding the serialized meta data.
+ *  @param[inout]
+ *  info        structure that holds the restored analysis meta data.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p nnz or \p size is invalid, or
+ *              \p m and \p nnz do not match the serialized meta data.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p blob or \p info pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p blob is not a valid blob, holds
+ *              invalid meta data, or its structural hash or index base does not
+ *              match the sparse CSR matrix.
+ *  \retval rocsparse_status_memory_error the buffer for the meta data could not be
+ *              allocated.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_deserialize(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t                    size,
+                                                const void*               blob,
+                                                rocsparse_mat_info        info);
+
 #ifdef __cplusplus
 }
 #endif
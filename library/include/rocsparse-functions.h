@@ -127,6 +127,172 @@ rocsparse_status rocsparse_zaxpyi(rocsparse_handle handle,
 */
 /**@}*/
 
+/*! \ingroup level1_module
+ *  \brief Scale a strided batch of sparse vectors and add them to dense vectors.
+ *
+ *  \details
+ *  \p rocsparse_axpyi_strided_batched multiplies each sparse vector \f$x_b\f$ of a batch with
+ *  scalar \f$\alpha\f$ and adds the result to the corresponding dense vector
+ *  \f$y_b\f$, such that
+ *  \f[
+ *      y_b := y_b + \alpha \cdot x_b, \quad b = 0, \dots, \text{batch_count} - 1
+ *  \f]
+ *
+ *  All vectors of the batch share the number of non-zero entries and are stored at a
+ *  constant stride from each other. The batch is processed by a single kernel launch.
+ *
+ *  \code{.c}
+ *      for(b = 0; b < batch_count; ++b)
+ *      {
+ *          for(i = 0; i < nnz; ++i)
+ *          {
+ *              y_b[x_ind_b[i]] = y_b[x_ind_b[i]] + alpha * x_val_b[i];
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  x_val       array of \p batch_count vectors of \p nnz elements containing the
+ *              values of \f$x_b\f$.
+ *  @param[in]
+ *  stride_x    stride between consecutive vectors of \p x_val.
+ *  @param[in]
+ *  x_ind       array of \p batch_count vectors of \p nnz elements containing the
+ *              indices of the non-zero values of \f$x_b\f$.
+ *  @param[in]
+ *  stride_ind  stride between consecutive vectors of \p x_ind.
+ *  @param[inout]
+ *  y           array of \p batch_count vectors in dense format.
+ *  @param[in]
+ *  stride_y    stride between consecutive vectors of \p y.
+ *  @param[in]
+ *  batch_count number of vectors in the batch.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p batch_count or a stride is
+ *          invalid.
+ *  \retval rocsparse_status_invalid_pointer \p alpha, \p x_val, \p x_ind or \p y pointer
+ *          is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_saxpyi_strided_batched(rocsparse_handle     handle,
+                                                  rocsparse_int        nnz,
+                                                  const float*         alpha,
+                                                  const float*         x_val,
+                                                  rocsparse_int        stride_x,
+                                                  const rocsparse_int* x_ind,
+                                                  rocsparse_int        stride_ind,
+                                                  float*               y,
+                                                  rocsparse_int        stride_y,
+                                                  rocsparse_int        batch_count,
+                                                  rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_daxpyi_strided_batched(rocsparse_handle     handle,
+                                                  rocsparse_int        nnz,
+                                                  const double*        alpha,
+                                                  const double*        x_val,
+                                                  rocsparse_int        stride_x,
+                                                  const rocsparse_int* x_ind,
+                                                  rocsparse_int        stride_ind,
+                                                  double*              y,
+                                                  rocsparse_int        stride_y,
+                                                  rocsparse_int        batch_count,
+                                                  rocsparse_index_base idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Scale a batch of sparse vectors and add them to dense vectors.
+ *
+ *  \details
+ *  \p rocsparse_axpyi_batched multiplies each sparse vector \f$x_b\f$ of a batch with
+ *  scalar \f$\alpha\f$ and adds the result to the corresponding dense vector
+ *  \f$y_b\f$, such that
+ *  \f[
+ *      y_b := y_b + \alpha \cdot x_b, \quad b = 0, \dots, \text{batch_count} - 1
+ *  \f]
+ *
+ *  All vectors of the batch share the number of non-zero entries. The vectors are
+ *  passed as device arrays of \p batch_count device pointers. The batch is processed by
+ *  a single kernel launch.
+ *
+ *  \code{.c}
+ *      for(b = 0; b < batch_count; ++b)
+ *      {
+ *          for(i = 0; i < nnz; ++i)
+ *          {
+ *              y_b[x_ind_b[i]] = y_b[x_ind_b[i]] + alpha * x_val_b[i];
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  x_val       array of \p batch_count pointers to the \p nnz values of
+ *              \f$x_b\f$.
+ *  @param[in]
+ *  x_ind       array of \p batch_count pointers to the \p nnz indices of the
+ *              non-zero values of \f$x_b\f$.
+ *  @param[inout]
+ *  y           array of \p batch_count pointers to the dense vectors \f$y_b\f$.
+ *  @param[in]
+ *  batch_count number of vectors in the batch.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz or \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p alpha, \p x_val, \p x_ind or \p y pointer
+ *          is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_saxpyi_batched(rocsparse_handle            handle,
+                                          rocsparse_int               nnz,
+                                          const float*                alpha,
+                                          const float* const*         x_val,
+                                          const rocsparse_int* const* x_ind,
+                                          float* const*               y,
+                                          rocsparse_int               batch_count,
+                                          rocsparse_index_base        idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_daxpyi_batched(rocsparse_handle            handle,
+                                          rocsparse_int               nnz,
+                                          const double*               alpha,
+                                          const double* const*        x_val,
+                                          const rocsparse_int* const* x_ind,
+                                          double* const*              y,
+                                          rocsparse_int               batch_count,
+                                          rocsparse_index_base        idx_base);
+/**@}*/
+
 /*! \ingroup level1_module
  *  \brief Compute the dot product of a sparse vector with a dense vector.
  *
@@ -145,8 +311,13 @@ rocsparse_status rocsparse_zaxpyi(rocsparse_handle handle,
  *  \endcode
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  In \ref rocsparse_pointer_mode_host, this function blocks until the result is
+ *  available, unless \ref rocsparse_result_mode_async has been set with
+ *  rocsparse_set_result_mode(). Then, the result is copied asynchronously and the
+ *  stream associated with \p handle must be synchronized before \p result is
+ *  accessed. In \ref rocsparse_pointer_mode_device, this function is non blocking
+ *  and executed asynchronously with respect to the host. It may return before the
+ *  actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -214,240 +385,492 @@ rocsparse_status rocsparse_zdoti(rocsparse_handle handle,
 /**@}*/
 
 /*! \ingroup level1_module
- *  \brief Gather elements from a dense vector and store them into a sparse vector.
+ *  \brief Compute the dot products of a strided batch of sparse vectors with dense vectors.
  *
  *  \details
- *  \p rocsparse_gthr gathers the elements that are listed in \p x_ind from the dense
- *  vector \f$y\f$ and stores them in the sparse vector \f$x\f$.
+ *  \p rocsparse_doti_strided_batched computes the dot product of each sparse vector \f$x_b\f$
+ *  of a batch with the corresponding dense vector \f$y_b\f$, such that
+ *  \f[
+ *    \text{result}_b := y_b^T x_b, \quad b = 0, \dots, \text{batch_count} - 1
+ *  \f]
+ *
+ *  All vectors of the batch share the number of non-zero entries and are stored at a
+ *  constant stride from each other. The batch is processed by a single kernel launch.
  *
  *  \code{.c}
- *      for(i = 0; i < nnz; ++i)
+ *      for(b = 0; b < batch_count; ++b)
  *      {
- *          x_val[i] = y[x_ind[i]];
+ *          result[b] = 0;
+ *          for(i = 0; i < nnz; ++i)
+ *          {
+ *              result[b] += x_val_b[i] * y_b[x_ind_b[i]];
+ *          }
  *      }
  *  \endcode
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  In \ref rocsparse_pointer_mode_host, this function blocks until the results are
+ *  available, unless \ref rocsparse_result_mode_async has been set with
+ *  rocsparse_set_result_mode(). Then, the results are copied asynchronously and the
+ *  stream associated with \p handle must be synchronized before \p result is
+ *  accessed. In \ref rocsparse_pointer_mode_device, this function is non blocking
+ *  and executed asynchronously with respect to the host. It may return before the
+ *  actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  nnz         number of non-zero entries of \f$x\f$.
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
  *  @param[in]
- *  y           array of values in dense format.
+ *  x_val       array of \p batch_count vectors of \p nnz elements containing the
+ *              values of \f$x_b\f$.
+ *  @param[in]
+ *  stride_x    stride between consecutive vectors of \p x_val.
+ *  @param[in]
+ *  x_ind       array of \p batch_count vectors of \p nnz elements containing the
+ *              indices of the non-zero values of \f$x_b\f$.
+ *  @param[in]
+ *  stride_ind  stride between consecutive vectors of \p x_ind.
+ *  @param[in]
+ *  y           array of \p batch_count vectors in dense format.
+ *  @param[in]
+ *  stride_y    stride between consecutive vectors of \p y.
  *  @param[out]
- *  x_val       array of \p nnz elements containing the values of \f$x\f$.
+ *  result      array of \p batch_count results, can be host or device memory.
  *  @param[in]
- *  x_ind       array of \p nnz elements containing the indices of the non-zero
- *              values of \f$x\f$.
+ *  batch_count number of vectors in the batch.
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
- *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
- *              invalid.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p batch_count or a stride is
+ *          invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y or \p result pointer
+ *          is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgthr(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 const float*         y,
-                                 float*               x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_index_base idx_base);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgthr(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 const double*        y,
-                                 double*              x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_index_base idx_base);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgthr(rocsparse_handle handle,
-                                 rocsparse_int nnz,
-                                 const rocsparse_float_complex* y,
-                                 rocsparse_float_complex* x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_index_base idx_base);
+rocsparse_status rocsparse_sdoti_strided_batched(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const float*         x_val,
+                                                 rocsparse_int        stride_x,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 const float*         y,
+                                                 rocsparse_int        stride_y,
+                                                 float*               result,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgthr(rocsparse_handle handle,
-                                 rocsparse_int nnz,
-                                 const rocsparse_double_complex* y,
-                                 rocsparse_double_complex* x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_index_base idx_base);
-*/
+rocsparse_status rocsparse_ddoti_strided_batched(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const double*        x_val,
+                                                 rocsparse_int        stride_x,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 const double*        y,
+                                                 rocsparse_int        stride_y,
+                                                 double*              result,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base);
 /**@}*/
 
 /*! \ingroup level1_module
- *  \brief Gather and zero out elements from a dense vector and store them into a sparse
- *  vector.
+ *  \brief Compute the dot products of a batch of sparse vectors with dense vectors.
  *
  *  \details
- *  \p rocsparse_gthrz gathers the elements that are listed in \p x_ind from the dense
- *  vector \f$y\f$ and stores them in the sparse vector \f$x\f$. The gathered elements
- *  in \f$y\f$ are replaced by zero.
+ *  \p rocsparse_doti_batched computes the dot product of each sparse vector \f$x_b\f$
+ *  of a batch with the corresponding dense vector \f$y_b\f$, such that
+ *  \f[
+ *    \text{result}_b := y_b^T x_b, \quad b = 0, \dots, \text{batch_count} - 1
+ *  \f]
+ *
+ *  All vectors of the batch share the number of non-zero entries. The vectors are
+ *  passed as device arrays of \p batch_count device pointers. The batch is processed by
+ *  a single kernel launch.
  *
  *  \code{.c}
- *      for(i = 0; i < nnz; ++i)
+ *      for(b = 0; b < batch_count; ++b)
  *      {
- *          x_val[i]    = y[x_ind[i]];
- *          y[x_ind[i]] = 0;
+ *          result[b] = 0;
+ *          for(i = 0; i < nnz; ++i)
+ *          {
+ *              result[b] += x_val_b[i] * y_b[x_ind_b[i]];
+ *          }
  *      }
  *  \endcode
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  In \ref rocsparse_pointer_mode_host, this function blocks until the results are
+ *  available, unless \ref rocsparse_result_mode_async has been set with
+ *  rocsparse_set_result_mode(). Then, the results are copied asynchronously and the
+ *  stream associated with \p handle must be synchronized before \p result is
+ *  accessed. In \ref rocsparse_pointer_mode_device, this function is non blocking
+ *  and executed asynchronously with respect to the host. It may return before the
+ *  actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  nnz         number of non-zero entries of \f$x\f$.
- *  @param[inout]
- *  y           array of values in dense format.
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
+ *  @param[in]
+ *  x_val       array of \p batch_count pointers to the \p nnz values of
+ *              \f$x_b\f$.
+ *  @param[in]
+ *  x_ind       array of \p batch_count pointers to the \p nnz indices of the
+ *              non-zero values of \f$x_b\f$.
+ *  @param[in]
+ *  y           array of \p batch_count pointers to the dense vectors \f$y_b\f$.
  *  @param[out]
- *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  result      array of \p batch_count results, can be host or device memory.
  *  @param[in]
- *  x_ind       array of \p nnz elements containing the indices of the non-zero
- *              values of \f$x\f$.
+ *  batch_count number of vectors in the batch.
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
- *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
- *              invalid.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz or \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y or \p result pointer
+ *          is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgthrz(rocsparse_handle     handle,
-                                  rocsparse_int        nnz,
-                                  float*               y,
-                                  float*               x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_index_base idx_base);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgthrz(rocsparse_handle     handle,
-                                  rocsparse_int        nnz,
-                                  double*              y,
-                                  double*              x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_index_base idx_base);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgthrz(rocsparse_handle handle,
-                                  rocsparse_int nnz,
-                                  rocsparse_float_complex* y,
-                                  rocsparse_float_complex* x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_index_base idx_base);
+rocsparse_status rocsparse_sdoti_batched(rocsparse_handle            handle,
+                                         rocsparse_int               nnz,
+                                         const float* const*         x_val,
+                                         const rocsparse_int* const* x_ind,
+                                         const float* const*         y,
+                                         float*                      result,
+                                         rocsparse_int               batch_count,
+                                         rocsparse_index_base        idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgthrz(rocsparse_handle handle,
-                                  rocsparse_int nnz,
-                                  rocsparse_double_complex* y,
-                                  rocsparse_double_complex* x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_index_base idx_base);
-*/
+rocsparse_status rocsparse_ddoti_batched(rocsparse_handle            handle,
+                                         rocsparse_int               nnz,
+                                         const double* const*        x_val,
+                                         const rocsparse_int* const* x_ind,
+                                         const double* const*        y,
+                                         double*                     result,
+                                         rocsparse_int               batch_count,
+                                         rocsparse_index_base        idx_base);
 /**@}*/
 
 /*! \ingroup level1_module
- *  \brief Apply Givens rotation to a dense and a sparse vector.
+ *  \brief Compute the dot product of two sparse vectors.
  *
  *  \details
- *  \p rocsparse_roti applies the Givens rotation matrix \f$G\f$ to the sparse vector
- *  \f$x\f$ and the dense vector \f$y\f$, where
+ *  \p rocsparse_spdoti computes the dot product of the sparse vector \f$x\f$ with the
+ *  sparse vector \f$y\f$, such that
  *  \f[
- *    G = \begin{pmatrix} c & s \\ -s & c \end{pmatrix}
+ *    \text{result} := y^T x
  *  \f]
  *
+ *  The indices of both vectors must be sorted in ascending order and must not contain
+ *  duplicates. Matching entries are found by a merge path over the two index arrays,
+ *  such that neither vector needs to be scattered into dense format and the work is
+ *  \f$O(\text{nnz_x} + \text{nnz_y})\f$, independent of the vector length.
+ *
  *  \code{.c}
- *      for(i = 0; i < nnz; ++i)
+ *      i = 0;
+ *      j = 0;
+ *      while(i < nnz_x && j < nnz_y)
  *      {
- *          x_tmp = x_val[i];
- *          y_tmp = y[x_ind[i]];
- *
- *          x_val[i]    = c * x_tmp + s * y_tmp;
- *          y[x_ind[i]] = c * y_tmp - s * x_tmp;
+ *          if(x_ind[i] == y_ind[j])
+ *          {
+ *              result += x_val[i++] * y_val[j++];
+ *          }
+ *          else if(x_ind[i] < y_ind[j])
+ *          {
+ *              ++i;
+ *          }
+ *          else
+ *          {
+ *              ++j;
+ *          }
  *      }
  *  \endcode
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  In \ref rocsparse_pointer_mode_host, this function blocks until the result is
+ *  available, unless \ref rocsparse_result_mode_async has been set with
+ *  rocsparse_set_result_mode(). Then, the result is copied asynchronously and the
+ *  stream associated with \p handle must be synchronized before \p result is
+ *  accessed. In \ref rocsparse_pointer_mode_device, this function is non blocking
+ *  and executed asynchronously with respect to the host. It may return before the
+ *  actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  nnz         number of non-zero entries of \f$x\f$.
- *  @param[inout]
- *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  nnz_x       number of non-zero entries of vector \f$x\f$.
  *  @param[in]
- *  x_ind       array of \p nnz elements containing the indices of the non-zero
- *              values of \f$x\f$.
- *  @param[inout]
- *  y           array of values in dense format.
+ *  x_val       array of \p nnz_x values of \f$x\f$.
  *  @param[in]
- *  c           pointer to the cosine element of \f$G\f$, can be on host or device.
+ *  x_ind       array of \p nnz_x sorted indices of the non-zero values of \f$x\f$.
  *  @param[in]
- *  s           pointer to the sine element of \f$G\f$, can be on host or device.
+ *  nnz_y       number of non-zero entries of vector \f$y\f$.
+ *  @param[in]
+ *  y_val       array of \p nnz_y values of \f$y\f$.
+ *  @param[in]
+ *  y_ind       array of \p nnz_y sorted indices of the non-zero values of \f$y\f$.
+ *  @param[out]
+ *  result      pointer to the result, can be host or device memory
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
- *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p c, \p s, \p x_val, \p x_ind or \p y
- *              pointer is invalid.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz_x or \p nnz_y is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y_val, \p y_ind or
+ *          \p result pointer is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sroti(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 float*               x_val,
-                                 const rocsparse_int* x_ind,
-                                 float*               y,
-                                 const float*         c,
-                                 const float*         s,
-                                 rocsparse_index_base idx_base);
+rocsparse_status rocsparse_sspdoti(rocsparse_handle     handle,
+                                   rocsparse_int        nnz_x,
+                                   const float*         x_val,
+                                   const rocsparse_int* x_ind,
+                                   rocsparse_int        nnz_y,
+                                   const float*         y_val,
+                                   const rocsparse_int* y_ind,
+                                   float*               result,
+                                   rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_droti(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 double*              x_val,
-                                 const rocsparse_int* x_ind,
-                                 double*              y,
-                                 const double*        c,
-                                 const double*        s,
-                                 rocsparse_index_base idx_base);
+rocsparse_status rocsparse_dspdoti(rocsparse_handle     handle,
+                                   rocsparse_int        nnz_x,
+                                   const double*        x_val,
+                                   const rocsparse_int* x_ind,
+                                   rocsparse_int        nnz_y,
+                                   const double*        y_val,
+                                   const rocsparse_int* y_ind,
+                                   double*              result,
+                                   rocsparse_index_base idx_base);
 /**@}*/
 
 /*! \ingroup level1_module
- *  \brief Scatter elements from a dense vector across a sparse vector.
+ *  \brief Compute the dot products of a strided batch of pairs of sparse vectors.
  *
  *  \details
- *  \p rocsparse_sctr scatters the elements that are listed in \p x_ind from the sparse
- *  vector \f$x\f$ into the dense vector \f$y\f$. Indices of \f$y\f$ that are not listed
- *  in \p x_ind remain unchanged.
+ *  \p rocsparse_spdoti_strided_batched computes the dot product of each sparse vector
+ *  \f$x_b\f$ of a batch with the corresponding sparse vector \f$y_b\f$, such that
+ *  \f[
+ *    \text{result}_b := y_b^T x_b, \quad b = 0, \dots, \text{batch_count} - 1
+ *  \f]
+ *
+ *  All vectors \f$x_b\f$ share the number of non-zero entries \p nnz_x, all vectors
+ *  \f$y_b\f$ share \p nnz_y. The values and indices of consecutive vectors are stored
+ *  at a constant stride from each other. The indices of each vector must be sorted in
+ *  ascending order. The batch is processed by a single kernel launch.
+ *
+ *  \note
+ *  In \ref rocsparse_pointer_mode_host, this function blocks until the results are
+ *  available, unless \ref rocsparse_result_mode_async has been set with
+ *  rocsparse_set_result_mode(). Then, the results are copied asynchronously and the
+ *  stream associated with \p handle must be synchronized before \p result is
+ *  accessed. In \ref rocsparse_pointer_mode_device, this function is non blocking
+ *  and executed asynchronously with respect to the host. It may return before the
+ *  actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz_x       number of non-zero entries of each sparse vector \f$x_b\f$.
+ *  @param[in]
+ *  x_val       array of \p batch_count vectors of \p nnz_x values of \f$x_b\f$.
+ *  @param[in]
+ *  x_ind       array of \p batch_count vectors of \p nnz_x sorted indices of the
+ *              non-zero values of \f$x_b\f$.
+ *  @param[in]
+ *  stride_x    stride between consecutive vectors of \p x_val and \p x_ind.
+ *  @param[in]
+ *  nnz_y       number of non-zero entries of each sparse vector \f$y_b\f$.
+ *  @param[in]
+ *  y_val       array of \p batch_count vectors of \p nnz_y values of \f$y_b\f$.
+ *  @param[in]
+ *  y_ind       array of \p batch_count vectors of \p nnz_y sorted indices of the
+ *              non-zero values of \f$y_b\f$.
+ *  @param[in]
+ *  stride_y    stride between consecutive vectors of \p y_val and \p y_ind.
+ *  @param[out]
+ *  result      array of \p batch_count results, can be host or device memory.
+ *  @param[in]
+ *  batch_count number of vector pairs in the batch.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz_x, \p nnz_y, \p batch_count or a
+ *          stride is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y_val, \p y_ind or
+ *          \p result pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sspdoti_strided_batched(rocsparse_handle     handle,
+                                                   rocsparse_int        nnz_x,
+                                                   const float*         x_val,
+                                                   const rocsparse_int* x_ind,
+                                                   rocsparse_int        stride_x,
+                                                   rocsparse_int        nnz_y,
+                                                   const float*         y_val,
+                                                   const rocsparse_int* y_ind,
+                                                   rocsparse_int        stride_y,
+                                                   float*               result,
+                                                   rocsparse_int        batch_count,
+                                                   rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dspdoti_strided_batched(rocsparse_handle     handle,
+                                                   rocsparse_int        nnz_x,
+                                                   const double*        x_val,
+                                                   const rocsparse_int* x_ind,
+                                                   rocsparse_int        stride_x,
+                                                   rocsparse_int        nnz_y,
+                                                   const double*        y_val,
+                                                   const rocsparse_int* y_ind,
+                                                   rocsparse_int        stride_y,
+                                                   double*              result,
+                                                   rocsparse_int        batch_count,
+                                                   rocsparse_index_base idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Compute the Euclidean norm of a sparse vector.
+ *
+ *  \details
+ *  \p rocsparse_nrm2i computes the Euclidean norm of the sparse vector \f$x\f$, such
+ *  that
+ *  \f[
+ *    \text{result} := \sqrt{x^T x}
+ *  \f]
+ *
+ *  Only the non-zero values of \f$x\f$ contribute to the norm, hence no indices are
+ *  required.
  *
  *  \code{.c}
  *      for(i = 0; i < nnz; ++i)
  *      {
- *          y[x_ind[i]] = x_val[i];
+ *          result += x_val[i] * x_val[i];
+ *      }
+ *      result = sqrt(result);
+ *  \endcode
+ *
+ *  \note
+ *  In \ref rocsparse_pointer_mode_host, this function blocks until the result is
+ *  available, unless \ref rocsparse_result_mode_async has been set with
+ *  rocsparse_set_result_mode(). Then, the result is copied asynchronously and the
+ *  stream associated with \p handle must be synchronized before \p result is
+ *  accessed. In \ref rocsparse_pointer_mode_device, this function is non blocking
+ *  and executed asynchronously with respect to the host. It may return before the
+ *  actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of vector \f$x\f$.
+ *  @param[in]
+ *  x_val       array of \p nnz values.
+ *  @param[out]
+ *  result      pointer to the result, can be host or device memory
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val or \p result pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_snrm2i(rocsparse_handle handle,
+                                  rocsparse_int    nnz,
+                                  const float*     x_val,
+                                  float*           result);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnrm2i(rocsparse_handle handle,
+                                  rocsparse_int    nnz,
+                                  const double*    x_val,
+                                  double*          result);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Compute the Euclidean norms of a strided batch of sparse vectors.
+ *
+ *  \details
+ *  \p rocsparse_nrm2i_strided_batched computes the Euclidean norm of each sparse vector
+ *  \f$x_b\f$ of a batch, such that
+ *  \f[
+ *    \text{result}_b := \sqrt{x_b^T x_b}, \quad b = 0, \dots, \text{batch_count} - 1
+ *  \f]
+ *
+ *  All vectors of the batch share the number of non-zero entries and are stored at a
+ *  constant stride from each other. The batch is processed by a single kernel launch.
+ *
+ *  \note
+ *  In \ref rocsparse_pointer_mode_host, this function blocks until the results are
+ *  available, unless \ref rocsparse_result_mode_async has been set with
+ *  rocsparse_set_result_mode(). Then, the results are copied asynchronously and the
+ *  stream associated with \p handle must be synchronized before \p result is
+ *  accessed. In \ref rocsparse_pointer_mode_device, this function is non blocking
+ *  and executed asynchronously with respect to the host. It may return before the
+ *  actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
+ *  @param[in]
+ *  x_val       array of \p batch_count vectors of \p nnz values of \f$x_b\f$.
+ *  @param[in]
+ *  stride_x    stride between consecutive vectors of \p x_val.
+ *  @param[out]
+ *  result      array of \p batch_count results, can be host or device memory.
+ *  @param[in]
+ *  batch_count number of vectors in the batch.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p stride_x or \p batch_count is
+ *          invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val or \p result pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_snrm2i_strided_batched(rocsparse_handle handle,
+                                                  rocsparse_int    nnz,
+                                                  const float*     x_val,
+                                                  rocsparse_int    stride_x,
+                                                  float*           result,
+                                                  rocsparse_int    batch_count);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnrm2i_strided_batched(rocsparse_handle handle,
+                                                  rocsparse_int    nnz,
+                                                  const double*    x_val,
+                                                  rocsparse_int    stride_x,
+                                                  double*          result,
+                                                  rocsparse_int    batch_count);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Gather elements from a dense vector and store them into a sparse vector.
+ *
+ *  \details
+ *  \p rocsparse_gthr gathers the elements that are listed in \p x_ind from the dense
+ *  vector \f$y\f$ and stores them in the sparse vector \f$x\f$.
+ *
+ *  \code{.c}
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          x_val[i] = y[x_ind[i]];
  *      }
  *  \endcode
  *
@@ -460,12 +883,12 @@ rocsparse_status rocsparse_droti(rocsparse_handle     handle,
  *  @param[in]
  *  nnz         number of non-zero entries of \f$x\f$.
  *  @param[in]
- *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  y           array of values in dense format.
+ *  @param[out]
+ *  x_val       array of \p nnz elements containing the values of \f$x\f$.
  *  @param[in]
  *  x_ind       array of \p nnz elements containing the indices of the non-zero
- *              values of x.
- *  @param[inout]
- *  y           array of values in dense format.
+ *              values of \f$x\f$.
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
@@ -473,84 +896,62 @@ rocsparse_status rocsparse_droti(rocsparse_handle     handle,
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
  *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
  *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p x_val, \p x_ind or \p y pointer is
+ *  \retval     rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
  *              invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ssctr(rocsparse_handle     handle,
+rocsparse_status rocsparse_sgthr(rocsparse_handle     handle,
                                  rocsparse_int        nnz,
-                                 const float*         x_val,
+                                 const float*         y,
+                                 float*               x_val,
                                  const rocsparse_int* x_ind,
-                                 float*               y,
                                  rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dsctr(rocsparse_handle     handle,
+rocsparse_status rocsparse_dgthr(rocsparse_handle     handle,
                                  rocsparse_int        nnz,
-                                 const double*        x_val,
+                                 const double*        y,
+                                 double*              x_val,
                                  const rocsparse_int* x_ind,
-                                 double*              y,
                                  rocsparse_index_base idx_base);
 /*
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csctr(rocsparse_handle handle,
+rocsparse_status rocsparse_cgthr(rocsparse_handle handle,
                                  rocsparse_int nnz,
-                                 const rocsparse_float_complex* x_val,
+                                 const rocsparse_float_complex* y,
+                                 rocsparse_float_complex* x_val,
                                  const rocsparse_int* x_ind,
-                                 rocsparse_float_complex* y,
                                  rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zsctr(rocsparse_handle handle,
+rocsparse_status rocsparse_zgthr(rocsparse_handle handle,
                                  rocsparse_int nnz,
-                                 const rocsparse_double_complex* x_val,
+                                 const rocsparse_double_complex* y,
+                                 rocsparse_double_complex* x_val,
                                  const rocsparse_int* x_ind,
-                                 rocsparse_double_complex* y,
                                  rocsparse_index_base idx_base);
 */
 /**@}*/
 
-/*
- * ===========================================================================
- *    level 2 SPARSE
- * ===========================================================================
- */
-
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using COO storage format
+/*! \ingroup level1_module
+ *  \brief Gather elements from a strided batch of dense vectors into sparse vectors.
  *
  *  \details
- *  \p rocsparse_coomv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in COO storage format, and the dense vector \f$x\f$ and adds the
- *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
- *  such that
- *  \f[
- *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
- *  \f]
- *  with
- *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans == rocsparse_operation_none} \\
- *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
- *  \f]
+ *  \p rocsparse_gthr_strided_batched gathers the elements that are listed in \p x_ind from
+ *  each dense vector \f$y_b\f$ of a batch and stores them in the corresponding sparse
+ *  vector \f$x_b\f$.
  *
- *  The COO matrix has to be sorted by row indices. This can be achieved by using
- *  rocsparse_coosort_by_row().
+ *  All vectors of the batch share the number of non-zero entries and are stored at a
+ *  constant stride from each other. The batch is processed by a single kernel launch.
  *
  *  \code{.c}
- *      for(i = 0; i < m; ++i)
- *      {
- *          y[i] = beta * y[i];
- *      }
- *
- *      for(i = 0; i < nnz; ++i)
+ *      for(b = 0; b < batch_count; ++b)
  *      {
- *          y[coo_row_ind[i]] += alpha * coo_val[i] * x[coo_col_ind[i]];
+ *          for(i = 0; i < nnz; ++i)
+ *          {
+ *              x_val_b[i] = y_b[x_ind_b[i]];
+ *          }
  *      }
  *  \endcode
  *
@@ -558,125 +959,84 @@ rocsparse_status rocsparse_zsctr(rocsparse_handle handle,
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
- *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
- *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse COO matrix.
- *  @param[in]
- *  n           number of columns of the sparse COO matrix.
- *  @param[in]
- *  nnz         number of non-zero entries of the sparse COO matrix.
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
  *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
+ *  y           array of \p batch_count vectors in dense format.
  *  @param[in]
- *  descr       descriptor of the sparse COO matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  stride_y    stride between consecutive vectors of \p y.
+ *  @param[out]
+ *  x_val       array of \p batch_count vectors of \p nnz elements containing the
+ *              values of \f$x_b\f$.
  *  @param[in]
- *  coo_val     array of \p nnz elements of the sparse COO matrix.
+ *  stride_x    stride between consecutive vectors of \p x_val.
  *  @param[in]
- *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
- *              matrix.
+ *  x_ind       array of \p batch_count vectors of \p nnz elements containing the
+ *              indices of the non-zero values of \f$x_b\f$.
  *  @param[in]
- *  coo_col_ind array of \p nnz elements containing the column indices of the sparse
- *              COO matrix.
+ *  stride_ind  stride between consecutive vectors of \p x_ind.
  *  @param[in]
- *  x           array of \p n elements (\f$op(A) = A\f$) or \p m elements
- *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
+ *  batch_count number of vectors in the batch.
  *  @param[in]
- *  beta        scalar \f$\beta\f$.
- *  @param[inout]
- *  y           array of \p m elements (\f$op(A) = A\f$) or \p n elements
- *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p coo_val,
- *              \p coo_row_ind, \p coo_col_ind, \p x, \p beta or \p y pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p batch_count or a stride is
+ *          invalid.
+ *  \retval rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer
+ *          is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scoomv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             nnz,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              coo_val,
-                                  const rocsparse_int*      coo_row_ind,
-                                  const rocsparse_int*      coo_col_ind,
-                                  const float*              x,
-                                  const float*              beta,
-                                  float*                    y);
+rocsparse_status rocsparse_sgthr_strided_batched(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const float*         y,
+                                                 rocsparse_int        stride_y,
+                                                 float*               x_val,
+                                                 rocsparse_int        stride_x,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcoomv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             nnz,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             coo_val,
-                                  const rocsparse_int*      coo_row_ind,
-                                  const rocsparse_int*      coo_col_ind,
-                                  const double*             x,
-                                  const double*             beta,
-                                  double*                   y);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccoomv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int nnz,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* coo_val,
-                                  const rocsparse_int* coo_row_ind,
-                                  const rocsparse_int* coo_col_ind,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* y);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int nnz,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* coo_val,
-                                  const rocsparse_int* coo_row_ind,
-                                  const rocsparse_int* coo_col_ind,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* y);
-*/
+rocsparse_status rocsparse_dgthr_strided_batched(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const double*        y,
+                                                 rocsparse_int        stride_y,
+                                                 double*              x_val,
+                                                 rocsparse_int        stride_x,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Gather elements from a batch of dense vectors into sparse vectors.
  *
  *  \details
- *  \p rocsparse_csrmv_analysis performs the analysis step for rocsparse_scsrmv() and
- *  rocsparse_dcsrmv(). It is expected that this function will be executed only once for
- *  a given matrix and particular operation type. The gathered analysis meta data can be
- *  cleared by rocsparse_csrmv_clear().
+ *  \p rocsparse_gthr_batched gathers the elements that are listed in \p x_ind from
+ *  each dense vector \f$y_b\f$ of a batch and stores them in the corresponding sparse
+ *  vector \f$x_b\f$.
  *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *  All vectors of the batch share the number of non-zero entries. The vectors are
+ *  passed as device arrays of \p batch_count device pointers. The batch is processed by
+ *  a single kernel launch.
+ *
+ *  \code{.c}
+ *      for(b = 0; b < batch_count; ++b)
+ *      {
+ *          for(i = 0; i < nnz; ++i)
+ *          {
+ *              x_val_b[i] = y_b[x_ind_b[i]];
+ *          }
+ *      }
+ *  \endcode
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -685,129 +1045,142 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[in]
- *  n           number of columns of the sparse CSR matrix.
- *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  y           array of \p batch_count pointers to the dense vectors \f$y_b\f$.
+ *  @param[out]
+ *  x_val       array of \p batch_count pointers to the \p nnz values of
+ *              \f$x_b\f$.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  x_ind       array of \p batch_count pointers to the \p nnz indices of the
+ *              non-zero values of \f$x_b\f$.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  batch_count number of vectors in the batch.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind or \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer for the gathered information
- *              could not be allocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz or \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer
+ *          is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrmv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             n,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const float*              csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info);
+rocsparse_status rocsparse_sgthr_batched(rocsparse_handle            handle,
+                                         rocsparse_int               nnz,
+                                         const float* const*         y,
+                                         float* const*               x_val,
+                                         const rocsparse_int* const* x_ind,
+                                         rocsparse_int               batch_count,
+                                         rocsparse_index_base        idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrmv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             n,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const double*             csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info);
+rocsparse_status rocsparse_dgthr_batched(rocsparse_handle            handle,
+                                         rocsparse_int               nnz,
+                                         const double* const*        y,
+                                         double* const*              x_val,
+                                         const rocsparse_int* const* x_ind,
+                                         rocsparse_int               batch_count,
+                                         rocsparse_index_base        idx_base);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Gather and zero out elements from a dense vector and store them into a sparse
+ *  vector.
  *
  *  \details
- *  \p rocsparse_csrmv_clear deallocates all memory that was allocated by
- *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). This is especially
- *  useful, if memory is an issue and the analysis data is not required anymore for
- *  further computation, e.g. when switching to another sparse matrix format.
+ *  \p rocsparse_gthrz gathers the elements that are listed in \p x_ind from the dense
+ *  vector \f$y\f$ and stores them in the sparse vector \f$x\f$. The gathered elements
+ *  in \f$y\f$ are replaced by zero.
+ *
+ *  \code{.c}
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          x_val[i]    = y[x_ind[i]];
+ *          y[x_ind[i]] = 0;
+ *      }
+ *  \endcode
  *
  *  \note
- *  Calling \p rocsparse_csrmv_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of \f$x\f$.
  *  @param[inout]
- *  info        structure that holds the information collected during analysis step.
+ *  y           array of values in dense format.
+ *  @param[out]
+ *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  @param[in]
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer for the gathered information
- *              could not be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- * */
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
+ *              invalid.
+ */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_sgthrz(rocsparse_handle     handle,
+                                  rocsparse_int        nnz,
+                                  float*               y,
+                                  float*               x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_index_base idx_base);
 
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using CSR storage format
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgthrz(rocsparse_handle     handle,
+                                  rocsparse_int        nnz,
+                                  double*              y,
+                                  double*              x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_index_base idx_base);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgthrz(rocsparse_handle handle,
+                                  rocsparse_int nnz,
+                                  rocsparse_float_complex* y,
+                                  rocsparse_float_complex* x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgthrz(rocsparse_handle handle,
+                                  rocsparse_int nnz,
+                                  rocsparse_double_complex* y,
+                                  rocsparse_double_complex* x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_index_base idx_base);
+*/
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Apply Givens rotation to a dense and a sparse vector.
  *
  *  \details
- *  \p rocsparse_csrmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in CSR storage format, and the dense vector \f$x\f$ and adds the
- *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
- *  such that
- *  \f[
- *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
- *  \f]
- *  with
+ *  \p rocsparse_roti applies the Givens rotation matrix \f$G\f$ to the sparse vector
+ *  \f$x\f$ and the dense vector \f$y\f$, where
  *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans == rocsparse_operation_none} \\
- *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
+ *    G = \begin{pmatrix} c & s \\ -s & c \end{pmatrix}
  *  \f]
  *
- *  The \p info parameter is optional and contains information collected by
- *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). If present, the
- *  information will be used to speed up the \p csrmv computation. If \p info == \p NULL,
- *  general \p csrmv routine will be used instead.
- *
  *  \code{.c}
- *      for(i = 0; i < m; ++i)
+ *      for(i = 0; i < nnz; ++i)
  *      {
- *          y[i] = beta * y[i];
+ *          x_tmp = x_val[i];
+ *          y_tmp = y[x_ind[i]];
  *
- *          for(j = csr_row_ptr[i]; j < csr_row_ptr[i + 1]; ++j)
- *          {
- *              y[i] = y[i] + alpha * csr_val[j] * x[csr_col_ind[j]];
- *          }
+ *          x_val[i]    = c * x_tmp + s * y_tmp;
+ *          y[x_ind[i]] = c * y_tmp - s * x_tmp;
  *      }
  *  \endcode
  *
@@ -815,294 +1188,236 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
- *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
- *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[in]
- *  n           number of columns of the sparse CSR matrix.
- *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
- *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
- *  @param[in]
- *  descr       descriptor of the sparse CSR matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
- *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
- *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start
- *              of every row of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of \f$x\f$.
+ *  @param[inout]
+ *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[inout]
+ *  y           array of values in dense format.
  *  @param[in]
- *  info        information collected by rocsparse_scsrmv_analysis() or
- *              rocsparse_dcsrmv_analysis(), can be \p NULL if no information is
- *              available.
+ *  c           pointer to the cosine element of \f$G\f$, can be on host or device.
  *  @param[in]
- *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  s           pointer to the sine element of \f$G\f$, can be on host or device.
  *  @param[in]
- *  beta        scalar \f$\beta\f$.
- *  @param[inout]
- *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
- *              invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  This example performs a sparse matrix vector multiplication in CSR format
- *  using additional meta data to improve performance.
- *  \code{.c}
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Perform analysis step to obtain meta data
- *      rocsparse_scsrmv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                n,
- *                                nnz,
- *                                descr,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info);
- *
- *      // Compute y = Ax
- *      rocsparse_scsrmv(handle,
- *                       rocsparse_operation_none,
- *                       m,
- *                       n,
- *                       nnz,
- *                       &alpha,
- *                       descr,
- *                       csr_val,
- *                       csr_row_ptr,
- *                       csr_col_ind,
- *                       info,
- *                       x,
- *                       &beta,
- *                       y);
- *
- *      // Do more work
- *      // ...
- *
- *      // Clean up
- *      rocsparse_destroy_mat_info(info);
- *  \endcode
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p c, \p s, \p x_val, \p x_ind or \p y
+ *              pointer is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             nnz,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  rocsparse_mat_info        info,
-                                  const float*              x,
-                                  const float*              beta,
-                                  float*                    y);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             nnz,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  rocsparse_mat_info        info,
-                                  const double*             x,
-                                  const double*             beta,
-                                  double*                   y);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int nnz,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  rocsparse_mat_info info,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* y);
+rocsparse_status rocsparse_sroti(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 float*               x_val,
+                                 const rocsparse_int* x_ind,
+                                 float*               y,
+                                 const float*         c,
+                                 const float*         s,
+                                 rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int nnz,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  rocsparse_mat_info info,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* y);
-*/
+rocsparse_status rocsparse_droti(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 double*              x_val,
+                                 const rocsparse_int* x_ind,
+                                 double*              y,
+                                 const double*        c,
+                                 const double*        s,
+                                 rocsparse_index_base idx_base);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Apply a sequence of Givens rotations to a dense and a sparse vector.
  *
  *  \details
- *  \p rocsparse_csrsv_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_scsrsv_solve() or
- *  rocsparse_dcsrsv_solve() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
- *  is stored in \p position, using same index base as the CSR matrix.
+ *  \p rocsparse_roti_multi applies the \p nrot Givens rotation matrices
+ *  \f$G_0, \dots, G_{\text{nrot}-1}\f$, in this order, to the sparse vector \f$x\f$ and
+ *  the dense vector \f$y\f$, where
+ *  \f[
+ *    G_k = \begin{pmatrix} c_k & s_k \\ -s_k & c_k \end{pmatrix}
+ *  \f]
  *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *  The result is the same as \p nrot consecutive calls to rocsparse_roti(), but the
+ *  entries of \f$x\f$ and the gathered entries of \f$y\f$ are read and written only
+ *  once, instead of once per rotation.
  *
- *  \note \p rocsparse_csrsv_zero_pivot is a blocking function. It might influence
- *  performance negatively.
+ *  \code{.c}
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          x_tmp = x_val[i];
+ *          y_tmp = y[x_ind[i]];
+ *
+ *          for(k = 0; k < nrot; ++k)
+ *          {
+ *              tmp   = c[k] * x_tmp + s[k] * y_tmp;
+ *              y_tmp = c[k] * y_tmp - s[k] * x_tmp;
+ *              x_tmp = tmp;
+ *          }
+ *
+ *          x_val[i]    = x_tmp;
+ *          y[x_ind[i]] = y_tmp;
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of \f$x\f$.
+ *  @param[inout]
+ *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
  *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *  y           array of values in dense format.
+ *  @param[in]
+ *  nrot        number of rotations.
+ *  @param[in]
+ *  c           array of \p nrot cosine elements of \f$G_k\f$, can be on host or device.
+ *  @param[in]
+ *  s           array of \p nrot sine elements of \f$G_k\f$, can be on host or device.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz or \p nrot is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p c, \p s, \p x_val, \p x_ind or \p y
+ *              pointer is invalid.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
-                                            const rocsparse_mat_descr descr,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_int*            position);
+rocsparse_status rocsparse_sroti_multi(rocsparse_handle     handle,
+                                       rocsparse_int        nnz,
+                                       float*               x_val,
+                                       const rocsparse_int* x_ind,
+                                       float*               y,
+                                       rocsparse_int        nrot,
+                                       const float*         c,
+                                       const float*         s,
+                                       rocsparse_index_base idx_base);
 
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_droti_multi(rocsparse_handle     handle,
+                                       rocsparse_int        nnz,
+                                       double*              x_val,
+                                       const rocsparse_int* x_ind,
+                                       double*              y,
+                                       rocsparse_int        nrot,
+                                       const double*        c,
+                                       const double*        s,
+                                       rocsparse_index_base idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Scatter elements from a dense vector across a sparse vector.
  *
  *  \details
- *  \p rocsparse_csrsv_buffer_size returns the size of the temporary storage buffer that
- *  is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
- *  rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve(). The temporary storage buffer
- *  must be allocated by the user. The size of the temporary storage buffer is identical
- *  to the size returned by rocsparse_scsrilu0_buffer_size() and
- *  rocsparse_dcsrilu0_buffer_size() if the matrix sparsity pattern is identical. The
- *  user allocated buffer can thus be shared between subsequent calls to those functions.
+ *  \p rocsparse_sctr scatters the elements that are listed in \p x_ind from the sparse
+ *  vector \f$x\f$ into the dense vector \f$y\f$. Indices of \f$y\f$ that are not listed
+ *  in \p x_ind remain unchanged.
+ *
+ *  \code{.c}
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          y[x_ind[i]] = x_val[i];
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
- *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of \f$x\f$.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of x.
+ *  @param[inout]
+ *  y           array of values in dense format.
  *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
- *              rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve().
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p x_val, \p x_ind or \p y pointer is
+ *              invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_operation       trans,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nnz,
-                                              const rocsparse_mat_descr descr,
-                                              const float*              csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size);
+rocsparse_status rocsparse_ssctr(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 const float*         x_val,
+                                 const rocsparse_int* x_ind,
+                                 float*               y,
+                                 rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_operation       trans,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nnz,
-                                              const rocsparse_mat_descr descr,
-                                              const double*             csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size);
+rocsparse_status rocsparse_dsctr(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 const double*        x_val,
+                                 const rocsparse_int* x_ind,
+                                 double*              y,
+                                 rocsparse_index_base idx_base);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csctr(rocsparse_handle handle,
+                                 rocsparse_int nnz,
+                                 const rocsparse_float_complex* x_val,
+                                 const rocsparse_int* x_ind,
+                                 rocsparse_float_complex* y,
+                                 rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zsctr(rocsparse_handle handle,
+                                 rocsparse_int nnz,
+                                 const rocsparse_double_complex* x_val,
+                                 const rocsparse_int* x_ind,
+                                 rocsparse_double_complex* y,
+                                 rocsparse_index_base idx_base);
+*/
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Scatter elements from a strided batch of sparse vectors into dense vectors.
  *
  *  \details
- *  \p rocsparse_csrsv_analysis performs the analysis step for rocsparse_scsrsv_solve()
- *  and rocsparse_dcsrsv_solve(). It is expected that this function will be executed only
- *  once for a given matrix and particular operation type. The analysis meta data can be
- *  cleared by rocsparse_csrsv_clear().
+ *  \p rocsparse_sctr_strided_batched scatters the elements that are listed in \p x_ind from
+ *  each sparse vector \f$x_b\f$ of a batch into the corresponding dense vector
+ *  \f$y_b\f$. Indices of \f$y_b\f$ that are not listed in \p x_ind remain unchanged.
  *
- *  \p rocsparse_csrsv_analysis can share its meta data with
- *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
+ *  All vectors of the batch share the number of non-zero entries and are stored at a
+ *  constant stride from each other. The batch is processed by a single kernel launch.
  *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *  \code{.c}
+ *      for(b = 0; b < batch_count; ++b)
+ *      {
+ *          for(i = 0; i < nnz; ++i)
+ *          {
+ *              y_b[x_ind_b[i]] = x_val_b[i];
+ *          }
+ *      }
+ *  \endcode
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -1111,112 +1426,146 @@ rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle          handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  x_val       array of \p batch_count vectors of \p nnz elements containing the
+ *              values of \f$x_b\f$.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  stride_x    stride between consecutive vectors of \p x_val.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  x_ind       array of \p batch_count vectors of \p nnz elements containing the
+ *              indices of the non-zero values of \f$x_b\f$.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
+ *  stride_ind  stride between consecutive vectors of \p x_ind.
+ *  @param[inout]
+ *  y           array of \p batch_count vectors in dense format.
  *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
+ *  stride_y    stride between consecutive vectors of \p y.
  *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
+ *  batch_count number of vectors in the batch.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p batch_count or a stride is
+ *          invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind or \p y pointer
+ *          is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const float*              csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_ssctr_strided_batched(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const float*         x_val,
+                                                 rocsparse_int        stride_x,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 float*               y,
+                                                 rocsparse_int        stride_y,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const double*             csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_dsctr_strided_batched(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const double*        x_val,
+                                                 rocsparse_int        stride_x,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 double*              y,
+                                                 rocsparse_int        stride_y,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Scatter elements from a batch of sparse vectors into dense vectors.
  *
  *  \details
- *  \p rocsparse_csrsv_clear deallocates all memory that was allocated by
- *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis(). This is especially
- *  useful, if memory is an issue and the analysis data is not required for further
- *  computation, e.g. when switching to another sparse matrix format. Calling
- *  \p rocsparse_csrsv_clear is optional. All allocated resources will be cleared, when
- *  the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
+ *  \p rocsparse_sctr_batched scatters the elements that are listed in \p x_ind from
+ *  each sparse vector \f$x_b\f$ of a batch into the corresponding dense vector
+ *  \f$y_b\f$. Indices of \f$y_b\f$ that are not listed in \p x_ind remain unchanged.
+ *
+ *  All vectors of the batch share the number of non-zero entries. The vectors are
+ *  passed as device arrays of \p batch_count device pointers. The batch is processed by
+ *  a single kernel launch.
+ *
+ *  \code{.c}
+ *      for(b = 0; b < batch_count; ++b)
+ *      {
+ *          for(i = 0; i < nnz; ++i)
+ *          {
+ *              y_b[x_ind_b[i]] = x_val_b[i];
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of each sparse vector \f$x_b\f$.
+ *  @param[in]
+ *  x_val       array of \p batch_count pointers to the \p nnz values of
+ *              \f$x_b\f$.
+ *  @param[in]
+ *  x_ind       array of \p batch_count pointers to the \p nnz indices of the
+ *              non-zero values of \f$x_b\f$.
  *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
+ *  y           array of \p batch_count pointers to the dense vectors \f$y_b\f$.
+ *  @param[in]
+ *  batch_count number of vectors in the batch.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz or \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind or \p y pointer
+ *          is invalid.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
-                                       const rocsparse_mat_descr descr,
-                                       rocsparse_mat_info        info);
+rocsparse_status rocsparse_ssctr_batched(rocsparse_handle            handle,
+                                         rocsparse_int               nnz,
+                                         const float* const*         x_val,
+                                         const rocsparse_int* const* x_ind,
+                                         float* const*               y,
+                                         rocsparse_int               batch_count,
+                                         rocsparse_index_base        idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsctr_batched(rocsparse_handle            handle,
+                                         rocsparse_int               nnz,
+                                         const double* const*        x_val,
+                                         const rocsparse_int* const* x_ind,
+                                         double* const*              y,
+                                         rocsparse_int               batch_count,
+                                         rocsparse_index_base        idx_base);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    level 2 SPARSE
+ * ===========================================================================
+ */
 
 /*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+ *  \brief Sparse matrix vector multiplication using COO storage format
  *
  *  \details
- *  \p rocsparse_csrsv_solve solves a sparse triangular linear system of a sparse
- *  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution vector
- *  \f$y\f$ and the right-hand side \f$x\f$ that is multiplied by \f$\alpha\f$, such that
+ *  \p rocsparse_coomv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in COO storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
  *  \f[
- *    op(A) \cdot y = \alpha \cdot x,
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
  *  \f]
  *  with
  *  \f[
@@ -1229,18 +1578,20 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
  *    \right.
  *  \f]
  *
- *  \p rocsparse_csrsv_solve requires a user allocated temporary buffer. Its size is
- *  returned by rocsparse_scsrsv_buffer_size() or rocsparse_dcsrsv_buffer_size().
- *  Furthermore, analysis meta data is required. It can be obtained by
- *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis().
- *  \p rocsparse_csrsv_solve reports the first zero pivot (either numerical or structural
- *  zero). The zero pivot status can be checked calling rocsparse_csrsv_zero_pivot().
- *  If \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
- *  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
+ *  The COO matrix has to be sorted by row indices. This can be achieved by using
+ *  rocsparse_coosort_by_row().
  *
- *  \note
- *  The sparse CSR matrix has to be sorted. This can be achieved by calling
- *  rocsparse_csrsort().
+ *  \code{.c}
+ *      for(i = 0; i < m; ++i)
+ *      {
+ *          y[i] = beta * y[i];
+ *      }
+ *
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          y[coo_row_ind[i]] += alpha * coo_val[i] * x[coo_col_ind[i]];
+ *      }
+ *  \endcode
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -1254,290 +1605,100 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
  *  @param[in]
  *  trans       matrix operation type.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  m           number of rows of the sparse COO matrix.
  *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
+ *  n           number of columns of the sparse COO matrix.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of the sparse COO matrix.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  alpha       scalar \f$\alpha\f$.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start
- *              of every row of the sparse CSR matrix.
+ *  descr       descriptor of the sparse COO matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  coo_val     array of \p nnz elements of the sparse COO matrix.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
+ *              matrix.
  *  @param[in]
- *  x           array of \p m elements, holding the right-hand side.
- *  @param[out]
- *  y           array of \p m elements, holding the solution.
+ *  coo_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              COO matrix.
  *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
+ *  x           array of \p n elements (\f$op(A) = A\f$) or \p m elements
+ *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) = A\f$) or \p n elements
+ *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p coo_val,
+ *              \p coo_row_ind, \p coo_col_ind, \p x, \p beta or \p y pointer is invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  Consider the lower triangular \f$m \times m\f$ matrix \f$L\f$, stored in CSR
- *  storage format with unit diagonal. The following example solves \f$L \cdot y = x\f$.
- *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
- *
- *      // Create matrix descriptor
- *      rocsparse_mat_descr descr;
- *      rocsparse_create_mat_descr(&descr);
- *      rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower);
- *      rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit);
- *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Obtain required buffer size
- *      size_t buffer_size;
- *      rocsparse_dcsrsv_buffer_size(handle,
- *                                   rocsparse_operation_none,
- *                                   m,
- *                                   nnz,
- *                                   descr,
- *                                   csr_val,
- *                                   csr_row_ptr,
- *                                   csr_col_ind,
- *                                   info,
- *                                   &buffer_size);
- *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
- *
- *      // Perform analysis step
- *      rocsparse_dcsrsv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                nnz,
- *                                descr,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *
- *      // Solve Ly = x
- *      rocsparse_dcsrsv_solve(handle,
- *                             rocsparse_operation_none,
- *                             m,
- *                             nnz,
- *                             &alpha,
- *                             descr,
- *                             csr_val,
- *                             csr_row_ptr,
- *                             csr_col_ind,
- *                             info,
- *                             x,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
- *
- *      // No zero pivot should be found, with L having unit diagonal
- *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr);
- *      rocsparse_destroy_handle(handle);
- *  \endcode
- */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_solve(rocsparse_handle          handle,
-                                        rocsparse_operation       trans,
-                                        rocsparse_int             m,
-                                        rocsparse_int             nnz,
-                                        const float*              alpha,
-                                        const rocsparse_mat_descr descr,
-                                        const float*              csr_val,
-                                        const rocsparse_int*      csr_row_ptr,
-                                        const rocsparse_int*      csr_col_ind,
-                                        rocsparse_mat_info        info,
-                                        const float*              x,
-                                        float*                    y,
-                                        rocsparse_solve_policy    policy,
-                                        void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle          handle,
-                                        rocsparse_operation       trans,
-                                        rocsparse_int             m,
-                                        rocsparse_int             nnz,
-                                        const double*             alpha,
-                                        const rocsparse_mat_descr descr,
-                                        const double*             csr_val,
-                                        const rocsparse_int*      csr_row_ptr,
-                                        const rocsparse_int*      csr_col_ind,
-                                        rocsparse_mat_info        info,
-                                        const double*             x,
-                                        double*                   y,
-                                        rocsparse_solve_policy    policy,
-                                        void*                     temp_buffer);
-/**@}*/
-
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using ELL storage format
- *
- *  \details
- *  \p rocsparse_ellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in ELL storage format, and the dense vector \f$x\f$ and adds the
- *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
- *  such that
- *  \f[
- *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
- *  \f]
- *  with
- *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans == rocsparse_operation_none} \\
- *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
- *  \f]
- *
- *  \code{.c}
- *      for(i = 0; i < m; ++i)
- *      {
- *          y[i] = beta * y[i];
- *
- *          for(p = 0; p < ell_width; ++p)
- *          {
- *              idx = p * m + i;
- *
- *              if((ell_col_ind[idx] >= 0) && (ell_col_ind[idx] < n))
- *              {
- *                  y[i] = y[i] + alpha * ell_val[idx] * x[ell_col_ind[idx]];
- *              }
- *          }
- *      }
- *  \endcode
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse ELL matrix.
- *  @param[in]
- *  n           number of columns of the sparse ELL matrix.
- *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
- *  @param[in]
- *  descr       descriptor of the sparse ELL matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
- *  @param[in]
- *  ell_val     array that contains the elements of the sparse ELL matrix. Padded
- *              elements should be zero.
- *  @param[in]
- *  ell_col_ind array that contains the column indices of the sparse ELL matrix.
- *              Padded column indices should be -1.
- *  @param[in]
- *  ell_width   number of non-zero elements per row of the sparse ELL matrix.
- *  @param[in]
- *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
- *  @param[in]
- *  beta        scalar \f$\beta\f$.
- *  @param[inout]
- *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
- *              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle          handle,
+rocsparse_status rocsparse_scoomv(rocsparse_handle          handle,
                                   rocsparse_operation       trans,
                                   rocsparse_int             m,
                                   rocsparse_int             n,
+                                  rocsparse_int             nnz,
                                   const float*              alpha,
                                   const rocsparse_mat_descr descr,
-                                  const float*              ell_val,
-                                  const rocsparse_int*      ell_col_ind,
-                                  rocsparse_int             ell_width,
+                                  const float*              coo_val,
+                                  const rocsparse_int*      coo_row_ind,
+                                  const rocsparse_int*      coo_col_ind,
                                   const float*              x,
                                   const float*              beta,
                                   float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dellmv(rocsparse_handle          handle,
+rocsparse_status rocsparse_dcoomv(rocsparse_handle          handle,
                                   rocsparse_operation       trans,
                                   rocsparse_int             m,
                                   rocsparse_int             n,
+                                  rocsparse_int             nnz,
                                   const double*             alpha,
                                   const rocsparse_mat_descr descr,
-                                  const double*             ell_val,
-                                  const rocsparse_int*      ell_col_ind,
-                                  rocsparse_int             ell_width,
+                                  const double*             coo_val,
+                                  const rocsparse_int*      coo_row_ind,
+                                  const rocsparse_int*      coo_col_ind,
                                   const double*             x,
                                   const double*             beta,
                                   double*                   y);
-
 /*
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
+rocsparse_status rocsparse_ccoomv(rocsparse_handle handle,
                                   rocsparse_operation trans,
                                   rocsparse_int m,
                                   rocsparse_int n,
+                                  rocsparse_int nnz,
                                   const rocsparse_float_complex* alpha,
                                   const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* ell_val,
-                                  const rocsparse_int* ell_col_ind,
-                                  rocsparse_int ell_width,
+                                  const rocsparse_float_complex* coo_val,
+                                  const rocsparse_int* coo_row_ind,
+                                  const rocsparse_int* coo_col_ind,
                                   const rocsparse_float_complex* x,
                                   const rocsparse_float_complex* beta,
                                   rocsparse_float_complex* y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
+rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
                                   rocsparse_operation trans,
                                   rocsparse_int m,
                                   rocsparse_int n,
+                                  rocsparse_int nnz,
                                   const rocsparse_double_complex* alpha,
                                   const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* ell_val,
-                                  const rocsparse_int* ell_col_ind,
-                                  rocsparse_int ell_width,
+                                  const rocsparse_double_complex* coo_val,
+                                  const rocsparse_int* coo_row_ind,
+                                  const rocsparse_int* coo_col_ind,
                                   const rocsparse_double_complex* x,
                                   const rocsparse_double_complex* beta,
                                   rocsparse_double_complex* y);
@@ -1545,161 +1706,178 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
 /**@}*/
 
 /*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using HYB storage format
+ *  \brief Sparse matrix vector multiplication using CSR storage format
  *
  *  \details
- *  \p rocsparse_hybmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in HYB storage format, and the dense vector \f$x\f$ and adds the
- *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
- *  such that
- *  \f[
- *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
- *  \f]
- *  with
- *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans == rocsparse_operation_none} \\
- *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
- *  \f]
+ *  \p rocsparse_csrmv_analysis performs the analysis step for rocsparse_scsrmv() and
+ *  rocsparse_dcsrmv(). It is expected that this function will be executed only once for
+ *  a given matrix and particular operation type. The gathered analysis meta data can be
+ *  cleared by rocsparse_csrmv_clear().
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  If \p trans != \ref rocsparse_operation_none, the analysis step chooses how the
+ *  rows of the matrix are scattered into the result, based on the number of columns
+ *  and the distribution of the non-zero entries over the columns. In
+ *  \ref rocsparse_analysis_mode_host, the longest column is determined on the device,
+ *  which requires a host synchronization.
+ *
+ *  \note
+ *  For \ref rocsparse_matrix_type_symmetric and \ref rocsparse_matrix_type_hermitian
+ *  matrices, the analysis step stores the transposed sparsity pattern of the matrix,
+ *  which requires \p m + 1 + 2 * \p nnz additional integers of device memory.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
  *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *  If the \ref rocsparse_analysis_mode of the library context is
+ *  \ref rocsparse_analysis_mode_host, the meta data is computed on the host, which
+ *  requires \p csr_row_ptr to be copied to the host. If the analysis mode is
+ *  \ref rocsparse_analysis_mode_device, the meta data is computed on the device
+ *  without any host synchronization. Both modes gather identical meta data.
+ *
+ *  \note
+ *  If the \ref rocsparse_analysis_policy of the library context is
+ *  \ref rocsparse_analysis_policy_reuse, already gathered meta data is re-used, if
+ *  the sparsity pattern of the matrix, identified by a structural hash of
+ *  \p csr_row_ptr and \p csr_col_ind, did not change. Computing the hash requires a
+ *  host synchronization. By default, the meta data is always re-built. The analysis
+ *  policy can be changed by rocsparse_set_analysis_policy().
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
  *  trans       matrix operation type.
  *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
+ *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
- *  descr       descriptor of the sparse HYB matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  n           number of columns of the sparse CSR matrix.
  *  @param[in]
- *  hyb         matrix in HYB storage format.
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  descr       descriptor of the sparse CSR matrix.
  *  @param[in]
- *  beta        scalar \f$\beta\f$.
- *  @param[inout]
- *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p hyb structure was not initialized with
- *              valid matrix sizes.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p hyb, \p x,
- *              \p beta or \p y pointer is invalid.
- *  \retval     rocsparse_status_invalid_value \p hyb structure was not initialized
- *              with a valid partitioning type.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_memory_error the buffer could not be allocated.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid, or
+ *              \p m != \p n for symmetric or Hermitian matrices.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the gathered information
+ *              could not be allocated.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general,
+ *              \ref rocsparse_matrix_type_symmetric or
+ *              \ref rocsparse_matrix_type_hermitian.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_shybmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat   hyb,
-                                  const float*              x,
-                                  const float*              beta,
-                                  float*                    y);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dhybmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat   hyb,
-                                  const double*             x,
-                                  const double*             beta,
-                                  double*                   y);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_shybmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat hyb,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* y);
+rocsparse_status rocsparse_scsrmv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat hyb,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* y);
-*/
+rocsparse_status rocsparse_dcsrmv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info);
 /**@}*/
 
-/*
- * ===========================================================================
- *    level 3 SPARSE
- * ===========================================================================
- */
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required anymore for
+ *  further computation, e.g. when switching to another sparse matrix format.
+ *
+ *  \note
+ *  Calling \p rocsparse_csrmv_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the gathered information
+ *              could not be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ * */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
-/*! \ingroup level3_module
- *  \brief Sparse matrix dense matrix multiplication using CSR storage format
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using CSR storage format
  *
  *  \details
- *  \p rocsparse_csrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
- *  matrix \f$A\f$, defined in CSR storage format, and the dense \f$k \times n\f$
- *  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
- *  is multiplied by the scalar \f$\beta\f$, such that
+ *  \p rocsparse_csrmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in CSR storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
  *  \f[
- *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
  *  \f]
  *  with
  *  \f[
  *    op(A) = \left\{
  *    \begin{array}{ll}
- *        A,   & \text{if trans_A == rocsparse_operation_none} \\
- *        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
- *  \f]
- *  and
- *  \f[
- *    op(B) = \left\{
- *    \begin{array}{ll}
- *        B,   & \text{if trans_B == rocsparse_operation_none} \\
- *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
- *        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
  *    \end{array}
  *    \right.
  *  \f]
  *
+ *  The \p info parameter is optional and contains information collected by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). If present, the
+ *  information will be used to speed up the \p csrmv computation. If \p info == \p NULL,
+ *  general \p csrmv routine will be used instead. In this case, the algorithm is
+ *  selected by rocsparse_set_csrmv_alg(). The merge path algorithm splits the rows
+ *  and the non-zero entries evenly across threads and does not require any analysis,
+ *  which is beneficial for matrices with highly irregular row lengths.
+ *
  *  \code{.c}
- *      for(i = 0; i < ldc; ++i)
+ *      for(i = 0; i < m; ++i)
  *      {
- *          for(j = 0; j < n; ++j)
- *          {
- *              C[i][j] = beta * C[i][j];
+ *          y[i] = beta * y[i];
  *
- *              for(k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
- *              {
- *                  C[i][j] += alpha * csr_val[k] * B[csr_col_ind[k]][j];
- *              }
+ *          for(j = csr_row_ptr[i]; j < csr_row_ptr[i + 1]; ++j)
+ *          {
+ *              y[i] = y[i] + alpha * csr_val[j] * x[csr_col_ind[j]];
  *          }
  *      }
  *  \endcode
@@ -1709,225 +1887,3140 @@ rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
  *  It may return before the actual computation has finished.
  *
  *  \note
- *  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+ *  If \p trans != \ref rocsparse_operation_none, the rows of the matrix are scattered
+ *  into \f$y\f$ using atomic operations, such that no transposed copy of the matrix
+ *  is required. The strategy is chosen by rocsparse_scsrmv_analysis() or
+ *  rocsparse_dcsrmv_analysis(), if \p info is present. Due to the atomic
+ *  accumulation, the order of the floating point summation is not deterministic.
+ *
+ *  \note
+ *  If the matrix type is \ref rocsparse_matrix_type_symmetric or
+ *  \ref rocsparse_matrix_type_hermitian, only the triangular part of the matrix
+ *  selected by \ref rocsparse_fill_mode is accessed, while the entries of the other
+ *  triangular part are ignored. The full matrix \f$A = L + D + L^T\f$ is applied, where
+ *  each stored off-diagonal entry contributes to its row and, mirrored, to its column.
+ *  Since \f$A = A^T\f$, all operation types are supported. If \p info is present,
+ *  each row gathers its mirrored entries from the transposed sparsity pattern, such
+ *  that the result is deterministic. If \p info == \p NULL, the mirrored entries are
+ *  accumulated into \p y atomically, which requires an additional pass to scale
+ *  \p y by \f$\beta\f$, contends on columns with many entries and makes the order
+ *  of the floating point summation non-deterministic.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans_A     matrix \f$A\f$ operation type.
- *  @param[in]
- *  trans_B     matrix \f$B\f$ operation type.
- *  @param[in]
- *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  trans       matrix operation type.
  *  @param[in]
- *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+ *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
- *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  n           number of columns of the sparse CSR matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
  *  alpha       scalar \f$\alpha\f$.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general, \ref rocsparse_matrix_type_symmetric
+ *              and \ref rocsparse_matrix_type_hermitian are supported.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix \f$A\f$.
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
  *  @param[in]
  *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix \f$A\f$.
+ *              CSR matrix.
  *  @param[in]
- *  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
- *              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis(), can be \p NULL if no information is
+ *              available.
  *  @param[in]
- *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$
- *              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ (\f$op(A) == A^T\f$ or
- *              \f$op(A) == A^H\f$).
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
  *  @param[in]
  *  beta        scalar \f$\beta\f$.
  *  @param[inout]
- *  C           array of dimension \f$ldc \times n\f$.
- *  @param[in]
- *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$
- *              (\f$op(A) == A\f$) or \f$\max{(1, k)}\f$ (\f$op(A) == A^T\f$ or
- *              \f$op(A) == A^H\f$).
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or \p ldc
- *              is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid, or
+ *              \p m != \p n for symmetric or Hermitian matrices.
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans_A != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general,
+ *              \ref rocsparse_matrix_type_symmetric or
+ *              \ref rocsparse_matrix_type_hermitian.
  *
  *  \par Example
- *  This example multiplies a CSR matrix with a dense matrix.
+ *  This example performs a sparse matrix vector multiplication in CSR format
+ *  using additional meta data to improve performance.
  *  \code{.c}
- *      //     1 2 0 3 0
- *      // A = 0 4 5 0 0
- *      //     6 0 0 7 8
- *
- *      rocsparse_int m   = 3;
- *      rocsparse_int k   = 5;
- *      rocsparse_int nnz = 8;
- *
- *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
  *
- *      // Set dimension n of B
- *      rocsparse_int n = 64;
+ *      // Perform analysis step to obtain meta data
+ *      rocsparse_scsrmv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                n,
+ *                                nnz,
+ *                                descr,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info);
  *
- *      // Allocate and generate dense matrix B
- *      std::vector<float> hB(k * n);
- *      for(rocsparse_int i = 0; i < k * n; ++i)
- *      {
- *          hB[i] = static_cast<float>(rand()) / RAND_MAX;
- *      }
- *
- *      // Copy B to the device
- *      float* B;
- *      hipMalloc((void**)&B, sizeof(float) * k * n);
- *      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
- *
- *      // alpha and beta
- *      float alpha = 1.0f;
- *      float beta  = 0.0f;
- *
- *      // Allocate memory for the resulting matrix C
- *      float* C;
- *      hipMalloc((void**)&C, sizeof(float) * m * n);
- *
- *      // Perform the matrix multiplication
- *      rocsparse_scsrmm(handle,
- *                       rocsparse_operation_none,
+ *      // Compute y = Ax
+ *      rocsparse_scsrmv(handle,
  *                       rocsparse_operation_none,
  *                       m,
  *                       n,
- *                       k,
  *                       nnz,
  *                       &alpha,
  *                       descr,
  *                       csr_val,
  *                       csr_row_ptr,
  *                       csr_col_ind,
- *                       B,
- *                       k,
+ *                       info,
+ *                       x,
  *                       &beta,
- *                       C,
- *                       m);
+ *                       y);
+ *
+ *      // Do more work
+ *      // ...
+ *
+ *      // Clean up
+ *      rocsparse_destroy_mat_info(info);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_mat_info info,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_mat_info info,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
+*/
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix multiple vector multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_multi multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in CSR storage format, and each of the \p k dense
+ *  vectors \f$x_j\f$ and adds the result to the dense vector \f$y_j\f$ that is
+ *  multiplied by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    y_j := \alpha \cdot op(A) \cdot x_j + \beta \cdot y_j, \quad j = 0, \ldots, k-1
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The vectors are stored column-major, i.e. \f$x_j\f$ starts at \p x + \p j * \p ldx
+ *  and \f$y_j\f$ starts at \p y + \p j * \p ldy.
+ *
+ *  The \p info parameter is optional and contains information collected by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). If present, the row
+ *  blocks of the analysis are re-used and each row block of the sparse matrix is only
+ *  loaded once for a set of vectors, instead of once per vector. If \p info == \p NULL,
+ *  general \p csrmv routine will be called for each vector instead.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  k           number of dense vectors.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis(), can be \p NULL if no information is
+ *              available.
+ *  @param[in]
+ *  x           array of dimension \f$ldx \times k\f$.
+ *  @param[in]
+ *  ldx         leading dimension of \p x, must be at least \f$\max{(1, n)}\f$
+ *              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ otherwise.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of dimension \f$ldy \times k\f$.
+ *  @param[in]
+ *  ldy         leading dimension of \p y, must be at least \f$\max{(1, m)}\f$
+ *              (\f$op(A) == A\f$) or \f$\max{(1, n)}\f$ otherwise.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldx or
+ *              \p ldy is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_multi(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             k,
+                                        rocsparse_int             nnz,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const float*              x,
+                                        rocsparse_int             ldx,
+                                        const float*              beta,
+                                        float*                    y,
+                                        rocsparse_int             ldy);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_multi(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             k,
+                                        rocsparse_int             nnz,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const double*             x,
+                                        rocsparse_int             ldx,
+                                        const double*             beta,
+                                        double*                   y,
+                                        rocsparse_int             ldy);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsrsv_solve() or
+ *  rocsparse_dcsrsv_solve() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csrsv_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int*            position);
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_buffer_size returns the size of the temporary storage buffer that
+ *  is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *  rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve(). The temporary storage buffer
+ *  must be allocated by the user. The size of the temporary storage buffer is identical
+ *  to the size returned by rocsparse_scsrilu0_buffer_size() and
+ *  rocsparse_dcsrilu0_buffer_size() if the matrix sparsity pattern is identical. The
+ *  user allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *              rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans == \ref rocsparse_operation_conjugate_transpose or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_analysis performs the analysis step for rocsparse_scsrsv_solve()
+ *  and rocsparse_dcsrsv_solve(). It is expected that this function will be executed only
+ *  once for a given matrix and particular operation type. The analysis meta data can be
+ *  cleared by rocsparse_csrsv_clear().
+ *  Meta data of transposed and non-transposed solves is kept separately, such that
+ *  both solves can be performed with the same \ref rocsparse_mat_info.
+ *
+ *  \p rocsparse_csrsv_analysis can share its meta data with
+ *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. Meta data is only re-used, if it has been gathered for
+ *  the same sparsity pattern, which is identified by a structural hash of
+ *  \p csr_row_ptr and \p csr_col_ind. Thus, meta data can also be re-used for
+ *  matrices with the same sparsity pattern, that are stored in different buffers.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans == \ref rocsparse_operation_conjugate_transpose or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation, e.g. when switching to another sparse matrix format. Calling
+ *  \p rocsparse_csrsv_clear is optional. All allocated resources will be cleared, when
+ *  the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
+                                       const rocsparse_mat_descr descr,
+                                       rocsparse_mat_info        info);
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_solve solves a sparse triangular linear system of a sparse
+ *  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution vector
+ *  \f$y\f$ and the right-hand side \f$x\f$ that is multiplied by \f$\alpha\f$, such that
+ *  \f[
+ *    op(A) \cdot y = \alpha \cdot x,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \p rocsparse_csrsv_solve requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_scsrsv_buffer_size() or rocsparse_dcsrsv_buffer_size().
+ *  Furthermore, analysis meta data is required. It can be obtained by
+ *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis().
+ *  \p rocsparse_csrsv_solve reports the first zero pivot (either numerical or structural
+ *  zero). The zero pivot status can be checked calling rocsparse_csrsv_zero_pivot().
+ *  If \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
+ *  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
+ *
+ *  If the analysis found a small number of wide dependency levels, the system is
+ *  solved level by level. Otherwise, all rows are solved by a single kernel that
+ *  resolves dependencies on the fly.
+ *
+ *  Transposed systems are solved directly on the CSR matrix, without explicitly
+ *  transposing it. Each row scatters its contribution to the rows that depend on it,
+ *  thus the results might differ in rounding from run to run. The analysis has to be
+ *  performed with the same \p trans as the solve.
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none and
+ *  \p trans == \ref rocsparse_operation_transpose are supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  x           array of \p m elements, holding the right-hand side.
+ *  @param[out]
+ *  y           array of \p m elements, holding the solution.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans == \ref rocsparse_operation_conjugate_transpose or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the lower triangular \f$m \times m\f$ matrix \f$L\f$, stored in CSR
+ *  storage format with unit diagonal. The following example solves \f$L \cdot y = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor
+ *      rocsparse_mat_descr descr;
+ *      rocsparse_create_mat_descr(&descr);
+ *      rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size;
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size);
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis step
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Solve Ly = x
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             x,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // No zero pivot should be found, with L having unit diagonal
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const float*              x,
+                                        float*                    y,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const double*             x,
+                                        double*                   y,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using ELL storage format
+ *
+ *  \details
+ *  \p rocsparse_ellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in ELL storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \code{.c}
+ *      for(i = 0; i < m; ++i)
+ *      {
+ *          y[i] = beta * y[i];
+ *
+ *          for(p = 0; p < ell_width; ++p)
+ *          {
+ *              idx = p * m + i;
+ *
+ *              if((ell_col_ind[idx] >= 0) && (ell_col_ind[idx] < n))
+ *              {
+ *                  y[i] = y[i] + alpha * ell_val[idx] * x[ell_col_ind[idx]];
+ *              }
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse ELL matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse ELL matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  ell_val     array that contains the elements of the sparse ELL matrix. Padded
+ *              elements should be zero.
+ *  @param[in]
+ *  ell_col_ind array that contains the column indices of the sparse ELL matrix.
+ *              Padded column indices should be -1.
+ *  @param[in]
+ *  ell_width   number of non-zero elements per row of the sparse ELL matrix.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
+ *              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sellmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              ell_val,
+                                  const rocsparse_int*      ell_col_ind,
+                                  rocsparse_int             ell_width,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dellmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             ell_val,
+                                  const rocsparse_int*      ell_col_ind,
+                                  rocsparse_int             ell_width,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
+
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_float_complex* ell_val,
+                                  const rocsparse_int* ell_col_ind,
+                                  rocsparse_int ell_width,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_double_complex* ell_val,
+                                  const rocsparse_int* ell_col_ind,
+                                  rocsparse_int ell_width,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
+*/
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using HYB storage format
+ *
+ *  \details
+ *  \p rocsparse_hybmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in HYB storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse HYB matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  hyb         matrix in HYB storage format.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p hyb structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p hyb, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p hyb structure was not initialized
+ *              with a valid partitioning type.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_memory_error the buffer could not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_shybmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat   hyb,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dhybmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat   hyb,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_shybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
+*/
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using CSR5 storage format
+ *
+ *  \details
+ *  \p rocsparse_csr5mv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in CSR5 storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The CSR5 matrix has to be created by rocsparse_csr2csr5(). Each thread processes a
+ *  fixed number of non-zero entries, independent of the row lengths, which makes
+ *  \p rocsparse_csr5mv well suited for matrices with very irregular row lengths.
+ *
+ *  \note
+ *  Partial row sums that cross tile boundaries are accumulated using atomic
+ *  operations. Thus, results may differ in the last bits between two calls.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR5 matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr5        matrix in CSR5 storage format.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p csr5 structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr5, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr5mv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_csr5_mat  csr5,
+                                   const float*              x,
+                                   const float*              beta,
+                                   float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr5mv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_csr5_mat  csr5,
+                                   const double*             x,
+                                   const double*             beta,
+                                   double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using SELL-C-sigma storage format
+ *
+ *  \details
+ *  \p rocsparse_sellcsmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in SELL-C-sigma storage format, and the dense vector \f$x\f$ and adds
+ *  the result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The SELL-C-sigma matrix has to be created by rocsparse_csr2sellcs().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse SELL-C-sigma matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  sell        matrix in SELL-C-sigma storage format.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p sell structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p sell, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ssellcsmv(rocsparse_handle           handle,
+                                     rocsparse_operation        trans,
+                                     const float*               alpha,
+                                     const rocsparse_mat_descr  descr,
+                                     const rocsparse_sellcs_mat sell,
+                                     const float*               x,
+                                     const float*               beta,
+                                     float*                     y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsellcsmv(rocsparse_handle           handle,
+                                     rocsparse_operation        trans,
+                                     const double*              alpha,
+                                     const rocsparse_mat_descr  descr,
+                                     const rocsparse_sellcs_mat sell,
+                                     const double*              x,
+                                     const double*              beta,
+                                     double*                    y);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    level 3 SPARSE
+ * ===========================================================================
+ */
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix dense matrix multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
+ *  matrix \f$A\f$, defined in CSR storage format, and the dense \f$k \times n\f$
+ *  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
+ *  is multiplied by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans_A == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *  and
+ *  \f[
+ *    op(B) = \left\{
+ *    \begin{array}{ll}
+ *        B,   & \text{if trans_B == rocsparse_operation_none} \\
+ *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+ *        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \code{.c}
+ *      for(i = 0; i < ldc; ++i)
+ *      {
+ *          for(j = 0; j < n; ++j)
+ *          {
+ *              C[i][j] = beta * C[i][j];
+ *
+ *              for(k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
+ *              {
+ *                  C[i][j] += alpha * csr_val[k] * B[csr_col_ind[k]][j];
+ *              }
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix \f$A\f$.
+ *  @param[in]
+ *  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
+ *              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$
+ *              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ (\f$op(A) == A^T\f$ or
+ *              \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension \f$ldc \times n\f$.
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$
+ *              (\f$op(A) == A\f$) or \f$\max{(1, k)}\f$ (\f$op(A) == A^T\f$ or
+ *              \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or \p ldc
+ *              is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example multiplies a CSR matrix with a dense matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
+ *
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int k   = 5;
+ *      rocsparse_int nnz = 8;
+ *
+ *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *
+ *      // Set dimension n of B
+ *      rocsparse_int n = 64;
+ *
+ *      // Allocate and generate dense matrix B
+ *      std::vector<float> hB(k * n);
+ *      for(rocsparse_int i = 0; i < k * n; ++i)
+ *      {
+ *          hB[i] = static_cast<float>(rand()) / RAND_MAX;
+ *      }
+ *
+ *      // Copy B to the device
+ *      float* B;
+ *      hipMalloc((void**)&B, sizeof(float) * k * n);
+ *      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
+ *
+ *      // alpha and beta
+ *      float alpha = 1.0f;
+ *      float beta  = 0.0f;
+ *
+ *      // Allocate memory for the resulting matrix C
+ *      float* C;
+ *      hipMalloc((void**)&C, sizeof(float) * m * n);
+ *
+ *      // Perform the matrix multiplication
+ *      rocsparse_scsrmm(handle,
+ *                       rocsparse_operation_none,
+ *                       rocsparse_operation_none,
+ *                       m,
+ *                       n,
+ *                       k,
+ *                       nnz,
+ *                       &alpha,
+ *                       descr,
+ *                       csr_val,
+ *                       csr_row_ptr,
+ *                       csr_col_ind,
+ *                       B,
+ *                       k,
+ *                       &beta,
+ *                       C,
+ *                       m);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const float*              B,
+                                  rocsparse_int             ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const double*             B,
+                                  rocsparse_int             ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmm(rocsparse_handle handle,
+                                  rocsparse_operation trans_A,
+                                  rocsparse_operation trans_B,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int k,
+                                  rocsparse_int nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_float_complex* B,
+                                  rocsparse_int ldb,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* C,
+                                  rocsparse_int ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmm(rocsparse_handle handle,
+                                  rocsparse_operation trans_A,
+                                  rocsparse_operation trans_B,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int k,
+                                  rocsparse_int nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_double_complex* B,
+                                  rocsparse_int ldb,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* C,
+                                  rocsparse_int ldc);
+*/
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse triangular system solve with multiple right-hand sides using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsm_solve solves a sparse triangular linear system of a sparse
+ *  \f$m \times m\f$ matrix, defined in CSR storage format, and a dense
+ *  \f$m \times nrhs\f$ matrix \f$B\f$ of right-hand sides, such that
+ *  \f[
+ *    op(A) \cdot X = \alpha \cdot B,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \p rocsparse_csrsm_solve re-uses the meta data collected by
+ *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis(), such that the analysis
+ *  of \f$A\f$ is only required once for all right-hand sides. The temporary storage
+ *  buffer has to be allocated with the size returned by rocsparse_scsrsv_buffer_size()
+ *  or rocsparse_dcsrsv_buffer_size(). Each row of the matrix is loaded and its
+ *  dependencies are resolved only once for a block of right-hand sides. Structural
+ *  or numerical zero pivots can be obtained by rocsparse_csrsv_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nrhs        number of right-hand sides, i.e. columns of \f$B\f$ and \f$X\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the csrsv
+ *              analysis step.
+ *  @param[in]
+ *  B           array of dimension \f$ldb \times nrhs\f$, holding the right-hand sides.
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, m)}\f$.
+ *  @param[out]
+ *  X           array of dimension \f$ldx \times nrhs\f$, holding the solution.
+ *  @param[in]
+ *  ldx         leading dimension of \f$X\f$, must be at least \f$\max{(1, m)}\f$.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nrhs, \p nnz, \p ldb or \p ldx
+ *              is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p info, \p B, \p X or \p temp_buffer
+ *              pointer is invalid, or the csrsv analysis has not been performed.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsm_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nrhs,
+                                        rocsparse_int             nnz,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const float*              B,
+                                        rocsparse_int             ldb,
+                                        float*                    X,
+                                        rocsparse_int             ldx,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsm_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nrhs,
+                                        rocsparse_int             nnz,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const double*             B,
+                                        rocsparse_int             ldb,
+                                        double*                   X,
+                                        rocsparse_int             ldx,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    preconditioner SPARSE
+ * ===========================================================================
+ */
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsrilu0() or
+ *  rocsparse_dcsrilu0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_numeric_boost enables the user to replace a numerical value
+ *  in an incomplete LU factorization. \p boost_tol is used to determine whether a
+ *  numerical value is replaced by \p boost_val, such that
+ *  \f[
+ *    A_{j,j} = \text{boost_val} \quad \text{if} \quad |A_{j,j}| \leq \text{boost_tol}.
+ *  \f]
+ *  The check is applied to the pivot of each row, once all updates of the row have
+ *  been completed during rocsparse_scsrilu0(), rocsparse_dcsrilu0(),
+ *  rocsparse_scsrilu0_refactor() or rocsparse_dcsrilu0_refactor(). Structural zero
+ *  pivots cannot be replaced. The number of replaced pivots of the last factorization
+ *  can be obtained by calling rocsparse_csrilu0_boost_count(), without a blocking
+ *  transfer to the host.
+ *
+ *  \p boost_tol and \p boost_val can be in host or device memory. Their values are
+ *  copied during the call, and kept in the \p info structure until boosting is
+ *  disabled by setting \p enable_boost to 0.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, if \p boost_tol and
+ *  \p boost_val are in device memory.
+ *
+ *  @param[in]
+ *  handle       handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info         structure that holds the information collected during the analysis
+ *               step.
+ *  @param[in]
+ *  enable_boost enable/disable numeric boost.
+ *  @param[in]
+ *  boost_tol    tolerance to determine whether a numerical value is replaced or not.
+ *  @param[in]
+ *  boost_val    boost value to replace a numerical value.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p boost_tol or \p boost_val
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p boost_tol is negative.
+ *  \retval     rocsparse_status_memory_error the buffer for the boost counter could not
+ *              be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const float*       boost_tol,
+                                                  const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const double*      boost_tol,
+                                                  const double*      boost_val);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_boost_count returns the number of pivots that have been
+ *  replaced during the last rocsparse_scsrilu0(), rocsparse_dcsrilu0(),
+ *  rocsparse_scsrilu0_refactor() or rocsparse_dcsrilu0_refactor() computation, that
+ *  has been performed with boosting enabled by rocsparse_scsrilu0_numeric_boost() or
+ *  rocsparse_dcsrilu0_numeric_boost(). If boosting has never been enabled, \p count
+ *  is set to 0.
+ *
+ *  \p count can be in host or device memory.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, if \p count is in host memory.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  count       pointer to the number of boosted pivots, can be in host or device
+ *              memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p count pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_boost_count(rocsparse_handle   handle,
+                                               rocsparse_mat_info info,
+                                               rocsparse_int*     count);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+ *  rocsparse_scsrilu0() and rocsparse_dcsrilu0(). The temporary storage buffer must
+ *  be allocated by the user. The size of the temporary storage buffer is identical to
+ *  the size returned by rocsparse_scsrsv_buffer_size() and
+ *  rocsparse_dcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+ *              rocsparse_scsrilu0() and rocsparse_dcsrilu0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0()
+ *  and rocsparse_dcsrilu0(). It is expected that this function will be executed only
+ *  once for a given matrix and particular operation type. The analysis meta data can be
+ *  cleared by rocsparse_csrilu0_clear().
+ *
+ *  \p rocsparse_csrilu0_analysis can share its meta data with
+ *  rocsparse_scsrsv_analysis() and rocsparse_dcsrsv_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. Meta data is only re-used, if it has been gathered for
+ *  the same sparsity pattern, which is identified by a structural hash of
+ *  \p csr_row_ptr and \p csr_col_ind. Thus, meta data can also be re-used for
+ *  matrices with the same sparsity pattern, that are stored in different buffers.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+ *  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *
+ *  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis()
+ *  or rocsparse_dcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_csrilu0_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+ *              or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+ *  storage format. The following example computes the incomplete LU factorization
+ *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
+ *
+ *      // Create matrix descriptor for L
+ *      rocsparse_mat_descr descr_L;
+ *      rocsparse_create_mat_descr(&descr_L);
+ *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+ *
+ *      // Create matrix descriptor for U
+ *      rocsparse_mat_descr descr_U;
+ *      rocsparse_create_mat_descr(&descr_U);
+ *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_U;
+ *      rocsparse_dcsrilu0_buffer_size(handle,
+ *                                    m,
+ *                                    nnz,
+ *                                    descr_M,
+ *                                    csr_val,
+ *                                    csr_row_ptr,
+ *                                    csr_col_ind,
+ *                                    info,
+ *                                    &buffer_size_M);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_L,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_U,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_U);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dcsrilu0_analysis(handle,
+ *                                  m,
+ *                                  nnz,
+ *                                  descr_M,
+ *                                  csr_val,
+ *                                  csr_row_ptr,
+ *                                  csr_col_ind,
+ *                                  info,
+ *                                  rocsparse_analysis_policy_reuse,
+ *                                  rocsparse_solve_policy_auto,
+ *                                  temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr_L,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr_U,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete LU factorization
+ *      rocsparse_dcsrilu0(handle,
+ *                         m,
+ *                         nnz,
+ *                         descr_M,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind,
+ *                         info,
+ *                         rocsparse_solve_policy_auto,
+ *                         temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("U has structural and/or numerical zero at U(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_L,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve Uy = z
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_U,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_mat_descr(descr_U);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU preconditioner application using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_apply applies the incomplete LU factorization, computed by
+ *  rocsparse_scsrilu0() or rocsparse_dcsrilu0(), to a dense vector, such that
+ *  \f[
+ *    L \cdot U \cdot y = \alpha \cdot x,
+ *  \f]
+ *  where \f$L\f$ is the unit lower and \f$U\f$ the non-unit upper triangular part of
+ *  the factorized sparse CSR matrix. This is equivalent to calling
+ *  rocsparse_scsrsv_solve() or rocsparse_dcsrsv_solve() with a unit lower and a non
+ *  unit upper triangular descriptor, respectively. Both triangular sweeps share a
+ *  single initialization of the temporary storage buffer, and the intermediate vector
+ *  is kept in the temporary storage buffer.
+ *
+ *  \p rocsparse_csrilu0_apply requires the meta data of both triangular parts, which
+ *  has to be collected by rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis()
+ *  with a lower and an upper triangular descriptor, using the same \p info structure.
+ *  The fill mode and diagonal type of \p descr are ignored. The temporary storage
+ *  buffer must be allocated by the user, with the size returned by
+ *  rocsparse_scsrsv_buffer_size() or rocsparse_dcsrsv_buffer_size(). Zero pivots of
+ *  \f$U\f$ can be obtained by rocsparse_csrsv_zero_pivot(), using an upper triangular
+ *  descriptor.
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the incomplete LU factorized sparse CSR
+ *              matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the csrsv
+ *              analysis steps.
+ *  @param[in]
+ *  x           array of \p m elements, holding the right-hand side.
+ *  @param[out]
+ *  y           array of \p m elements, holding the solution.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p info, \p x, \p y or \p temp_buffer
+ *              pointer is invalid, or the lower or upper csrsv analysis has not been
+ *              performed.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_apply(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const float*              alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info,
+                                          const float*              x,
+                                          float*                    y,
+                                          rocsparse_solve_policy    policy,
+                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_apply(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const double*             alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info,
+                                          const double*             x,
+                                          double*                   y,
+                                          rocsparse_solve_policy    policy,
+                                          void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Iterative incomplete LU factorization with 0 fill-ins and no pivoting using
+ *  CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_iter computes the incomplete LU factorization with 0 fill-ins
+ *  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$ by fixed-point
+ *  iterations, such that
+ *  \f[
+ *    A \approx LU.
+ *  \f]
+ *  In contrast to rocsparse_scsrilu0() and rocsparse_dcsrilu0(), rows are not
+ *  processed in dependency order. Instead, all entries of \f$L\f$ and \f$U\f$ are
+ *  updated in parallel, for a total of \p sweeps asynchronous sweeps, starting from
+ *  the strictly lower and the upper triangular part of \f$A\f$. This avoids the
+ *  serialization of matrices with long dependency chains, at the cost of an
+ *  approximate factorization. Each entry is exact, once the number of sweeps exceeds
+ *  the depth of its dependencies.
+ *
+ *  The factorization is stored in \p ilu0_val, using the same layout as
+ *  rocsparse_scsrilu0() and rocsparse_dcsrilu0(), and \p csr_val remains unchanged.
+ *  If \p residual is not a null pointer, the norm \f$\|A - LU\|_F\f$ of the final
+ *  iterate, restricted to the sparsity pattern of \f$A\f$, is returned as estimate of
+ *  the quality of the factorization.
+ *
+ *  \p rocsparse_csrilu0_iter requires the analysis meta data, obtained by
+ *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). Zero pivots of the
+ *  final iterate can be obtained by calling rocsparse_csrilu0_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host,
+ *  unless \p residual is a host pointer. It may return before the actual computation
+ *  has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  sweeps      number of fixed-point sweeps.
+ *  @param[out]
+ *  ilu0_val    array of \p nnz elements, holding the incomplete LU factorization.
+ *  @param[out]
+ *  residual    residual norm of the final iterate, can be a null pointer.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p sweeps is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p ilu0_val pointer is invalid, or the
+ *              analysis has not been performed.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_iter(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const float*              csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         rocsparse_int             sweeps,
+                                         float*                    ilu0_val,
+                                         float*                    residual);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_iter(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const double*             csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         rocsparse_int             sweeps,
+                                         double*                   ilu0_val,
+                                         double*                   residual);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU refactorization analysis using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_refactor_analysis performs the additional analysis step for
+ *  rocsparse_scsrilu0_refactor() and rocsparse_dcsrilu0_refactor(). For each entry of
+ *  the strictly lower triangular part of the sparse CSR matrix, the list of entries
+ *  that are updated during the incomplete LU factorization is precomputed and stored
+ *  in the \p info structure, such that subsequent refactorizations of matrices with
+ *  identical sparsity pattern only need to perform the numerical updates.
+ *
+ *  \p rocsparse_csrilu0_refactor_analysis requires the analysis meta data, obtained
+ *  by rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). The additional
+ *  meta data is released together with the analysis meta data.
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind or \p info pointer is invalid, or the analysis has not
+ *              been performed.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_memory_error the buffer for the update lists could not
+ *              be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_refactor_analysis(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU refactorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_refactor computes the incomplete LU factorization with 0
+ *  fill-ins and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU.
+ *  \f]
+ *  The result is identical to rocsparse_scsrilu0() and rocsparse_dcsrilu0(). In
+ *  contrast, the column lookups of the factorization are taken from the update lists
+ *  that have been collected by rocsparse_csrilu0_refactor_analysis(), such that each
+ *  row only performs the numerical updates. This is beneficial, if a sequence of
+ *  matrices with identical sparsity pattern and changing values needs to be factorized,
+ *  e.g. in each step of a non-linear solver. No temporary storage buffer is required.
+ *
+ *  \p rocsparse_csrilu0_refactor requires the analysis meta data, obtained by
+ *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(), and the update
+ *  lists, obtained by rocsparse_csrilu0_refactor_analysis(). A zero pivot can be
+ *  obtained by calling rocsparse_csrilu0_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p info pointer is invalid, or the refactorization
+ *              analysis has not been performed.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_refactor(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             float*                    csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_refactor(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             double*                   csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsric0() or
+ *  rocsparse_dcsric0() computation. A non-positive pivot, which indicates that the
+ *  matrix is not positive definite, is reported as numerical zero. The first zero pivot
+ *  \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same index base as the CSR
+ *  matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+ *  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
+ *  be allocated by the user. The size of the temporary storage buffer is identical to
+ *  the size returned by rocsparse_scsrsv_buffer_size() and
+ *  rocsparse_dcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+ *              rocsparse_scsric0() and rocsparse_dcsric0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
+ *  and rocsparse_dcsric0(). It is expected that this function will be executed only
+ *  once for a given matrix and particular operation type. The analysis meta data can be
+ *  cleared by rocsparse_csric0_clear().
+ *
+ *  \p rocsparse_csric0_analysis can share its meta data with
+ *  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. Meta data is only re-used, if it has been gathered for
+ *  the same sparsity pattern, which is identified by a structural hash of
+ *  \p csr_row_ptr and \p csr_col_ind. Thus, meta data can also be re-used for
+ *  matrices with the same sparsity pattern, that are stored in different buffers.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_clear deallocates all memory that was allocated by
+ *  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csric0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
+ *  and no pivoting of a sparse \f$m \times m\f$ symmetric positive definite CSR matrix
+ *  \f$A\f$, such that
+ *  \f[
+ *    A \approx LL^T
+ *  \f]
+ *  Only the lower triangular part of \f$A\f$ is accessed and overwritten by \f$L\f$.
+ *  Entries of the strictly upper triangular part, if stored, are ignored and remain
+ *  unchanged. Thus, it is sufficient to store the lower triangular part of \f$A\f$.
+ *
+ *  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
+ *  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_csric0_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+ *              or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+ *  storage format. The following example computes the incomplete Cholesky
+ *  factorization \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
+ *
+ *      // Create matrix descriptor for L
+ *      rocsparse_mat_descr descr_L;
+ *      rocsparse_create_mat_descr(&descr_L);
+ *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_Lt;
+ *      rocsparse_dcsric0_buffer_size(handle,
+ *                                    m,
+ *                                    nnz,
+ *                                    descr_M,
+ *                                    csr_val,
+ *                                    csr_row_ptr,
+ *                                    csr_col_ind,
+ *                                    info,
+ *                                    &buffer_size_M);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_L,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_transpose,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_L,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_Lt);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dcsric0_analysis(handle,
+ *                                 m,
+ *                                 nnz,
+ *                                 descr_M,
+ *                                 csr_val,
+ *                                 csr_row_ptr,
+ *                                 csr_col_ind,
+ *                                 info,
+ *                                 rocsparse_analysis_policy_reuse,
+ *                                 rocsparse_solve_policy_auto,
+ *                                 temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr_L,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_transpose,
+ *                                m,
+ *                                nnz,
+ *                                descr_L,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+ *                                                                    info,
+ *                                                                    &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete Cholesky factorization
+ *      rocsparse_dcsric0(handle,
+ *                        m,
+ *                        nnz,
+ *                        descr_M,
+ *                        csr_val,
+ *                        csr_row_ptr,
+ *                        csr_col_ind,
+ *                        info,
+ *                        rocsparse_solve_policy_auto,
+ *                        temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+ *                                                                    info,
+ *                                                                    &position))
+ *      {
+ *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_L,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve L^Ty = z
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_transpose,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_L,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_handle(handle);
  *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrmm(rocsparse_handle          handle,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             k,
-                                  rocsparse_int             nnz,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  const float*              B,
-                                  rocsparse_int             ldb,
-                                  const float*              beta,
-                                  float*                    C,
-                                  rocsparse_int             ldc);
+rocsparse_status rocsparse_scsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             k,
-                                  rocsparse_int             nnz,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  const double*             B,
-                                  rocsparse_int             ldb,
-                                  const double*             beta,
-                                  double*                   C,
-                                  rocsparse_int             ldc);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrmm(rocsparse_handle handle,
-                                  rocsparse_operation trans_A,
-                                  rocsparse_operation trans_B,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int k,
-                                  rocsparse_int nnz,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  const rocsparse_float_complex* B,
-                                  rocsparse_int ldb,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* C,
-                                  rocsparse_int ldc);
+rocsparse_status rocsparse_dcsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+/**@}*/
 
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill \f$k\f$ and no pivoting using
+ *  CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_symbolic computes the sparsity pattern of the incomplete LU
+ *  factorization with level of fill \p fill_level of a sparse \f$m \times m\f$ CSR
+ *  matrix \f$A\f$. Entries of \f$A\f$ have level 0, a fill-in entry that is created by
+ *  eliminating the entries \f$L_{i,k}\f$ and \f$U_{k,j}\f$ has level
+ *  \f$\text{lev}_{i,k} + \text{lev}_{k,j} + 1\f$. All fill-in entries with level up to
+ *  \p fill_level are kept. The number of non-zero entries of the factorized matrix is
+ *  returned in \p lu_nnz. Furthermore, the level analysis of the factorized sparsity
+ *  pattern is performed, such that rocsparse_scsriluk() and rocsparse_dcsriluk() can
+ *  be executed repeatedly without further analysis.
+ *
+ *  The symbolic factorization and its meta data are stored in \p info. If the
+ *  \ref rocsparse_analysis_policy of the library context is
+ *  \ref rocsparse_analysis_policy_reuse, they are re-used, if
+ *  \p rocsparse_csriluk_symbolic is called again with the same sparsity pattern and
+ *  level of fill. By default, the symbolic factorization is always re-computed. The
+ *  analysis policy can be changed by rocsparse_set_analysis_policy(). The symbolic
+ *  factorization can be cleared by rocsparse_csriluk_clear(). For
+ *  \p fill_level = 0, the factorized sparsity pattern is identical to the one of
+ *  \f$A\f$.
+ *
+ *  \p rocsparse_csriluk_symbolic requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  The level of fill computation is performed on the host. This function is blocking
+ *  with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  fill_level  level of fill \f$k \ge 0\f$.
+ *  @param[out]
+ *  info        structure that holds the symbolic factorization.
+ *  @param[out]
+ *  lu_nnz      number of non-zero entries of the factorized matrix, can be in host or
+ *              device memory.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p fill_level is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p lu_nnz or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrmm(rocsparse_handle handle,
-                                  rocsparse_operation trans_A,
-                                  rocsparse_operation trans_B,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int k,
-                                  rocsparse_int nnz,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  const rocsparse_double_complex* B,
-                                  rocsparse_int ldb,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* C,
-                                  rocsparse_int ldc);
-*/
-/**@}*/
+rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             fill_level,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int*            lu_nnz,
+                                            void*                     temp_buffer);
 
-/*
- * ===========================================================================
- *    preconditioner SPARSE
- * ===========================================================================
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill \f$k\f$ and no pivoting using
+ *  CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_pattern copies the sparsity pattern of the factorized matrix,
+ *  that has been computed by rocsparse_csriluk_symbolic(), into \p lu_row_ptr and
+ *  \p lu_col_ind, using the same index base as the CSR matrix.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the symbolic factorization.
+ *  @param[out]
+ *  lu_row_ptr  array of \p m+1 elements that point to the start of every row of the
+ *              factorized matrix.
+ *  @param[out]
+ *  lu_col_ind  array of \p lu_nnz elements containing the column indices of the
+ *              factorized matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p lu_row_ptr or
+ *              \p lu_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
  */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_pattern(rocsparse_handle   handle,
+                                           rocsparse_mat_info info,
+                                           rocsparse_int*     lu_row_ptr,
+                                           rocsparse_int*     lu_col_ind);
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+ *  \brief Incomplete LU factorization with level of fill \f$k\f$ and no pivoting using
+ *  CSR storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_scsrilu0() or
- *  rocsparse_dcsrilu0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
- *  is stored in \p position, using same index base as the CSR matrix.
+ *  \p rocsparse_csriluk_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_csriluk_symbolic(),
+ *  rocsparse_scsriluk() or rocsparse_dcsriluk() computation. The first zero pivot
+ *  \f$j\f$ at \f$(LU)_{j,j}\f$ is stored in \p position, using same index base as the
+ *  CSR matrix.
  *
  *  \p position can be in host or device memory. If no zero pivot has been found,
  *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
  *
- *  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
+ *  \note \p rocsparse_csriluk_zero_pivot is a blocking function. It might influence
  *  performance negatively.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  info        structure that holds the symbolic factorization.
  *  @param[inout]
  *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
  *
@@ -1939,22 +5032,69 @@ rocsparse_status rocsparse_zcsrmm(rocsparse_handle handle,
  *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
+rocsparse_status rocsparse_csriluk_zero_pivot(rocsparse_handle   handle,
                                               rocsparse_mat_info info,
                                               rocsparse_int*     position);
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+ *  \brief Incomplete LU factorization with level of fill \f$k\f$ and no pivoting using
+ *  CSR storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
- *  rocsparse_scsrilu0() and rocsparse_dcsrilu0(). The temporary storage buffer must
- *  be allocated by the user. The size of the temporary storage buffer is identical to
- *  the size returned by rocsparse_scsrsv_buffer_size() and
- *  rocsparse_dcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
- *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *  \p rocsparse_csriluk_clear deallocates all memory that was allocated by
+ *  rocsparse_csriluk_symbolic().
+ *
+ *  \note
+ *  Calling \p rocsparse_csriluk_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the symbolic factorization.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with level of fill \f$k\f$ and no pivoting using
+ *  CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk computes the numerical incomplete LU factorization with level of
+ *  fill \f$k\f$ and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such
+ *  that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *  The values of \f$A\f$ are scattered into the sparsity pattern computed by
+ *  rocsparse_csriluk_symbolic() and the factorization is performed in place in
+ *  \p lu_val. \f$L\f$ has unit diagonal and is stored in the strictly lower part of the
+ *  factorized matrix, \f$U\f$ is stored in its upper part. The sparsity pattern of the
+ *  factorized matrix can be obtained by rocsparse_csriluk_pattern().
+ *
+ *  \p rocsparse_csriluk requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size().
+ *  Furthermore, the symbolic factorization is required. It can be obtained by
+ *  rocsparse_csriluk_symbolic(). \p rocsparse_csriluk reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_csriluk_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -1967,80 +5107,74 @@ rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
  *  @param[in]
  *  csr_val     array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
  *  @param[in]
  *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
  *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the symbolic factorization.
  *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
+ *  lu_val      array of \p lu_nnz elements of the factorized matrix.
  *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
- *              rocsparse_scsrilu0() and rocsparse_dcsrilu0().
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid or does not
+ *              match the symbolic factorization.
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *              \p csr_col_ind, \p info, \p lu_val or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    float*                    lu_val,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    double*                   lu_val,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+ *  \brief Jacobi smoother using CSR storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0()
- *  and rocsparse_dcsrilu0(). It is expected that this function will be executed only
- *  once for a given matrix and particular operation type. The analysis meta data can be
- *  cleared by rocsparse_csrilu0_clear().
- *
- *  \p rocsparse_csrilu0_analysis can share its meta data with
- *  rocsparse_scsrsv_analysis() and rocsparse_dcsrsv_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
- *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  \p rocsparse_csrjacobi_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsrjacobi_analysis(), rocsparse_dcsrjacobi_analysis(),
+ *  rocsparse_scsrjacobi() and rocsparse_dcsrjacobi(). The temporary storage buffer must
+ *  be allocated by the user.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  type        type of the Jacobi smoother, see \ref rocsparse_jacobi_type.
+ *  @param[in]
+ *  m           number of rows and columns of the sparse CSR matrix.
  *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
@@ -2053,106 +5187,145 @@ rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle
  *  @param[in]
  *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
  *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
- *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
- *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  block_dim   dimension of the diagonal blocks, \f$1 \le block\_dim \le 8\f$. Only
+ *              referenced by \ref rocsparse_jacobi_type_block.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrjacobi_analysis(), rocsparse_dcsrjacobi_analysis(),
+ *              rocsparse_scsrjacobi() and rocsparse_dcsrjacobi().
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p block_dim is invalid.
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *              \p csr_col_ind or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p type or the index base is invalid.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const float*              csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_scsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_jacobi_type     type,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             block_dim,
+                                                  size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const double*             csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_jacobi_type     type,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             block_dim,
+                                                  size_t*                   buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+ *  \brief Jacobi smoother using CSR storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
- *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). This is especially
- *  useful, if memory is an issue and the analysis data is not required for further
- *  computation.
+ *  \p rocsparse_csrjacobi_analysis computes the scaling of the Jacobi smoother and
+ *  stores it in the temporary storage buffer. Depending on \p type, this is the inverse
+ *  of the diagonal, the inverse of the l1 norm of each row, or the inverse of the dense
+ *  diagonal blocks of dimension \p block_dim. Rows with zero scaling, or rows of a
+ *  singular diagonal block, are not updated by rocsparse_scsrjacobi() and
+ *  rocsparse_dcsrjacobi(). The analysis has to be repeated if the values of the matrix
+ *  change.
  *
  *  \note
- *  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
- *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  type        type of the Jacobi smoother, see \ref rocsparse_jacobi_type.
+ *  @param[in]
+ *  m           number of rows and columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  block_dim   dimension of the diagonal blocks, \f$1 \le block\_dim \le 8\f$. Only
+ *              referenced by \ref rocsparse_jacobi_type_block.
+ *  @param[out]
+ *  temp_buffer temporary storage buffer allocated by the user.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p type or the index base is invalid.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_scsrjacobi_analysis(rocsparse_handle          handle,
+                                               rocsparse_jacobi_type     type,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrjacobi_analysis(rocsparse_handle          handle,
+                                               rocsparse_jacobi_type     type,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               void*                     temp_buffer);
+/**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+ *  \brief Jacobi smoother using CSR storage format
  *
  *  \details
- *  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
- *  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \p rocsparse_csrjacobi performs \p sweeps iterations of the damped Jacobi smoother
  *  \f[
- *    A \approx LU
+ *    x := x + \omega \cdot D^{-1} \cdot (b - A \cdot x)
  *  \f]
- *
- *  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis()
- *  or rocsparse_dcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
- *  (either numerical or structural zero). The zero pivot status can be obtained by
- *  calling rocsparse_csrilu0_zero_pivot().
- *
- *  \note
- *  The sparse CSR matrix has to be sorted. This can be achieved by calling
- *  rocsparse_csrsort().
+ *  on a sparse \f$m \times m\f$ CSR matrix \f$A\f$, where \f$D\f$ is the diagonal of
+ *  \f$A\f$, the diagonal matrix of the l1 norms of the rows of \f$A\f$, or the block
+ *  diagonal of \f$A\f$ with blocks of dimension \p block_dim, depending on \p type.
+ *  The trailing block is padded with the identity, if \p m is not a multiple of
+ *  \p block_dim. Each sweep computes the residual and updates the iterate in a single
+ *  pass over the matrix.
+ *
+ *  \p rocsparse_csrjacobi requires a user allocated temporary storage buffer. Its size
+ *  is returned by rocsparse_scsrjacobi_buffer_size() or
+ *  rocsparse_dcsrjacobi_buffer_size(). Furthermore, the scaling has to be computed by
+ *  rocsparse_scsrjacobi_analysis() or rocsparse_dcsrjacobi_analysis().
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -2161,240 +5334,248 @@ rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  type        type of the Jacobi smoother, see \ref rocsparse_jacobi_type.
+ *  @param[in]
+ *  m           number of rows and columns of the sparse CSR matrix.
  *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
+ *  omega       scalar damping factor \f$\omega\f$.
+ *  @param[in]
  *  descr       descriptor of the sparse CSR matrix.
- *  @param[inout]
+ *  @param[in]
  *  csr_val     array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start
- *              of every row of the sparse CSR matrix.
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
  *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
  *              CSR matrix.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  block_dim   dimension of the diagonal blocks, \f$1 \le block\_dim \le 8\f$. Only
+ *              referenced by \ref rocsparse_jacobi_type_block.
  *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
+ *  b           array of \p m elements (\f$b\f$).
+ *  @param[inout]
+ *  x           array of \p m elements (\f$x\f$), holding the initial guess on entry.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  sweeps      number of smoother iterations.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer holding the scaling computed by the analysis.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
- *              or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz, \p block_dim or \p sweeps is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p omega, \p descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p b, \p x or \p temp_buffer pointer is
+ *              invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_invalid_value \p type or the index base is invalid.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrjacobi(rocsparse_handle          handle,
+                                      rocsparse_jacobi_type     type,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const float*              omega,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             block_dim,
+                                      const float*              b,
+                                      float*                    x,
+                                      rocsparse_int             sweeps,
+                                      void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrjacobi(rocsparse_handle          handle,
+                                      rocsparse_jacobi_type     type,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const double*             omega,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             block_dim,
+                                      const double*             b,
+                                      double*                   x,
+                                      rocsparse_int             sweeps,
+                                      void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Chebyshev polynomial preconditioner using CSR storage format
  *
- *  \par Example
- *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
- *  storage format. The following example computes the incomplete LU factorization
- *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
- *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
- *
- *      // Create matrix descriptor for M
- *      rocsparse_mat_descr descr_M;
- *      rocsparse_create_mat_descr(&descr_M);
- *
- *      // Create matrix descriptor for L
- *      rocsparse_mat_descr descr_L;
- *      rocsparse_create_mat_descr(&descr_L);
- *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
- *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
- *
- *      // Create matrix descriptor for U
- *      rocsparse_mat_descr descr_U;
- *      rocsparse_create_mat_descr(&descr_U);
- *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
- *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Obtain required buffer size
- *      size_t buffer_size_M;
- *      size_t buffer_size_L;
- *      size_t buffer_size_U;
- *      rocsparse_dcsrilu0_buffer_size(handle,
- *                                    m,
- *                                    nnz,
- *                                    descr_M,
- *                                    csr_val,
- *                                    csr_row_ptr,
- *                                    csr_col_ind,
- *                                    info,
- *                                    &buffer_size_M);
- *      rocsparse_dcsrsv_buffer_size(handle,
- *                                   rocsparse_operation_none,
- *                                   m,
- *                                   nnz,
- *                                   descr_L,
- *                                   csr_val,
- *                                   csr_row_ptr,
- *                                   csr_col_ind,
- *                                   info,
- *                                   &buffer_size_L);
- *      rocsparse_dcsrsv_buffer_size(handle,
- *                                   rocsparse_operation_none,
- *                                   m,
- *                                   nnz,
- *                                   descr_U,
- *                                   csr_val,
- *                                   csr_row_ptr,
- *                                   csr_col_ind,
- *                                   info,
- *                                   &buffer_size_U);
- *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
- *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
- *
- *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
- *      // computation performance
- *      rocsparse_dcsrilu0_analysis(handle,
- *                                  m,
- *                                  nnz,
- *                                  descr_M,
- *                                  csr_val,
- *                                  csr_row_ptr,
- *                                  csr_col_ind,
- *                                  info,
- *                                  rocsparse_analysis_policy_reuse,
- *                                  rocsparse_solve_policy_auto,
- *                                  temp_buffer);
- *      rocsparse_dcsrsv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                nnz,
- *                                descr_L,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *      rocsparse_dcsrsv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                nnz,
- *                                descr_U,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
+ *  \details
+ *  \p rocsparse_csrcheby_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsrcheby() and rocsparse_dcsrcheby(). The temporary
+ *  storage buffer must be allocated by the user.
  *
- *      // Check for zero pivot
- *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("A has structural zero at A(%d,%d)\n", position, position);
- *      }
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows and columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected by
+ *              rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis().
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrcheby() and rocsparse_dcsrcheby().
  *
- *      // Compute incomplete LU factorization
- *      rocsparse_dcsrilu0(handle,
- *                         m,
- *                         nnz,
- *                         descr_M,
- *                         csr_val,
- *                         csr_row_ptr,
- *                         csr_col_ind,
- *                         info,
- *                         rocsparse_solve_policy_auto,
- *                         temp_buffer);
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrcheby_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrcheby_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Chebyshev polynomial preconditioner using CSR storage format
  *
- *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("U has structural and/or numerical zero at U(%d,%d)\n",
- *                 position,
- *                 position);
- *      }
+ *  \details
+ *  \p rocsparse_csrcheby applies the Chebyshev polynomial preconditioner
+ *  \f[
+ *    z := p(A) \cdot r,
+ *  \f]
+ *  of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, where \f$p(A) \approx A^{-1}\f$
+ *  is obtained by \p degree steps of the Chebyshev iteration with zero initial guess
+ *  on the spectral interval \f$[\lambda_{min}, \lambda_{max}]\f$ of \f$A\f$.
+ *
+ *  Each step after the first computes the residual with the CSR-Adaptive kernel of
+ *  rocsparse_scsrmv() and rocsparse_dcsrmv(), and updates the search direction and the
+ *  iterate of the three-term recurrence within the same kernel. Thus,
+ *  \p rocsparse_csrcheby requires the meta data gathered by rocsparse_scsrmv_analysis()
+ *  or rocsparse_dcsrmv_analysis() with \ref rocsparse_operation_none. Furthermore, it
+ *  requires a user allocated temporary buffer. Its size is returned by
+ *  rocsparse_scsrcheby_buffer_size() or rocsparse_dcsrcheby_buffer_size().
  *
- *      // Solve Lz = x
- *      rocsparse_dcsrsv_solve(handle,
- *                             rocsparse_operation_none,
- *                             m,
- *                             nnz,
- *                             &alpha,
- *                             descr_L,
- *                             csr_val,
- *                             csr_row_ptr,
- *                             csr_col_ind,
- *                             info,
- *                             x,
- *                             z,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *  \note
+ *  In \ref rocsparse_pointer_mode_device, \p lambda_min and \p lambda_max are copied
+ *  to the host and this function is blocking with respect to the host.
  *
- *      // Solve Uy = z
- *      rocsparse_dcsrsv_solve(handle,
- *                             rocsparse_operation_none,
- *                             m,
- *                             nnz,
- *                             &alpha,
- *                             descr_U,
- *                             csr_val,
- *                             csr_row_ptr,
- *                             csr_col_ind,
- *                             info,
- *                             z,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows and columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected by
+ *              rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis().
+ *  @param[in]
+ *  degree      degree of the polynomial, i.e. the number of Chebyshev steps.
+ *  @param[in]
+ *  lambda_min  lower bound of the spectrum of \f$A\f$,
+ *              \f$0 \le \lambda_{min} < \lambda_{max}\f$.
+ *  @param[in]
+ *  lambda_max  upper bound of the spectrum of \f$A\f$.
+ *  @param[in]
+ *  r           array of \p m elements (\f$r\f$).
+ *  @param[out]
+ *  z           array of \p m elements (\f$z\f$).
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
  *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr_M);
- *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_U);
- *      rocsparse_destroy_handle(handle);
- *  \endcode
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p degree is invalid, or
+ *              does not match the csrmv meta data.
+ *  \retval     rocsparse_status_invalid_value the spectral bounds are invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p lambda_min, \p lambda_max, \p r, \p z or
+ *              \p temp_buffer pointer is invalid, or the csrmv meta data is missing.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    float*                    csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_scsrcheby(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             degree,
+                                     const float*              lambda_min,
+                                     const float*              lambda_max,
+                                     const float*              r,
+                                     float*                    z,
+                                     void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    double*                   csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrcheby(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             degree,
+                                     const double*             lambda_min,
+                                     const double*             lambda_max,
+                                     const double*             r,
+                                     double*                   z,
+                                     void*                     temp_buffer);
 /**@}*/
 
 /*
@@ -3015,6 +6196,200 @@ rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
 */
 /**@}*/
 
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse CSR5 matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2csr5 converts a CSR matrix into a CSR5 matrix. It is assumed
+ *  that \p csr5 has been initialized with rocsparse_create_csr5_mat().
+ *
+ *  The non-zero entries are partitioned into tiles of equal size. Within each tile,
+ *  the entries are stored transposed, together with a tile descriptor that marks the
+ *  beginning of each row. Entries that do not fill a complete tile are kept in CSR
+ *  order. The tile size is chosen depending on the average number of non-zero
+ *  entries per row.
+ *
+ *  \note
+ *  The conversion requires only a few linear passes over the matrix and is
+ *  typically amortized after a small number of calls to rocsparse_csr5mv().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[out]
+ *  csr5            sparse matrix in CSR5 format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
+ *  \retval     rocsparse_status_invalid_value \p descr index base is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr5, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the CSR5 matrix could not be
+ *              allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example converts a CSR matrix into a CSR5 matrix and uses it for multiple
+ *  sparse matrix vector multiplications.
+ *  \code{.c}
+ *      // Create CSR5 matrix structure
+ *      rocsparse_csr5_mat csr5;
+ *      rocsparse_create_csr5_mat(&csr5);
+ *
+ *      // Perform the conversion
+ *      rocsparse_scsr2csr5(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, csr5);
+ *
+ *      // Perform the sparse matrix vector multiplications
+ *      for(int i = 0; i < 100; ++i)
+ *      {
+ *          rocsparse_scsr5mv(handle,
+ *                            rocsparse_operation_none,
+ *                            &alpha,
+ *                            descr,
+ *                            csr5,
+ *                            x,
+ *                            &beta,
+ *                            y);
+ *      }
+ *
+ *      // Clean up
+ *      rocsparse_destroy_csr5_mat(csr5);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csr5(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_csr5_mat        csr5);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csr5(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_csr5_mat        csr5);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse SELL-C-sigma matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2sellcs converts a CSR matrix into a SELL-C-sigma matrix. It is
+ *  assumed that \p sell has been initialized with rocsparse_create_sellcs_mat().
+ *
+ *  The rows of the matrix are grouped into slices of 32 consecutive rows. Each slice is
+ *  stored in ELL format, padded to the length of its longest row only. Optionally, the
+ *  rows are sorted by their number of non-zero entries within windows of \p sigma
+ *  consecutive rows, such that rows of similar length share a slice and the padding is
+ *  reduced further.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[out]
+ *  sell            sparse matrix in SELL-C-sigma format.
+ *  @param[in]
+ *  sigma           number of consecutive rows that are sorted by their length. If
+ *                  \p sigma is 1, the rows are not sorted.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p sigma is invalid.
+ *  \retval     rocsparse_status_invalid_value \p descr index base is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p sell, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the SELL-C-sigma matrix could
+ *              not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example converts a CSR matrix into a SELL-C-sigma matrix, where the rows are
+ *  sorted within windows of 256 rows.
+ *  \code{.c}
+ *      // Create SELL-C-sigma matrix structure
+ *      rocsparse_sellcs_mat sell;
+ *      rocsparse_create_sellcs_mat(&sell);
+ *
+ *      // Perform the conversion
+ *      rocsparse_scsr2sellcs(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, sell, 256);
+ *
+ *      // Do some work
+ *
+ *      // Clean up
+ *      rocsparse_destroy_sellcs_mat(sell);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2sellcs(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_sellcs_mat      sell,
+                                       rocsparse_int             sigma);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2sellcs(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_sellcs_mat      sell,
+                                       rocsparse_int             sigma);
+/**@}*/
+
 /*! \ingroup conv_module
  *  \brief Convert a sparse COO matrix into a sparse CSR matrix
  *
@@ -73,6 +73,28 @@ typedef struct _rocsparse_mat_descr* rocsparse_mat_descr;
  */
 typedef struct _rocsparse_hyb_mat* rocsparse_hyb_mat;
 
+/*! \ingroup types_module
+ *  \brief CSR5 matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE CSR5 matrix structure holds the CSR5 matrix. It must be initialized
+ *  using rocsparse_create_csr5_mat() and the returned CSR5 matrix must be passed to
+ *  all subsequent library calls that involve the matrix. It should be destroyed at the
+ *  end using rocsparse_destroy_csr5_mat().
+ */
+typedef struct _rocsparse_csr5_mat* rocsparse_csr5_mat;
+
+/*! \ingroup types_module
+ *  \brief SELL-C-sigma matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE SELL-C-sigma matrix structure holds the sliced ELL matrix. It must be
+ *  initialized using rocsparse_create_sellcs_mat() and the returned SELL-C-sigma matrix
+ *  must be passed to all subsequent library calls that involve the matrix. It should be
+ *  destroyed at the end using rocsparse_destroy_sellcs_mat().
+ */
+typedef struct _rocsparse_sellcs_mat* rocsparse_sellcs_mat;
+
 /*! \ingroup types_module
  *  \brief Info structure to hold all matrix meta data.
  *
@@ -202,6 +224,16 @@ typedef enum rocsparse_hyb_partition_
  *  re-used or not. If meta data from a previous e.g. rocsparse_csrilu0_analysis() call
  *  is available, it can be re-used for subsequent calls to e.g.
  *  rocsparse_csrsv_analysis() and greatly improve performance of the analysis function.
+ *  Meta data is only re-used for matrices with the same sparsity pattern, which is
+ *  identified by a structural hash of the sparse matrix.
+ *
+ *  \note
+ *  Re-use is a probabilistic match. Apart from the dimensions and the number of
+ *  non-zero entries, only the 64 bit structural hash of \p csr_row_ptr and
+ *  \p csr_col_ind is compared. If two different sparsity patterns collide, the meta
+ *  data of the other pattern is used, which leads to wrong results and can stall
+ *  the triangular solvers and factorizations. Use
+ *  \ref rocsparse_analysis_policy_force, if this is not acceptable.
  */
 typedef enum rocsparse_analysis_policy_
 {
@@ -220,6 +252,22 @@ typedef enum rocsparse_solve_policy_
     rocsparse_solve_policy_auto = 0 /**< automatically decide on level information. */
 } rocsparse_solve_policy;
 
+/*! \ingroup types_module
+ *  \brief Specify the type of the Jacobi smoother.
+ *
+ *  \details
+ *  The \ref rocsparse_jacobi_type specifies the scaling that is used by the Jacobi
+ *  smoother, e.g. rocsparse_scsrjacobi(). The point Jacobi smoother scales each row by
+ *  its diagonal entry, the l1 Jacobi smoother scales each row by its l1 norm and the
+ *  block Jacobi smoother applies the inverse of small dense diagonal blocks.
+ */
+typedef enum rocsparse_jacobi_type_
+{
+    rocsparse_jacobi_type_point = 0, /**< scale by the diagonal. */
+    rocsparse_jacobi_type_l1    = 1, /**< scale by the l1 norm of each row. */
+    rocsparse_jacobi_type_block = 2 /**< scale by the inverse diagonal blocks. */
+} rocsparse_jacobi_type;
+
 /*! \ingroup types_module
  *  \brief Indicates if the pointer is device pointer or host pointer.
  *
@@ -235,6 +283,59 @@ typedef enum rocsparse_pointer_mode_
     rocsparse_pointer_mode_device = 1 /**< scalar pointers are in device memory. */
 } rocsparse_pointer_mode;
 
+/*! \ingroup types_module
+ *  \brief Indicates where analysis meta data is computed.
+ *
+ *  \details
+ *  The \ref rocsparse_analysis_mode indicates whether the meta data of analysis
+ *  functions, e.g. rocsparse_csrmv_analysis(), is computed on the host or on the
+ *  device. The \ref rocsparse_analysis_mode can be changed by
+ *  rocsparse_set_analysis_mode(). The currently used analysis mode can be obtained by
+ *  rocsparse_get_analysis_mode().
+ */
+typedef enum rocsparse_analysis_mode_
+{
+    rocsparse_analysis_mode_host   = 0, /**< meta data is computed on the host. */
+    rocsparse_analysis_mode_device = 1 /**< meta data is computed on the device. */
+} rocsparse_analysis_mode;
+
+/*! \ingroup types_module
+ *  \brief Indicates whether results in host memory are returned asynchronously.
+ *
+ *  \details
+ *  The \ref rocsparse_result_mode indicates whether reductions, e.g. rocsparse_sdoti(),
+ *  block until their result is available in \ref rocsparse_pointer_mode_host. In
+ *  \ref rocsparse_result_mode_async, the result is copied asynchronously and the stream
+ *  associated with the handle must be synchronized before the result is accessed.
+ *  Deferring the synchronization is opt-in, such that callers that read the result
+ *  right after the call remain correct by default. The
+ *  \ref rocsparse_result_mode can be changed by rocsparse_set_result_mode(). The
+ *  currently used result mode can be obtained by rocsparse_get_result_mode().
+ */
+typedef enum rocsparse_result_mode_
+{
+    rocsparse_result_mode_blocking = 0, /**< host results are available on return. */
+    rocsparse_result_mode_async    = 1 /**< host results are copied asynchronously. */
+} rocsparse_result_mode;
+
+/*! \ingroup types_module
+ *  \brief Indicates the csrmv algorithm to be used without analysis meta data.
+ *
+ *  \details
+ *  The \ref rocsparse_csrmv_alg indicates which algorithm is used by rocsparse_csrmv(),
+ *  if no analysis meta data is available. The row algorithm assigns a group of threads
+ *  to each row. The merge algorithm splits the work evenly over the rows and non-zero
+ *  entries, which is insensitive to the distribution of the row lengths. The
+ *  \ref rocsparse_csrmv_alg can be changed by rocsparse_set_csrmv_alg(). The currently
+ *  used algorithm can be obtained by rocsparse_get_csrmv_alg().
+ */
+typedef enum rocsparse_csrmv_alg_
+{
+    rocsparse_csrmv_alg_auto  = 0, /**< row based algorithm, merge path on request. */
+    rocsparse_csrmv_alg_row   = 1, /**< row based algorithm. */
+    rocsparse_csrmv_alg_merge = 2 /**< merge path based algorithm. */
+} rocsparse_csrmv_alg;
+
 /*! \ingroup types_module
  *  \brief Indicates if layer is active with bitmask.
  *
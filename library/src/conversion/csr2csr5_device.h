@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef CSR2CSR5_DEVICE_H
+#define CSR2CSR5_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Returns the row that holds entry idx, i.e. the last row r in [lo, hi] with
+// csr_row_ptr[r] <= idx. Empty rows that start at idx are skipped.
+__device__ __forceinline__ rocsparse_int csr5_row_search(rocsparse_int        idx,
+                                                         rocsparse_int        lo,
+                                                         rocsparse_int        hi,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         rocsparse_index_base idx_base)
+{
+    while(lo < hi)
+    {
+        rocsparse_int mid = (lo + hi + 1) >> 1;
+
+        if(csr_row_ptr[mid] - idx_base <= idx)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    return lo;
+}
+
+// Compute the first row of each tile. Tile num_tiles marks the first row of the
+// entries that follow the last tile.
+template <rocsparse_int NB>
+__global__ void csr2csr5_tile_ptr_kernel(rocsparse_int        m,
+                                         rocsparse_int        num_tiles,
+                                         rocsparse_int        tile_size,
+                                         const rocsparse_int* csr_row_ptr,
+                                         rocsparse_int*       tile_ptr,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid > num_tiles)
+    {
+        return;
+    }
+
+    tile_ptr[gid] = csr5_row_search(gid * tile_size, 0, m, csr_row_ptr, idx_base);
+}
+
+// Flag all tiles that contain empty rows. The rows of such tiles cannot be
+// obtained by counting the row starts within the tile.
+template <rocsparse_int NB>
+__global__ void csr2csr5_empty_rows_kernel(rocsparse_int        m,
+                                           rocsparse_int        num_tiles,
+                                           rocsparse_int        tile_size,
+                                           const rocsparse_int* csr_row_ptr,
+                                           rocsparse_int*       tile_ptr,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+
+    // Empty rows that start at the beginning of a tile precede its first row
+    if(row_begin != csr_row_ptr[row + 1] - idx_base || row_begin % tile_size == 0)
+    {
+        return;
+    }
+
+    rocsparse_int tile = row_begin / tile_size;
+
+    if(tile < num_tiles)
+    {
+        atomicOr(reinterpret_cast<unsigned int*>(tile_ptr + tile), CSR5_EMPTY_TILE);
+    }
+}
+
+// Compute the tile descriptor of each lane of each tile and transpose the entries
+// of each tile, such that the entries of all lanes are accessed contiguously.
+// Bit s of the lane flag is set, if entry s of the lane is the first entry of a
+// row. The first entry of a tile is never flagged, its row is given by tile_ptr.
+template <typename T, rocsparse_int NB, rocsparse_int SIGMA>
+__global__ void csr2csr5_tile_desc_kernel(rocsparse_int        m,
+                                          rocsparse_int        num_tiles,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const T*             csr_val,
+                                          const rocsparse_int* tile_ptr,
+                                          unsigned int*        tile_flag,
+                                          rocsparse_int*       tile_count,
+                                          rocsparse_int*       csr5_col_ind,
+                                          T*                   csr5_val,
+                                          rocsparse_index_base idx_base)
+{
+    rocsparse_int gid  = hipBlockIdx_x * NB + hipThreadIdx_x;
+    rocsparse_int tile = gid / CSR5_OMEGA;
+    rocsparse_int lane = gid % CSR5_OMEGA;
+
+    if(tile >= num_tiles)
+    {
+        return;
+    }
+
+    // Row of the first entry of this lane
+    rocsparse_int idx = (tile * CSR5_OMEGA + lane) * SIGMA;
+    rocsparse_int row = csr5_row_search(idx,
+                                        tile_ptr[tile] & ~CSR5_EMPTY_TILE,
+                                        tile_ptr[tile + 1] & ~CSR5_EMPTY_TILE,
+                                        csr_row_ptr,
+                                        idx_base);
+
+    rocsparse_int row_end = csr_row_ptr[row + 1] - idx_base;
+
+    unsigned int  flag  = 0;
+    rocsparse_int count = 0;
+
+    for(rocsparse_int s = 0; s < SIGMA; ++s)
+    {
+        // Skip rows that end before this entry, including empty rows
+        while(row_end <= idx + s)
+        {
+            row_end = csr_row_ptr[++row + 1] - idx_base;
+        }
+
+        if(csr_row_ptr[row] - idx_base == idx + s && (lane > 0 || s > 0))
+        {
+            flag |= 1u << s;
+            ++count;
+        }
+
+        rocsparse_int ind = CSR5_IND(tile, lane, s, SIGMA);
+
+        csr5_col_ind[ind] = csr_col_ind[idx + s];
+        csr5_val[ind]     = csr_val[idx + s];
+    }
+
+    tile_flag[gid]  = flag;
+    tile_count[gid] = count;
+}
+
+// Turn the scanned row start counts into offsets relative to each tile
+template <rocsparse_int NB>
+__global__ void csr2csr5_tile_offset_kernel(rocsparse_int        num_tiles,
+                                            const rocsparse_int* tile_scan,
+                                            rocsparse_int*       tile_offset)
+{
+    rocsparse_int gid  = hipBlockIdx_x * NB + hipThreadIdx_x;
+    rocsparse_int tile = gid / CSR5_OMEGA;
+
+    if(tile >= num_tiles)
+    {
+        return;
+    }
+
+    tile_offset[gid] = tile_scan[gid] - tile_scan[tile * CSR5_OMEGA];
+}
+
+#endif // CSR2CSR5_DEVICE_H
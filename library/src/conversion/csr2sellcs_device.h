@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef CSR2SELLCS_DEVICE_H
+#define CSR2SELLCS_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Compute the number of non-zero entries per row, which serve as sort keys, and
+// initialize the row permutation with the identity
+template <rocsparse_int NB>
+__global__ void csr2sellcs_row_nnz_kernel(rocsparse_int        m,
+                                          const rocsparse_int* csr_row_ptr,
+                                          rocsparse_int*       row_nnz,
+                                          rocsparse_int*       perm)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    row_nnz[gid] = csr_row_ptr[gid + 1] - csr_row_ptr[gid];
+    perm[gid]    = gid;
+}
+
+// Compute the first row of each sorting window
+template <rocsparse_int NB>
+__global__ void csr2sellcs_window_ptr_kernel(rocsparse_int  m,
+                                             rocsparse_int  num_windows,
+                                             rocsparse_int  sigma,
+                                             rocsparse_int* window_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid > num_windows)
+    {
+        return;
+    }
+
+    window_ptr[gid] = min(gid * sigma, m);
+}
+
+// Compute the size of each slice, given by its longest row, and store it in
+// slice_ptr[slice + 1]. slice_ptr is expected to be zero initialized.
+template <rocsparse_int NB>
+__global__ void csr2sellcs_slice_size_kernel(rocsparse_int        m,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* perm,
+                                             rocsparse_int*       slice_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row = (perm != nullptr) ? perm[gid] : gid;
+    rocsparse_int nnz = csr_row_ptr[row + 1] - csr_row_ptr[row];
+
+    if(nnz > 0)
+    {
+        atomicMax(slice_ptr + gid / SELLCS_C + 1, nnz * SELLCS_C);
+    }
+}
+
+// CSR to SELL-C-sigma format conversion kernel. Each thread fills one row of a
+// slice, including the padded rows of the last slice.
+template <typename T>
+__global__ void csr2sellcs_kernel(rocsparse_int        m,
+                                  rocsparse_int        num_slices,
+                                  const T*             csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  const rocsparse_int* slice_ptr,
+                                  const rocsparse_int* perm,
+                                  rocsparse_int*       sell_col_ind,
+                                  T*                   sell_val,
+                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= num_slices * SELLCS_C)
+    {
+        return;
+    }
+
+    rocsparse_int slice  = gid / SELLCS_C;
+    rocsparse_int r      = gid % SELLCS_C;
+    rocsparse_int offset = slice_ptr[slice];
+    rocsparse_int width  = (slice_ptr[slice + 1] - offset) / SELLCS_C;
+
+    rocsparse_int row_begin = 0;
+    rocsparse_int row_nnz   = 0;
+
+    if(gid < m)
+    {
+        rocsparse_int row = (perm != nullptr) ? perm[gid] : gid;
+
+        row_begin = csr_row_ptr[row] - idx_base;
+        row_nnz   = csr_row_ptr[row + 1] - idx_base - row_begin;
+    }
+
+    // Fill slice
+    for(rocsparse_int p = 0; p < row_nnz; ++p)
+    {
+        rocsparse_int idx = SELLCS_IND(offset, r, p);
+        sell_col_ind[idx] = csr_col_ind[row_begin + p];
+        sell_val[idx]     = csr_val[row_begin + p];
+    }
+
+    // Pad remaining slice structure
+    for(rocsparse_int p = row_nnz; p < width; ++p)
+    {
+        rocsparse_int idx = SELLCS_IND(offset, r, p);
+        sell_col_ind[idx] = -1;
+        sell_val[idx]     = static_cast<T>(0);
+    }
+}
+
+#endif // CSR2SELLCS_DEVICE_H
@@ -0,0 +1,368 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef ROCSPARSE_CSR2CSR5_HPP
+#define ROCSPARSE_CSR2CSR5_HPP
+
+#include "csr2csr5_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+#define CSR2CSR5_DIM 256
+
+template <typename T, rocsparse_int SIGMA>
+static void csr2csr5_tile_desc(rocsparse_handle          handle,
+                               rocsparse_int             m,
+                               const rocsparse_mat_descr descr,
+                               const T*                  csr_val,
+                               const rocsparse_int*      csr_row_ptr,
+                               const rocsparse_int*      csr_col_ind,
+                               rocsparse_csr5_mat        csr5,
+                               rocsparse_int*            tile_count)
+{
+    hipLaunchKernelGGL((csr2csr5_tile_desc_kernel<T, CSR2CSR5_DIM, SIGMA>),
+                       dim3((csr5->num_tiles * CSR5_OMEGA - 1) / CSR2CSR5_DIM + 1),
+                       dim3(CSR2CSR5_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       csr5->num_tiles,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       csr5->tile_ptr,
+                       csr5->tile_flag,
+                       tile_count,
+                       csr5->col_ind,
+                       (T*)csr5->val,
+                       descr->base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2csr5_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_csr5_mat        csr5)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr5 == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2csr5"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)csr5);
+
+    log_bench(handle, "./rocsparse-bench -f csr5mv -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Get number of CSR non-zeros
+    rocsparse_int nnz;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Correct by index base
+    nnz -= descr->base;
+
+    // Clear CSR5 structure if already allocated
+    if(csr5->row_ptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csr5->row_ptr));
+    }
+    if(csr5->col_ind)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csr5->col_ind));
+    }
+    if(csr5->val)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csr5->val));
+    }
+    if(csr5->tile_ptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csr5->tile_ptr));
+    }
+    if(csr5->tile_flag)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csr5->tile_flag));
+    }
+    if(csr5->tile_offset)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csr5->tile_offset));
+    }
+
+    csr5->row_ptr     = nullptr;
+    csr5->col_ind     = nullptr;
+    csr5->val         = nullptr;
+    csr5->tile_ptr    = nullptr;
+    csr5->tile_flag   = nullptr;
+    csr5->tile_offset = nullptr;
+
+    // Tile height is determined by the average row length, such that most lanes
+    // contain few row starts
+    rocsparse_int nnz_per_row = nnz / m;
+
+    csr5->m         = m;
+    csr5->n         = n;
+    csr5->nnz       = nnz;
+    csr5->sigma     = (nnz_per_row <= 8) ? 8 : ((nnz_per_row <= 16) ? 16 : 32);
+    csr5->num_tiles = nnz / (CSR5_OMEGA * csr5->sigma);
+    csr5->tail_row  = 0;
+
+    rocsparse_int tile_size = CSR5_OMEGA * csr5->sigma;
+    rocsparse_int num_lanes = csr5->num_tiles * CSR5_OMEGA;
+
+    // Allocate CSR5 structure
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csr5->row_ptr, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&csr5->tile_ptr, sizeof(rocsparse_int) * (csr5->num_tiles + 1)));
+
+    if(nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&csr5->col_ind, sizeof(rocsparse_int) * nnz));
+        RETURN_IF_HIP_ERROR(hipMalloc(&csr5->val, sizeof(T) * nnz));
+    }
+
+    if(num_lanes > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&csr5->tile_flag, sizeof(unsigned int) * num_lanes));
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&csr5->tile_offset, sizeof(rocsparse_int) * num_lanes));
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr5->row_ptr,
+                                       csr_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    // First row of each tile
+    hipLaunchKernelGGL((csr2csr5_tile_ptr_kernel<CSR2CSR5_DIM>),
+                       dim3(csr5->num_tiles / CSR2CSR5_DIM + 1),
+                       dim3(CSR2CSR5_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr5->num_tiles,
+                       tile_size,
+                       csr_row_ptr,
+                       csr5->tile_ptr,
+                       descr->base);
+
+    // Obtain the row of the entries that follow the last tile
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&csr5->tail_row,
+                                       csr5->tile_ptr + csr5->num_tiles,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Entries that follow the last tile are kept in CSR order
+    rocsparse_int tail_begin = csr5->num_tiles * tile_size;
+
+    if(nnz > tail_begin)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr5->col_ind + tail_begin,
+                                           csr_col_ind + tail_begin,
+                                           sizeof(rocsparse_int) * (nnz - tail_begin),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync((T*)csr5->val + tail_begin,
+                                           csr_val + tail_begin,
+                                           sizeof(T) * (nnz - tail_begin),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+
+    if(num_lanes == 0)
+    {
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return rocsparse_status_success;
+    }
+
+    // Flag tiles that contain empty rows
+    hipLaunchKernelGGL((csr2csr5_empty_rows_kernel<CSR2CSR5_DIM>),
+                       dim3((m - 1) / CSR2CSR5_DIM + 1),
+                       dim3(CSR2CSR5_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr5->num_tiles,
+                       tile_size,
+                       csr_row_ptr,
+                       csr5->tile_ptr,
+                       descr->base);
+
+    // Number of row starts per lane, scanned in place
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                (rocsparse_int*)nullptr,
+                                                (rocsparse_int*)nullptr,
+                                                0,
+                                                num_lanes,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    size_t count_bytes = ((sizeof(rocsparse_int) * num_lanes - 1) / 256 + 1) * 256;
+    size_t temp_bytes  = count_bytes + rocprim_size;
+
+    // Get temporary storage
+    bool  temp_alloc;
+    char* ptr;
+
+    // Device buffer should be sufficient in most cases
+    if(handle->buffer_size >= temp_bytes)
+    {
+        ptr        = reinterpret_cast<char*>(handle->buffer);
+        temp_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&ptr, temp_bytes));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* tile_count     = reinterpret_cast<rocsparse_int*>(ptr);
+    void*          rocprim_buffer = reinterpret_cast<void*>(ptr + count_bytes);
+
+    // Tile descriptor and transposed tiles
+    if(csr5->sigma == 8)
+    {
+        csr2csr5_tile_desc<T, 8>(
+            handle, m, descr, csr_val, csr_row_ptr, csr_col_ind, csr5, tile_count);
+    }
+    else if(csr5->sigma == 16)
+    {
+        csr2csr5_tile_desc<T, 16>(
+            handle, m, descr, csr_val, csr_row_ptr, csr_col_ind, csr5, tile_count);
+    }
+    else
+    {
+        csr2csr5_tile_desc<T, 32>(
+            handle, m, descr, csr_val, csr_row_ptr, csr_col_ind, csr5, tile_count);
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                tile_count,
+                                                tile_count,
+                                                0,
+                                                num_lanes,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Row start offsets relative to each tile
+    hipLaunchKernelGGL((csr2csr5_tile_offset_kernel<CSR2CSR5_DIM>),
+                       dim3((num_lanes - 1) / CSR2CSR5_DIM + 1),
+                       dim3(CSR2CSR5_DIM),
+                       0,
+                       stream,
+                       csr5->num_tiles,
+                       tile_count,
+                       csr5->tile_offset);
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2CSR5_HPP
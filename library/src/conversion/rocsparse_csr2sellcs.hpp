@@ -0,0 +1,353 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef ROCSPARSE_CSR2SELLCS_HPP
+#define ROCSPARSE_CSR2SELLCS_HPP
+
+#include "csr2sellcs_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+#define CSR2SELLCS_DIM 256
+
+template <typename T>
+rocsparse_status rocsparse_csr2sellcs_template(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_sellcs_mat      sell,
+                                               rocsparse_int             sigma)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2sellcs"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)sell,
+              sigma);
+
+    log_bench(handle, "./rocsparse-bench -f csr2sellcs -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sigma < 1)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Get number of CSR non-zeros
+    rocsparse_int nnz;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Correct by index base
+    nnz -= descr->base;
+
+    // Clear SELL-C-sigma structure if already allocated
+    if(sell->slice_ptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(sell->slice_ptr));
+    }
+    if(sell->perm)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(sell->perm));
+    }
+    if(sell->col_ind)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(sell->col_ind));
+    }
+    if(sell->val)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(sell->val));
+    }
+
+    sell->slice_ptr = nullptr;
+    sell->perm      = nullptr;
+    sell->col_ind   = nullptr;
+    sell->val       = nullptr;
+
+    // Sorting windows that exceed the matrix are clamped to m rows
+    sigma = std::min(sigma, m);
+
+    sell->m          = m;
+    sell->n          = n;
+    sell->nnz        = nnz;
+    sell->sigma      = sigma;
+    sell->num_slices = (m - 1) / SELLCS_C + 1;
+    sell->sell_nnz   = 0;
+
+    rocsparse_int num_windows = (m - 1) / sigma + 1;
+
+    // Allocate slice offsets and row permutation
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&sell->slice_ptr, sizeof(rocsparse_int) * (sell->num_slices + 1)));
+
+    if(sigma > 1)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&sell->perm, sizeof(rocsparse_int) * m));
+    }
+
+    // Determine temporary storage size
+    size_t rocprim_size;
+    size_t size;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                sell->slice_ptr,
+                                                sell->slice_ptr,
+                                                sell->num_slices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    size_t row_bytes    = ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+    size_t window_bytes = ((sizeof(rocsparse_int) * (num_windows + 1) - 1) / 256 + 1) * 256;
+    size_t temp_bytes   = 0;
+
+    if(sigma > 1)
+    {
+        RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(nullptr,
+                                                                     size,
+                                                                     (rocsparse_int*)nullptr,
+                                                                     (rocsparse_int*)nullptr,
+                                                                     (rocsparse_int*)nullptr,
+                                                                     sell->perm,
+                                                                     m,
+                                                                     num_windows,
+                                                                     (rocsparse_int*)nullptr,
+                                                                     (rocsparse_int*)nullptr,
+                                                                     0,
+                                                                     rocsparse_clz(n),
+                                                                     stream));
+
+        rocprim_size = std::max(rocprim_size, size);
+
+        // Row lengths, sorted row lengths, identity permutation and window offsets
+        temp_bytes = 3 * row_bytes + window_bytes;
+    }
+
+    temp_bytes += rocprim_size;
+
+    // Get temporary storage
+    bool  temp_alloc;
+    char* ptr;
+
+    // Device buffer should be sufficient in most cases
+    if(handle->buffer_size >= temp_bytes)
+    {
+        ptr        = reinterpret_cast<char*>(handle->buffer);
+        temp_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&ptr, temp_bytes));
+        temp_alloc = true;
+    }
+
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    // Sort rows by length within each window
+    if(sigma > 1)
+    {
+        rocsparse_int* row_nnz    = reinterpret_cast<rocsparse_int*>(ptr);
+        rocsparse_int* row_sorted = reinterpret_cast<rocsparse_int*>(ptr + row_bytes);
+        rocsparse_int* identity   = reinterpret_cast<rocsparse_int*>(ptr + 2 * row_bytes);
+        rocsparse_int* window_ptr = reinterpret_cast<rocsparse_int*>(ptr + 3 * row_bytes);
+
+        rocprim_buffer = reinterpret_cast<void*>(ptr + 3 * row_bytes + window_bytes);
+
+        hipLaunchKernelGGL((csr2sellcs_row_nnz_kernel<CSR2SELLCS_DIM>),
+                           dim3((m - 1) / CSR2SELLCS_DIM + 1),
+                           dim3(CSR2SELLCS_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           row_nnz,
+                           identity);
+
+        hipLaunchKernelGGL((csr2sellcs_window_ptr_kernel<CSR2SELLCS_DIM>),
+                           dim3(num_windows / CSR2SELLCS_DIM + 1),
+                           dim3(CSR2SELLCS_DIM),
+                           0,
+                           stream,
+                           m,
+                           num_windows,
+                           sigma,
+                           window_ptr);
+
+        // Stable sort, rows of equal length keep their original order
+        RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(rocprim_buffer,
+                                                                     rocprim_size,
+                                                                     row_nnz,
+                                                                     row_sorted,
+                                                                     identity,
+                                                                     sell->perm,
+                                                                     m,
+                                                                     num_windows,
+                                                                     window_ptr,
+                                                                     window_ptr + 1,
+                                                                     0,
+                                                                     rocsparse_clz(n),
+                                                                     stream));
+    }
+
+    // Slice sizes
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(
+        sell->slice_ptr, 0, sizeof(rocsparse_int) * (sell->num_slices + 1), stream));
+
+    hipLaunchKernelGGL((csr2sellcs_slice_size_kernel<CSR2SELLCS_DIM>),
+                       dim3((m - 1) / CSR2SELLCS_DIM + 1),
+                       dim3(CSR2SELLCS_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       sell->perm,
+                       sell->slice_ptr);
+
+    // Slice offsets
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                sell->slice_ptr,
+                                                sell->slice_ptr,
+                                                sell->num_slices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Obtain number of stored entries, including padding
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&sell->sell_nnz,
+                                       sell->slice_ptr + sell->num_slices,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+    }
+
+    // Quick return if all rows are empty
+    if(sell->sell_nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Allocate slices
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&sell->col_ind, sizeof(rocsparse_int) * sell->sell_nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc(&sell->val, sizeof(T) * sell->sell_nnz));
+
+    hipLaunchKernelGGL((csr2sellcs_kernel<T>),
+                       dim3((sell->num_slices * SELLCS_C - 1) / CSR2SELLCS_DIM + 1),
+                       dim3(CSR2SELLCS_DIM),
+                       0,
+                       stream,
+                       m,
+                       sell->num_slices,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       sell->slice_ptr,
+                       sell->perm,
+                       sell->col_ind,
+                       (T*)sell->val,
+                       descr->base);
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2SELLCS_HPP
@@ -68,12 +68,16 @@ _rocsparse_handle::_rocsparse_handle()
     THROW_IF_HIP_ERROR(hipMalloc(&sone, sizeof(float)));
     THROW_IF_HIP_ERROR(hipMalloc(&done, sizeof(double)));
 
+    // Device reduction counter
+    THROW_IF_HIP_ERROR(hipMalloc(&reduce_count, sizeof(int)));
+
     // Execute empty kernel for initialization
     hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, stream);
 
     // Execute memset for initialization
     THROW_IF_HIP_ERROR(hipMemsetAsync(sone, 0, sizeof(float), stream));
     THROW_IF_HIP_ERROR(hipMemsetAsync(done, 0, sizeof(double), stream));
+    THROW_IF_HIP_ERROR(hipMemsetAsync(reduce_count, 0, sizeof(int), stream));
 
     float  hsone = 1.0f;
     double hdone = 1.0;
@@ -105,6 +109,7 @@ _rocsparse_handle::~_rocsparse_handle()
     PRINT_IF_HIP_ERROR(hipFree(buffer));
     PRINT_IF_HIP_ERROR(hipFree(sone));
     PRINT_IF_HIP_ERROR(hipFree(done));
+    PRINT_IF_HIP_ERROR(hipFree(reduce_count));
 
     // Close log files
     if(log_trace_ofs.is_open())
@@ -180,11 +185,32 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
     }
 
     // Clean up row blocks
-    if(info->size > 0)
+    if(info->row_blocks != nullptr)
     {
         RETURN_IF_HIP_ERROR(hipFree(info->row_blocks));
     }
 
+    if(info->device_size != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->device_size));
+    }
+
+    // Clean up transposed triangle
+    if(info->symm_col_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->symm_col_ptr));
+    }
+
+    if(info->symm_row_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->symm_row_ind));
+    }
+
+    if(info->symm_perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->symm_perm));
+    }
+
     // Destruct
     try
     {
@@ -197,6 +223,28 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Row blocks that have been computed on the device require their number
+ * to be known on the host, before they can be used.
+ *******************************************************************************/
+rocsparse_status rocsparse_csrmv_info_fetch_size(rocsparse_handle     handle,
+                                                 rocsparse_csrmv_info info)
+{
+    if(info->device_size == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &info->size, info->device_size, sizeof(size_t), hipMemcpyDeviceToHost, handle->stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    RETURN_IF_HIP_ERROR(hipFree(info->device_size));
+
+    info->device_size = nullptr;
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_csrtr_info is a structure holding the rocsparse csrsv and
  * csrilu0 data gathered during csrsv_analysis and csrilu0_analysis. It must be
@@ -253,6 +301,107 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
         info->zero_pivot = nullptr;
     }
 
+    if(info->dep_count != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->dep_count));
+        info->dep_count = nullptr;
+    }
+
+    if(info->ilu0_update_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->ilu0_update_ptr));
+        info->ilu0_update_ptr = nullptr;
+    }
+
+    if(info->ilu0_update_src != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->ilu0_update_src));
+        info->ilu0_update_src = nullptr;
+    }
+
+    if(info->ilu0_update_dst != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->ilu0_update_dst));
+        info->ilu0_update_dst = nullptr;
+    }
+
+    if(info->ilu0_done != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->ilu0_done));
+        info->ilu0_done = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the symbolic ILU(k)
+ * factorization gathered during csriluk_symbolic. It must be initialized using
+ * the rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csriluk_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up
+    if(info->lu_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->lu_row_ptr));
+        info->lu_row_ptr = nullptr;
+    }
+
+    if(info->lu_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->lu_col_ind));
+        info->lu_col_ind = nullptr;
+    }
+
+    if(info->lu_map != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->lu_map));
+        info->lu_map = nullptr;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrtr));
+    info->csrtr = nullptr;
+
     // Destruct
     try
     {
@@ -25,6 +25,8 @@
 #ifndef COMMON_H
 #define COMMON_H
 
+#include "rocsparse.h"
+
 #include <hip/hip_runtime.h>
 
 // clang-format off
@@ -46,6 +48,9 @@ __device__ __forceinline__ double rocsparse_fma(double p, double q, double r) {
 __device__ __forceinline__ float rocsparse_rcp(float val) { return 1.0f / val; }
 __device__ __forceinline__ double rocsparse_rcp(double val) { return 1.0 / val; }
 
+__device__ __forceinline__ float rocsparse_abs(float val) { return fabsf(val); }
+__device__ __forceinline__ double rocsparse_abs(double val) { return fabs(val); }
+
 __device__ __forceinline__ int32_t rocsparse_mul24(int32_t x, int32_t y) { return ((x << 8) >> 8) * ((y << 8) >> 8); }
 __device__ __forceinline__ int64_t rocsparse_mul24(int64_t x, int64_t y) { return ((x << 40) >> 40) * ((y << 40) >> 40); }
 
@@ -55,6 +60,9 @@ __device__ __forceinline__ int rocsparse_atomic_load(const int* ptr, int memorde
 
 __device__ __forceinline__ void rocsparse_atomic_store(int* ptr, int val, int memorder) { __atomic_store_n(ptr, val, memorder); }
 
+// Wavefront barrier, shared memory written by any lane is visible to all lanes of the wavefront afterwards
+__device__ __forceinline__ void rocsparse_wavefront_barrier() { __builtin_amdgcn_fence(__ATOMIC_RELEASE, "wavefront"); __builtin_amdgcn_wave_barrier(); __builtin_amdgcn_fence(__ATOMIC_ACQUIRE, "wavefront"); }
+
 // Block reduce kernel computing block sum
 template <typename T, unsigned int BLOCKSIZE>
 __device__ __forceinline__ void rocsparse_blockreduce_sum(int i, T* data)
@@ -214,4 +222,18 @@ __device__ __forceinline__ double rocsparse_wfreduce_sum(double sum)
 }
 // clang-format on
 
+// Return the vector of batch b, either strided from a single base pointer or
+// taken from an array of pointers
+template <typename T>
+__device__ __forceinline__ T* rocsparse_batch_ptr(T* ptr, rocsparse_int stride, rocsparse_int b)
+{
+    return ptr + static_cast<size_t>(stride) * b;
+}
+
+template <typename T>
+__device__ __forceinline__ T* rocsparse_batch_ptr(T* const* ptr, rocsparse_int, rocsparse_int b)
+{
+    return ptr[b];
+}
+
 #endif // COMMON_H
@@ -0,0 +1,188 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR_HASH_H
+#define CSR_HASH_H
+
+#include "common.h"
+#include "definitions.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Number of blocks (and threads per block) used to compute the structural hash.
+// rocsparse_csr_hash_template() requires CSR_HASH_DIM elements of workspace.
+#define CSR_HASH_DIM 256
+
+// splitmix64 finalizer
+__host__ __device__ __forceinline__ unsigned long long rocsparse_hash_mix(unsigned long long x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+
+    return x;
+}
+
+// The structural hash of a CSR matrix is the sum of the mixed (position, value)
+// pairs of the concatenation of csr_row_ptr and csr_col_ind. The sum is order
+// independent, such that it can be computed by a parallel reduction, while the
+// position makes it sensitive to any change of the sparsity pattern.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr_hash_kernel_part1(rocsparse_int m,
+                               rocsparse_int nnz,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               unsigned long long* __restrict__ workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    // m + 1 + nnz may exceed the range of rocsparse_int, but always fits into 32 bits
+    // unsigned, such that the position is not truncated when shifted below
+    int64_t gid    = static_cast<int64_t>(hipBlockDim_x) * hipBlockIdx_x + tid;
+    int64_t stride = static_cast<int64_t>(hipGridDim_x) * hipBlockDim_x;
+    int64_t size   = static_cast<int64_t>(m) + 1 + nnz;
+
+    __shared__ unsigned long long sdata[BLOCKSIZE];
+    sdata[tid] = 0ULL;
+
+    for(int64_t idx = gid; idx < size; idx += stride)
+    {
+        rocsparse_int val = (idx <= m) ? csr_row_ptr[idx] : csr_col_ind[idx - m - 1];
+
+        sdata[tid] += rocsparse_hash_mix((static_cast<unsigned long long>(idx) << 32)
+                                         | static_cast<unsigned int>(val));
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<unsigned long long, BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr_hash_kernel_part2(rocsparse_int m,
+                               rocsparse_int nnz,
+                               rocsparse_int n,
+                               const unsigned long long* __restrict__ workspace,
+                               unsigned long long* __restrict__ hash)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ unsigned long long sdata[BLOCKSIZE];
+    sdata[tid] = 0ULL;
+
+    for(rocsparse_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        sdata[tid] += workspace[i];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<unsigned long long, BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        // Mix in the dimensions
+        *hash = rocsparse_hash_mix(
+            sdata[0]
+            + rocsparse_hash_mix((static_cast<unsigned long long>(m) << 32)
+                                 | static_cast<unsigned int>(nnz)));
+    }
+}
+
+// Computes the structural hash of a CSR matrix into the device pointer hash.
+// The computation is asynchronous and uses the handle device buffer as workspace.
+static rocsparse_status rocsparse_csr_hash_template(rocsparse_handle     handle,
+                                                    rocsparse_int        m,
+                                                    rocsparse_int        nnz,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    unsigned long long*  hash)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Get workspace from handle device buffer
+    unsigned long long* workspace = reinterpret_cast<unsigned long long*>(handle->buffer);
+
+    hipLaunchKernelGGL((csr_hash_kernel_part1<CSR_HASH_DIM>),
+                       dim3(CSR_HASH_DIM),
+                       dim3(CSR_HASH_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       workspace);
+
+    hipLaunchKernelGGL((csr_hash_kernel_part2<CSR_HASH_DIM>),
+                       dim3(1),
+                       dim3(CSR_HASH_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       CSR_HASH_DIM,
+                       workspace,
+                       hash);
+
+    return rocsparse_status_success;
+}
+
+// Computes the structural hash of a CSR matrix into the host pointer hash.
+// This function is blocking with respect to the host.
+static rocsparse_status rocsparse_csr_hash(rocsparse_handle     handle,
+                                           rocsparse_int        m,
+                                           rocsparse_int        nnz,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           unsigned long long*  hash)
+{
+    // The hash is stored right after the reduction workspace
+    unsigned long long* d_hash
+        = reinterpret_cast<unsigned long long*>(handle->buffer) + CSR_HASH_DIM;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr_hash_template(handle, m, nnz, csr_row_ptr, csr_col_ind, d_hash));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hash, d_hash, sizeof(unsigned long long), hipMemcpyDeviceToHost, handle->stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
+    return rocsparse_status_success;
+}
+
+#endif // CSR_HASH_H
@@ -35,6 +35,7 @@
 /*! \brief typedefs to opaque info structs */
 typedef struct _rocsparse_csrmv_info* rocsparse_csrmv_info;
 typedef struct _rocsparse_csrtr_info* rocsparse_csrtr_info;
+typedef struct _rocsparse_csriluk_info* rocsparse_csriluk_info;
 
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
@@ -65,6 +66,14 @@ struct _rocsparse_handle
     hipStream_t stream = 0;
     // pointer mode ; default mode is host
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
+    // analysis mode ; default mode is host
+    rocsparse_analysis_mode analysis_mode = rocsparse_analysis_mode_host;
+    // analysis policy of functions without policy argument ; default is force
+    rocsparse_analysis_policy analysis_policy = rocsparse_analysis_policy_force;
+    // result mode of reductions in host pointer mode ; default is blocking
+    rocsparse_result_mode result_mode = rocsparse_result_mode_blocking;
+    // csrmv algorithm without analysis ; default is auto
+    rocsparse_csrmv_alg csrmv_alg = rocsparse_csrmv_alg_auto;
     // logging mode
     rocsparse_layer_mode layer_mode;
     // device buffer
@@ -73,6 +82,8 @@ struct _rocsparse_handle
     // device one
     float*  sone;
     double* done;
+    // device reduction counter, reset to zero by the last block of each reduction
+    int* reduce_count;
 
     // logging streams
     std::ofstream log_trace_ofs;
@@ -130,6 +141,81 @@ struct _rocsparse_hyb_mat
     void*          coo_val     = nullptr;
 };
 
+/********************************************************************************
+ * \brief rocsparse_csr5_mat is a structure holding the rocsparse CSR5 matrix.
+ * It must be initialized using rocsparse_create_csr5_mat() and the returned
+ * handle must be passed to all subsequent library function calls that involve
+ * the CSR5 matrix.
+ * It should be destroyed at the end using rocsparse_destroy_csr5_mat().
+ *******************************************************************************/
+struct _rocsparse_csr5_mat
+{
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+    // num non-zero entries
+    rocsparse_int nnz = 0;
+
+    // tile height, each tile holds CSR5_OMEGA * sigma entries
+    rocsparse_int sigma = 0;
+    // num tiles, entries following the last tile are kept in CSR order
+    rocsparse_int num_tiles = 0;
+    // row that holds the first entry following the last tile
+    rocsparse_int tail_row = 0;
+
+    // CSR row pointer
+    rocsparse_int* row_ptr = nullptr;
+
+    // first row of each tile, flagged by CSR5_EMPTY_TILE if the tile
+    // contains empty rows
+    rocsparse_int* tile_ptr = nullptr;
+
+    // tile descriptor, row start bit flags and number of row starts that
+    // precede each lane within its tile
+    unsigned int*  tile_flag   = nullptr;
+    rocsparse_int* tile_offset = nullptr;
+
+    // column indices and values, transposed within each tile
+    rocsparse_int* col_ind = nullptr;
+    void*          val     = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_sellcs_mat is a structure holding the rocsparse SELL-C-sigma
+ * matrix. It must be initialized using rocsparse_create_sellcs_mat() and the
+ * returned handle must be passed to all subsequent library function calls that
+ * involve the SELL-C-sigma matrix.
+ * It should be destroyed at the end using rocsparse_destroy_sellcs_mat().
+ *******************************************************************************/
+struct _rocsparse_sellcs_mat
+{
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+    // num non-zero entries
+    rocsparse_int nnz = 0;
+
+    // rows are sorted by length within windows of sigma rows
+    rocsparse_int sigma = 1;
+    // num slices of SELLCS_C rows
+    rocsparse_int num_slices = 0;
+    // num stored entries, including padding
+    rocsparse_int sell_nnz = 0;
+
+    // offset of each slice, the slice width is given by the offset difference
+    // divided by SELLCS_C
+    rocsparse_int* slice_ptr = nullptr;
+
+    // original row of each sorted row, only required if sigma > 1
+    rocsparse_int* perm = nullptr;
+
+    // column indices and values, column-major within each slice
+    rocsparse_int* col_ind = nullptr;
+    void*          val     = nullptr;
+};
+
 /********************************************************************************
  * \brief rocsparse_mat_info is a structure holding the matrix info data that is
  * gathered during the analysis routines. It must be initialized by calling
@@ -140,12 +226,34 @@ struct _rocsparse_hyb_mat
 struct _rocsparse_mat_info
 {
     // info structs
-    rocsparse_csrmv_info csrmv_info       = nullptr;
-    rocsparse_csrtr_info csrilu0_info     = nullptr;
-    rocsparse_csrtr_info csrsv_upper_info = nullptr;
-    rocsparse_csrtr_info csrsv_lower_info = nullptr;
+    rocsparse_csrmv_info   csrmv_info        = nullptr;
+    rocsparse_csrtr_info   csrilu0_info      = nullptr;
+    rocsparse_csrtr_info   csric0_info       = nullptr;
+    rocsparse_csrtr_info   csrsv_upper_info  = nullptr;
+    rocsparse_csrtr_info   csrsv_lower_info  = nullptr;
+    rocsparse_csrtr_info   csrsvt_upper_info = nullptr;
+    rocsparse_csrtr_info   csrsvt_lower_info = nullptr;
+    rocsparse_csriluk_info csriluk_info      = nullptr;
+
+    // csrilu0 pivot boosting, tiny pivots with magnitude less or equal to boost_tol
+    // are replaced by boost_val, boost_count is a device pointer holding the number of
+    // boosted rows of the last factorization
+    int            boost_enable = 0;
+    double         boost_tol    = 0.0;
+    double         boost_val    = 0.0;
+    rocsparse_int* boost_count  = nullptr;
 };
 
+/********************************************************************************
+ * \brief Strategy of the transposed csrmv, chosen during csrmv_analysis from the
+ * column distribution of the matrix.
+ *******************************************************************************/
+typedef enum rocsparse_csrmvt_alg_
+{
+    rocsparse_csrmvt_alg_atomic = 0, // scatter into y using global atomics
+    rocsparse_csrmvt_alg_lds    = 1  // accumulate into a block private copy of y in LDS
+} rocsparse_csrmvt_alg;
+
 /********************************************************************************
  * \brief rocsparse_csrmv_info is a structure holding the rocsparse csrmv info
  * data gathered during csrmv_analysis. It must be initialized using the
@@ -158,6 +266,21 @@ struct _rocsparse_csrmv_info
     size_t size = 0;
     // row blocks
     unsigned long long* row_blocks = nullptr;
+    // device pointer to hold num row blocks, if row blocks have been computed on
+    // the device and their number is not yet known on the host
+    size_t* device_size = nullptr;
+
+    // strategy of the transposed product, row blocks are not used in this case
+    rocsparse_csrmvt_alg trans_alg = rocsparse_csrmvt_alg_atomic;
+
+    // transpose of the stored triangle of symmetric matrices, row blocks are not used
+    // in this case. symm_perm holds the position of each entry in the csr arrays.
+    rocsparse_int* symm_col_ptr = nullptr;
+    rocsparse_int* symm_row_ind = nullptr;
+    rocsparse_int* symm_perm    = nullptr;
+
+    // structural hash of the analysed sparsity pattern, 0 if unknown
+    unsigned long long hash = 0;
 
     // some data to verify correct execution
     rocsparse_operation         trans;
@@ -182,6 +305,12 @@ rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info);
 
+/********************************************************************************
+ * \brief Fetch the number of row blocks that have been computed on the device.
+ *******************************************************************************/
+rocsparse_status rocsparse_csrmv_info_fetch_size(rocsparse_handle     handle,
+                                                 rocsparse_csrmv_info info);
+
 struct _rocsparse_csrtr_info
 {
     // maximum non-zero entries per row
@@ -193,6 +322,26 @@ struct _rocsparse_csrtr_info
     rocsparse_int* csr_diag_ind = nullptr;
     // device pointer to hold zero pivot
     rocsparse_int* zero_pivot = nullptr;
+    // device array to hold the number of rows each row depends on, for transposed
+    // solves only
+    rocsparse_int* dep_count = nullptr;
+
+    // host array to hold the first row of each level in row_map, if the solve is
+    // level scheduled, empty otherwise
+    std::vector<rocsparse_int> level_ptr;
+
+    // device arrays to hold the update lists of the csrilu0 refactorization, the
+    // updates of entry j are stored from ilu0_update_ptr[j] to ilu0_update_ptr[j + 1]
+    rocsparse_int* ilu0_update_ptr = nullptr;
+    rocsparse_int* ilu0_update_src = nullptr;
+    rocsparse_int* ilu0_update_dst = nullptr;
+    // device array to hold the done flags of the csrilu0 refactorization and their
+    // current epoch
+    int* ilu0_done  = nullptr;
+    int  ilu0_epoch = 0;
+
+    // structural hash of the analysed sparsity pattern, 0 if unknown
+    unsigned long long hash = 0;
 
     // some data to verify correct execution
     rocsparse_int               m;
@@ -215,6 +364,44 @@ rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info);
 
+struct _rocsparse_csriluk_info
+{
+    // level of fill
+    rocsparse_int fill_level = 0;
+    // number of non-zero entries of the factorized matrix
+    rocsparse_int lu_nnz = 0;
+
+    // device arrays to hold the sparsity pattern of the factorized matrix
+    rocsparse_int* lu_row_ptr = nullptr;
+    rocsparse_int* lu_col_ind = nullptr;
+    // device array to hold the position of each entry of A in the factorized matrix
+    rocsparse_int* lu_map = nullptr;
+
+    // meta data of the factorized sparsity pattern, gathered by the level analysis
+    rocsparse_csrtr_info csrtr = nullptr;
+
+    // structural hash of A, 0 if unknown
+    unsigned long long hash = 0;
+
+    // some data to verify correct execution
+    rocsparse_int        m;
+    rocsparse_int        nnz;
+    rocsparse_index_base base;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the symbolic ILU(k)
+ * factorization gathered during csriluk_symbolic. It must be initialized using
+ * the rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info);
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info);
+
 /********************************************************************************
  * \brief ELL format indexing
  *******************************************************************************/
@@ -222,4 +409,18 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info);
 #define ELL_IND_EL(i, el, m, width) (el) + (width) * (i)
 #define ELL_IND(i, el, m, width) ELL_IND_ROW(i, el, m, width)
 
+/********************************************************************************
+ * \brief CSR5 format tiling, entry s of lane l of a tile is stored transposed
+ *******************************************************************************/
+#define CSR5_OMEGA 32
+#define CSR5_EMPTY_TILE 0x80000000
+#define CSR5_IND(tile, l, s, sigma) (tile) * CSR5_OMEGA * (sigma) + (s) * CSR5_OMEGA + (l)
+
+/********************************************************************************
+ * \brief SELL-C-sigma format slicing, entry p of row r of a slice is stored
+ * column-major
+ *******************************************************************************/
+#define SELLCS_C 32
+#define SELLCS_IND(offset, r, p) (offset) + (p) * SELLCS_C + (r)
+
 #endif // HANDLE_H
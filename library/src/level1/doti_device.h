@@ -30,17 +30,21 @@
 #include <hip/hip_runtime.h>
 
 template <typename T, rocsparse_int NB>
-__global__ void doti_kernel_part1(rocsparse_int        nnz,
-                                  const T*             x_val,
-                                  const rocsparse_int* x_ind,
-                                  const T*             y,
-                                  T*                   workspace,
-                                  rocsparse_index_base idx_base)
+__global__ void doti_kernel(rocsparse_int        nnz,
+                            const T*             x_val,
+                            const rocsparse_int* x_ind,
+                            const T*             y,
+                            T*                   workspace,
+                            int*                 count,
+                            T*                   result,
+                            rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
     rocsparse_int gid = hipBlockDim_x * hipBlockIdx_x + tid;
 
-    __shared__ T sdata[NB];
+    __shared__ T    sdata[NB];
+    __shared__ bool last;
+
     sdata[tid] = static_cast<T>(0);
 
     for(rocsparse_int idx = gid; idx < nnz; idx += hipGridDim_x * hipBlockDim_x)
@@ -55,37 +59,67 @@ __global__ void doti_kernel_part1(rocsparse_int        nnz,
     if(tid == 0)
     {
         workspace[hipBlockIdx_x] = sdata[0];
+
+        // Make the partial sum visible to all blocks before signaling completion
+        __threadfence();
+
+        last = (atomicAdd(count, 1) == static_cast<int>(hipGridDim_x) - 1);
+    }
+
+    __syncthreads();
+
+    // The last block to finish reduces the partial sums of all blocks
+    if(!last)
+    {
+        return;
+    }
+
+    // Do not read partial sums of other blocks from a stale cache
+    __threadfence();
+
+    sdata[tid] = static_cast<T>(0);
+
+    for(rocsparse_int i = tid; i < hipGridDim_x; i += NB)
+    {
+        sdata[tid] += workspace[i];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        *result = sdata[0];
+
+        // Reset the counter for subsequent reductions
+        *count = 0;
     }
 }
 
+// Dot product of a sparse vector with a dense vector, computed by a single block
 template <typename T, rocsparse_int NB>
-__global__ void doti_kernel_part2(rocsparse_int n, T* workspace, T* result)
+__device__ T doti_block_device(rocsparse_int        nnz,
+                               const T*             x_val,
+                               const rocsparse_int* x_ind,
+                               const T*             y,
+                               rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
 
     __shared__ T sdata[NB];
     sdata[tid] = static_cast<T>(0);
 
-    for(rocsparse_int i = tid; i < n; i += NB)
+    for(rocsparse_int idx = tid; idx < nnz; idx += NB)
     {
-        sdata[tid] += workspace[i];
+        sdata[tid] += y[x_ind[idx] - idx_base] * x_val[idx];
     }
 
     __syncthreads();
 
     rocsparse_blockreduce_sum<T, NB>(tid, sdata);
 
-    if(tid == 0)
-    {
-        if(result)
-        {
-            *result = sdata[0];
-        }
-        else
-        {
-            workspace[0] = sdata[0];
-        }
-    }
+    return sdata[0];
 }
 
 #endif // DOTI_DEVICE_H
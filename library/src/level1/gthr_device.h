@@ -28,7 +28,7 @@
 #include <hip/hip_runtime.h>
 
 template <typename T>
-__global__ void gthr_kernel(rocsparse_int        nnz,
+__device__ void gthr_device(rocsparse_int        nnz,
                             const T*             y,
                             T*                   x_val,
                             const rocsparse_int* x_ind,
@@ -44,4 +44,14 @@ __global__ void gthr_kernel(rocsparse_int        nnz,
     x_val[idx] = y[x_ind[idx] - idx_base];
 }
 
+template <typename T>
+__global__ void gthr_kernel(rocsparse_int        nnz,
+                            const T*             y,
+                            T*                   x_val,
+                            const rocsparse_int* x_ind,
+                            rocsparse_index_base idx_base)
+{
+    gthr_device(nnz, y, x_val, x_ind, idx_base);
+}
+
 #endif // GTHR_DEVICE_H
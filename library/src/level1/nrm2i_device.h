@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef NRM2I_DEVICE_H
+#define NRM2I_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, rocsparse_int NB>
+__global__ void nrm2i_kernel(
+    rocsparse_int nnz, const T* x_val, T* workspace, int* count, T* result)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockDim_x * hipBlockIdx_x + tid;
+
+    __shared__ T    sdata[NB];
+    __shared__ bool last;
+
+    sdata[tid] = static_cast<T>(0);
+
+    for(rocsparse_int idx = gid; idx < nnz; idx += hipGridDim_x * hipBlockDim_x)
+    {
+        sdata[tid] += x_val[idx] * x_val[idx];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+
+        // Make the partial sum visible to all blocks before signaling completion
+        __threadfence();
+
+        last = (atomicAdd(count, 1) == static_cast<int>(hipGridDim_x) - 1);
+    }
+
+    __syncthreads();
+
+    // The last block to finish reduces the partial sums of all blocks
+    if(!last)
+    {
+        return;
+    }
+
+    // Do not read partial sums of other blocks from a stale cache
+    __threadfence();
+
+    sdata[tid] = static_cast<T>(0);
+
+    for(rocsparse_int i = tid; i < hipGridDim_x; i += NB)
+    {
+        sdata[tid] += workspace[i];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        *result = sqrt(sdata[0]);
+
+        // Reset the counter for subsequent reductions
+        *count = 0;
+    }
+}
+
+// Each block computes the norm of a single sparse vector of the batch
+template <typename T, rocsparse_int NB>
+__global__ void nrm2i_strided_batched_kernel(rocsparse_int nnz,
+                                             const T*      x_val,
+                                             rocsparse_int stride_x,
+                                             rocsparse_int batch_offset,
+                                             T*            result)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    x_val += static_cast<size_t>(stride_x) * (batch_offset + hipBlockIdx_x);
+
+    __shared__ T sdata[NB];
+    sdata[tid] = static_cast<T>(0);
+
+    for(rocsparse_int idx = tid; idx < nnz; idx += NB)
+    {
+        sdata[tid] += x_val[idx] * x_val[idx];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        result[hipBlockIdx_x] = sqrt(sdata[0]);
+    }
+}
+
+#endif // NRM2I_DEVICE_H
@@ -0,0 +1,358 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_AXPYI_BATCHED_HPP
+#define ROCSPARSE_AXPYI_BATCHED_HPP
+
+#include "axpyi_device.h"
+#include "common.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// The batched kernels are templated on the vector types, such that strided
+// and pointer array batches share the same code path
+template <typename T, typename XV, typename XI, typename YV>
+__global__ void axpyi_batched_kernel_host_scalar(rocsparse_int        nnz,
+                                                 T                    alpha,
+                                                 XV                   x_val,
+                                                 rocsparse_int        stride_x,
+                                                 XI                   x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 YV                   y,
+                                                 rocsparse_int        stride_y,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base)
+{
+    for(rocsparse_int b = hipBlockIdx_y; b < batch_count; b += hipGridDim_y)
+    {
+        axpyi_device(nnz,
+                     alpha,
+                     rocsparse_batch_ptr(x_val, stride_x, b),
+                     rocsparse_batch_ptr(x_ind, stride_ind, b),
+                     rocsparse_batch_ptr(y, stride_y, b),
+                     idx_base);
+    }
+}
+
+template <typename T, typename XV, typename XI, typename YV>
+__global__ void axpyi_batched_kernel_device_scalar(rocsparse_int        nnz,
+                                                   const T*             alpha,
+                                                   XV                   x_val,
+                                                   rocsparse_int        stride_x,
+                                                   XI                   x_ind,
+                                                   rocsparse_int        stride_ind,
+                                                   YV                   y,
+                                                   rocsparse_int        stride_y,
+                                                   rocsparse_int        batch_count,
+                                                   rocsparse_index_base idx_base)
+{
+    if(*alpha == static_cast<T>(0))
+    {
+        return;
+    }
+
+    for(rocsparse_int b = hipBlockIdx_y; b < batch_count; b += hipGridDim_y)
+    {
+        axpyi_device(nnz,
+                     *alpha,
+                     rocsparse_batch_ptr(x_val, stride_x, b),
+                     rocsparse_batch_ptr(x_ind, stride_ind, b),
+                     rocsparse_batch_ptr(y, stride_y, b),
+                     idx_base);
+    }
+}
+
+template <typename T, typename XV, typename XI, typename YV>
+rocsparse_status rocsparse_axpyi_batched_dispatch(rocsparse_handle     handle,
+                                                  rocsparse_int        nnz,
+                                                  const T*             alpha,
+                                                  XV                   x_val,
+                                                  rocsparse_int        stride_x,
+                                                  XI                   x_ind,
+                                                  rocsparse_int        stride_ind,
+                                                  YV                   y,
+                                                  rocsparse_int        stride_y,
+                                                  rocsparse_int        batch_count,
+                                                  rocsparse_index_base idx_base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define AXPYI_DIM 256
+    // All vectors of the batch are processed by a single launch, where the
+    // second grid dimension runs over the batch
+    rocsparse_int max_batch = handle->properties.maxGridSize[1];
+
+    dim3 axpyi_blocks((nnz - 1) / AXPYI_DIM + 1, std::min(batch_count, max_batch));
+    dim3 axpyi_threads(AXPYI_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((axpyi_batched_kernel_device_scalar<T, XV, XI, YV>),
+                           axpyi_blocks,
+                           axpyi_threads,
+                           0,
+                           stream,
+                           nnz,
+                           alpha,
+                           x_val,
+                           stride_x,
+                           x_ind,
+                           stride_ind,
+                           y,
+                           stride_y,
+                           batch_count,
+                           idx_base);
+    }
+    else
+    {
+        if(*alpha == 0.0)
+        {
+            return rocsparse_status_success;
+        }
+
+        hipLaunchKernelGGL((axpyi_batched_kernel_host_scalar<T, XV, XI, YV>),
+                           axpyi_blocks,
+                           axpyi_threads,
+                           0,
+                           stream,
+                           nnz,
+                           *alpha,
+                           x_val,
+                           stride_x,
+                           x_ind,
+                           stride_ind,
+                           y,
+                           stride_y,
+                           batch_count,
+                           idx_base);
+    }
+#undef AXPYI_DIM
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_axpyi_strided_batched_template(rocsparse_handle     handle,
+                                                          rocsparse_int        nnz,
+                                                          const T*             alpha,
+                                                          const T*             x_val,
+                                                          rocsparse_int        stride_x,
+                                                          const rocsparse_int* x_ind,
+                                                          rocsparse_int        stride_ind,
+                                                          T*                   y,
+                                                          rocsparse_int        stride_y,
+                                                          rocsparse_int        batch_count,
+                                                          rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xaxpyi_strided_batched"),
+                  nnz,
+                  *alpha,
+                  (const void*&)x_val,
+                  stride_x,
+                  (const void*&)x_ind,
+                  stride_ind,
+                  (const void*&)y,
+                  stride_y,
+                  batch_count);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f axpyi_strided_batched -r",
+                  replaceX<T>("X"),
+                  "--mtx <vector.mtx> ",
+                  "--alpha",
+                  *alpha,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xaxpyi_strided_batched"),
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)x_val,
+                  stride_x,
+                  (const void*&)x_ind,
+                  stride_ind,
+                  (const void*&)y,
+                  stride_y,
+                  batch_count);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride_x < 0 || stride_ind < 0 || stride_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_axpyi_batched_dispatch(
+        handle, nnz, alpha, x_val, stride_x, x_ind, stride_ind, y, stride_y, batch_count, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_axpyi_batched_template(rocsparse_handle            handle,
+                                                  rocsparse_int               nnz,
+                                                  const T*                    alpha,
+                                                  const T* const*             x_val,
+                                                  const rocsparse_int* const* x_ind,
+                                                  T* const*                   y,
+                                                  rocsparse_int               batch_count,
+                                                  rocsparse_index_base        idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xaxpyi_batched"),
+                  nnz,
+                  *alpha,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  (const void*&)y,
+                  batch_count);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f axpyi_batched -r",
+                  replaceX<T>("X"),
+                  "--mtx <vector.mtx> ",
+                  "--alpha",
+                  *alpha,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xaxpyi_batched"),
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  (const void*&)y,
+                  batch_count);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_axpyi_batched_dispatch(
+        handle, nnz, alpha, x_val, 0, x_ind, 0, y, 0, batch_count, idx_base);
+}
+
+#endif // ROCSPARSE_AXPYI_BATCHED_HPP
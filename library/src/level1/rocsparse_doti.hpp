@@ -117,7 +117,11 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
     // Get workspace from handle device buffer
     T* workspace = reinterpret_cast<T*>(handle->buffer);
 
-    hipLaunchKernelGGL((doti_kernel_part1<T, DOTI_DIM>),
+    // In host pointer mode, the reduction result is stored in the workspace and
+    // copied to the host asynchronously
+    bool host_mode = handle->pointer_mode == rocsparse_pointer_mode_host;
+
+    hipLaunchKernelGGL((doti_kernel<T, DOTI_DIM>),
                        dim3(DOTI_DIM),
                        dim3(DOTI_DIM),
                        0,
@@ -127,31 +131,20 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
                        x_ind,
                        y,
                        workspace,
+                       handle->reduce_count,
+                       host_mode ? workspace : result,
                        idx_base);
 
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        hipLaunchKernelGGL((doti_kernel_part2<T, DOTI_DIM>),
-                           dim3(1),
-                           dim3(DOTI_DIM),
-                           0,
-                           stream,
-                           DOTI_DIM,
-                           workspace,
-                           result);
-    }
-    else
+    if(host_mode)
     {
-        hipLaunchKernelGGL((doti_kernel_part2<T, DOTI_DIM>),
-                           dim3(1),
-                           dim3(DOTI_DIM),
-                           0,
-                           stream,
-                           DOTI_DIM,
-                           workspace,
-                           nullptr);
-
-        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(result, workspace, sizeof(T), hipMemcpyDeviceToHost, stream));
+
+        // Wait for the host transfer, unless the result is returned asynchronously
+        if(handle->result_mode == rocsparse_result_mode_blocking)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
     }
 #undef DOTI_DIM
 
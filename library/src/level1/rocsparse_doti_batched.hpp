@@ -0,0 +1,320 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_DOTI_BATCHED_HPP
+#define ROCSPARSE_DOTI_BATCHED_HPP
+
+#include "common.h"
+#include "definitions.h"
+#include "doti_device.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// Each block computes the dot product of a single vector of the batch
+template <typename T, rocsparse_int NB, typename XV, typename XI, typename YV>
+__global__ void doti_batched_kernel(rocsparse_int        nnz,
+                                    XV                   x_val,
+                                    rocsparse_int        stride_x,
+                                    XI                   x_ind,
+                                    rocsparse_int        stride_ind,
+                                    YV                   y,
+                                    rocsparse_int        stride_y,
+                                    rocsparse_int        batch_offset,
+                                    T*                   result,
+                                    rocsparse_index_base idx_base)
+{
+    rocsparse_int b = batch_offset + hipBlockIdx_x;
+
+    T sum = doti_block_device<T, NB>(nnz,
+                                     rocsparse_batch_ptr(x_val, stride_x, b),
+                                     rocsparse_batch_ptr(x_ind, stride_ind, b),
+                                     rocsparse_batch_ptr(y, stride_y, b),
+                                     idx_base);
+
+    if(hipThreadIdx_x == 0)
+    {
+        result[hipBlockIdx_x] = sum;
+    }
+}
+
+template <typename T, typename XV, typename XI, typename YV>
+rocsparse_status rocsparse_doti_batched_dispatch(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 XV                   x_val,
+                                                 rocsparse_int        stride_x,
+                                                 XI                   x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 YV                   y,
+                                                 rocsparse_int        stride_y,
+                                                 T*                   result,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define DOTI_DIM 256
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((doti_batched_kernel<T, DOTI_DIM, XV, XI, YV>),
+                           dim3(batch_count),
+                           dim3(DOTI_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           stride_x,
+                           x_ind,
+                           stride_ind,
+                           y,
+                           stride_y,
+                           0,
+                           result,
+                           idx_base);
+    }
+    else
+    {
+        // Results are reduced into the handle workspace and copied to the host
+        // asynchronously, in chunks that fit into the workspace
+        T*            workspace = reinterpret_cast<T*>(handle->buffer);
+        rocsparse_int max_batch = handle->buffer_size / sizeof(T);
+
+        for(rocsparse_int offset = 0; offset < batch_count; offset += max_batch)
+        {
+            rocsparse_int nbatch = std::min(batch_count - offset, max_batch);
+
+            hipLaunchKernelGGL((doti_batched_kernel<T, DOTI_DIM, XV, XI, YV>),
+                               dim3(nbatch),
+                               dim3(DOTI_DIM),
+                               0,
+                               stream,
+                               nnz,
+                               x_val,
+                               stride_x,
+                               x_ind,
+                               stride_ind,
+                               y,
+                               stride_y,
+                               offset,
+                               workspace,
+                               idx_base);
+
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(result + offset,
+                                               workspace,
+                                               sizeof(T) * nbatch,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        }
+
+        // Wait for the host transfer, unless the results are returned asynchronously
+        if(handle->result_mode == rocsparse_result_mode_blocking)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+    }
+#undef DOTI_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_doti_strided_batched_template(rocsparse_handle     handle,
+                                                         rocsparse_int        nnz,
+                                                         const T*             x_val,
+                                                         rocsparse_int        stride_x,
+                                                         const rocsparse_int* x_ind,
+                                                         rocsparse_int        stride_ind,
+                                                         const T*             y,
+                                                         rocsparse_int        stride_y,
+                                                         T*                   result,
+                                                         rocsparse_int        batch_count,
+                                                         rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdoti_strided_batched"),
+              nnz,
+              (const void*&)x_val,
+              stride_x,
+              (const void*&)x_ind,
+              stride_ind,
+              (const void*&)y,
+              stride_y,
+              (const void*&)result,
+              batch_count,
+              idx_base);
+
+    log_bench(handle,
+              "./rocsparse-bench -f doti_strided_batched -r",
+              replaceX<T>("X"),
+              "--mtx <vector.mtx> ",
+              "--batch",
+              batch_count);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride_x < 0 || stride_ind < 0 || stride_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_doti_batched_dispatch(handle,
+                                           nnz,
+                                           x_val,
+                                           stride_x,
+                                           x_ind,
+                                           stride_ind,
+                                           y,
+                                           stride_y,
+                                           result,
+                                           batch_count,
+                                           idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_doti_batched_template(rocsparse_handle            handle,
+                                                 rocsparse_int               nnz,
+                                                 const T* const*             x_val,
+                                                 const rocsparse_int* const* x_ind,
+                                                 const T* const*             y,
+                                                 T*                          result,
+                                                 rocsparse_int               batch_count,
+                                                 rocsparse_index_base        idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdoti_batched"),
+              nnz,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              (const void*&)y,
+              (const void*&)result,
+              batch_count,
+              idx_base);
+
+    log_bench(handle,
+              "./rocsparse-bench -f doti_batched -r",
+              replaceX<T>("X"),
+              "--mtx <vector.mtx> ",
+              "--batch",
+              batch_count);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_doti_batched_dispatch(
+        handle, nnz, x_val, 0, x_ind, 0, y, 0, result, batch_count, idx_base);
+}
+
+#endif // ROCSPARSE_DOTI_BATCHED_HPP
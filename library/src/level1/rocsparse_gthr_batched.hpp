@@ -0,0 +1,253 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_GTHR_BATCHED_HPP
+#define ROCSPARSE_GTHR_BATCHED_HPP
+
+#include "common.h"
+#include "gthr_device.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+template <typename YV, typename XV, typename XI>
+__global__ void gthr_batched_kernel(rocsparse_int        nnz,
+                                    YV                   y,
+                                    rocsparse_int        stride_y,
+                                    XV                   x_val,
+                                    rocsparse_int        stride_x,
+                                    XI                   x_ind,
+                                    rocsparse_int        stride_ind,
+                                    rocsparse_int        batch_count,
+                                    rocsparse_index_base idx_base)
+{
+    for(rocsparse_int b = hipBlockIdx_y; b < batch_count; b += hipGridDim_y)
+    {
+        gthr_device(nnz,
+                    rocsparse_batch_ptr(y, stride_y, b),
+                    rocsparse_batch_ptr(x_val, stride_x, b),
+                    rocsparse_batch_ptr(x_ind, stride_ind, b),
+                    idx_base);
+    }
+}
+
+template <typename YV, typename XV, typename XI>
+rocsparse_status rocsparse_gthr_batched_dispatch(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 YV                   y,
+                                                 rocsparse_int        stride_y,
+                                                 XV                   x_val,
+                                                 rocsparse_int        stride_x,
+                                                 XI                   x_ind,
+                                                 rocsparse_int        stride_ind,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define GTHR_DIM 512
+    // All vectors of the batch are processed by a single launch, where the
+    // second grid dimension runs over the batch
+    rocsparse_int max_batch = handle->properties.maxGridSize[1];
+
+    dim3 gthr_blocks((nnz - 1) / GTHR_DIM + 1, std::min(batch_count, max_batch));
+    dim3 gthr_threads(GTHR_DIM);
+
+    hipLaunchKernelGGL((gthr_batched_kernel<YV, XV, XI>),
+                       gthr_blocks,
+                       gthr_threads,
+                       0,
+                       stream,
+                       nnz,
+                       y,
+                       stride_y,
+                       x_val,
+                       stride_x,
+                       x_ind,
+                       stride_ind,
+                       batch_count,
+                       idx_base);
+#undef GTHR_DIM
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_gthr_strided_batched_template(rocsparse_handle     handle,
+                                                         rocsparse_int        nnz,
+                                                         const T*             y,
+                                                         rocsparse_int        stride_y,
+                                                         T*                   x_val,
+                                                         rocsparse_int        stride_x,
+                                                         const rocsparse_int* x_ind,
+                                                         rocsparse_int        stride_ind,
+                                                         rocsparse_int        batch_count,
+                                                         rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgthr_strided_batched"),
+              nnz,
+              (const void*&)y,
+              stride_y,
+              (const void*&)x_val,
+              stride_x,
+              (const void*&)x_ind,
+              stride_ind,
+              batch_count,
+              idx_base);
+
+    log_bench(handle,
+              "./rocsparse-bench -f gthr_strided_batched -r",
+              replaceX<T>("X"),
+              "--mtx <vector.mtx> ",
+              "--batch",
+              batch_count);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride_y < 0 || stride_x < 0 || stride_ind < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_gthr_batched_dispatch(
+        handle, nnz, y, stride_y, x_val, stride_x, x_ind, stride_ind, batch_count, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_gthr_batched_template(rocsparse_handle            handle,
+                                                 rocsparse_int               nnz,
+                                                 const T* const*             y,
+                                                 T* const*                   x_val,
+                                                 const rocsparse_int* const* x_ind,
+                                                 rocsparse_int               batch_count,
+                                                 rocsparse_index_base        idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgthr_batched"),
+              nnz,
+              (const void*&)y,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              batch_count,
+              idx_base);
+
+    log_bench(handle,
+              "./rocsparse-bench -f gthr_batched -r",
+              replaceX<T>("X"),
+              "--mtx <vector.mtx> ",
+              "--batch",
+              batch_count);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_gthr_batched_dispatch(
+        handle, nnz, y, 0, x_val, 0, x_ind, 0, batch_count, idx_base);
+}
+
+#endif // ROCSPARSE_GTHR_BATCHED_HPP
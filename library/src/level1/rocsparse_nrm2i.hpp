@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_NRM2I_HPP
+#define ROCSPARSE_NRM2I_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "nrm2i_device.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status
+    rocsparse_nrm2i_template(rocsparse_handle handle, rocsparse_int nnz, const T* x_val, T* result)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle, replaceX<T>("rocsparse_Xnrm2i"), nnz, (const void*&)x_val, *result);
+
+        log_bench(handle, "./rocsparse-bench -f nrm2i -r", replaceX<T>("X"), "--mtx <vector.mtx> ");
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xnrm2i"),
+                  nnz,
+                  (const void*&)x_val,
+                  (const void*&)result);
+    }
+
+    // Check size
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define NRM2I_DIM 256
+    // Get workspace from handle device buffer
+    T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+    // In host pointer mode, the reduction result is stored in the workspace and
+    // copied to the host asynchronously
+    bool host_mode = handle->pointer_mode == rocsparse_pointer_mode_host;
+
+    hipLaunchKernelGGL((nrm2i_kernel<T, NRM2I_DIM>),
+                       dim3(NRM2I_DIM),
+                       dim3(NRM2I_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       x_val,
+                       workspace,
+                       handle->reduce_count,
+                       host_mode ? workspace : result);
+
+    if(host_mode)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(result, workspace, sizeof(T), hipMemcpyDeviceToHost, stream));
+
+        // Wait for the host transfer, unless the result is returned asynchronously
+        if(handle->result_mode == rocsparse_result_mode_blocking)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+    }
+#undef NRM2I_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_nrm2i_strided_batched_template(rocsparse_handle handle,
+                                                          rocsparse_int    nnz,
+                                                          const T*         x_val,
+                                                          rocsparse_int    stride_x,
+                                                          T*               result,
+                                                          rocsparse_int    batch_count)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xnrm2i_strided_batched"),
+              nnz,
+              (const void*&)x_val,
+              stride_x,
+              (const void*&)result,
+              batch_count);
+
+    log_bench(handle,
+              "./rocsparse-bench -f nrm2i_batched -r",
+              replaceX<T>("X"),
+              "--mtx <vector.mtx> ",
+              "--batch",
+              batch_count);
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride_x < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define NRM2I_DIM 256
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((nrm2i_strided_batched_kernel<T, NRM2I_DIM>),
+                           dim3(batch_count),
+                           dim3(NRM2I_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           stride_x,
+                           0,
+                           result);
+    }
+    else
+    {
+        // Results are reduced into the handle workspace and copied to the host
+        // asynchronously, in chunks that fit into the workspace
+        T*            workspace = reinterpret_cast<T*>(handle->buffer);
+        rocsparse_int max_batch = handle->buffer_size / sizeof(T);
+
+        for(rocsparse_int offset = 0; offset < batch_count; offset += max_batch)
+        {
+            rocsparse_int nbatch = std::min(batch_count - offset, max_batch);
+
+            hipLaunchKernelGGL((nrm2i_strided_batched_kernel<T, NRM2I_DIM>),
+                               dim3(nbatch),
+                               dim3(NRM2I_DIM),
+                               0,
+                               stream,
+                               nnz,
+                               x_val,
+                               stride_x,
+                               offset,
+                               workspace);
+
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(result + offset,
+                                               workspace,
+                                               sizeof(T) * nbatch,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        }
+
+        // Wait for the host transfer, unless the results are returned asynchronously
+        if(handle->result_mode == rocsparse_result_mode_blocking)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+    }
+#undef NRM2I_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_NRM2I_HPP
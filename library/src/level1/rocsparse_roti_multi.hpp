@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_ROTI_MULTI_HPP
+#define ROCSPARSE_ROTI_MULTI_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "roti_device.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+template <typename T, rocsparse_int NB>
+__global__ void roti_multi_kernel(rocsparse_int        nnz,
+                                  T*                   x_val,
+                                  const rocsparse_int* x_ind,
+                                  T*                   y,
+                                  rocsparse_int        nrot,
+                                  const T*             c,
+                                  const T*             s,
+                                  rocsparse_index_base idx_base)
+{
+    roti_multi_device<T, NB>(nnz, x_val, x_ind, y, nrot, c, s, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_roti_multi_template(rocsparse_handle     handle,
+                                               rocsparse_int        nnz,
+                                               T*                   x_val,
+                                               const rocsparse_int* x_ind,
+                                               T*                   y,
+                                               rocsparse_int        nrot,
+                                               const T*             c,
+                                               const T*             s,
+                                               rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xroti_multi"),
+              nnz,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              (const void*&)y,
+              nrot,
+              (const void*&)c,
+              (const void*&)s,
+              idx_base);
+
+    log_bench(handle,
+              "./rocsparse-bench -f roti_multi -r",
+              replaceX<T>("X"),
+              "--mtx <vector.mtx> ",
+              "-k",
+              nrot);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrot < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || nrot == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(c == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(s == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define ROTI_DIM 512
+    dim3 roti_blocks((nnz - 1) / ROTI_DIM + 1);
+    dim3 roti_threads(ROTI_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((roti_multi_kernel<T, ROTI_DIM>),
+                           roti_blocks,
+                           roti_threads,
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           y,
+                           nrot,
+                           c,
+                           s,
+                           idx_base);
+    }
+    else
+    {
+        // Rotations are staged through the handle workspace, in chunks that fit
+        // into the workspace. Each chunk costs one pass over x and y.
+        rocsparse_int max_rot = handle->buffer_size / (2 * sizeof(T));
+
+        T* dc = reinterpret_cast<T*>(handle->buffer);
+        T* ds = dc + max_rot;
+
+        for(rocsparse_int offset = 0; offset < nrot; offset += max_rot)
+        {
+            rocsparse_int nchunk = std::min(nrot - offset, max_rot);
+
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                dc, c + offset, sizeof(T) * nchunk, hipMemcpyHostToDevice, stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                ds, s + offset, sizeof(T) * nchunk, hipMemcpyHostToDevice, stream));
+
+            hipLaunchKernelGGL((roti_multi_kernel<T, ROTI_DIM>),
+                               roti_blocks,
+                               roti_threads,
+                               0,
+                               stream,
+                               nnz,
+                               x_val,
+                               x_ind,
+                               y,
+                               nchunk,
+                               dc,
+                               ds,
+                               idx_base);
+        }
+    }
+#undef ROTI_DIM
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_ROTI_MULTI_HPP
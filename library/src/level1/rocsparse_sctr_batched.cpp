@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "rocsparse_sctr_batched.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_ssctr_strided_batched(rocsparse_handle     handle,
+                                                            rocsparse_int        nnz,
+                                                            const float*         x_val,
+                                                            rocsparse_int        stride_x,
+                                                            const rocsparse_int* x_ind,
+                                                            rocsparse_int        stride_ind,
+                                                            float*               y,
+                                                            rocsparse_int        stride_y,
+                                                            rocsparse_int        batch_count,
+                                                            rocsparse_index_base idx_base)
+{
+    return rocsparse_sctr_strided_batched_template<float>(
+        handle, nnz, x_val, stride_x, x_ind, stride_ind, y, stride_y, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dsctr_strided_batched(rocsparse_handle     handle,
+                                                            rocsparse_int        nnz,
+                                                            const double*        x_val,
+                                                            rocsparse_int        stride_x,
+                                                            const rocsparse_int* x_ind,
+                                                            rocsparse_int        stride_ind,
+                                                            double*              y,
+                                                            rocsparse_int        stride_y,
+                                                            rocsparse_int        batch_count,
+                                                            rocsparse_index_base idx_base)
+{
+    return rocsparse_sctr_strided_batched_template<double>(
+        handle, nnz, x_val, stride_x, x_ind, stride_ind, y, stride_y, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_ssctr_batched(rocsparse_handle            handle,
+                                                    rocsparse_int               nnz,
+                                                    const float* const*         x_val,
+                                                    const rocsparse_int* const* x_ind,
+                                                    float* const*               y,
+                                                    rocsparse_int               batch_count,
+                                                    rocsparse_index_base        idx_base)
+{
+    return rocsparse_sctr_batched_template<float>(
+        handle, nnz, x_val, x_ind, y, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dsctr_batched(rocsparse_handle            handle,
+                                                    rocsparse_int               nnz,
+                                                    const double* const*        x_val,
+                                                    const rocsparse_int* const* x_ind,
+                                                    double* const*              y,
+                                                    rocsparse_int               batch_count,
+                                                    rocsparse_index_base        idx_base)
+{
+    return rocsparse_sctr_batched_template<double>(
+        handle, nnz, x_val, x_ind, y, batch_count, idx_base);
+}
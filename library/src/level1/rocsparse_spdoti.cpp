@@ -0,0 +1,114 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_spdoti.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_sspdoti(rocsparse_handle     handle,
+                                              rocsparse_int        nnz_x,
+                                              const float*         x_val,
+                                              const rocsparse_int* x_ind,
+                                              rocsparse_int        nnz_y,
+                                              const float*         y_val,
+                                              const rocsparse_int* y_ind,
+                                              float*               result,
+                                              rocsparse_index_base idx_base)
+{
+    return rocsparse_spdoti_template<float>(
+        handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, result, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dspdoti(rocsparse_handle     handle,
+                                              rocsparse_int        nnz_x,
+                                              const double*        x_val,
+                                              const rocsparse_int* x_ind,
+                                              rocsparse_int        nnz_y,
+                                              const double*        y_val,
+                                              const rocsparse_int* y_ind,
+                                              double*              result,
+                                              rocsparse_index_base idx_base)
+{
+    return rocsparse_spdoti_template<double>(
+        handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, result, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_sspdoti_strided_batched(rocsparse_handle     handle,
+                                                              rocsparse_int        nnz_x,
+                                                              const float*         x_val,
+                                                              const rocsparse_int* x_ind,
+                                                              rocsparse_int        stride_x,
+                                                              rocsparse_int        nnz_y,
+                                                              const float*         y_val,
+                                                              const rocsparse_int* y_ind,
+                                                              rocsparse_int        stride_y,
+                                                              float*               result,
+                                                              rocsparse_int        batch_count,
+                                                              rocsparse_index_base idx_base)
+{
+    return rocsparse_spdoti_strided_batched_template<float>(handle,
+                                                            nnz_x,
+                                                            x_val,
+                                                            x_ind,
+                                                            stride_x,
+                                                            nnz_y,
+                                                            y_val,
+                                                            y_ind,
+                                                            stride_y,
+                                                            result,
+                                                            batch_count,
+                                                            idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dspdoti_strided_batched(rocsparse_handle     handle,
+                                                              rocsparse_int        nnz_x,
+                                                              const double*        x_val,
+                                                              const rocsparse_int* x_ind,
+                                                              rocsparse_int        stride_x,
+                                                              rocsparse_int        nnz_y,
+                                                              const double*        y_val,
+                                                              const rocsparse_int* y_ind,
+                                                              rocsparse_int        stride_y,
+                                                              double*              result,
+                                                              rocsparse_int        batch_count,
+                                                              rocsparse_index_base idx_base)
+{
+    return rocsparse_spdoti_strided_batched_template<double>(handle,
+                                                             nnz_x,
+                                                             x_val,
+                                                             x_ind,
+                                                             stride_x,
+                                                             nnz_y,
+                                                             y_val,
+                                                             y_ind,
+                                                             stride_y,
+                                                             result,
+                                                             batch_count,
+                                                             idx_base);
+}
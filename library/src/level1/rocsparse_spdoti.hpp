@@ -0,0 +1,332 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SPDOTI_HPP
+#define ROCSPARSE_SPDOTI_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "spdoti_device.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_spdoti_template(rocsparse_handle     handle,
+                                           rocsparse_int        nnz_x,
+                                           const T*             x_val,
+                                           const rocsparse_int* x_ind,
+                                           rocsparse_int        nnz_y,
+                                           const T*             y_val,
+                                           const rocsparse_int* y_ind,
+                                           T*                   result,
+                                           rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xspdoti"),
+                  nnz_x,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  nnz_y,
+                  (const void*&)y_val,
+                  (const void*&)y_ind,
+                  *result,
+                  idx_base);
+
+        log_bench(
+            handle, "./rocsparse-bench -f spdoti -r", replaceX<T>("X"), "--mtx <vector.mtx> ");
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xspdoti"),
+                  nnz_x,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  nnz_y,
+                  (const void*&)y_val,
+                  (const void*&)y_ind,
+                  (const void*&)result,
+                  idx_base);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz_x < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz_x == 0 || nnz_y == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define SPDOTI_DIM 256
+    // Get workspace from handle device buffer
+    T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+    // Only launch as many blocks as there are merge path segments
+    rocsparse_int nseg = (nnz_x + nnz_y - 1) / SPDOTI_ITEMS + 1;
+    rocsparse_int nblk = std::min((nseg - 1) / SPDOTI_DIM + 1, SPDOTI_DIM);
+
+    // In host pointer mode, the reduction result is stored in the workspace and
+    // copied to the host asynchronously
+    bool host_mode = handle->pointer_mode == rocsparse_pointer_mode_host;
+
+    hipLaunchKernelGGL((spdoti_kernel<T, SPDOTI_DIM>),
+                       dim3(nblk),
+                       dim3(SPDOTI_DIM),
+                       0,
+                       stream,
+                       nnz_x,
+                       x_val,
+                       x_ind,
+                       nnz_y,
+                       y_val,
+                       y_ind,
+                       workspace,
+                       handle->reduce_count,
+                       host_mode ? workspace : result);
+
+    if(host_mode)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(result, workspace, sizeof(T), hipMemcpyDeviceToHost, stream));
+
+        // Wait for the host transfer, unless the result is returned asynchronously
+        if(handle->result_mode == rocsparse_result_mode_blocking)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+    }
+#undef SPDOTI_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_spdoti_strided_batched_template(rocsparse_handle     handle,
+                                                           rocsparse_int        nnz_x,
+                                                           const T*             x_val,
+                                                           const rocsparse_int* x_ind,
+                                                           rocsparse_int        stride_x,
+                                                           rocsparse_int        nnz_y,
+                                                           const T*             y_val,
+                                                           const rocsparse_int* y_ind,
+                                                           rocsparse_int        stride_y,
+                                                           T*                   result,
+                                                           rocsparse_int        batch_count,
+                                                           rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xspdoti_strided_batched"),
+              nnz_x,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              stride_x,
+              nnz_y,
+              (const void*&)y_val,
+              (const void*&)y_ind,
+              stride_y,
+              (const void*&)result,
+              batch_count,
+              idx_base);
+
+    log_bench(handle,
+              "./rocsparse-bench -f spdoti_batched -r",
+              replaceX<T>("X"),
+              "--mtx <vector.mtx> ",
+              "--batch",
+              batch_count);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz_x < 0 || nnz_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride_x < 0 || stride_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz_x == 0 || nnz_y == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define SPDOTI_DIM 256
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((spdoti_strided_batched_kernel<T, SPDOTI_DIM>),
+                           dim3(batch_count),
+                           dim3(SPDOTI_DIM),
+                           0,
+                           stream,
+                           nnz_x,
+                           x_val,
+                           x_ind,
+                           stride_x,
+                           nnz_y,
+                           y_val,
+                           y_ind,
+                           stride_y,
+                           0,
+                           result);
+    }
+    else
+    {
+        // Results are reduced into the handle workspace and copied to the host
+        // asynchronously, in chunks that fit into the workspace
+        T*            workspace = reinterpret_cast<T*>(handle->buffer);
+        rocsparse_int max_batch = handle->buffer_size / sizeof(T);
+
+        for(rocsparse_int offset = 0; offset < batch_count; offset += max_batch)
+        {
+            rocsparse_int nbatch = std::min(batch_count - offset, max_batch);
+
+            hipLaunchKernelGGL((spdoti_strided_batched_kernel<T, SPDOTI_DIM>),
+                               dim3(nbatch),
+                               dim3(SPDOTI_DIM),
+                               0,
+                               stream,
+                               nnz_x,
+                               x_val,
+                               x_ind,
+                               stride_x,
+                               nnz_y,
+                               y_val,
+                               y_ind,
+                               stride_y,
+                               offset,
+                               workspace);
+
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(result + offset,
+                                               workspace,
+                                               sizeof(T) * nbatch,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        }
+
+        // Wait for the host transfer, unless the results are returned asynchronously
+        if(handle->result_mode == rocsparse_result_mode_blocking)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+    }
+#undef SPDOTI_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_SPDOTI_HPP
@@ -52,4 +52,64 @@ __device__ void roti_device(rocsparse_int        nnz,
     y[i]       = c * yr - s * xr;
 }
 
+// Applies a sequence of nrot Givens rotations to the sparse vector x and the dense
+// vector y. The entries are held in registers across all rotations, the (c, s) pairs
+// are staged through LDS in chunks of NB.
+template <typename T, rocsparse_int NB>
+__device__ void roti_multi_device(rocsparse_int        nnz,
+                                  T*                   x_val,
+                                  const rocsparse_int* x_ind,
+                                  T*                   y,
+                                  rocsparse_int        nrot,
+                                  const T*             c,
+                                  const T*             s,
+                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int idx = hipBlockIdx_x * NB + tid;
+
+    __shared__ T sc[NB];
+    __shared__ T ss[NB];
+
+    rocsparse_int i  = 0;
+    T             xr = static_cast<T>(0);
+    T             yr = static_cast<T>(0);
+
+    // Out of range threads still take part in loading the rotations
+    if(idx < nnz)
+    {
+        i  = x_ind[idx] - idx_base;
+        xr = x_val[idx];
+        yr = y[i];
+    }
+
+    for(rocsparse_int k = 0; k < nrot; k += NB)
+    {
+        __syncthreads();
+
+        if(k + tid < nrot)
+        {
+            sc[tid] = c[k + tid];
+            ss[tid] = s[k + tid];
+        }
+
+        __syncthreads();
+
+        rocsparse_int n = min(NB, nrot - k);
+
+        for(rocsparse_int r = 0; r < n; ++r)
+        {
+            T xt = sc[r] * xr + ss[r] * yr;
+            yr   = sc[r] * yr - ss[r] * xr;
+            xr   = xt;
+        }
+    }
+
+    if(idx < nnz)
+    {
+        x_val[idx] = xr;
+        y[i]       = yr;
+    }
+}
+
 #endif // ROTI_DEVICE_H
@@ -28,7 +28,7 @@
 #include <hip/hip_runtime.h>
 
 template <typename T>
-__global__ void sctr_kernel(rocsparse_int        nnz,
+__device__ void sctr_device(rocsparse_int        nnz,
                             const T*             x_val,
                             const rocsparse_int* x_ind,
                             T*                   y,
@@ -44,4 +44,14 @@ __global__ void sctr_kernel(rocsparse_int        nnz,
     y[x_ind[idx] - idx_base] = x_val[idx];
 }
 
+template <typename T>
+__global__ void sctr_kernel(rocsparse_int        nnz,
+                            const T*             x_val,
+                            const rocsparse_int* x_ind,
+                            T*                   y,
+                            rocsparse_index_base idx_base)
+{
+    sctr_device(nnz, x_val, x_ind, y, idx_base);
+}
+
 #endif // SCTR_DEVICE_H
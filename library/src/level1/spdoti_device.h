@@ -0,0 +1,217 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SPDOTI_DEVICE_H
+#define SPDOTI_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Number of merge path diagonals processed by each thread
+#define SPDOTI_ITEMS 8
+
+// Returns the number of entries of x that precede the given diagonal of the merge
+// path of the sorted index arrays x_ind and y_ind. On equal indices, x comes first.
+__device__ __forceinline__ rocsparse_int spdoti_merge_path_search(rocsparse_int        diag,
+                                                                  rocsparse_int        nnz_x,
+                                                                  const rocsparse_int* x_ind,
+                                                                  rocsparse_int        nnz_y,
+                                                                  const rocsparse_int* y_ind)
+{
+    rocsparse_int lo = max(0, diag - nnz_y);
+    rocsparse_int hi = min(diag, nnz_x);
+
+    while(lo < hi)
+    {
+        rocsparse_int mid = (lo + hi) >> 1;
+
+        if(x_ind[mid] <= y_ind[diag - mid - 1])
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+// Partial dot product of the merge path segment [diag_begin, diag_end). Since x entries
+// are consumed first on equal indices, a matching y entry is always the current one when
+// an x entry is consumed, even if it lies in the segment of another thread.
+template <typename T>
+__device__ T spdoti_merge_device(rocsparse_int        diag_begin,
+                                 rocsparse_int        diag_end,
+                                 rocsparse_int        nnz_x,
+                                 const T*             x_val,
+                                 const rocsparse_int* x_ind,
+                                 rocsparse_int        nnz_y,
+                                 const T*             y_val,
+                                 const rocsparse_int* y_ind)
+{
+    rocsparse_int i = spdoti_merge_path_search(diag_begin, nnz_x, x_ind, nnz_y, y_ind);
+    rocsparse_int j = diag_begin - i;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int diag = diag_begin; diag < diag_end && i < nnz_x; ++diag)
+    {
+        if(j == nnz_y || x_ind[i] <= y_ind[j])
+        {
+            if(j < nnz_y && x_ind[i] == y_ind[j])
+            {
+                sum += x_val[i] * y_val[j];
+            }
+
+            ++i;
+        }
+        else
+        {
+            ++j;
+        }
+    }
+
+    return sum;
+}
+
+template <typename T, rocsparse_int NB>
+__global__ void spdoti_kernel(rocsparse_int        nnz_x,
+                              const T*             x_val,
+                              const rocsparse_int* x_ind,
+                              rocsparse_int        nnz_y,
+                              const T*             y_val,
+                              const rocsparse_int* y_ind,
+                              T*                   workspace,
+                              int*                 count,
+                              T*                   result)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockDim_x * hipBlockIdx_x + tid;
+
+    __shared__ T    sdata[NB];
+    __shared__ bool last;
+
+    sdata[tid] = static_cast<T>(0);
+
+    // Each thread processes segments of SPDOTI_ITEMS diagonals of the merge path
+    rocsparse_int ndiag = nnz_x + nnz_y;
+
+    for(rocsparse_int diag = gid * SPDOTI_ITEMS; diag < ndiag;
+        diag += hipGridDim_x * hipBlockDim_x * SPDOTI_ITEMS)
+    {
+        sdata[tid] += spdoti_merge_device(
+            diag, min(diag + SPDOTI_ITEMS, ndiag), nnz_x, x_val, x_ind, nnz_y, y_val, y_ind);
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+
+        // Make the partial sum visible to all blocks before signaling completion
+        __threadfence();
+
+        last = (atomicAdd(count, 1) == static_cast<int>(hipGridDim_x) - 1);
+    }
+
+    __syncthreads();
+
+    // The last block to finish reduces the partial sums of all blocks
+    if(!last)
+    {
+        return;
+    }
+
+    // Do not read partial sums of other blocks from a stale cache
+    __threadfence();
+
+    sdata[tid] = static_cast<T>(0);
+
+    for(rocsparse_int i = tid; i < hipGridDim_x; i += NB)
+    {
+        sdata[tid] += workspace[i];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        *result = sdata[0];
+
+        // Reset the counter for subsequent reductions
+        *count = 0;
+    }
+}
+
+// Each block computes the dot product of a single pair of sparse vectors of the batch
+template <typename T, rocsparse_int NB>
+__global__ void spdoti_strided_batched_kernel(rocsparse_int        nnz_x,
+                                              const T*             x_val,
+                                              const rocsparse_int* x_ind,
+                                              rocsparse_int        stride_x,
+                                              rocsparse_int        nnz_y,
+                                              const T*             y_val,
+                                              const rocsparse_int* y_ind,
+                                              rocsparse_int        stride_y,
+                                              rocsparse_int        batch_offset,
+                                              T*                   result)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int b   = batch_offset + hipBlockIdx_x;
+
+    x_val += static_cast<size_t>(stride_x) * b;
+    x_ind += static_cast<size_t>(stride_x) * b;
+    y_val += static_cast<size_t>(stride_y) * b;
+    y_ind += static_cast<size_t>(stride_y) * b;
+
+    __shared__ T sdata[NB];
+    sdata[tid] = static_cast<T>(0);
+
+    rocsparse_int ndiag = nnz_x + nnz_y;
+
+    for(rocsparse_int diag = tid * SPDOTI_ITEMS; diag < ndiag; diag += NB * SPDOTI_ITEMS)
+    {
+        sdata[tid] += spdoti_merge_device(
+            diag, min(diag + SPDOTI_ITEMS, ndiag), nnz_x, x_val, x_ind, nnz_y, y_val, y_ind);
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        result[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+#endif // SPDOTI_DEVICE_H
@@ -0,0 +1,321 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef CSR5MV_DEVICE_H
+#define CSR5MV_DEVICE_H
+
+#include "../conversion/csr2csr5_device.h"
+#include "common.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Returns the row of the entry that precedes lane of tile. Within tiles without
+// empty rows, this is given by the number of row starts that precede the lane.
+template <unsigned int SIGMA>
+__device__ __forceinline__ rocsparse_int csr5_lane_row(rocsparse_int        tile,
+                                                       rocsparse_int        lane,
+                                                       const rocsparse_int* row_ptr,
+                                                       const rocsparse_int* tile_ptr,
+                                                       const rocsparse_int* tile_offset,
+                                                       bool&                empty,
+                                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int first = tile_ptr[tile];
+
+    empty = (first & CSR5_EMPTY_TILE) != 0;
+    first &= ~CSR5_EMPTY_TILE;
+
+    if(!empty)
+    {
+        return first + tile_offset[tile * CSR5_OMEGA + lane];
+    }
+    else if(lane == 0)
+    {
+        return first;
+    }
+
+    return csr5_row_search((tile * CSR5_OMEGA + lane) * SIGMA - 1,
+                           first,
+                           tile_ptr[tile + 1] & ~CSR5_EMPTY_TILE,
+                           row_ptr,
+                           idx_base);
+}
+
+// Returns the row that starts at entry idx, where row is the row of the entry
+// that precedes idx. Empty rows are skipped.
+__device__ __forceinline__ rocsparse_int csr5_next_row(rocsparse_int        row,
+                                                       rocsparse_int        idx,
+                                                       const rocsparse_int* row_ptr,
+                                                       bool                 empty,
+                                                       rocsparse_index_base idx_base)
+{
+    if(!empty)
+    {
+        return row + 1;
+    }
+
+    while(row_ptr[row + 1] - idx_base <= idx)
+    {
+        ++row;
+    }
+
+    return row;
+}
+
+// CSR5 SpMV for general, non-transposed matrices, where y has already been scaled
+// by beta. Each lane sums its SIGMA entries, split at the flagged row starts. Rows
+// that start and end within a lane are written directly. The sum of the row that
+// is still open at the end of a lane is passed on to the lane that completes the
+// row, using a segmented scan within the block. Rows that span multiple blocks
+// are accumulated atomically.
+template <typename T, unsigned int BLOCKSIZE, unsigned int SIGMA>
+static __device__ void csr5mvn_device(rocsparse_int        num_tiles,
+                                      T                    alpha,
+                                      const rocsparse_int* row_ptr,
+                                      const rocsparse_int* tile_ptr,
+                                      const unsigned int*  tile_flag,
+                                      const rocsparse_int* tile_offset,
+                                      const rocsparse_int* col_ind,
+                                      const T*             val,
+                                      const T*             x,
+                                      T*                   y,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int tid  = hipThreadIdx_x;
+    rocsparse_int gid  = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int tile = gid / CSR5_OMEGA;
+    rocsparse_int lane = gid % CSR5_OMEGA;
+
+    __shared__ rocsparse_int srow[BLOCKSIZE];
+    __shared__ T             sval[BLOCKSIZE];
+
+    rocsparse_int row      = -1;
+    rocsparse_int head_row = -1;
+    T             head_sum = static_cast<T>(0);
+    T             sum      = static_cast<T>(0);
+
+    if(tile < num_tiles)
+    {
+        bool          empty;
+        rocsparse_int idx  = (tile * CSR5_OMEGA + lane) * SIGMA;
+        unsigned int  flag = tile_flag[gid];
+
+        row = csr5_lane_row<SIGMA>(tile, lane, row_ptr, tile_ptr, tile_offset, empty, idx_base);
+
+        bool head = true;
+
+        for(unsigned int s = 0; s < SIGMA; ++s)
+        {
+            if(flag & (1u << s))
+            {
+                if(head)
+                {
+                    // Completed once the sums of the preceding lanes are known
+                    head_row = row;
+                    head_sum = sum;
+                    head     = false;
+                }
+                else
+                {
+                    y[row] = rocsparse_fma(alpha, sum, y[row]);
+                }
+
+                sum = static_cast<T>(0);
+                row = csr5_next_row(row, idx + s, row_ptr, empty, idx_base);
+            }
+
+            rocsparse_int ind = CSR5_IND(tile, lane, s, SIGMA);
+
+            sum = rocsparse_fma(val[ind], rocsparse_ldg(x + col_ind[ind] - idx_base), sum);
+        }
+    }
+
+    srow[tid] = row;
+    sval[tid] = sum;
+
+    __syncthreads();
+
+    // Segmented inclusive scan of the open rows, lanes of the same row are adjacent
+    for(unsigned int j = 1; j < BLOCKSIZE; j <<= 1)
+    {
+        T carry = (tid >= j && srow[tid - j] == srow[tid]) ? sval[tid - j] : static_cast<T>(0);
+
+        __syncthreads();
+
+        sval[tid] += carry;
+
+        __syncthreads();
+    }
+
+    // Complete the first row of the lane, it may have been started by a preceding block
+    if(head_row != -1)
+    {
+        if(tid > 0 && srow[tid - 1] == head_row)
+        {
+            head_sum += sval[tid - 1];
+        }
+
+        if(head_sum != static_cast<T>(0))
+        {
+            atomicAdd(y + head_row, alpha * head_sum);
+        }
+    }
+
+    // The row that is still open at the end of the block is completed by a
+    // succeeding block or the entries that follow the last tile
+    if(row != -1 && (tid == BLOCKSIZE - 1 || gid == num_tiles * CSR5_OMEGA - 1))
+    {
+        if(sval[tid] != static_cast<T>(0))
+        {
+            atomicAdd(y + row, alpha * sval[tid]);
+        }
+    }
+}
+
+// CSR5 SpMV for general, transposed matrices, where y has already been scaled by
+// beta. Each lane scatters its SIGMA entries into y.
+template <typename T, unsigned int SIGMA>
+static __device__ void csr5mvt_device(rocsparse_int        num_tiles,
+                                      T                    alpha,
+                                      const rocsparse_int* row_ptr,
+                                      const rocsparse_int* tile_ptr,
+                                      const unsigned int*  tile_flag,
+                                      const rocsparse_int* tile_offset,
+                                      const rocsparse_int* col_ind,
+                                      const T*             val,
+                                      const T*             x,
+                                      T*                   y,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int gid  = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int tile = gid / CSR5_OMEGA;
+    rocsparse_int lane = gid % CSR5_OMEGA;
+
+    if(tile >= num_tiles)
+    {
+        return;
+    }
+
+    bool          empty;
+    rocsparse_int idx  = (tile * CSR5_OMEGA + lane) * SIGMA;
+    unsigned int  flag = tile_flag[gid];
+    rocsparse_int row
+        = csr5_lane_row<SIGMA>(tile, lane, row_ptr, tile_ptr, tile_offset, empty, idx_base);
+
+    T xr = alpha * x[row];
+
+    for(unsigned int s = 0; s < SIGMA; ++s)
+    {
+        if(flag & (1u << s))
+        {
+            row = csr5_next_row(row, idx + s, row_ptr, empty, idx_base);
+            xr  = alpha * x[row];
+        }
+
+        if(xr != static_cast<T>(0))
+        {
+            rocsparse_int ind = CSR5_IND(tile, lane, s, SIGMA);
+
+            atomicAdd(y + col_ind[ind] - idx_base, val[ind] * xr);
+        }
+    }
+}
+
+// Entries that follow the last tile are kept in CSR order and processed with one
+// thread per row. The first row may have been started within the last tile.
+template <typename T>
+static __device__ void csr5mvn_tail_device(rocsparse_int        m,
+                                           rocsparse_int        tail_row,
+                                           rocsparse_int        tail_begin,
+                                           T                    alpha,
+                                           const rocsparse_int* row_ptr,
+                                           const rocsparse_int* col_ind,
+                                           const T*             val,
+                                           const T*             x,
+                                           T*                   y,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int row = tail_row + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = row_ptr[row] - idx_base;
+    rocsparse_int row_end   = row_ptr[row + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int j = max(row_begin, tail_begin); j < row_end; ++j)
+    {
+        sum = rocsparse_fma(val[j], rocsparse_ldg(x + col_ind[j] - idx_base), sum);
+    }
+
+    if(row_begin >= tail_begin)
+    {
+        y[row] = rocsparse_fma(alpha, sum, y[row]);
+    }
+    else if(sum != static_cast<T>(0))
+    {
+        atomicAdd(y + row, alpha * sum);
+    }
+}
+
+template <typename T>
+static __device__ void csr5mvt_tail_device(rocsparse_int        m,
+                                           rocsparse_int        tail_row,
+                                           rocsparse_int        tail_begin,
+                                           T                    alpha,
+                                           const rocsparse_int* row_ptr,
+                                           const rocsparse_int* col_ind,
+                                           const T*             val,
+                                           const T*             x,
+                                           T*                   y,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int row = tail_row + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    T xr = alpha * x[row];
+
+    if(xr == static_cast<T>(0))
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = max(row_ptr[row] - idx_base, tail_begin);
+    rocsparse_int row_end   = row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        atomicAdd(y + col_ind[j] - idx_base, val[j] * xr);
+    }
+}
+
+#endif // CSR5MV_DEVICE_H
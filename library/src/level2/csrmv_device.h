@@ -79,6 +79,433 @@ static __device__ void csrmvn_general_device(rocsparse_int        m,
     }
 }
 
+// Merge path search, returns the number of rows that have been completed at merge
+// path diagonal diag. The merged sequences are the row end offsets and the indices
+// of the non-zero entries. The remaining diag - row items are non-zero entries.
+__device__ __forceinline__ rocsparse_int csrmv_merge_path_search(rocsparse_int        diag,
+                                                                 rocsparse_int        m,
+                                                                 rocsparse_int        nnz,
+                                                                 const rocsparse_int* csr_row_ptr,
+                                                                 rocsparse_index_base idx_base)
+{
+    rocsparse_int lo = max(0, diag - nnz);
+    rocsparse_int hi = min(diag, m);
+
+    while(lo < hi)
+    {
+        rocsparse_int mid = (lo + hi) >> 1;
+
+        if(csr_row_ptr[mid + 1] - idx_base <= diag - mid - 1)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+// Merge path csrmv. Each thread consumes ITEMS consecutive items of the merge of the
+// row end offsets and the non-zero entries, such that the work is evenly distributed
+// over m + nnz, independent of the row lengths. Rows that end within the range of a
+// thread are written by this thread. The partial sum of the row that is still open at
+// the end of a range is carried to the thread that completes the row, using a
+// segmented scan within the block. The carry of the last thread of each block is
+// added by csrmvn_merge_fixup_device.
+template <typename T, unsigned int BLOCKSIZE, unsigned int ITEMS>
+static __device__ void csrmvn_merge_device(rocsparse_int        m,
+                                           rocsparse_int        nnz,
+                                           T                    alpha,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           const T*             csr_val,
+                                           const T*             x,
+                                           T                    beta,
+                                           T*                   y,
+                                           rocsparse_int*       carry_row,
+                                           T*                   carry_val,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ rocsparse_int srow[BLOCKSIZE];
+    __shared__ T             sval[BLOCKSIZE];
+
+    // Merge path range of this thread
+    rocsparse_int num_items  = m + nnz;
+    rocsparse_int diag_begin = min(gid * static_cast<rocsparse_int>(ITEMS), num_items);
+    rocsparse_int diag_end   = min(diag_begin + static_cast<rocsparse_int>(ITEMS), num_items);
+
+    rocsparse_int row      = csrmv_merge_path_search(diag_begin, m, nnz, csr_row_ptr, idx_base);
+    rocsparse_int row_last = csrmv_merge_path_search(diag_end, m, nnz, csr_row_ptr, idx_base);
+    rocsparse_int idx      = diag_begin - row;
+    rocsparse_int idx_last = diag_end - row_last;
+
+    // The first row has already been started by a preceding thread
+    bool head = (row < m && idx > csr_row_ptr[row] - idx_base);
+
+    rocsparse_int head_row = -1;
+    T             head_sum = static_cast<T>(0);
+    T             sum      = static_cast<T>(0);
+
+    // Rows that end within the range of this thread
+    for(; row < row_last; ++row)
+    {
+        rocsparse_int row_end = csr_row_ptr[row + 1] - idx_base;
+
+        for(; idx < row_end; ++idx)
+        {
+            sum = rocsparse_fma(csr_val[idx], rocsparse_ldg(x + csr_col_ind[idx] - idx_base), sum);
+        }
+
+        if(head)
+        {
+            // Completed once the carries of the preceding threads are known
+            head_row = row;
+            head_sum = sum;
+            head     = false;
+        }
+        else if(beta == static_cast<T>(0))
+        {
+            y[row] = alpha * sum;
+        }
+        else
+        {
+            y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+        }
+
+        sum = static_cast<T>(0);
+    }
+
+    // Leading entries of the row that is still open
+    for(; idx < idx_last; ++idx)
+    {
+        sum = rocsparse_fma(csr_val[idx], rocsparse_ldg(x + csr_col_ind[idx] - idx_base), sum);
+    }
+
+    srow[tid] = row_last;
+    sval[tid] = sum;
+
+    __syncthreads();
+
+    // Segmented inclusive scan of the carries, carries of the same row are adjacent
+    for(unsigned int j = 1; j < BLOCKSIZE; j <<= 1)
+    {
+        T val = (tid >= j && srow[tid - j] == srow[tid]) ? sval[tid - j] : static_cast<T>(0);
+
+        __syncthreads();
+
+        sval[tid] += val;
+
+        __syncthreads();
+    }
+
+    // Complete the first row with the carries of the preceding threads of the block
+    if(head_row != -1)
+    {
+        if(tid > 0 && srow[tid - 1] == head_row)
+        {
+            head_sum += sval[tid - 1];
+        }
+
+        if(beta == static_cast<T>(0))
+        {
+            y[head_row] = alpha * head_sum;
+        }
+        else
+        {
+            y[head_row] = rocsparse_fma(beta, y[head_row], alpha * head_sum);
+        }
+    }
+
+    // The row that is still open at the end of the block is completed by a
+    // succeeding block
+    if(tid == BLOCKSIZE - 1)
+    {
+        carry_row[hipBlockIdx_x] = srow[tid];
+        carry_val[hipBlockIdx_x] = alpha * sval[tid];
+    }
+}
+
+// Adds the carries of all blocks to y, after csrmvn_merge_device has completed all rows
+template <typename T>
+__device__ void csrmvn_merge_fixup_device(rocsparse_int        nblocks,
+                                          rocsparse_int        m,
+                                          const rocsparse_int* carry_row,
+                                          const T*             carry_val,
+                                          T*                   y)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nblocks)
+    {
+        return;
+    }
+
+    rocsparse_int row = carry_row[gid];
+    T             val = carry_val[gid];
+
+    if(row < m && val != static_cast<T>(0))
+    {
+        atomicAdd(y + row, val);
+    }
+}
+
+// Scales y by beta, before a product is accumulated into it atomically
+template <typename T>
+__device__ void csrmv_scale_device(rocsparse_int m, T beta, T* __restrict__ y)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    y[gid] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[gid];
+}
+
+// Symmetric product from a single stored triangle. Each wavefront processes one row.
+// The stored entries of the row contribute to y[row] and, mirrored, to y[col]. Entries
+// of the other triangle are ignored. The columns of a row are distinct, such that the
+// atomic updates of the lanes of a wavefront never collide with each other.
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_symm_device(rocsparse_int        m,
+                                          T                    alpha,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const T*             csr_val,
+                                          const T*             x,
+                                          T*                   y,
+                                          rocsparse_fill_mode  fill_mode,
+                                          rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Scaled x entry of the mirrored contributions
+        T xr = alpha * rocsparse_ldg(x + row);
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(fill_mode == rocsparse_fill_mode_lower ? col > row : col < row)
+            {
+                continue;
+            }
+
+            T val = csr_val[j];
+
+            sum = rocsparse_fma(val, rocsparse_ldg(x + col), sum);
+
+            if(col != row)
+            {
+                atomicAdd(y + col, val * xr);
+            }
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Other rows may concurrently contribute to y[row]
+        if(lid == WF_SIZE - 1)
+        {
+            atomicAdd(y + row, alpha * sum);
+        }
+    }
+}
+
+// Symmetric product from a single stored triangle, using the transposed triangle of
+// the analysis. Each wavefront processes one row and gathers the stored entries of
+// the row, as well as the mirrored entries of the column with the same index. Thus,
+// each entry of y is written exactly once and no atomics are required.
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_symm_gather_device(rocsparse_int        m,
+                                                 T                    alpha,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 const T*             csr_val,
+                                                 const rocsparse_int* symm_col_ptr,
+                                                 const rocsparse_int* symm_row_ind,
+                                                 const rocsparse_int* symm_perm,
+                                                 const T*             x,
+                                                 T                    beta,
+                                                 T*                   y,
+                                                 rocsparse_fill_mode  fill_mode,
+                                                 rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    bool lower = (fill_mode == rocsparse_fill_mode_lower);
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Stored entries of the row, including the diagonal
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(lower ? col <= row : col >= row)
+            {
+                sum = rocsparse_fma(csr_val[j], rocsparse_ldg(x + col), sum);
+            }
+        }
+
+        rocsparse_int col_start = symm_col_ptr[row] - idx_base;
+        rocsparse_int col_end   = symm_col_ptr[row + 1] - idx_base;
+
+        // Mirrored entries of the column, excluding the diagonal
+        for(rocsparse_int j = col_start + lid; j < col_end; j += WF_SIZE)
+        {
+            rocsparse_int col = symm_row_ind[j] - idx_base;
+
+            if(lower ? col > row : col < row)
+            {
+                sum = rocsparse_fma(csr_val[symm_perm[j]], rocsparse_ldg(x + col), sum);
+            }
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = alpha * sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+            }
+        }
+    }
+}
+
+// Transposed product, scattering the rows of A into y. Each wavefront processes
+// one row and adds alpha * x[row] * A(row, :) to y using global atomics.
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvt_atomic_device(rocsparse_int        m,
+                                            T                    alpha,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            const T*             csr_val,
+                                            const T*             x,
+                                            T*                   y,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        T xr = alpha * rocsparse_ldg(x + row);
+
+        // Rows that do not contribute are skipped
+        if(xr == static_cast<T>(0))
+        {
+            continue;
+        }
+
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            atomicAdd(y + csr_col_ind[j] - idx_base, csr_val[j] * xr);
+        }
+    }
+}
+
+// Transposed product for matrices with few columns. Each block accumulates the
+// contributions of its rows into a private copy of y in LDS, which is added to y
+// once the block has processed all of its rows. This keeps the contention on
+// heavily populated columns within the block.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int LDS_SIZE>
+static __device__ void csrmvt_lds_device(rocsparse_int        m,
+                                         rocsparse_int        n,
+                                         T                    alpha,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_int* csr_col_ind,
+                                         const T*             csr_val,
+                                         const T*             x,
+                                         T*                   y,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    __shared__ T sdata[LDS_SIZE];
+
+    for(rocsparse_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        sdata[i] = static_cast<T>(0);
+    }
+
+    __syncthreads();
+
+    // Loop over rows
+    for(rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + tid) / WF_SIZE; row < m; row += nwf)
+    {
+        T xr = alpha * rocsparse_ldg(x + row);
+
+        // Rows that do not contribute are skipped
+        if(xr == static_cast<T>(0))
+        {
+            continue;
+        }
+
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            atomicAdd(sdata + csr_col_ind[j] - idx_base, csr_val[j] * xr);
+        }
+    }
+
+    __syncthreads();
+
+    // Add the block contribution to y
+    for(rocsparse_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        if(sdata[i] != static_cast<T>(0))
+        {
+            atomicAdd(y + i, sdata[i]);
+        }
+    }
+}
+
 template <typename T>
 static inline __device__ T sum2_reduce(
     T cur_sum, T* partial, rocsparse_int lid, rocsparse_int max_size, rocsparse_int reduc_size)
@@ -92,22 +519,49 @@ static inline __device__ T sum2_reduce(
     return cur_sum;
 }
 
+// Default epilogue of the CSR-Adaptive kernel, computing y := sum + beta * y for each
+// row. Each epilogue also exposes beta and y, which are used by CSR-LongRows, where
+// multiple workgroups accumulate their partial sums of a single row atomically into y.
+template <typename T>
+struct csrmvn_axpby_epilogue
+{
+    T  beta;
+    T* y;
+
+    __device__ void operator()(rocsparse_int row, T sum) const
+    {
+        // All of our write-outs check to see if the output vector should first be zeroed.
+        // If so, just do a write rather than a read-write. Measured to be a slight (~5%)
+        // performance improvement.
+        if(beta != static_cast<T>(0))
+        {
+            sum = rocsparse_fma(beta, y[row], sum);
+        }
+
+        y[row] = sum;
+    }
+};
+
+// CSR-Adaptive with a custom epilogue that is applied to the result alpha * A * x of
+// each row. Rows that are processed by CSR-LongRows are only accumulated into
+// epilogue.y. This is the final result for the default epilogue, while any other
+// epilogue has to be applied to those rows by a subsequent kernel.
 template <typename T,
           rocsparse_int BLOCKSIZE,
           rocsparse_int BLOCK_MULTIPLIER,
           rocsparse_int ROWS_FOR_VECTOR,
           rocsparse_int WG_BITS,
           rocsparse_int ROW_BITS,
-          rocsparse_int WG_SIZE>
-__device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
-                                       T                    alpha,
-                                       const rocsparse_int* csr_row_ptr,
-                                       const rocsparse_int* csr_col_ind,
-                                       const T*             csr_val,
-                                       const T*             x,
-                                       T                    beta,
-                                       T*                   y,
-                                       rocsparse_index_base idx_base)
+          rocsparse_int WG_SIZE,
+          typename EPILOGUE>
+__device__ void csrmvn_adaptive_epilogue_device(unsigned long long*  row_blocks,
+                                                T                    alpha,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                const T*             csr_val,
+                                                const T*             x,
+                                                const EPILOGUE&      epilogue,
+                                                rocsparse_index_base idx_base)
 {
     __shared__ T  partialSums[BLOCKSIZE];
     rocsparse_int gid = hipBlockIdx_x;
@@ -260,14 +714,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
 
             if(threadInBlock == 0 && local_row < stop_row)
             {
-                // All of our write-outs check to see if the output vector should first be zeroed.
-                // If so, just do a write rather than a read-write. Measured to be a slight (~5%)
-                // performance improvement.
-                if(beta != static_cast<T>(0))
-                {
-                    temp_sum = rocsparse_fma(beta, y[local_row], temp_sum);
-                }
-                y[local_row] = temp_sum;
+                epilogue(local_row, temp_sum);
             }
         }
         else
@@ -292,12 +739,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
 
                 // After you've done the reduction into the temp_sum register,
                 // put that into the output for each row.
-                if(beta != static_cast<T>(0))
-                {
-                    temp_sum = rocsparse_fma(beta, y[local_row], temp_sum);
-                }
-
-                y[local_row] = temp_sum;
+                epilogue(local_row, temp_sum);
                 local_row += WG_SIZE;
             }
         }
@@ -341,14 +783,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
 
             if(lid == 0)
             {
-                temp_sum = partialSums[0];
-
-                if(beta != static_cast<T>(0))
-                {
-                    temp_sum = rocsparse_fma(beta, y[row], temp_sum);
-                }
-
-                y[row] = temp_sum;
+                epilogue(row, partialSums[0]);
             }
             ++row;
         }
@@ -375,8 +810,8 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
         if(gid == first_wg_in_row && lid == 0)
         {
             // The first workgroup handles the output initialization.
-            T out_val = y[row];
-            temp_sum  = (beta - static_cast<T>(1)) * out_val;
+            T out_val = epilogue.y[row];
+            temp_sum  = (epilogue.beta - static_cast<T>(1)) * out_val;
             atomicXor(&row_blocks[first_wg_in_row], (1ULL << WG_BITS)); // Release other workgroups.
         }
         // For every other workgroup, bit 24 holds the value they wait on.
@@ -413,9 +848,673 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
 
         if(lid == 0)
         {
-            atomicAdd(y + row, partialSums[0]);
+            atomicAdd(epilogue.y + row, partialSums[0]);
         }
     }
 }
 
+template <typename T,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int ROW_BITS,
+          rocsparse_int WG_SIZE>
+__device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
+                                       T                    alpha,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       const T*             csr_val,
+                                       const T*             x,
+                                       T                    beta,
+                                       T*                   y,
+                                       rocsparse_index_base idx_base)
+{
+    csrmvn_axpby_epilogue<T> epilogue = {beta, y};
+
+    csrmvn_adaptive_epilogue_device<T,
+                                    BLOCKSIZE,
+                                    BLOCK_MULTIPLIER,
+                                    ROWS_FOR_VECTOR,
+                                    WG_BITS,
+                                    ROW_BITS,
+                                    WG_SIZE>(
+        row_blocks, alpha, csr_row_ptr, csr_col_ind, csr_val, x, epilogue, idx_base);
+}
+
+// CSR-Adaptive for multiple dense vectors. x and y hold k column-major vectors with
+// leading dimensions ldx and ldy. The row block partitioning is identical to the
+// single vector case, such that the csrmv analysis meta data can be reused.
+// CSR-Stream row blocks hold their matrix entries in registers while they are
+// applied to all k vectors. CSR-Vector and CSR-LongRows row blocks process the
+// vectors in chunks of NVEC, such that each matrix entry is loaded once per chunk.
+template <typename T,
+          rocsparse_int NVEC,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int ROW_BITS,
+          rocsparse_int WG_SIZE>
+__device__ void csrmvn_adaptive_multi_device(rocsparse_int        k,
+                                             unsigned long long*  row_blocks,
+                                             T                    alpha,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             const T*             csr_val,
+                                             const T*             x,
+                                             rocsparse_int        ldx,
+                                             T                    beta,
+                                             T*                   y,
+                                             rocsparse_int        ldy,
+                                             rocsparse_index_base idx_base)
+{
+    __shared__ T  partialSums[BLOCKSIZE];
+    rocsparse_int gid = hipBlockIdx_x;
+    rocsparse_int lid = hipThreadIdx_x;
+
+    // See csrmvn_adaptive_device() for the layout of the row blocks buffer
+    rocsparse_int row = ((row_blocks[gid] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int stop_row
+        = ((row_blocks[gid + 1] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int num_rows = stop_row - row;
+
+    rocsparse_int wg = row_blocks[gid] & ((1 << WG_BITS) - 1);
+
+    rocsparse_int vecStart
+        = rocsparse_mad24(wg, BLOCK_MULTIPLIER * BLOCKSIZE, csr_row_ptr[row] - idx_base);
+    rocsparse_int vecEnd
+        = min(csr_row_ptr[row + 1] - idx_base, vecStart + BLOCK_MULTIPLIER * BLOCKSIZE);
+
+    if(num_rows > ROWS_FOR_VECTOR)
+    {
+        // CSR-Stream case
+        rocsparse_int numThreadsForRed = wg;
+
+        // Load this row block's matrix entries into registers. They are re-used
+        // for every vector. Entries beyond the row block are never reduced, so
+        // they are not loaded.
+        T             val[BLOCKSIZE / WG_SIZE];
+        rocsparse_int ind[BLOCKSIZE / WG_SIZE];
+
+        rocsparse_int col     = csr_row_ptr[row] + lid - idx_base;
+        rocsparse_int col_end = csr_row_ptr[stop_row] - idx_base;
+
+#pragma unroll
+        for(rocsparse_int i = 0; i < BLOCKSIZE / WG_SIZE; ++i)
+        {
+            if(col + i * WG_SIZE < col_end)
+            {
+                val[i] = alpha * csr_val[col + i * WG_SIZE];
+                ind[i] = csr_col_ind[col + i * WG_SIZE] - idx_base;
+            }
+        }
+
+        for(rocsparse_int v = 0; v < k; ++v)
+        {
+            const T* xv = x + v * ldx;
+            T*       yv = y + v * ldy;
+
+#pragma unroll
+            for(rocsparse_int i = 0; i < BLOCKSIZE / WG_SIZE; ++i)
+            {
+                if(col + i * WG_SIZE < col_end)
+                {
+                    partialSums[lid + i * WG_SIZE] = val[i] * xv[ind[i]];
+                }
+            }
+            __syncthreads();
+
+            T temp_sum = static_cast<T>(0);
+
+            if(numThreadsForRed > 1)
+            {
+                // Tree-style reduction, numThreadsForRed adjacent threads reduce a row
+                rocsparse_int local_row       = row + (lid >> (31 - __clz(numThreadsForRed)));
+                rocsparse_int local_first_val = csr_row_ptr[local_row] - csr_row_ptr[row];
+                rocsparse_int local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
+                rocsparse_int threadInBlock   = lid & (numThreadsForRed - 1);
+
+                if(local_row < stop_row)
+                {
+                    for(rocsparse_int local_cur_val = local_first_val + threadInBlock;
+                        local_cur_val < local_last_val;
+                        local_cur_val += numThreadsForRed)
+                    {
+                        temp_sum += partialSums[local_cur_val];
+                    }
+                }
+                __syncthreads();
+
+                partialSums[lid] = temp_sum;
+
+                for(rocsparse_int i = (WG_SIZE >> 1); i > 0; i >>= 1)
+                {
+                    __syncthreads();
+                    temp_sum = sum2_reduce(temp_sum, partialSums, lid, numThreadsForRed, i);
+                }
+
+                if(threadInBlock == 0 && local_row < stop_row)
+                {
+                    if(beta != static_cast<T>(0))
+                    {
+                        temp_sum = rocsparse_fma(beta, yv[local_row], temp_sum);
+                    }
+                    yv[local_row] = temp_sum;
+                }
+            }
+            else
+            {
+                // Each thread reduces a single row out of local memory
+                rocsparse_int local_row = row + lid;
+                while(local_row < stop_row)
+                {
+                    rocsparse_int local_first_val = (csr_row_ptr[local_row] - csr_row_ptr[row]);
+                    rocsparse_int local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
+                    temp_sum                      = static_cast<T>(0);
+                    for(rocsparse_int local_cur_val = local_first_val;
+                        local_cur_val < local_last_val;
+                        ++local_cur_val)
+                    {
+                        temp_sum += partialSums[local_cur_val];
+                    }
+
+                    if(beta != static_cast<T>(0))
+                    {
+                        temp_sum = rocsparse_fma(beta, yv[local_row], temp_sum);
+                    }
+
+                    yv[local_row] = temp_sum;
+                    local_row += WG_SIZE;
+                }
+            }
+
+            // Local memory is overwritten by the next vector
+            __syncthreads();
+        }
+    }
+    else if(num_rows >= 1 && !wg) // CSR-Vector case.
+    {
+        while(row < stop_row)
+        {
+            vecStart = csr_row_ptr[row] - idx_base;
+            vecEnd   = csr_row_ptr[row + 1] - idx_base;
+
+            for(rocsparse_int v = 0; v < k; v += NVEC)
+            {
+                T temp_sum[NVEC];
+
+#pragma unroll
+                for(rocsparse_int l = 0; l < NVEC; ++l)
+                {
+                    temp_sum[l] = static_cast<T>(0);
+                }
+
+                // Each matrix entry is loaded once for all vectors of this chunk
+                for(rocsparse_int j = vecStart + lid; j < vecEnd; j += WG_SIZE)
+                {
+                    T             val = alpha * csr_val[j];
+                    rocsparse_int c   = csr_col_ind[j] - idx_base;
+
+#pragma unroll
+                    for(rocsparse_int l = 0; l < NVEC; ++l)
+                    {
+                        if(v + l < k)
+                        {
+                            temp_sum[l] = rocsparse_fma(val, x[(v + l) * ldx + c], temp_sum[l]);
+                        }
+                    }
+                }
+
+#pragma unroll
+                for(rocsparse_int l = 0; l < NVEC; ++l)
+                {
+                    if(v + l < k)
+                    {
+                        partialSums[lid] = temp_sum[l];
+
+                        __syncthreads();
+
+                        // Reduce partial sums
+                        rocsparse_blockreduce_sum<T, WG_SIZE>(lid, partialSums);
+
+                        if(lid == 0)
+                        {
+                            T* yv  = y + (v + l) * ldy;
+                            T  sum = partialSums[0];
+
+                            if(beta != static_cast<T>(0))
+                            {
+                                sum = rocsparse_fma(beta, yv[row], sum);
+                            }
+
+                            yv[row] = sum;
+                        }
+                        __syncthreads();
+                    }
+                }
+            }
+            ++row;
+        }
+    }
+    else
+    {
+        // CSR-LongRows case. The first workgroup of the long row scales all k output
+        // values by beta and then releases the other workgroups, which wait on the
+        // flag bit exactly as in csrmvn_adaptive_device(). Afterwards, all workgroups
+        // atomically add their partial results.
+        rocsparse_int first_wg_in_row = gid - (row_blocks[gid] & ((1ULL << WG_BITS) - 1ULL));
+        rocsparse_int compare_value   = row_blocks[gid] & (1ULL << WG_BITS);
+
+        if(gid == first_wg_in_row && lid == 0)
+        {
+            for(rocsparse_int v = 0; v < k; ++v)
+            {
+                T* yv = y + v * ldy;
+
+                yv[row] = (beta != static_cast<T>(0)) ? beta * yv[row] : static_cast<T>(0);
+            }
+
+            // Make the scaled output visible before releasing other workgroups
+            __threadfence();
+            atomicXor(&row_blocks[first_wg_in_row], (1ULL << WG_BITS)); // Release other workgroups.
+        }
+        __syncthreads();
+        while(gid != first_wg_in_row && lid == 0
+              && ((atomicMax(&row_blocks[first_wg_in_row], 0ULL) & (1ULL << WG_BITS))
+                  == compare_value))
+            ;
+        __syncthreads();
+
+        if(gid != first_wg_in_row && lid == 0)
+            row_blocks[gid] ^= (1ULL << WG_BITS);
+
+        for(rocsparse_int v = 0; v < k; v += NVEC)
+        {
+            T temp_sum[NVEC];
+
+#pragma unroll
+            for(rocsparse_int l = 0; l < NVEC; ++l)
+            {
+                temp_sum[l] = static_cast<T>(0);
+            }
+
+            for(rocsparse_int j = vecStart + lid; j < vecEnd; j += WG_SIZE)
+            {
+                T             val = alpha * csr_val[j];
+                rocsparse_int c   = csr_col_ind[j] - idx_base;
+
+#pragma unroll
+                for(rocsparse_int l = 0; l < NVEC; ++l)
+                {
+                    if(v + l < k)
+                    {
+                        temp_sum[l] = rocsparse_fma(val, x[(v + l) * ldx + c], temp_sum[l]);
+                    }
+                }
+            }
+
+#pragma unroll
+            for(rocsparse_int l = 0; l < NVEC; ++l)
+            {
+                if(v + l < k)
+                {
+                    partialSums[lid] = temp_sum[l];
+
+                    __syncthreads();
+
+                    // Reduce partial sums
+                    rocsparse_blockreduce_sum<T, WG_SIZE>(lid, partialSums);
+
+                    if(lid == 0)
+                    {
+                        atomicAdd(y + (v + l) * ldy + row, partialSums[0]);
+                    }
+                    __syncthreads();
+                }
+            }
+        }
+    }
+}
+
+// Short rows in CSR-Adaptive are batched together into a single row block.
+// If there are a relatively small number of these, then we choose to do
+// a horizontal reduction (groups of threads all reduce the same row).
+// If there are many threads (e.g. more threads than the maximum size
+// of our workgroup) then we choose to have each thread serially reduce
+// the row.
+// This function calculates the number of threads that could team up
+// to reduce these groups of rows. For instance, if you have a
+// workgroup size of 256 and 4 rows, you could have 64 threads
+// working on each row. If you have 5 rows, only 32 threads could
+// reliably work on each row because our reduction assumes power-of-2.
+template <rocsparse_int WG_SIZE>
+static inline __host__ __device__ unsigned long long
+    csrmv_num_threads_for_reduction(unsigned long long num_rows)
+{
+    return WG_SIZE >> (8 * sizeof(int) - __builtin_clz(static_cast<unsigned int>(num_rows - 1)));
+}
+
+// Computes the row block that starts at row first, given that CSR-Adaptive has
+// just started a new row block at this row. The partitioning state machine is
+// always reset when a new row block is started, thus the row block only depends
+// on its first row. Returns the first row of the next row block. The low-order
+// bits of the row block entry are stored in bits, the number of additional
+// workgroups required by a CSR-Vector row block is stored in extra_wg.
+template <rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int WG_SIZE>
+static __host__ __device__ rocsparse_int csrmv_row_block_next(const rocsparse_int* csr_row_ptr,
+                                                              rocsparse_int        m,
+                                                              rocsparse_int        first,
+                                                              unsigned long long&  bits,
+                                                              rocsparse_int&       extra_wg)
+{
+    unsigned long long sum                   = 0;
+    rocsparse_int      consecutive_long_rows = 0;
+
+    bits     = 0;
+    extra_wg = 0;
+
+    for(rocsparse_int i = first + 1; i <= m; ++i)
+    {
+        rocsparse_int row_length = csr_row_ptr[i] - csr_row_ptr[i - 1];
+        sum += row_length;
+
+        // The following section of code calculates whether you're moving between
+        // a series of "short" rows and a series of "long" rows.
+        // This is because the reduction in CSR-Adaptive likes things to be
+        // roughly the same length. Long rows can be reduced horizontally.
+        // Short rows can be reduced one-thread-per-row. Try not to mix them.
+        if(row_length > 128)
+        {
+            ++consecutive_long_rows;
+        }
+        else if(consecutive_long_rows > 0)
+        {
+            // If it turns out we WERE in a long-row region, cut if off now.
+            consecutive_long_rows = (row_length < 32) ? -1 : consecutive_long_rows + 1;
+        }
+
+        // If you just entered into a "long" row from a series of short rows,
+        // then we need to make sure we cut off those short rows. Put them in
+        // their own workgroup. The same holds for the first short row after
+        // some long ones that didn't previously fill up a row block.
+        if((consecutive_long_rows == 1 && i - first > 1) || consecutive_long_rows == -1)
+        {
+            // If this row fits into CSR-Stream, calculate how many rows
+            // can be used to do a parallel reduction.
+            if(i - 1 - first > ROWS_FOR_VECTOR)
+            {
+                bits = csrmv_num_threads_for_reduction<WG_SIZE>(i - 1 - first);
+            }
+
+            return i - 1;
+        }
+
+        // exactly one row results in non-zero elements to be greater than blockSize
+        // This is csr-vector case; bottom WGBITS == workgroup ID
+        if(i - first == 1 && sum > BLOCKSIZE)
+        {
+            rocsparse_int numWGReq = (row_length - 1) / (BLOCK_MULTIPLIER * BLOCKSIZE) + 1;
+
+            // Check to ensure #workgroups can fit in WGBITS bits, if not
+            // then the last workgroup will do all the remaining work
+            extra_wg = ((numWGReq < (1 << WG_BITS)) ? numWGReq : (1 << WG_BITS)) - 1;
+
+            return i;
+        }
+        // more than one row results in non-zero elements to be greater than blockSize
+        // This is csr-stream case; this row won't fit, so back off one.
+        else if(sum > BLOCKSIZE)
+        {
+            if(i - 1 - first > ROWS_FOR_VECTOR)
+            {
+                bits = csrmv_num_threads_for_reduction<WG_SIZE>(i - 1 - first);
+            }
+
+            return i - 1;
+        }
+        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
+        else if(sum == BLOCKSIZE)
+        {
+            if(i - first > ROWS_FOR_VECTOR)
+            {
+                bits = csrmv_num_threads_for_reduction<WG_SIZE>(i - first);
+            }
+
+            return i;
+        }
+    }
+
+    // If we didn't fill a row block with the last row, make sure we don't lose it.
+    if(m - first > ROWS_FOR_VECTOR)
+    {
+        bits = csrmv_num_threads_for_reduction<WG_SIZE>(m + 1 - first);
+    }
+
+    return m;
+}
+
+// Device row block analysis splits the rows into chunks. Each thread
+// speculatively starts a row block at the first row of its chunk and follows
+// the row block chain through the chunk, counting the row block entries.
+template <rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int WG_SIZE>
+__device__ void csrmv_row_blocks_speculate_device(rocsparse_int        m,
+                                                  rocsparse_int        chunk_size,
+                                                  rocsparse_int        num_chunks,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  rocsparse_int*       spec_exit,
+                                                  rocsparse_int*       spec_count,
+                                                  rocsparse_int*       count)
+{
+    rocsparse_int c = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(c >= num_chunks)
+    {
+        return;
+    }
+
+    rocsparse_int row  = c * chunk_size;
+    rocsparse_int last = min(row + chunk_size, m);
+    rocsparse_int nrb  = 0;
+
+    while(row < last)
+    {
+        unsigned long long bits;
+        rocsparse_int      extra_wg;
+
+        row = csrmv_row_block_next<BLOCKSIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_BITS, WG_SIZE>(
+            csr_row_ptr, m, row, bits, extra_wg);
+        nrb += 1 + extra_wg;
+    }
+
+    spec_exit[c]  = row;
+    spec_count[c] = nrb;
+
+    // Mark the exact row block count as outstanding
+    count[c] = -1;
+
+    if(c == 0)
+    {
+        count[num_chunks] = 0;
+    }
+}
+
+// Stitches the speculative row block chains of all chunks together. A row block
+// only depends on its first row, thus the exact row block chain entering a chunk
+// coincides with the speculative one, as soon as both share a row block. The
+// exact entry row of each chunk is the exit row of its predecessor, which is
+// iterated until no entry row changes anymore. Usually, this requires only a
+// single iteration. This runs on a single workgroup.
+template <rocsparse_int STITCH_DIM,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int WG_SIZE>
+__device__ void csrmv_row_blocks_stitch_device(rocsparse_int        m,
+                                               rocsparse_int        chunk_size,
+                                               rocsparse_int        num_chunks,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* spec_exit,
+                                               const rocsparse_int* spec_count,
+                                               rocsparse_int*       chunk_entry,
+                                               rocsparse_int*       chunk_exit,
+                                               rocsparse_int*       count)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ int changed;
+
+    // Initial guess is that all speculations were successful
+    for(rocsparse_int c = tid; c < num_chunks; c += STITCH_DIM)
+    {
+        chunk_entry[c] = (c == 0) ? 0 : spec_exit[c - 1];
+    }
+
+    __syncthreads();
+
+    do
+    {
+        // Follow the exact row block chain of each outstanding chunk, until it
+        // meets the speculative one
+        for(rocsparse_int c = tid; c < num_chunks; c += STITCH_DIM)
+        {
+            if(count[c] != -1)
+            {
+                continue;
+            }
+
+            rocsparse_int last = min((c + 1) * chunk_size, m);
+
+            rocsparse_int exact  = chunk_entry[c];
+            rocsparse_int spec   = c * chunk_size;
+            rocsparse_int nexact = 0;
+            rocsparse_int nspec  = 0;
+            bool          met    = false;
+
+            while(exact < last)
+            {
+                if(exact == spec)
+                {
+                    met = true;
+                    break;
+                }
+
+                unsigned long long bits;
+                rocsparse_int      extra_wg;
+
+                if(exact < spec)
+                {
+                    exact = csrmv_row_block_next<BLOCKSIZE,
+                                                 BLOCK_MULTIPLIER,
+                                                 ROWS_FOR_VECTOR,
+                                                 WG_BITS,
+                                                 WG_SIZE>(csr_row_ptr, m, exact, bits, extra_wg);
+                    nexact += 1 + extra_wg;
+                }
+                else
+                {
+                    spec = csrmv_row_block_next<BLOCKSIZE,
+                                                BLOCK_MULTIPLIER,
+                                                ROWS_FOR_VECTOR,
+                                                WG_BITS,
+                                                WG_SIZE>(csr_row_ptr, m, spec, bits, extra_wg);
+                    nspec += 1 + extra_wg;
+                }
+            }
+
+            chunk_exit[c]  = met ? spec_exit[c] : exact;
+            count[c] = met ? nexact + spec_count[c] - nspec : nexact;
+        }
+
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            changed = 0;
+        }
+
+        __syncthreads();
+
+        // Propagate exit rows to the successors
+        for(rocsparse_int c = tid + 1; c < num_chunks; c += STITCH_DIM)
+        {
+            if(chunk_entry[c] != chunk_exit[c - 1])
+            {
+                chunk_entry[c] = chunk_exit[c - 1];
+                count[c] = -1;
+                changed  = 1;
+            }
+        }
+
+        __syncthreads();
+    } while(changed);
+}
+
+// Writes the exact row block entries of each chunk, starting at its offset
+template <rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int ROW_BITS,
+          rocsparse_int WG_SIZE>
+__device__ void csrmv_row_blocks_fill_device(rocsparse_int        m,
+                                             rocsparse_int        chunk_size,
+                                             rocsparse_int        num_chunks,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* chunk_entry,
+                                             const rocsparse_int* offset,
+                                             unsigned long long*  row_blocks,
+                                             size_t*              size)
+{
+    rocsparse_int c = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(c >= num_chunks)
+    {
+        return;
+    }
+
+    rocsparse_int row  = chunk_entry[c];
+    rocsparse_int last = min((c + 1) * chunk_size, m);
+    rocsparse_int idx  = offset[c];
+
+    while(row < last)
+    {
+        unsigned long long bits;
+        rocsparse_int      extra_wg;
+
+        rocsparse_int next
+            = csrmv_row_block_next<BLOCKSIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_BITS, WG_SIZE>(
+                csr_row_ptr, m, row, bits, extra_wg);
+
+        row_blocks[idx++] = (static_cast<unsigned long long>(row) << (64 - ROW_BITS)) | bits;
+
+        for(rocsparse_int w = 1; w <= extra_wg; ++w)
+        {
+            row_blocks[idx++] = (static_cast<unsigned long long>(row) << (64 - ROW_BITS))
+                                | static_cast<unsigned long long>(w);
+        }
+
+        row = next;
+    }
+
+    // The last row block entry terminates the last row block
+    if(c == num_chunks - 1)
+    {
+        row_blocks[idx] = static_cast<unsigned long long>(m) << (64 - ROW_BITS);
+
+        // We're multiplying the size by two because the extended precision form of
+        // CSR-Adaptive requires more space for the final global reduction.
+        *size = 2 * (static_cast<size_t>(idx) + 1);
+    }
+}
+
 #endif // CSRMV_DEVICE_H
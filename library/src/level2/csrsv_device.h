@@ -277,7 +277,172 @@ __global__ void csrsv_analysis_upper_kernel(rocsparse_int m,
     }
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+// Counts, for each row of the transposed triangular system, the number of rows it
+// depends on. Row i of the transposed system depends on all rows j that hold an
+// off-diagonal entry in column i, which is the number of entries in column i of the
+// triangular part of the CSR matrix.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csrsv_transpose_count_kernel(rocsparse_int m,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             rocsparse_int* __restrict__ csr_diag_ind,
+                                             rocsparse_int* __restrict__ dep_count,
+                                             rocsparse_int* __restrict__ max_nnz,
+                                             rocsparse_int* __restrict__ zero_pivot,
+                                             rocsparse_index_base idx_base,
+                                             rocsparse_fill_mode  fill_mode)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Row that the wavefront will process
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Diagonal entry found by this lane
+    rocsparse_int diag = -1;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        if(local_col == row)
+        {
+            diag = j;
+        }
+        else if((fill_mode == rocsparse_fill_mode_lower && local_col < row)
+                || (fill_mode == rocsparse_fill_mode_upper && local_col > row))
+        {
+            // Row local_col of the transposed system depends on this row
+            atomicAdd(&dep_count[local_col], 1);
+        }
+    }
+
+    // Determine the diagonal entry within the wavefront
+    rocsparse_wfreduce_max<WF_SIZE>(&diag);
+
+    if(lid == WF_SIZE - 1)
+    {
+        // Store diagonal index
+        csr_diag_ind[row] = diag;
+
+        // Obtain maximum nnz
+        atomicMax(max_nnz, row_end - row_begin);
+
+        if(diag == -1)
+        {
+            // We are looking for the first zero pivot
+            atomicMin(zero_pivot, row + idx_base);
+        }
+    }
+}
+
+// Computes the depth of each row of the transposed triangular system without
+// transposing the matrix. Rows are processed in reverse dependency order, i.e.
+// backwards for lower and forwards for upper triangular matrices. Once all rows a
+// row depends on have been processed, the row pushes its depth to the rows that
+// depend on it, which are given by the column indices of its CSR row.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csrsv_analysis_transpose_kernel(rocsparse_int m,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ csr_col_ind,
+                                                int* __restrict__ done_array,
+                                                int* __restrict__ dep_count,
+                                                rocsparse_index_base idx_base,
+                                                rocsparse_fill_mode  fill_mode)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Index of the row in processing order
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Row that the wavefront will process
+    rocsparse_int row = (fill_mode == rocsparse_fill_mode_lower) ? m - 1 - idx : idx;
+
+    // Wait until all dependencies have pushed their depth. All of them have been
+    // assigned to previous wavefronts.
+    while(rocsparse_atomic_load(&dep_count[row], __ATOMIC_ACQUIRE) != 0)
+        ;
+
+    // Depth of this row
+    int depth = atomicOr(&done_array[row], 0) + 1;
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        if((fill_mode == rocsparse_fill_mode_lower && local_col < row)
+           || (fill_mode == rocsparse_fill_mode_upper && local_col > row))
+        {
+            // Push depth to the dependent row and resolve the dependency
+            atomicMax(&done_array[local_col], depth);
+            __threadfence();
+            atomicSub(&dep_count[local_col], 1);
+        }
+    }
+
+    if(lid == 0)
+    {
+        // Store the depth of this row
+        atomicExch(&done_array[row], depth);
+    }
+}
+
+// Computes the first row of each level from the depth sorted rows. Levels are
+// 1-based and contiguous, as each row depends on at least one row of the previous
+// level.
+template <unsigned int BLOCKSIZE>
+__global__ void csrsv_level_ptr_kernel(rocsparse_int m,
+                                       const int* __restrict__ depth,
+                                       rocsparse_int* __restrict__ level_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= m)
+    {
+        return;
+    }
+
+    int level = depth[gid];
+
+    // First row of a level
+    if(gid == 0 || depth[gid - 1] != level)
+    {
+        level_ptr[level - 1] = gid;
+    }
+
+    // Last row of the last level
+    if(gid == m - 1)
+    {
+        level_ptr[level] = m;
+    }
+}
+
+// Solves the rows given by map[offset, offset + m). If SPIN_LOOP is true, each
+// row waits for its dependencies by spinning on the done array, until they have
+// been flagged with done_flag. Otherwise, all dependencies must have been resolved
+// by previous kernel launches, which is the case if the rows belong to a single
+// level.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
 __device__ void csrsv_device(rocsparse_int m,
                              T             alpha,
                              const rocsparse_int* __restrict__ csr_row_ptr,
@@ -286,6 +451,7 @@ __device__ void csrsv_device(rocsparse_int m,
                              const T* __restrict__ x,
                              T* __restrict__ y,
                              int* __restrict__ done_array,
+                             int           done_flag,
                              rocsparse_int* __restrict__ map,
                              rocsparse_int offset,
                              rocsparse_int* __restrict__ zero_pivot,
@@ -391,8 +557,11 @@ __device__ void csrsv_device(rocsparse_int m,
         }
 
         // Spin loop until dependency has been resolved
-        while(!rocsparse_atomic_load(&done_array[local_col], __ATOMIC_ACQUIRE))
-            ;
+        if(SPIN_LOOP)
+        {
+            while(rocsparse_atomic_load(&done_array[local_col], __ATOMIC_ACQUIRE) != done_flag)
+                ;
+        }
 
         // Local sum computation for each lane
         local_sum = rocsparse_fma(-local_val, y[local_col], local_sum);
@@ -412,7 +581,136 @@ __device__ void csrsv_device(rocsparse_int m,
     {
         // Write the "row is done" flag and store the rows result in y
         rocsparse_nontemporal_store(local_sum, &y[row]);
-        rocsparse_atomic_store(&done_array[row], 1, __ATOMIC_RELEASE);
+
+        if(SPIN_LOOP)
+        {
+            rocsparse_atomic_store(&done_array[row], done_flag, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+// Initializes y with alpha * x
+template <typename T, unsigned int BLOCKSIZE>
+__device__ void csrsv_scale_device(rocsparse_int m,
+                                   T             alpha,
+                                   const T* __restrict__ x,
+                                   T* __restrict__ y)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= m)
+    {
+        return;
+    }
+
+    y[gid] = alpha * x[gid];
+}
+
+// Solves the rows given by map[offset, offset + m) of the transposed triangular
+// system. y must hold alpha * x on entry. Each row divides its accumulated value by
+// the diagonal entry and scatters its contribution to the rows that depend on it.
+// If SPIN_LOOP is true, each row waits until all of its dependencies have been
+// resolved, as counted by dep_count. Otherwise, all dependencies must have been
+// resolved by previous kernel launches.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
+__device__ void csrsv_transpose_device(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       T* __restrict__ y,
+                                       int* __restrict__ dep_count,
+                                       const rocsparse_int* __restrict__ csr_diag_ind,
+                                       const rocsparse_int* __restrict__ map,
+                                       rocsparse_int offset,
+                                       rocsparse_int* __restrict__ zero_pivot,
+                                       rocsparse_index_base idx_base,
+                                       rocsparse_fill_mode  fill_mode,
+                                       rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Index into the row map
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Get the row this warp will operate on
+    rocsparse_int row = map[idx + offset];
+
+    // Spin loop until all dependencies have been resolved
+    if(SPIN_LOOP)
+    {
+        while(rocsparse_atomic_load(&dep_count[row], __ATOMIC_ACQUIRE) != 0)
+            ;
+    }
+
+    // All contributions have been accumulated
+    T local_y = y[row];
+
+    // If we have non unit diagonal, take the diagonal into account
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        rocsparse_int diag = csr_diag_ind[row];
+
+        // Structural zero pivots have been stored during analysis
+        if(diag != -1)
+        {
+            T diag_val = csr_val[diag];
+
+            // Check for numerical zero
+            if(diag_val == static_cast<T>(0))
+            {
+                // Numerical zero pivot found, avoid division by 0
+                // and store index for later use.
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+            }
+            else
+            {
+                local_y *= rocsparse_rcp(diag_val);
+            }
+        }
+    }
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Ignore the diagonal and all entries of the other triangular part
+        if((fill_mode == rocsparse_fill_mode_lower && local_col >= row)
+           || (fill_mode == rocsparse_fill_mode_upper && local_col <= row))
+        {
+            continue;
+        }
+
+        // Scatter the contribution of this row
+        atomicAdd(&y[local_col], -rocsparse_nontemporal_load(csr_val + j) * local_y);
+
+        // Resolve the dependency
+        if(SPIN_LOOP)
+        {
+            __threadfence();
+            atomicSub(&dep_count[local_col], 1);
+        }
+    }
+
+    if(lid == 0)
+    {
+        // Store the rows result in y
+        y[row] = local_y;
     }
 }
 
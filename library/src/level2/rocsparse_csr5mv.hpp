@@ -0,0 +1,565 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef ROCSPARSE_CSR5MV_HPP
+#define ROCSPARSE_CSR5MV_HPP
+
+#include "csr5mv_device.h"
+#include "csrmv_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+#define CSR5MV_DIM 256
+
+template <typename T, unsigned int BLOCKDIM, unsigned int SIGMA>
+__launch_bounds__(BLOCKDIM) __global__
+    void csr5mvn_kernel_host_pointer(rocsparse_int num_tiles,
+                                     T             alpha,
+                                     const rocsparse_int* __restrict__ row_ptr,
+                                     const rocsparse_int* __restrict__ tile_ptr,
+                                     const unsigned int* __restrict__ tile_flag,
+                                     const rocsparse_int* __restrict__ tile_offset,
+                                     const rocsparse_int* __restrict__ col_ind,
+                                     const T* __restrict__ val,
+                                     const T* __restrict__ x,
+                                     T* __restrict__ y,
+                                     rocsparse_index_base idx_base)
+{
+    csr5mvn_device<T, BLOCKDIM, SIGMA>(
+        num_tiles, alpha, row_ptr, tile_ptr, tile_flag, tile_offset, col_ind, val, x, y, idx_base);
+}
+
+template <typename T, unsigned int BLOCKDIM, unsigned int SIGMA>
+__launch_bounds__(BLOCKDIM) __global__
+    void csr5mvn_kernel_device_pointer(rocsparse_int num_tiles,
+                                       const T*      alpha,
+                                       const rocsparse_int* __restrict__ row_ptr,
+                                       const rocsparse_int* __restrict__ tile_ptr,
+                                       const unsigned int* __restrict__ tile_flag,
+                                       const rocsparse_int* __restrict__ tile_offset,
+                                       const rocsparse_int* __restrict__ col_ind,
+                                       const T* __restrict__ val,
+                                       const T* __restrict__ x,
+                                       T* __restrict__ y,
+                                       rocsparse_index_base idx_base)
+{
+    csr5mvn_device<T, BLOCKDIM, SIGMA>(
+        num_tiles, *alpha, row_ptr, tile_ptr, tile_flag, tile_offset, col_ind, val, x, y, idx_base);
+}
+
+template <typename T, unsigned int SIGMA>
+__global__ void csr5mvt_kernel_host_pointer(rocsparse_int num_tiles,
+                                            T             alpha,
+                                            const rocsparse_int* __restrict__ row_ptr,
+                                            const rocsparse_int* __restrict__ tile_ptr,
+                                            const unsigned int* __restrict__ tile_flag,
+                                            const rocsparse_int* __restrict__ tile_offset,
+                                            const rocsparse_int* __restrict__ col_ind,
+                                            const T* __restrict__ val,
+                                            const T* __restrict__ x,
+                                            T* __restrict__ y,
+                                            rocsparse_index_base idx_base)
+{
+    csr5mvt_device<T, SIGMA>(
+        num_tiles, alpha, row_ptr, tile_ptr, tile_flag, tile_offset, col_ind, val, x, y, idx_base);
+}
+
+template <typename T, unsigned int SIGMA>
+__global__ void csr5mvt_kernel_device_pointer(rocsparse_int num_tiles,
+                                              const T*      alpha,
+                                              const rocsparse_int* __restrict__ row_ptr,
+                                              const rocsparse_int* __restrict__ tile_ptr,
+                                              const unsigned int* __restrict__ tile_flag,
+                                              const rocsparse_int* __restrict__ tile_offset,
+                                              const rocsparse_int* __restrict__ col_ind,
+                                              const T* __restrict__ val,
+                                              const T* __restrict__ x,
+                                              T* __restrict__ y,
+                                              rocsparse_index_base idx_base)
+{
+    csr5mvt_device<T, SIGMA>(
+        num_tiles, *alpha, row_ptr, tile_ptr, tile_flag, tile_offset, col_ind, val, x, y, idx_base);
+}
+
+template <typename T>
+__global__ void csr5mvn_tail_kernel_host_pointer(rocsparse_int m,
+                                                 rocsparse_int tail_row,
+                                                 rocsparse_int tail_begin,
+                                                 T             alpha,
+                                                 const rocsparse_int* __restrict__ row_ptr,
+                                                 const rocsparse_int* __restrict__ col_ind,
+                                                 const T* __restrict__ val,
+                                                 const T* __restrict__ x,
+                                                 T* __restrict__ y,
+                                                 rocsparse_index_base idx_base)
+{
+    csr5mvn_tail_device(m, tail_row, tail_begin, alpha, row_ptr, col_ind, val, x, y, idx_base);
+}
+
+template <typename T>
+__global__ void csr5mvn_tail_kernel_device_pointer(rocsparse_int m,
+                                                   rocsparse_int tail_row,
+                                                   rocsparse_int tail_begin,
+                                                   const T*      alpha,
+                                                   const rocsparse_int* __restrict__ row_ptr,
+                                                   const rocsparse_int* __restrict__ col_ind,
+                                                   const T* __restrict__ val,
+                                                   const T* __restrict__ x,
+                                                   T* __restrict__ y,
+                                                   rocsparse_index_base idx_base)
+{
+    csr5mvn_tail_device(m, tail_row, tail_begin, *alpha, row_ptr, col_ind, val, x, y, idx_base);
+}
+
+template <typename T>
+__global__ void csr5mvt_tail_kernel_host_pointer(rocsparse_int m,
+                                                 rocsparse_int tail_row,
+                                                 rocsparse_int tail_begin,
+                                                 T             alpha,
+                                                 const rocsparse_int* __restrict__ row_ptr,
+                                                 const rocsparse_int* __restrict__ col_ind,
+                                                 const T* __restrict__ val,
+                                                 const T* __restrict__ x,
+                                                 T* __restrict__ y,
+                                                 rocsparse_index_base idx_base)
+{
+    csr5mvt_tail_device(m, tail_row, tail_begin, alpha, row_ptr, col_ind, val, x, y, idx_base);
+}
+
+template <typename T>
+__global__ void csr5mvt_tail_kernel_device_pointer(rocsparse_int m,
+                                                   rocsparse_int tail_row,
+                                                   rocsparse_int tail_begin,
+                                                   const T*      alpha,
+                                                   const rocsparse_int* __restrict__ row_ptr,
+                                                   const rocsparse_int* __restrict__ col_ind,
+                                                   const T* __restrict__ val,
+                                                   const T* __restrict__ x,
+                                                   T* __restrict__ y,
+                                                   rocsparse_index_base idx_base)
+{
+    csr5mvt_tail_device(m, tail_row, tail_begin, *alpha, row_ptr, col_ind, val, x, y, idx_base);
+}
+
+template <typename T>
+__global__ void csr5mv_scale_kernel_host_pointer(rocsparse_int m, T beta, T* __restrict__ y)
+{
+    csrmv_scale_device(m, beta, y);
+}
+
+template <typename T>
+__global__ void csr5mv_scale_kernel_device_pointer(rocsparse_int m,
+                                                   const T*      beta,
+                                                   T* __restrict__ y)
+{
+    csrmv_scale_device(m, *beta, y);
+}
+
+template <typename T, unsigned int SIGMA>
+static void rocsparse_csr5mv_launch(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    const T*                  alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_csr5_mat  csr5,
+                                    const T*                  x,
+                                    T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Entries that follow the last tile
+    rocsparse_int tail_begin = csr5->num_tiles * CSR5_OMEGA * SIGMA;
+
+    dim3 csr5mv_blocks((csr5->num_tiles * CSR5_OMEGA - 1) / CSR5MV_DIM + 1);
+    dim3 csr5mv_tail_blocks((csr5->m - csr5->tail_row - 1) / CSR5MV_DIM + 1);
+    dim3 csr5mv_threads(CSR5MV_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(trans == rocsparse_operation_none)
+        {
+            if(csr5->num_tiles > 0)
+            {
+                hipLaunchKernelGGL((csr5mvn_kernel_device_pointer<T, CSR5MV_DIM, SIGMA>),
+                                   csr5mv_blocks,
+                                   csr5mv_threads,
+                                   0,
+                                   stream,
+                                   csr5->num_tiles,
+                                   alpha,
+                                   csr5->row_ptr,
+                                   csr5->tile_ptr,
+                                   csr5->tile_flag,
+                                   csr5->tile_offset,
+                                   csr5->col_ind,
+                                   (const T*)csr5->val,
+                                   x,
+                                   y,
+                                   descr->base);
+            }
+
+            if(csr5->m > csr5->tail_row)
+            {
+                hipLaunchKernelGGL((csr5mvn_tail_kernel_device_pointer<T>),
+                                   csr5mv_tail_blocks,
+                                   csr5mv_threads,
+                                   0,
+                                   stream,
+                                   csr5->m,
+                                   csr5->tail_row,
+                                   tail_begin,
+                                   alpha,
+                                   csr5->row_ptr,
+                                   csr5->col_ind,
+                                   (const T*)csr5->val,
+                                   x,
+                                   y,
+                                   descr->base);
+            }
+        }
+        else
+        {
+            if(csr5->num_tiles > 0)
+            {
+                hipLaunchKernelGGL((csr5mvt_kernel_device_pointer<T, SIGMA>),
+                                   csr5mv_blocks,
+                                   csr5mv_threads,
+                                   0,
+                                   stream,
+                                   csr5->num_tiles,
+                                   alpha,
+                                   csr5->row_ptr,
+                                   csr5->tile_ptr,
+                                   csr5->tile_flag,
+                                   csr5->tile_offset,
+                                   csr5->col_ind,
+                                   (const T*)csr5->val,
+                                   x,
+                                   y,
+                                   descr->base);
+            }
+
+            if(csr5->m > csr5->tail_row)
+            {
+                hipLaunchKernelGGL((csr5mvt_tail_kernel_device_pointer<T>),
+                                   csr5mv_tail_blocks,
+                                   csr5mv_threads,
+                                   0,
+                                   stream,
+                                   csr5->m,
+                                   csr5->tail_row,
+                                   tail_begin,
+                                   alpha,
+                                   csr5->row_ptr,
+                                   csr5->col_ind,
+                                   (const T*)csr5->val,
+                                   x,
+                                   y,
+                                   descr->base);
+            }
+        }
+    }
+    else
+    {
+        if(trans == rocsparse_operation_none)
+        {
+            if(csr5->num_tiles > 0)
+            {
+                hipLaunchKernelGGL((csr5mvn_kernel_host_pointer<T, CSR5MV_DIM, SIGMA>),
+                                   csr5mv_blocks,
+                                   csr5mv_threads,
+                                   0,
+                                   stream,
+                                   csr5->num_tiles,
+                                   *alpha,
+                                   csr5->row_ptr,
+                                   csr5->tile_ptr,
+                                   csr5->tile_flag,
+                                   csr5->tile_offset,
+                                   csr5->col_ind,
+                                   (const T*)csr5->val,
+                                   x,
+                                   y,
+                                   descr->base);
+            }
+
+            if(csr5->m > csr5->tail_row)
+            {
+                hipLaunchKernelGGL((csr5mvn_tail_kernel_host_pointer<T>),
+                                   csr5mv_tail_blocks,
+                                   csr5mv_threads,
+                                   0,
+                                   stream,
+                                   csr5->m,
+                                   csr5->tail_row,
+                                   tail_begin,
+                                   *alpha,
+                                   csr5->row_ptr,
+                                   csr5->col_ind,
+                                   (const T*)csr5->val,
+                                   x,
+                                   y,
+                                   descr->base);
+            }
+        }
+        else
+        {
+            if(csr5->num_tiles > 0)
+            {
+                hipLaunchKernelGGL((csr5mvt_kernel_host_pointer<T, SIGMA>),
+                                   csr5mv_blocks,
+                                   csr5mv_threads,
+                                   0,
+                                   stream,
+                                   csr5->num_tiles,
+                                   *alpha,
+                                   csr5->row_ptr,
+                                   csr5->tile_ptr,
+                                   csr5->tile_flag,
+                                   csr5->tile_offset,
+                                   csr5->col_ind,
+                                   (const T*)csr5->val,
+                                   x,
+                                   y,
+                                   descr->base);
+            }
+
+            if(csr5->m > csr5->tail_row)
+            {
+                hipLaunchKernelGGL((csr5mvt_tail_kernel_host_pointer<T>),
+                                   csr5mv_tail_blocks,
+                                   csr5mv_threads,
+                                   0,
+                                   stream,
+                                   csr5->m,
+                                   csr5->tail_row,
+                                   tail_begin,
+                                   *alpha,
+                                   csr5->row_ptr,
+                                   csr5->col_ind,
+                                   (const T*)csr5->val,
+                                   x,
+                                   y,
+                                   descr->base);
+            }
+        }
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr5mv_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_csr5_mat  csr5,
+                                           const T*                  x,
+                                           const T*                  beta,
+                                           T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr5 == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsr5mv"),
+                  trans,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr5,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csr5mv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsr5mv"),
+                  trans,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr5,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(csr5->m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csr5->n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csr5->nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check CSR5 structure
+    if(csr5->nnz > 0)
+    {
+        if(csr5->sigma != 8 && csr5->sigma != 16 && csr5->sigma != 32)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(csr5->row_ptr == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(csr5->col_ind == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(csr5->val == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Check pointer arguments
+    if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(csr5->m == 0 || csr5->n == 0 || csr5->nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // y = beta * y, where y has m entries (op(A) == A) or n entries (op(A) == A^T)
+    rocsparse_int size = (trans == rocsparse_operation_none) ? csr5->m : csr5->n;
+
+    dim3 csr5mv_scale_blocks((size - 1) / CSR5MV_DIM + 1);
+    dim3 csr5mv_scale_threads(CSR5MV_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csr5mv_scale_kernel_device_pointer<T>),
+                           csr5mv_scale_blocks,
+                           csr5mv_scale_threads,
+                           0,
+                           stream,
+                           size,
+                           beta,
+                           y);
+    }
+    else
+    {
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        if(*beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((csr5mv_scale_kernel_host_pointer<T>),
+                               csr5mv_scale_blocks,
+                               csr5mv_scale_threads,
+                               0,
+                               stream,
+                               size,
+                               *beta,
+                               y);
+        }
+
+        if(*alpha == static_cast<T>(0))
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // y += alpha * op(A) * x, op(A) = A^T = A^H for real types
+    if(csr5->sigma == 8)
+    {
+        rocsparse_csr5mv_launch<T, 8>(handle, trans, alpha, descr, csr5, x, y);
+    }
+    else if(csr5->sigma == 16)
+    {
+        rocsparse_csr5mv_launch<T, 16>(handle, trans, alpha, descr, csr5, x, y);
+    }
+    else
+    {
+        rocsparse_csr5mv_launch<T, 32>(handle, trans, alpha, descr, csr5, x, y);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR5MV_HPP
@@ -27,11 +27,18 @@
 
 #include "rocsparse.h"
 
+#include "csr_hash.h"
 #include "csrmv_device.h"
+#include "definitions.h"
 #include "handle.h"
 #include "utility.h"
 
+#include <algorithm>
 #include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+#include <system_error>
+#include <thread>
+#include <vector>
 
 #define BLOCKSIZE 1024
 #define BLOCK_MULTIPLIER 3
@@ -40,256 +47,703 @@
 #define ROW_BITS 32
 #define WG_SIZE 256
 
-__attribute__((unused)) static unsigned int flp2(unsigned int x)
+// Device row block analysis
+#define ROW_BLOCKS_DIM 256
+#define ROW_BLOCKS_STITCH_DIM 1024
+#define ROW_BLOCKS_MIN_CHUNK 512
+
+// Symmetric csrmv
+#define CSRMV_SYMM_GATHER_DIM 512
+
+// Transposed csrmv
+#define CSRMVT_DIM 256
+#define CSRMVT_COUNT_DIM 256
+#define CSRMVT_LDS_BYTES 32768
+#define CSRMVT_LDS_MIN_COL_NNZ 16
+
+// Merge path csrmv
+#define CSRMV_MERGE_DIM 256
+#define CSRMV_MERGE_ITEMS 8
+#define CSRMV_MERGE_FIXUP_DIM 256
+
+// Appends the row blocks that start in [first, last) to row_blocks, following
+// the row block chain that starts at row first. Returns the first row block
+// start that is not smaller than last.
+static rocsparse_int csrmv_row_blocks_chunk(const rocsparse_int*             csr_row_ptr,
+                                            rocsparse_int                    m,
+                                            rocsparse_int                    first,
+                                            rocsparse_int                    last,
+                                            std::vector<unsigned long long>& row_blocks)
 {
-    x |= (x >> 1);
-    x |= (x >> 2);
-    x |= (x >> 4);
-    x |= (x >> 8);
-    x |= (x >> 16);
-    return x - (x >> 1);
-}
+    while(first < last)
+    {
+        unsigned long long bits;
+        rocsparse_int      extra_wg;
+        rocsparse_int      next
+            = csrmv_row_block_next<BLOCKSIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_BITS, WG_SIZE>(
+                csr_row_ptr, m, first, bits, extra_wg);
 
-// Short rows in CSR-Adaptive are batched together into a single row block.
-// If there are a relatively small number of these, then we choose to do
-// a horizontal reduction (groups of threads all reduce the same row).
-// If there are many threads (e.g. more threads than the maximum size
-// of our workgroup) then we choose to have each thread serially reduce
-// the row.
-// This function calculates the number of threads that could team up
-// to reduce these groups of rows. For instance, if you have a
-// workgroup size of 256 and 4 rows, you could have 64 threads
-// working on each row. If you have 5 rows, only 32 threads could
-// reliably work on each row because our reduction assumes power-of-2.
-static unsigned long long numThreadsForReduction(unsigned long long num_rows)
-{
-#if defined(__INTEL_COMPILER)
-    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
-    || !defined(__clang) && defined(__GNUG__)             \
-           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-    unsigned long long bit_returned;
-    _BitScanReverse(&bit_returned, (num_rows - 1));
-    return WG_SIZE >> (bit_returned + 1);
-#else
-    return flp2(WG_SIZE / num_rows);
-#endif
+        row_blocks.push_back((static_cast<unsigned long long>(first) << (64 - ROW_BITS)) | bits);
+
+        for(rocsparse_int w = 1; w <= extra_wg; ++w)
+        {
+            row_blocks.push_back((static_cast<unsigned long long>(first) << (64 - ROW_BITS))
+                                 | static_cast<unsigned long long>(w));
+        }
+
+        first = next;
+    }
+
+    return first;
 }
 
-static void ComputeRowBlocks(unsigned long long*  rowBlocks,
-                             size_t&              rowBlockSize,
-                             const rocsparse_int* rowDelimiters,
-                             rocsparse_int        nRows,
-                             bool                 allocate_row_blocks = true)
+// Returns the position of the row block entry that starts at row, or the size of
+// row_blocks if no row block starts at row.
+static size_t csrmv_row_blocks_find(const std::vector<unsigned long long>& row_blocks,
+                                    rocsparse_int                          row)
 {
-    unsigned long long* rowBlocksBase;
+    unsigned long long key = static_cast<unsigned long long>(row) << (64 - ROW_BITS);
 
-    // Start at one because of rowBlock[0]
-    rocsparse_int total_row_blocks = 1;
+    auto it = std::lower_bound(row_blocks.begin(), row_blocks.end(), key);
 
-    if(allocate_row_blocks)
+    if(it != row_blocks.end() && (*it >> (64 - ROW_BITS)) == key >> (64 - ROW_BITS))
     {
-        rowBlocksBase = rowBlocks;
-        *rowBlocks    = 0;
-        ++rowBlocks;
+        return it - row_blocks.begin();
     }
 
-    unsigned long long sum = 0;
-    unsigned long long i;
-    unsigned long long last_i = 0;
+    return row_blocks.size();
+}
+
+// Computes the CSR-Adaptive row blocks of a host CSR row pointer array in a
+// single pass. The rows are split into chunks that are processed concurrently,
+// each chunk speculatively starting a row block at its first row. Since a row
+// block only depends on its first row, the speculative row block chain of a
+// chunk coincides with the exact one as soon as both share a row block start.
+// The chunks are then stitched together in order, recomputing only the leading
+// row blocks of a chunk up to that point, and concatenated by their prefix sum.
+// The result is identical to the serial computation.
+static void ComputeRowBlocks(std::vector<unsigned long long>& row_blocks,
+                             const rocsparse_int*             csr_row_ptr,
+                             rocsparse_int                    m,
+                             unsigned int                     num_threads = 0)
+{
+    // Minimum number of rows per chunk
+    static constexpr rocsparse_int min_chunk_rows = 4096;
 
-    // Check to ensure nRows can fit in 32 bits
-    if(static_cast<unsigned long long>(nRows)
-       > static_cast<unsigned long long>(std::pow(2, ROW_BITS)))
+    if(num_threads == 0)
     {
-        fprintf(stderr, "nrow does not fit in 32 bits\n");
-        exit(1);
+        num_threads = std::max(std::thread::hardware_concurrency(), 1U);
     }
 
-    rocsparse_int consecutive_long_rows = 0;
-    for(i = 1; i <= static_cast<unsigned long long>(nRows); ++i)
-    {
-        rocsparse_int row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-        sum += row_length;
+    rocsparse_int num_chunks = std::min(static_cast<rocsparse_int>(num_threads),
+                                        (m - 1) / min_chunk_rows + 1);
+    rocsparse_int chunk_rows = (m - 1) / num_chunks + 1;
+
+    std::vector<std::vector<unsigned long long>> chunk_blocks(num_chunks);
+    std::vector<rocsparse_int>                   chunk_exit(num_chunks);
+
+    auto compute_chunk = [&](rocsparse_int c) {
+        rocsparse_int first = c * chunk_rows;
+        rocsparse_int last  = std::min(first + chunk_rows, m);
+
+        chunk_blocks[c].reserve((csr_row_ptr[last] - csr_row_ptr[first]) / BLOCKSIZE + 16);
+        chunk_exit[c] = csrmv_row_blocks_chunk(csr_row_ptr, m, first, last, chunk_blocks[c]);
+    };
 
-        // The following section of code calculates whether you're moving between
-        // a series of "short" rows and a series of "long" rows.
-        // This is because the reduction in CSR-Adaptive likes things to be
-        // roughly the same length. Long rows can be reduced horizontally.
-        // Short rows can be reduced one-thread-per-row. Try not to mix them.
-        if(row_length > 128)
+    // Speculatively compute the row blocks of each chunk
+    std::vector<std::thread> threads;
+    threads.reserve(num_chunks - 1);
+
+    for(rocsparse_int c = 1; c < num_chunks; ++c)
+    {
+        try
         {
-            ++consecutive_long_rows;
+            threads.emplace_back(compute_chunk, c);
         }
-        else if(consecutive_long_rows > 0)
+        catch(const std::system_error&)
         {
-            // If it turns out we WERE in a long-row region, cut if off now.
-            if(row_length < 32) // Now we're in a short-row region
-            {
-                consecutive_long_rows = -1;
-            }
-            else
-            {
-                consecutive_long_rows++;
-            }
+            // Process the chunk on the calling thread, if no thread can be spawned
+            compute_chunk(c);
         }
+    }
 
-        // If you just entered into a "long" row from a series of short rows,
-        // then we need to make sure we cut off those short rows. Put them in
-        // their own workgroup.
-        if(consecutive_long_rows == 1)
-        {
-            // Assuming there *was* a previous workgroup. If not, nothing to do here.
-            if(i - last_i > 1)
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = ((i - 1) << (64 - ROW_BITS));
+    // First chunk starts at row 0, which is always exact
+    compute_chunk(0);
 
-                    // If this row fits into CSR-Stream, calculate how many rows
-                    // can be used to do a parallel reduction.
-                    // Fill in the low-order bits with the numThreadsForRed
-                    if(((i - 1) - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                    {
-                        *(rowBlocks - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
+    for(auto& t : threads)
+    {
+        t.join();
+    }
 
-                    ++rowBlocks;
-                }
+    // Stitch the chunks together
+    rocsparse_int entry = chunk_exit[0];
 
-                ++total_row_blocks;
-                last_i = i - 1;
-                sum    = row_length;
-            }
+    for(rocsparse_int c = 1; c < num_chunks; ++c)
+    {
+        rocsparse_int last = std::min((c + 1) * chunk_rows, m);
+
+        std::vector<unsigned long long>& blocks = chunk_blocks[c];
+
+        // entry is the first exact row block start within or beyond this chunk
+        size_t pos = (entry < last) ? csrmv_row_blocks_find(blocks, entry) : blocks.size();
+
+        if(pos < blocks.size())
+        {
+            // Speculation was successful from entry on
+            blocks.erase(blocks.begin(), blocks.begin() + pos);
+            entry = chunk_exit[c];
+
+            continue;
         }
-        else if(consecutive_long_rows == -1)
+
+        // Recompute the row blocks until they meet the speculative ones
+        std::vector<unsigned long long> exact;
+
+        while(entry < last)
         {
-            // We see the first short row after some long ones that
-            // didn't previously fill up a row block.
-            if(allocate_row_blocks)
+            entry = csrmv_row_blocks_chunk(csr_row_ptr, m, entry, entry + 1, exact);
+
+            if(entry < last)
             {
-                *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-                if(((i - 1) - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
+                pos = csrmv_row_blocks_find(blocks, entry);
+
+                if(pos < blocks.size())
                 {
-                    *(rowBlocks - 1) |= numThreadsForReduction((i - 1) - last_i);
-                }
+                    exact.insert(exact.end(), blocks.begin() + pos, blocks.end());
+                    entry = chunk_exit[c];
 
-                ++rowBlocks;
+                    break;
+                }
             }
-
-            ++total_row_blocks;
-            last_i                = i - 1;
-            sum                   = row_length;
-            consecutive_long_rows = 0;
         }
 
-        // Now, what's up with this row? What did it do?
+        blocks.swap(exact);
+    }
 
-        // exactly one row results in non-zero elements to be greater than blockSize
-        // This is csr-vector case; bottom WGBITS == workgroup ID
-        if((i - last_i == 1) && sum > static_cast<unsigned long long>(BLOCKSIZE))
-        {
-            rocsparse_int numWGReq = static_cast<rocsparse_int>(
-                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCKSIZE)));
+    // Compute chunk offsets
+    std::vector<size_t> offset(num_chunks + 1, 0);
+
+    for(rocsparse_int c = 0; c < num_chunks; ++c)
+    {
+        offset[c + 1] = offset[c] + chunk_blocks[c].size();
+    }
 
-            // Check to ensure #workgroups can fit in WGBITS bits, if not
-            // then the last workgroup will do all the remaining work
-            numWGReq = (numWGReq < static_cast<rocsparse_int>(std::pow(2, WG_BITS)))
-                           ? numWGReq
-                           : static_cast<rocsparse_int>(std::pow(2, WG_BITS));
+    // Concatenate the chunks, the last row block entry terminates the last row block
+    row_blocks.resize(offset[num_chunks] + 1);
+    row_blocks[offset[num_chunks]] = static_cast<unsigned long long>(m) << (64 - ROW_BITS);
 
-            if(allocate_row_blocks)
-            {
-                for(rocsparse_int w = 1; w < numWGReq; ++w)
-                {
-                    *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-                    *rowBlocks |= static_cast<unsigned long long>(w);
-                    ++rowBlocks;
-                }
+    auto copy_chunk = [&](rocsparse_int c) {
+        std::copy(chunk_blocks[c].begin(), chunk_blocks[c].end(), row_blocks.begin() + offset[c]);
+    };
 
-                *rowBlocks = (i << (64 - ROW_BITS));
-                ++rowBlocks;
-            }
+    threads.clear();
 
-            total_row_blocks += numWGReq;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
+    for(rocsparse_int c = 1; c < num_chunks; ++c)
+    {
+        try
+        {
+            threads.emplace_back(copy_chunk, c);
         }
-        // more than one row results in non-zero elements to be greater than blockSize
-        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
-        else if((i - last_i > 1) && sum > static_cast<unsigned long long>(BLOCKSIZE))
+        catch(const std::system_error&)
         {
-            // This row won't fit, so back off one.
-            --i;
+            copy_chunk(c);
+        }
+    }
 
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = (i << (64 - ROW_BITS));
-                if((i - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-                }
+    copy_chunk(0);
 
-                ++rowBlocks;
-            }
+    for(auto& t : threads)
+    {
+        t.join();
+    }
+}
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
-        else if(sum == static_cast<unsigned long long>(BLOCKSIZE))
-        {
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = (i << (64 - ROW_BITS));
-                if((i - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-                }
+template <rocsparse_int BLOCKDIM>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmv_row_blocks_speculate_kernel(rocsparse_int m,
+                                           rocsparse_int chunk_size,
+                                           rocsparse_int num_chunks,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           rocsparse_int* __restrict__ spec_exit,
+                                           rocsparse_int* __restrict__ spec_count,
+                                           rocsparse_int* __restrict__ count)
+{
+    csrmv_row_blocks_speculate_device<BLOCKSIZE,
+                                      BLOCK_MULTIPLIER,
+                                      ROWS_FOR_VECTOR,
+                                      WG_BITS,
+                                      WG_SIZE>(
+        m, chunk_size, num_chunks, csr_row_ptr, spec_exit, spec_count, count);
+}
 
-                ++rowBlocks;
-            }
+template <rocsparse_int BLOCKDIM>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmv_row_blocks_stitch_kernel(rocsparse_int m,
+                                        rocsparse_int chunk_size,
+                                        rocsparse_int num_chunks,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ spec_exit,
+                                        const rocsparse_int* __restrict__ spec_count,
+                                        rocsparse_int* __restrict__ chunk_entry,
+                                        rocsparse_int* __restrict__ chunk_exit,
+                                        rocsparse_int* __restrict__ count)
+{
+    csrmv_row_blocks_stitch_device<BLOCKDIM,
+                                   BLOCKSIZE,
+                                   BLOCK_MULTIPLIER,
+                                   ROWS_FOR_VECTOR,
+                                   WG_BITS,
+                                   WG_SIZE>(m,
+                                            chunk_size,
+                                            num_chunks,
+                                            csr_row_ptr,
+                                            spec_exit,
+                                            spec_count,
+                                            chunk_entry,
+                                            chunk_exit,
+                                            count);
+}
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
+template <rocsparse_int BLOCKDIM>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmv_row_blocks_fill_kernel(rocsparse_int m,
+                                      rocsparse_int chunk_size,
+                                      rocsparse_int num_chunks,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ chunk_entry,
+                                      const rocsparse_int* __restrict__ offset,
+                                      unsigned long long* __restrict__ row_blocks,
+                                      size_t* __restrict__ size)
+{
+    csrmv_row_blocks_fill_device<BLOCKSIZE,
+                                 BLOCK_MULTIPLIER,
+                                 ROWS_FOR_VECTOR,
+                                 WG_BITS,
+                                 ROW_BITS,
+                                 WG_SIZE>(
+        m, chunk_size, num_chunks, csr_row_ptr, chunk_entry, offset, row_blocks, size);
+}
+
+// Column histogram of the sparsity pattern, the maximum number of entries per
+// column is accumulated into max_count
+template <rocsparse_int BLOCKDIM>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmvt_column_count_kernel(rocsparse_int        nnz,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_index_base idx_base,
+                                    rocsparse_int* __restrict__ count,
+                                    rocsparse_int* __restrict__ max_count)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKDIM + tid;
+
+    __shared__ rocsparse_int sdata[BLOCKDIM];
+
+    rocsparse_int local_max = 0;
+
+    for(rocsparse_int j = gid; j < nnz; j += hipGridDim_x * BLOCKDIM)
+    {
+        local_max = max(local_max, atomicAdd(count + csr_col_ind[j] - idx_base, 1) + 1);
     }
 
-    // If we didn't fill a row block with the last row, make sure we don't lose it.
-    if(allocate_row_blocks
-       && (*(rowBlocks - 1) >> (64 - ROW_BITS)) != static_cast<unsigned long long>(nRows))
+    sdata[tid] = local_max;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_max<rocsparse_int, BLOCKDIM>(tid, sdata);
+
+    if(tid == 0)
     {
-        *rowBlocks = (static_cast<unsigned long long>(nRows) << (64 - ROW_BITS));
-        if((nRows - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-        {
-            *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-        }
+        atomicMax(max_count, sdata[0]);
+    }
+}
+
+// Row index of each entry of the transposed triangle, given its position in the
+// csr arrays and the row index of each entry of the csr arrays
+template <rocsparse_int BLOCKDIM>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmv_symm_gather_kernel(rocsparse_int nnz,
+                                  const rocsparse_int* __restrict__ perm,
+                                  const rocsparse_int* __restrict__ coo_row_ind,
+                                  rocsparse_int* __restrict__ symm_row_ind)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKDIM + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    symm_row_ind[gid] = coo_row_ind[perm[gid]];
+}
+
+// Computes the row blocks on the host, requires the row pointer array to be
+// copied to the host
+static rocsparse_status rocsparse_csrmv_analysis_host(rocsparse_handle     handle,
+                                                      rocsparse_int        m,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      rocsparse_csrmv_info info)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Temporary arrays to hold device data
+    std::vector<rocsparse_int> hptr(m + 1);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hptr.data(), csr_row_ptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Create row blocks structure
+    std::vector<unsigned long long> row_blocks;
+    ComputeRowBlocks(row_blocks, hptr.data(), m);
+
+    // We're multiplying the size by two because the extended precision form of
+    // CSR-Adaptive requires more space for the final global reduction.
+    info->size = 2 * row_blocks.size();
+
+    // Allocate memory on device to hold csrmv info
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->row_blocks, sizeof(unsigned long long) * info->size));
+
+    // Copy row blocks information to device
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->row_blocks,
+                                       row_blocks.data(),
+                                       sizeof(unsigned long long) * row_blocks.size(),
+                                       hipMemcpyHostToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(info->row_blocks + row_blocks.size(),
+                                       0,
+                                       sizeof(unsigned long long) * row_blocks.size(),
+                                       stream));
 
-        ++rowBlocks;
+    // Wait for device transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+// Computes the row blocks on the device, without any host synchronization. The
+// row blocks are identical to the ones computed on the host. Their number is
+// written to the device and fetched by the first csrmv call that requires it.
+static rocsparse_status rocsparse_csrmv_analysis_device(rocsparse_handle     handle,
+                                                        rocsparse_int        m,
+                                                        rocsparse_int        nnz,
+                                                        const rocsparse_int* csr_row_ptr,
+                                                        rocsparse_csrmv_info info)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Each row block holds at least one row. Apart from the last one, each row block
+    // is either adjacent to a long row, or holds more than BLOCKSIZE non-zero entries
+    // together with the first row of its successor. Multiple workgroups per row add
+    // at most one entry per BLOCK_MULTIPLIER * BLOCKSIZE non-zero entries.
+    size_t max_row_blocks = std::min(static_cast<size_t>(m) + 1, static_cast<size_t>(nnz) / 32 + 2)
+                            + static_cast<size_t>(nnz) / (BLOCK_MULTIPLIER * BLOCKSIZE) + 1;
+
+    // Allocate memory on device to hold csrmv info
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->row_blocks,
+                                  sizeof(unsigned long long) * 2 * max_row_blocks));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->device_size, sizeof(size_t)));
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(
+        info->row_blocks, 0, sizeof(unsigned long long) * 2 * max_row_blocks, stream));
+
+    // Each chunk requires six integers of temporary storage, the number of chunks
+    // is chosen such that they fit into the device buffer, if possible
+    rocsparse_int max_chunks
+        = static_cast<rocsparse_int>(handle->buffer_size / 2 / (6 * sizeof(rocsparse_int)));
+    rocsparse_int chunk_size
+        = std::max((m - 1) / max_chunks + 1, static_cast<rocsparse_int>(ROW_BLOCKS_MIN_CHUNK));
+    rocsparse_int num_chunks = (m - 1) / chunk_size + 1;
+
+    // Temporary storage sizes
+    size_t chunk_bytes = ((sizeof(rocsparse_int) * (num_chunks + 1) - 1) / 256 + 1) * 256;
+    size_t rocprim_size;
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                (rocsparse_int*)nullptr,
+                                                (rocsparse_int*)nullptr,
+                                                0,
+                                                num_chunks + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    size_t temp_bytes = 6 * chunk_bytes + rocprim_size;
+
+    // Get temporary storage
+    bool  temp_alloc;
+    char* ptr;
+
+    // Device buffer should be sufficient in most cases
+    if(handle->buffer_size >= temp_bytes)
+    {
+        ptr        = reinterpret_cast<char*>(handle->buffer);
+        temp_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&ptr, temp_bytes));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* spec_exit   = reinterpret_cast<rocsparse_int*>(ptr);
+    rocsparse_int* spec_count  = reinterpret_cast<rocsparse_int*>(ptr + chunk_bytes);
+    rocsparse_int* chunk_entry = reinterpret_cast<rocsparse_int*>(ptr + 2 * chunk_bytes);
+    rocsparse_int* chunk_exit  = reinterpret_cast<rocsparse_int*>(ptr + 3 * chunk_bytes);
+    rocsparse_int* count       = reinterpret_cast<rocsparse_int*>(ptr + 4 * chunk_bytes);
+    rocsparse_int* offset      = reinterpret_cast<rocsparse_int*>(ptr + 5 * chunk_bytes);
+    void*          rocprim_buffer = reinterpret_cast<void*>(ptr + 6 * chunk_bytes);
+
+    dim3 row_blocks_blocks((num_chunks - 1) / ROW_BLOCKS_DIM + 1);
+    dim3 row_blocks_threads(ROW_BLOCKS_DIM);
+
+    // Speculative row blocks of each chunk
+    hipLaunchKernelGGL((csrmv_row_blocks_speculate_kernel<ROW_BLOCKS_DIM>),
+                       row_blocks_blocks,
+                       row_blocks_threads,
+                       0,
+                       stream,
+                       m,
+                       chunk_size,
+                       num_chunks,
+                       csr_row_ptr,
+                       spec_exit,
+                       spec_count,
+                       count);
+
+    // Stitch chunks together
+    hipLaunchKernelGGL((csrmv_row_blocks_stitch_kernel<ROW_BLOCKS_STITCH_DIM>),
+                       dim3(1),
+                       dim3(ROW_BLOCKS_STITCH_DIM),
+                       0,
+                       stream,
+                       m,
+                       chunk_size,
+                       num_chunks,
+                       csr_row_ptr,
+                       spec_exit,
+                       spec_count,
+                       chunk_entry,
+                       chunk_exit,
+                       count);
+
+    // Exclusive sum to obtain the row block offset of each chunk
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                count,
+                                                offset,
+                                                0,
+                                                num_chunks + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Write row blocks
+    hipLaunchKernelGGL((csrmv_row_blocks_fill_kernel<ROW_BLOCKS_DIM>),
+                       row_blocks_blocks,
+                       row_blocks_threads,
+                       0,
+                       stream,
+                       m,
+                       chunk_size,
+                       num_chunks,
+                       csr_row_ptr,
+                       chunk_entry,
+                       offset,
+                       info->row_blocks,
+                       info->device_size);
+
+    if(temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
     }
 
-    ++total_row_blocks;
+    return rocsparse_status_success;
+}
+
+// Transposes the sparsity pattern of a symmetric matrix, such that the mirrored
+// entries of the stored triangle can be gathered by their row instead of being
+// scattered into y. The values are not copied, but referenced by their position in
+// the csr arrays, which keeps the meta data valid if only the values change.
+static rocsparse_status rocsparse_csrmv_symm_analysis(rocsparse_handle     handle,
+                                                      rocsparse_int        m,
+                                                      rocsparse_int        nnz,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_index_base idx_base,
+                                                      rocsparse_csrmv_info info)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Allocate memory on device to hold csrmv info
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->symm_col_ptr, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->symm_row_ind, sizeof(rocsparse_int) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->symm_perm, sizeof(rocsparse_int) * nnz));
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(m);
 
-    if(allocate_row_blocks)
+    // Temporary storage sizes
+    size_t nnz_bytes = ((sizeof(rocsparse_int) * nnz - 1) / 256 + 1) * 256;
+    size_t rocprim_size;
+
+    rocprim::double_buffer<rocsparse_int> dummy(nullptr, nullptr);
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, dummy, dummy, nnz, startbit, endbit, stream));
+
+    size_t temp_bytes = 3 * nnz_bytes + rocprim_size;
+
+    // Get temporary storage
+    bool  temp_alloc;
+    char* ptr;
+
+    // Device buffer might be sufficient for small matrices
+    if(handle->buffer_size >= temp_bytes)
     {
-        size_t dist = std::distance(rowBlocksBase, rowBlocks);
-        assert((2 * dist) <= rowBlockSize);
-        // Update the size of rowBlocks to reflect the actual amount of memory used
-        // We're multiplying the size by two because the extended precision form of
-        // CSR-Adaptive requires more space for the final global reduction.
-        rowBlockSize = 2 * dist;
+        ptr        = reinterpret_cast<char*>(handle->buffer);
+        temp_alloc = false;
     }
     else
     {
-        rowBlockSize = 2 * total_row_blocks;
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&ptr, temp_bytes));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* tmp_work1      = reinterpret_cast<rocsparse_int*>(ptr);
+    rocsparse_int* tmp_work2      = reinterpret_cast<rocsparse_int*>(ptr + nnz_bytes);
+    rocsparse_int* tmp_work3      = reinterpret_cast<rocsparse_int*>(ptr + 2 * nnz_bytes);
+    void*          rocprim_buffer = reinterpret_cast<void*>(ptr + 3 * nnz_bytes);
+
+    // Stable sort the entries by column, keeping track of their position
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz, tmp_work3));
+
+    rocprim::double_buffer<rocsparse_int> keys(tmp_work1, tmp_work2);
+    rocprim::double_buffer<rocsparse_int> vals(tmp_work3, info->symm_perm);
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+
+    if(vals.current() != info->symm_perm)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->symm_perm,
+                                           vals.current(),
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+
+    // Column pointers of the transposed pattern
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, keys.current(), nnz, m, info->symm_col_ptr, idx_base));
+
+    // Row indices of the transposed pattern
+    rocsparse_int* coo_row_ind = (keys.current() == tmp_work1) ? tmp_work2 : tmp_work1;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, coo_row_ind, idx_base));
+
+    hipLaunchKernelGGL((csrmv_symm_gather_kernel<CSRMV_SYMM_GATHER_DIM>),
+                       dim3((nnz - 1) / CSRMV_SYMM_GATHER_DIM + 1),
+                       dim3(CSRMV_SYMM_GATHER_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       info->symm_perm,
+                       coo_row_ind,
+                       info->symm_row_ind);
+
+    if(temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+// Selects the transposed csrmv strategy from the number of columns and the number of
+// entries per column. A private copy of y in LDS requires y to fit into LDS, and only
+// pays off if the columns are long enough for the global atomics to contend.
+template <typename T>
+static rocsparse_csrmvt_alg rocsparse_csrmvt_select_alg(rocsparse_int n, rocsparse_int col_nnz)
+{
+    if(n <= static_cast<rocsparse_int>(CSRMVT_LDS_BYTES / sizeof(T))
+       && col_nnz >= CSRMVT_LDS_MIN_COL_NNZ)
+    {
+        return rocsparse_csrmvt_alg_lds;
+    }
+
+    return rocsparse_csrmvt_alg_atomic;
+}
+
+// Determines the transposed csrmv strategy. In host analysis mode, the strategy
+// is chosen from the longest column of the matrix, which requires the column
+// histogram to be computed on the device. Otherwise, the average number of entries
+// per column is used, to keep the analysis free of host synchronization.
+template <typename T>
+static rocsparse_status rocsparse_csrmvt_analysis(rocsparse_handle          handle,
+                                                  rocsparse_int             n,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_csrmv_info      info)
+{
+    rocsparse_int col_nnz = nnz / n;
+
+    // The longest column is only of interest, if y fits into LDS
+    if(handle->analysis_mode == rocsparse_analysis_mode_host
+       && rocsparse_csrmvt_select_alg<T>(n, CSRMVT_LDS_MIN_COL_NNZ) == rocsparse_csrmvt_alg_lds)
+    {
+        // Stream
+        hipStream_t stream = handle->stream;
+
+        // The column counts and their maximum always fit into the device buffer
+        rocsparse_int* count     = reinterpret_cast<rocsparse_int*>(handle->buffer);
+        rocsparse_int* max_count = count + n;
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(count, 0, sizeof(rocsparse_int) * (n + 1), stream));
+
+        hipLaunchKernelGGL((csrmvt_column_count_kernel<CSRMVT_COUNT_DIM>),
+                           dim3((nnz - 1) / CSRMVT_COUNT_DIM + 1),
+                           dim3(CSRMVT_COUNT_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           csr_col_ind,
+                           descr->base,
+                           count,
+                           max_count);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &col_nnz, max_count, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    info->trans_alg = rocsparse_csrmvt_select_alg<T>(n, col_nnz);
+
+    return rocsparse_status_success;
+}
+
+// Chooses the csrmv algorithm, if no analysis meta data is available. Without
+// analysis, only the average row length is known, which cannot tell a few very long
+// rows from uniformly long ones. Inspecting the row lengths would require a host
+// synchronization, thus the row algorithm is used by default and the merge algorithm
+// has to be selected explicitly.
+static rocsparse_csrmv_alg rocsparse_csrmv_select_alg(rocsparse_handle handle)
+{
+    if(handle->csrmv_alg != rocsparse_csrmv_alg_auto)
+    {
+        return handle->csrmv_alg;
     }
+
+    return rocsparse_csrmv_alg_row;
 }
 
 template <typename T>
@@ -336,7 +790,9 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric
+       && descr->type != rocsparse_matrix_type_hermitian)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -356,6 +812,12 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and Hermitian matrices must be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
@@ -376,49 +838,57 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
-    // Clear csrmv info
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
-
-    // Create csrmv info
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
-
-    // Stream
-    hipStream_t stream = handle->stream;
+    // Structural hash of the sparsity pattern. It is only computed, if the user
+    // asks for re-use of the meta data, as it requires a host synchronization.
+    unsigned long long hash = 0;
 
-    // row blocks size
-    info->csrmv_info->size = 0;
+    if(handle->analysis_policy == rocsparse_analysis_policy_reuse)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, &hash));
 
-    // Temporary arrays to hold device data
-    std::vector<rocsparse_int> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        hptr.data(), csr_row_ptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToHost, stream));
+        // If meta data of the same sparsity pattern is already available, re-use it
+        rocsparse_csrmv_info csrmv = info->csrmv_info;
 
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        if(csrmv != nullptr && csrmv->hash != 0 && csrmv->hash == hash && csrmv->trans == trans
+           && csrmv->m == m && csrmv->n == n && csrmv->nnz == nnz
+           && (csrmv->symm_col_ptr != nullptr) == (descr->type != rocsparse_matrix_type_general))
+        {
+            csrmv->descr       = descr;
+            csrmv->csr_row_ptr = csr_row_ptr;
+            csrmv->csr_col_ind = csr_col_ind;
 
-    // Determine row blocks array size
-    ComputeRowBlocks((unsigned long long*)NULL, info->csrmv_info->size, hptr.data(), m, false);
+            return rocsparse_status_success;
+        }
+    }
 
-    // Create row blocks structure
-    std::vector<unsigned long long> row_blocks(info->csrmv_info->size, 0);
+    // Clear csrmv info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
 
-    ComputeRowBlocks(row_blocks.data(), info->csrmv_info->size, hptr.data(), m, true);
+    // Create csrmv info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
 
-    // Allocate memory on device to hold csrmv info, if required
-    if(info->csrmv_info->size > 0)
+    // Compute row blocks, the transposed triangle of a symmetric matrix, or the
+    // strategy of the transposed product
+    if(descr->type != rocsparse_matrix_type_general)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->row_blocks,
-                                      sizeof(unsigned long long) * info->csrmv_info->size));
-
-        // Copy row blocks information to device
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->row_blocks,
-                                           row_blocks.data(),
-                                           sizeof(unsigned long long) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_symm_analysis(
+            handle, m, nnz, csr_row_ptr, csr_col_ind, descr->base, info->csrmv_info));
+    }
+    else if(trans != rocsparse_operation_none)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrmvt_analysis<T>(handle, n, nnz, descr, csr_col_ind, info->csrmv_info));
+    }
+    else if(handle->analysis_mode == rocsparse_analysis_mode_device)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis_device(handle, m, nnz, csr_row_ptr, info->csrmv_info));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis_host(handle, m, csr_row_ptr, info->csrmv_info));
     }
 
     // Store some pointers to verify correct execution
@@ -429,6 +899,7 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     info->csrmv_info->descr       = descr;
     info->csrmv_info->csr_row_ptr = csr_row_ptr;
     info->csrmv_info->csr_col_ind = csr_col_ind;
+    info->csrmv_info->hash        = hash;
 
     return rocsparse_status_success;
 }
@@ -464,22 +935,252 @@ __global__ void csrmvn_general_kernel_device_pointer(rocsparse_int m,
 }
 
 template <typename T>
-__launch_bounds__(WG_SIZE) __global__
-    void csrmvn_adaptive_kernel_host_pointer(unsigned long long* __restrict__ row_blocks,
-                                             T alpha,
+__global__ void csrmv_scale_kernel_host_pointer(rocsparse_int m, T beta, T* __restrict__ y)
+{
+    csrmv_scale_device(m, beta, y);
+}
+
+template <typename T>
+__global__ void csrmv_scale_kernel_device_pointer(rocsparse_int m, const T* beta, T* __restrict__ y)
+{
+    csrmv_scale_device(m, *beta, y);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_symm_kernel_host_pointer(rocsparse_int m,
+                                                T             alpha,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ csr_col_ind,
+                                                const T* __restrict__ csr_val,
+                                                const T* __restrict__ x,
+                                                T* __restrict__ y,
+                                                rocsparse_fill_mode  fill_mode,
+                                                rocsparse_index_base idx_base)
+{
+    csrmvn_symm_device<T, WF_SIZE>(
+        m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, fill_mode, idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_symm_kernel_device_pointer(rocsparse_int m,
+                                                  const T*      alpha,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                                  const T* __restrict__ csr_val,
+                                                  const T* __restrict__ x,
+                                                  T* __restrict__ y,
+                                                  rocsparse_fill_mode  fill_mode,
+                                                  rocsparse_index_base idx_base)
+{
+    csrmvn_symm_device<T, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, fill_mode, idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void
+    csrmvn_symm_gather_kernel_host_pointer(rocsparse_int m,
+                                           T             alpha,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           const rocsparse_int* __restrict__ csr_col_ind,
+                                           const T* __restrict__ csr_val,
+                                           const rocsparse_int* __restrict__ symm_col_ptr,
+                                           const rocsparse_int* __restrict__ symm_row_ind,
+                                           const rocsparse_int* __restrict__ symm_perm,
+                                           const T* __restrict__ x,
+                                           T beta,
+                                           T* __restrict__ y,
+                                           rocsparse_fill_mode  fill_mode,
+                                           rocsparse_index_base idx_base)
+{
+    csrmvn_symm_gather_device<T, WF_SIZE>(m,
+                                          alpha,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          csr_val,
+                                          symm_col_ptr,
+                                          symm_row_ind,
+                                          symm_perm,
+                                          x,
+                                          beta,
+                                          y,
+                                          fill_mode,
+                                          idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void
+    csrmvn_symm_gather_kernel_device_pointer(rocsparse_int m,
+                                             const T*      alpha,
                                              const rocsparse_int* __restrict__ csr_row_ptr,
                                              const rocsparse_int* __restrict__ csr_col_ind,
                                              const T* __restrict__ csr_val,
+                                             const rocsparse_int* __restrict__ symm_col_ptr,
+                                             const rocsparse_int* __restrict__ symm_row_ind,
+                                             const rocsparse_int* __restrict__ symm_perm,
                                              const T* __restrict__ x,
-                                             T beta,
+                                             const T* beta,
                                              T* __restrict__ y,
+                                             rocsparse_fill_mode  fill_mode,
                                              rocsparse_index_base idx_base)
 {
-    csrmvn_adaptive_device<T,
-                           BLOCKSIZE,
-                           BLOCK_MULTIPLIER,
-                           ROWS_FOR_VECTOR,
-                           WG_BITS,
+    csrmvn_symm_gather_device<T, WF_SIZE>(m,
+                                          *alpha,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          csr_val,
+                                          symm_col_ptr,
+                                          symm_row_ind,
+                                          symm_perm,
+                                          x,
+                                          *beta,
+                                          y,
+                                          fill_mode,
+                                          idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvt_atomic_kernel_host_pointer(rocsparse_int m,
+                                                  T             alpha,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                                  const T* __restrict__ csr_val,
+                                                  const T* __restrict__ x,
+                                                  T* __restrict__ y,
+                                                  rocsparse_index_base idx_base)
+{
+    csrmvt_atomic_device<T, WF_SIZE>(m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvt_atomic_kernel_device_pointer(rocsparse_int m,
+                                                    const T*      alpha,
+                                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                                    const T* __restrict__ csr_val,
+                                                    const T* __restrict__ x,
+                                                    T* __restrict__ y,
+                                                    rocsparse_index_base idx_base)
+{
+    csrmvt_atomic_device<T, WF_SIZE>(m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKDIM, rocsparse_int WF_SIZE, rocsparse_int LDS_SIZE>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmvt_lds_kernel_host_pointer(rocsparse_int m,
+                                        rocsparse_int n,
+                                        T             alpha,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        const T* __restrict__ csr_val,
+                                        const T* __restrict__ x,
+                                        T* __restrict__ y,
+                                        rocsparse_index_base idx_base)
+{
+    csrmvt_lds_device<T, BLOCKDIM, WF_SIZE, LDS_SIZE>(
+        m, n, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKDIM, rocsparse_int WF_SIZE, rocsparse_int LDS_SIZE>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmvt_lds_kernel_device_pointer(rocsparse_int m,
+                                          rocsparse_int n,
+                                          const T*      alpha,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const T* __restrict__ csr_val,
+                                          const T* __restrict__ x,
+                                          T* __restrict__ y,
+                                          rocsparse_index_base idx_base)
+{
+    csrmvt_lds_device<T, BLOCKDIM, WF_SIZE, LDS_SIZE>(
+        m, n, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename T, unsigned int BLOCKDIM, unsigned int ITEMS>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmvn_merge_kernel_host_pointer(rocsparse_int m,
+                                          rocsparse_int nnz,
+                                          T             alpha,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const T* __restrict__ csr_val,
+                                          const T* __restrict__ x,
+                                          T beta,
+                                          T* __restrict__ y,
+                                          rocsparse_int* __restrict__ carry_row,
+                                          T* __restrict__ carry_val,
+                                          rocsparse_index_base idx_base)
+{
+    csrmvn_merge_device<T, BLOCKDIM, ITEMS>(m,
+                                            nnz,
+                                            alpha,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            x,
+                                            beta,
+                                            y,
+                                            carry_row,
+                                            carry_val,
+                                            idx_base);
+}
+
+template <typename T, unsigned int BLOCKDIM, unsigned int ITEMS>
+__launch_bounds__(BLOCKDIM) __global__
+    void csrmvn_merge_kernel_device_pointer(rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const T*      alpha,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            const T* __restrict__ x,
+                                            const T* beta,
+                                            T* __restrict__ y,
+                                            rocsparse_int* __restrict__ carry_row,
+                                            T* __restrict__ carry_val,
+                                            rocsparse_index_base idx_base)
+{
+    csrmvn_merge_device<T, BLOCKDIM, ITEMS>(m,
+                                            nnz,
+                                            *alpha,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            x,
+                                            *beta,
+                                            y,
+                                            carry_row,
+                                            carry_val,
+                                            idx_base);
+}
+
+template <typename T>
+__global__ void csrmvn_merge_fixup_kernel(rocsparse_int nblocks,
+                                          rocsparse_int m,
+                                          const rocsparse_int* __restrict__ carry_row,
+                                          const T* __restrict__ carry_val,
+                                          T* __restrict__ y)
+{
+    csrmvn_merge_fixup_device(nblocks, m, carry_row, carry_val, y);
+}
+
+template <typename T>
+__launch_bounds__(WG_SIZE) __global__
+    void csrmvn_adaptive_kernel_host_pointer(unsigned long long* __restrict__ row_blocks,
+                                             T alpha,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             const T* __restrict__ csr_val,
+                                             const T* __restrict__ x,
+                                             T beta,
+                                             T* __restrict__ y,
+                                             rocsparse_index_base idx_base)
+{
+    csrmvn_adaptive_device<T,
+                           BLOCKSIZE,
+                           BLOCK_MULTIPLIER,
+                           ROWS_FOR_VECTOR,
+                           WG_BITS,
                            ROW_BITS,
                            WG_SIZE>(
         row_blocks, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
@@ -584,7 +1285,9 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric
+       && descr->type != rocsparse_matrix_type_hermitian)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -604,6 +1307,12 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and Hermitian matrices must be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
@@ -640,15 +1349,51 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
-    if(info == nullptr)
+    if(descr->type != rocsparse_matrix_type_general)
     {
-        // If csrmv info is not available, call csrmv general
-        return rocsparse_csrmv_general_template(
-            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        // Symmetric and Hermitian matrices, op(A) = A for real types
+        return rocsparse_csrmv_symm_template(handle,
+                                             m,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             (info != nullptr) ? info->csrmv_info : nullptr,
+                                             x,
+                                             beta,
+                                             y);
     }
-    else if(info->csrmv_info == nullptr)
+
+    if(trans != rocsparse_operation_none)
+    {
+        // Scatter the rows of A into y, op(A) = A^T = A^H for real types
+        return rocsparse_csrmvt_template(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         nnz,
+                                         alpha,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         (info != nullptr) ? info->csrmv_info : nullptr,
+                                         x,
+                                         beta,
+                                         y);
+    }
+
+    if(info == nullptr || info->csrmv_info == nullptr)
     {
-        // If csrmv info is not available, call csrmv general
+        // If csrmv info is not available, call csrmv merge or csrmv general
+        if(rocsparse_csrmv_select_alg(handle) == rocsparse_csrmv_alg_merge)
+        {
+            return rocsparse_csrmv_merge_template(
+                handle, m, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        }
+
         return rocsparse_csrmv_general_template(
             handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
     }
@@ -1160,6 +1905,9 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Make sure the number of row blocks is known
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_info_fetch_size(handle, info));
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -1217,4 +1965,593 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const T*                  x,
+                                                const T*                  beta,
+                                                T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        // Quick return if possible
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // Each thread processes CSRMV_MERGE_ITEMS items of the merge path of length m + nnz
+    rocsparse_int nblocks = (m + nnz - 1) / (CSRMV_MERGE_DIM * CSRMV_MERGE_ITEMS) + 1;
+
+    // Each block carries the partial sum of its last row to a succeeding block
+    size_t row_bytes  = ((sizeof(rocsparse_int) * nblocks - 1) / 256 + 1) * 256;
+    size_t temp_bytes = row_bytes + sizeof(T) * nblocks;
+
+    // Get temporary storage
+    bool  temp_alloc;
+    char* ptr;
+
+    // Device buffer should be sufficient in most cases
+    if(handle->buffer_size >= temp_bytes)
+    {
+        ptr        = reinterpret_cast<char*>(handle->buffer);
+        temp_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&ptr, temp_bytes));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* carry_row = reinterpret_cast<rocsparse_int*>(ptr);
+    T*             carry_val = reinterpret_cast<T*>(ptr + row_bytes);
+
+    dim3 csrmvn_blocks(nblocks);
+    dim3 csrmvn_threads(CSRMV_MERGE_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL(
+            (csrmvn_merge_kernel_device_pointer<T, CSRMV_MERGE_DIM, CSRMV_MERGE_ITEMS>),
+            csrmvn_blocks,
+            csrmvn_threads,
+            0,
+            stream,
+            m,
+            nnz,
+            alpha,
+            csr_row_ptr,
+            csr_col_ind,
+            csr_val,
+            x,
+            beta,
+            y,
+            carry_row,
+            carry_val,
+            descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            (csrmvn_merge_kernel_host_pointer<T, CSRMV_MERGE_DIM, CSRMV_MERGE_ITEMS>),
+            csrmvn_blocks,
+            csrmvn_threads,
+            0,
+            stream,
+            m,
+            nnz,
+            *alpha,
+            csr_row_ptr,
+            csr_col_ind,
+            csr_val,
+            x,
+            *beta,
+            y,
+            carry_row,
+            carry_val,
+            descr->base);
+    }
+
+    // Add the carries of all blocks to the rows that span multiple blocks
+    hipLaunchKernelGGL((csrmvn_merge_fixup_kernel<T>),
+                       dim3((nblocks - 1) / CSRMV_MERGE_FIXUP_DIM + 1),
+                       dim3(CSRMV_MERGE_FIXUP_DIM),
+                       0,
+                       stream,
+                       nblocks,
+                       m,
+                       carry_row,
+                       carry_val,
+                       y);
+
+    if(temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+#define CSRMV_SYMM_DIM 512
+template <typename T, rocsparse_int WF_SIZE>
+static rocsparse_status rocsparse_csrmv_symm_launch(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    const T*                  alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_csrmv_info      info,
+                                                    const T*                  x,
+                                                    const T*                  beta,
+                                                    T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dim3 csrmv_blocks((m - 1) / CSRMV_SYMM_DIM + 1);
+    dim3 csrmv_threads(CSRMV_SYMM_DIM);
+
+    // Without the transposed triangle, the mirrored entries are scattered into y
+    bool gather = (info != nullptr && info->symm_col_ptr != nullptr);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(gather)
+        {
+            // y = alpha * A * x + beta * y
+            hipLaunchKernelGGL((csrmvn_symm_gather_kernel_device_pointer<T, WF_SIZE>),
+                               csrmv_blocks,
+                               csrmv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               info->symm_col_ptr,
+                               info->symm_row_ind,
+                               info->symm_perm,
+                               x,
+                               beta,
+                               y,
+                               descr->fill_mode,
+                               descr->base);
+
+            return rocsparse_status_success;
+        }
+
+        // y = beta * y
+        hipLaunchKernelGGL((csrmv_scale_kernel_device_pointer<T>),
+                           csrmv_blocks,
+                           csrmv_threads,
+                           0,
+                           stream,
+                           m,
+                           beta,
+                           y);
+
+        // y += alpha * A * x
+        hipLaunchKernelGGL((csrmvn_symm_kernel_device_pointer<T, WF_SIZE>),
+                           csrmv_blocks,
+                           csrmv_threads,
+                           0,
+                           stream,
+                           m,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           descr->fill_mode,
+                           descr->base);
+    }
+    else
+    {
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        if(gather)
+        {
+            // y = alpha * A * x + beta * y
+            hipLaunchKernelGGL((csrmvn_symm_gather_kernel_host_pointer<T, WF_SIZE>),
+                               csrmv_blocks,
+                               csrmv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               info->symm_col_ptr,
+                               info->symm_row_ind,
+                               info->symm_perm,
+                               x,
+                               *beta,
+                               y,
+                               descr->fill_mode,
+                               descr->base);
+
+            return rocsparse_status_success;
+        }
+
+        // y = beta * y
+        if(*beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((csrmv_scale_kernel_host_pointer<T>),
+                               csrmv_blocks,
+                               csrmv_threads,
+                               0,
+                               stream,
+                               m,
+                               *beta,
+                               y);
+        }
+
+        // y += alpha * A * x
+        if(*alpha != static_cast<T>(0))
+        {
+            hipLaunchKernelGGL((csrmvn_symm_kernel_host_pointer<T, WF_SIZE>),
+                               csrmv_blocks,
+                               csrmv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               descr->fill_mode,
+                               descr->base);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+#undef CSRMV_SYMM_DIM
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_symm_template(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const T*                  alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_csrmv_info      info,
+                                               const T*                  x,
+                                               const T*                  beta,
+                                               T*                        y)
+{
+    // Only the lower or upper triangular part of A is accessed, diagonal entries
+    // are taken into account once. Each stored off-diagonal entry is applied to
+    // both, its row and its column. With the transposed triangle of the analysis,
+    // each row gathers its mirrored entries. Otherwise, they are accumulated into
+    // y atomically.
+    if(info != nullptr)
+    {
+        // Check if info matches current matrix and options
+        if(info->m != m)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(info->nnz != nnz)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(info->descr != descr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(info->csr_row_ptr != csr_row_ptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(info->csr_col_ind != csr_col_ind)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    if(nnz_per_row < 4)
+    {
+        return rocsparse_csrmv_symm_launch<T, 2>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    }
+    else if(nnz_per_row < 8)
+    {
+        return rocsparse_csrmv_symm_launch<T, 4>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        return rocsparse_csrmv_symm_launch<T, 8>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        return rocsparse_csrmv_symm_launch<T, 16>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        return rocsparse_csrmv_symm_launch<T, 32>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    }
+    else
+    {
+        return rocsparse_csrmv_symm_launch<T, 64>(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    }
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+static rocsparse_status rocsparse_csrmvt_launch(rocsparse_handle          handle,
+                                                rocsparse_csrmvt_alg      alg,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const T*                  x,
+                                                T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    if(alg == rocsparse_csrmvt_alg_lds)
+    {
+        static constexpr rocsparse_int LDS_SIZE = CSRMVT_LDS_BYTES / sizeof(T);
+
+        // Each block adds its private copy of y to y, thus the number of blocks is
+        // limited to what is required to fill the device
+        dim3 csrmvt_blocks(std::min((m - 1) / (CSRMVT_DIM / WF_SIZE) + 1,
+                                    2 * handle->properties.multiProcessorCount));
+        dim3 csrmvt_threads(CSRMVT_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrmvt_lds_kernel_device_pointer<T, CSRMVT_DIM, WF_SIZE, LDS_SIZE>),
+                               csrmvt_blocks,
+                               csrmvt_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrmvt_lds_kernel_host_pointer<T, CSRMVT_DIM, WF_SIZE, LDS_SIZE>),
+                               csrmvt_blocks,
+                               csrmvt_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+    }
+    else
+    {
+        dim3 csrmvt_blocks((m - 1) / CSRMVT_DIM + 1);
+        dim3 csrmvt_threads(CSRMVT_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrmvt_atomic_kernel_device_pointer<T, WF_SIZE>),
+                               csrmvt_blocks,
+                               csrmvt_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrmvt_atomic_kernel_host_pointer<T, WF_SIZE>),
+                               csrmvt_blocks,
+                               csrmvt_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmvt_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_csrmv_info      info,
+                                           const T*                  x,
+                                           const T*                  beta,
+                                           T*                        y)
+{
+    rocsparse_csrmvt_alg alg;
+
+    if(info != nullptr)
+    {
+        // Check if info matches current matrix and options
+        if(info->trans != trans)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(info->m != m)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(info->n != n)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(info->nnz != nnz)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(info->descr != descr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(info->csr_row_ptr != csr_row_ptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(info->csr_col_ind != csr_col_ind)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        alg = info->trans_alg;
+    }
+    else
+    {
+        // Without analysis, the strategy is chosen from the average column length
+        alg = rocsparse_csrmvt_select_alg<T>(n, nnz / n);
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // y = beta * y, where y has n entries
+    dim3 csrmv_scale_blocks((n - 1) / CSRMVT_DIM + 1);
+    dim3 csrmv_scale_threads(CSRMVT_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmv_scale_kernel_device_pointer<T>),
+                           csrmv_scale_blocks,
+                           csrmv_scale_threads,
+                           0,
+                           stream,
+                           n,
+                           beta,
+                           y);
+    }
+    else
+    {
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        if(*beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((csrmv_scale_kernel_host_pointer<T>),
+                               csrmv_scale_blocks,
+                               csrmv_scale_threads,
+                               0,
+                               stream,
+                               n,
+                               *beta,
+                               y);
+        }
+
+        if(*alpha == static_cast<T>(0))
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // y += alpha * A^T * x
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    if(nnz_per_row < 4)
+    {
+        return rocsparse_csrmvt_launch<T, 2>(
+            handle, alg, m, n, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 8)
+    {
+        return rocsparse_csrmvt_launch<T, 4>(
+            handle, alg, m, n, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        return rocsparse_csrmvt_launch<T, 8>(
+            handle, alg, m, n, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        return rocsparse_csrmvt_launch<T, 16>(
+            handle, alg, m, n, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        return rocsparse_csrmvt_launch<T, 32>(
+            handle, alg, m, n, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+    else
+    {
+        return rocsparse_csrmvt_launch<T, 64>(
+            handle, alg, m, n, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, y);
+    }
+}
+
 #endif // ROCSPARSE_CSRMV_HPP
@@ -0,0 +1,399 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMV_MULTI_HPP
+#define ROCSPARSE_CSRMV_MULTI_HPP
+
+#include "rocsparse.h"
+
+#include "csrmv_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse_csrmv.hpp"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+// Number of vectors that are processed per pass over a long row
+#define CSRMV_MULTI_NVEC 4
+
+template <typename T>
+__launch_bounds__(WG_SIZE) __global__
+    void csrmvn_adaptive_multi_kernel_host_pointer(rocsparse_int k,
+                                                   unsigned long long* __restrict__ row_blocks,
+                                                   T alpha,
+                                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                                   const T* __restrict__ csr_val,
+                                                   const T* __restrict__ x,
+                                                   rocsparse_int ldx,
+                                                   T             beta,
+                                                   T* __restrict__ y,
+                                                   rocsparse_int        ldy,
+                                                   rocsparse_index_base idx_base)
+{
+    csrmvn_adaptive_multi_device<T,
+                                 CSRMV_MULTI_NVEC,
+                                 BLOCKSIZE,
+                                 BLOCK_MULTIPLIER,
+                                 ROWS_FOR_VECTOR,
+                                 WG_BITS,
+                                 ROW_BITS,
+                                 WG_SIZE>(k,
+                                          row_blocks,
+                                          alpha,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          csr_val,
+                                          x,
+                                          ldx,
+                                          beta,
+                                          y,
+                                          ldy,
+                                          idx_base);
+}
+
+template <typename T>
+__launch_bounds__(WG_SIZE) __global__
+    void csrmvn_adaptive_multi_kernel_device_pointer(rocsparse_int k,
+                                                     unsigned long long* __restrict__ row_blocks,
+                                                     const T* alpha,
+                                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                                     const T* __restrict__ csr_val,
+                                                     const T* __restrict__ x,
+                                                     rocsparse_int ldx,
+                                                     const T*      beta,
+                                                     T* __restrict__ y,
+                                                     rocsparse_int        ldy,
+                                                     rocsparse_index_base idx_base)
+{
+    csrmvn_adaptive_multi_device<T,
+                                 CSRMV_MULTI_NVEC,
+                                 BLOCKSIZE,
+                                 BLOCK_MULTIPLIER,
+                                 ROWS_FOR_VECTOR,
+                                 WG_BITS,
+                                 ROW_BITS,
+                                 WG_SIZE>(k,
+                                          row_blocks,
+                                          *alpha,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          csr_val,
+                                          x,
+                                          ldx,
+                                          *beta,
+                                          y,
+                                          ldy,
+                                          idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_multi_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const T*                  x,
+                                                rocsparse_int             ldx,
+                                                const T*                  beta,
+                                                T*                        y,
+                                                rocsparse_int             ldy)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_multi"),
+                  trans,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  ldx,
+                  *beta,
+                  (const void*&)y,
+                  ldy);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv_multi -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--sizek",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_multi"),
+                  trans,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  ldx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  ldy);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check leading dimensions
+    if(trans == rocsparse_operation_none)
+    {
+        if(ldx < n || ldy < m)
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+    else
+    {
+        if(ldx < m || ldy < n)
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(info == nullptr || info->csrmv_info == nullptr)
+    {
+        // If csrmv info is not available, call csrmv general for each vector
+        for(rocsparse_int v = 0; v < k; ++v)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_general_template(handle,
+                                                                       trans,
+                                                                       m,
+                                                                       n,
+                                                                       nnz,
+                                                                       alpha,
+                                                                       descr,
+                                                                       csr_val,
+                                                                       csr_row_ptr,
+                                                                       csr_col_ind,
+                                                                       x + v * ldx,
+                                                                       beta,
+                                                                       y + v * ldy));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check if info matches current matrix and options
+    rocsparse_csrmv_info csrmv_info = info->csrmv_info;
+
+    if(csrmv_info->trans != trans)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csrmv_info->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv_info->n != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv_info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv_info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csrmv_info->csr_row_ptr != csr_row_ptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrmv_info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Make sure the number of row blocks is known
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_info_fetch_size(handle, csrmv_info));
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different csrmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+        dim3 csrmvn_blocks((csrmv_info->size / 2) - 1);
+        dim3 csrmvn_threads(WG_SIZE);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrmvn_adaptive_multi_kernel_device_pointer<T>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               stream,
+                               k,
+                               csrmv_info->row_blocks,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               ldx,
+                               beta,
+                               y,
+                               ldy,
+                               descr->base);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            hipLaunchKernelGGL((csrmvn_adaptive_multi_kernel_host_pointer<T>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               stream,
+                               k,
+                               csrmv_info->row_blocks,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               ldx,
+                               *beta,
+                               y,
+                               ldy,
+                               descr->base);
+        }
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRMV_MULTI_HPP
@@ -25,6 +25,7 @@
 
 #include "rocsparse_csrsv.hpp"
 
+#include <algorithm>
 #include <limits>
 
 /*
@@ -141,8 +142,13 @@ extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          hand
     // Determine which info meta data should be deleted
     if(descr->fill_mode == rocsparse_fill_mode_lower)
     {
+        // Transposed meta data is never shared
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_lower_info));
+        info->csrsvt_lower_info = nullptr;
+
         // If meta data is shared, do not delete anything
-        if(info->csrilu0_info == info->csrsv_lower_info)
+        if(info->csrilu0_info == info->csrsv_lower_info
+           || info->csric0_info == info->csrsv_lower_info)
         {
             info->csrsv_lower_info = nullptr;
 
@@ -157,6 +163,9 @@ extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          hand
         // Upper info has no shares (yet)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
         info->csrsv_upper_info = nullptr;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_upper_info));
+        info->csrsvt_upper_info = nullptr;
     }
 
     return rocsparse_status_success;
@@ -251,21 +260,25 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
     // Stream
     hipStream_t stream = handle->stream;
 
-    // Determine the info meta data place
-    rocsparse_csrtr_info csrsv = nullptr;
+    // Determine the info meta data place. Transposed solves have their own meta
+    // data, which is queried as well.
+    rocsparse_csrtr_info csrsv  = nullptr;
+    rocsparse_csrtr_info csrsvt = nullptr;
 
     // For hipSPARSE compatibility mode, we allow descr == nullptr
     // In this case, only lower OR upper is populated and we can use the right
     // info meta data
     if(descr == nullptr)
     {
-        if(info->csrsv_lower_info != nullptr)
+        if(info->csrsv_lower_info != nullptr || info->csrsvt_lower_info != nullptr)
         {
-            csrsv = info->csrsv_lower_info;
+            csrsv  = info->csrsv_lower_info;
+            csrsvt = info->csrsvt_lower_info;
         }
         else
         {
-            csrsv = info->csrsv_upper_info;
+            csrsv  = info->csrsv_upper_info;
+            csrsvt = info->csrsvt_upper_info;
         }
     }
     else
@@ -273,17 +286,19 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
         // Switch between upper and lower triangular
         if(descr->fill_mode == rocsparse_fill_mode_lower)
         {
-            csrsv = info->csrsv_lower_info;
+            csrsv  = info->csrsv_lower_info;
+            csrsvt = info->csrsvt_lower_info;
         }
         else
         {
-            csrsv = info->csrsv_upper_info;
+            csrsv  = info->csrsv_upper_info;
+            csrsvt = info->csrsvt_upper_info;
         }
     }
 
     // If m == 0 || nnz == 0 it can happen, that info structure is not created.
     // In this case, always return -1.
-    if(csrsv == nullptr)
+    if(csrsv == nullptr && csrsvt == nullptr)
     {
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
@@ -297,29 +312,46 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
         return rocsparse_status_success;
     }
 
-    // Differentiate between pointer modes
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    // Determine the first zero pivot of all available meta data
+    rocsparse_int        pivot    = std::numeric_limits<rocsparse_int>::max();
+    rocsparse_csrtr_info infos[2] = {csrsv, csrsvt};
+
+    for(int i = 0; i < 2; ++i)
     {
-        // rocsparse_pointer_mode_device
-        rocsparse_int pivot;
+        if(infos[i] == nullptr)
+        {
+            continue;
+        }
 
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            &pivot, csrsv->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        rocsparse_int local_pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&local_pivot,
+                                           infos[i]->zero_pivot,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
 
         // Wait for host transfer to finish
         RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
+        pivot = std::min(pivot, local_pivot);
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
         if(pivot == std::numeric_limits<rocsparse_int>::max())
         {
             RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
-                                               csrsv->zero_pivot,
-                                               sizeof(rocsparse_int),
-                                               hipMemcpyDeviceToDevice,
-                                               stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                position, &pivot, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+            // Wait for device transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
             return rocsparse_status_zero_pivot;
         }
@@ -327,16 +359,15 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
     else
     {
         // rocsparse_pointer_mode_host
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(position, csrsv->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-
         // If no zero pivot is found, set -1
-        if(*position == std::numeric_limits<rocsparse_int>::max())
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
         {
             *position = -1;
         }
         else
         {
+            *position = pivot;
+
             return rocsparse_status_zero_pivot;
         }
     }
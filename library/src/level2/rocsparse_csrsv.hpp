@@ -27,6 +27,7 @@
 
 #include "rocsparse.h"
 
+#include "csr_hash.h"
 #include "definitions.h"
 #include "handle.h"
 #include "utility.h"
@@ -38,6 +39,11 @@
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
 
+// Level scheduling is used for at most CSRSV_LEVEL_MAX levels with an average of
+// at least CSRSV_LEVEL_MIN_WIDTH rows per level
+#define CSRSV_LEVEL_MAX 256
+#define CSRSV_LEVEL_MIN_WIDTH 1024
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle          handle,
                                                       rocsparse_operation       trans,
@@ -88,6 +94,12 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
         return rocsparse_status_not_implemented;
     }
 
+    // Check operation
+    if(trans != rocsparse_operation_none && trans != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -155,6 +167,64 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static rocsparse_status rocsparse_csrtr_transpose_analysis(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           rocsparse_csrtr_info      info,
+                                                           rocsparse_int*            d_max_nnz,
+                                                           int*                      done_array,
+                                                           int*                      dep_count)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dim3 csrsv_blocks((WF_SIZE * m - 1) / BLOCKSIZE + 1);
+    dim3 csrsv_threads(BLOCKSIZE);
+
+    // Allocate buffer to hold the number of dependencies of each row
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->dep_count, sizeof(rocsparse_int) * m));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(info->dep_count, 0, sizeof(rocsparse_int) * m, stream));
+
+    // Count the dependencies of each row of the transposed system
+    hipLaunchKernelGGL((csrsv_transpose_count_kernel<BLOCKSIZE, WF_SIZE>),
+                       csrsv_blocks,
+                       csrsv_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       info->csr_diag_ind,
+                       info->dep_count,
+                       d_max_nnz,
+                       info->zero_pivot,
+                       descr->base,
+                       descr->fill_mode);
+
+    // Dependencies are resolved on a copy of the dependency count
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        dep_count, info->dep_count, sizeof(int) * m, hipMemcpyDeviceToDevice, stream));
+
+    // Compute the depth of each row of the transposed system
+    hipLaunchKernelGGL((csrsv_analysis_transpose_kernel<BLOCKSIZE, WF_SIZE>),
+                       csrsv_blocks,
+                       csrsv_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       done_array,
+                       dep_count,
+                       descr->base,
+                       descr->fill_mode);
+
+    return rocsparse_status_success;
+}
+
 static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handle,
                                                  rocsparse_operation       trans,
                                                  rocsparse_int             m,
@@ -162,6 +232,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
                                                  const rocsparse_mat_descr descr,
                                                  const rocsparse_int*      csr_row_ptr,
                                                  const rocsparse_int*      csr_col_ind,
+                                                 unsigned long long        hash,
                                                  rocsparse_csrtr_info      info,
                                                  void*                     temp_buffer)
 {
@@ -216,7 +287,41 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
     dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRILU0_DIM + 1);
     dim3 csrsv_threads(CSRILU0_DIM);
 
-    if(handle->wavefront_size == 32)
+    if(trans != rocsparse_operation_none)
+    {
+        // The transposed system has reversed dependencies
+        if(handle->wavefront_size == 32)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_csrtr_transpose_analysis<CSRILU0_DIM, 32>(handle,
+                                                                     m,
+                                                                     descr,
+                                                                     csr_row_ptr,
+                                                                     csr_col_ind,
+                                                                     info,
+                                                                     d_max_nnz,
+                                                                     done_array,
+                                                                     workspace2)));
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_csrtr_transpose_analysis<CSRILU0_DIM, 64>(handle,
+                                                                     m,
+                                                                     descr,
+                                                                     csr_row_ptr,
+                                                                     csr_col_ind,
+                                                                     info,
+                                                                     d_max_nnz,
+                                                                     done_array,
+                                                                     workspace2)));
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+    else if(handle->wavefront_size == 32)
     {
         if(descr->fill_mode == rocsparse_fill_mode_upper)
         {
@@ -323,16 +428,82 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
                                            stream));
     }
 
+    // Number of levels, given by the depth of the last row in row_map
+    rocsparse_int num_levels;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&num_levels,
+                                       keys.current() + m - 1,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Few wide levels are solved level by level, which avoids wavefronts that spin
+    // on unresolved dependencies. Otherwise, all rows are solved by a single kernel.
+    info->level_ptr.clear();
+
+    if(num_levels <= CSRSV_LEVEL_MAX && m / num_levels >= CSRSV_LEVEL_MIN_WIDTH)
+    {
+        // Get level boundaries from handle device buffer
+        rocsparse_int* level_ptr = reinterpret_cast<rocsparse_int*>(handle->buffer);
+
+#define CSRSV_LEVEL_DIM 256
+        hipLaunchKernelGGL((csrsv_level_ptr_kernel<CSRSV_LEVEL_DIM>),
+                           dim3((m - 1) / CSRSV_LEVEL_DIM + 1),
+                           dim3(CSRSV_LEVEL_DIM),
+                           0,
+                           stream,
+                           m,
+                           keys.current(),
+                           level_ptr);
+#undef CSRSV_LEVEL_DIM
+
+        info->level_ptr.resize(num_levels + 1);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->level_ptr.data(),
+                                           level_ptr,
+                                           sizeof(rocsparse_int) * (num_levels + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
     // Store some pointers to verify correct execution
     info->m           = m;
     info->nnz         = nnz;
     info->descr       = descr;
     info->csr_row_ptr = csr_row_ptr;
     info->csr_col_ind = csr_col_ind;
+    info->hash        = hash;
 
     return rocsparse_status_success;
 }
 
+// Checks whether csrtr meta data has been gathered for the sparsity pattern with
+// the given structural hash
+static bool rocsparse_csrtr_match(rocsparse_csrtr_info info,
+                                  rocsparse_int        m,
+                                  rocsparse_int        nnz,
+                                  unsigned long long   hash)
+{
+    return info != nullptr && info->hash != 0 && info->hash == hash && info->m == m
+           && info->nnz == nnz;
+}
+
+// Binds csrtr meta data to a matrix with the same sparsity pattern
+static void rocsparse_csrtr_rebind(rocsparse_csrtr_info      info,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind)
+{
+    info->descr       = descr;
+    info->csr_row_ptr = csr_row_ptr;
+    info->csr_col_ind = csr_col_ind;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
@@ -389,6 +560,12 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
         return rocsparse_status_not_implemented;
     }
 
+    // Check operation
+    if(trans != rocsparse_operation_none && trans != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // Check analysis policy
     if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
     {
@@ -435,11 +612,65 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Structural hash of the sparsity pattern, to identify meta data that can be
+    // re-used. A forced analysis always re-builds the meta data and skips the hash.
+    unsigned long long hash = 0;
+
+    if(analysis == rocsparse_analysis_policy_reuse)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, &hash));
+    }
+
+    // Transposed solves have their own meta data, as their dependencies are reversed
+    if(trans != rocsparse_operation_none)
+    {
+        rocsparse_csrtr_info* csrsvt = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                           ? &info->csrsvt_upper_info
+                                           : &info->csrsvt_lower_info;
+
+        // Re-use transposed meta data of the same sparsity pattern
+        if(analysis == rocsparse_analysis_policy_reuse
+           && rocsparse_csrtr_match(*csrsvt, m, nnz, hash) == true)
+        {
+            rocsparse_csrtr_rebind(*csrsvt, descr, csr_row_ptr, csr_col_ind);
+
+            return rocsparse_status_success;
+        }
+
+        // Clear csrsv info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(*csrsvt));
+
+        // Create csrsv info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(csrsvt));
+
+        // Perform analysis
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
+                                                           trans,
+                                                           m,
+                                                           nnz,
+                                                           descr,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           hash,
+                                                           *csrsvt,
+                                                           temp_buffer));
+
+        return rocsparse_status_success;
+    }
+
     // Switch between lower and upper triangular analysis
     if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
         // This is currently the only case where we need upper triangular analysis,
-        // therefore we ignore the analysis policy
+        // therefore we only re-use upper meta data of the same sparsity pattern
+        if(analysis == rocsparse_analysis_policy_reuse
+           && rocsparse_csrtr_match(info->csrsv_upper_info, m, nnz, hash) == true)
+        {
+            rocsparse_csrtr_rebind(info->csrsv_upper_info, descr, csr_row_ptr, csr_col_ind);
+
+            return rocsparse_status_success;
+        }
 
         // Clear csrsv info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
@@ -455,6 +686,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                            descr,
                                                            csr_row_ptr,
                                                            csr_col_ind,
+                                                           hash,
                                                            info->csrsv_upper_info,
                                                            temp_buffer));
     }
@@ -463,13 +695,15 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
         // Differentiate the analysis policies
         if(analysis == rocsparse_analysis_policy_reuse)
         {
-            // We try to re-use already analyzed lower part, if available.
-            // It is the user's responsibility that this data is still valid,
-            // since he passed the 'reuse' flag.
+            // We try to re-use already analyzed lower part, if available. Meta data
+            // is only re-used, if it has been gathered for the same sparsity pattern,
+            // which is identified by its structural hash.
 
-            // If csrsv meta data is already available, do nothing
-            if(info->csrsv_lower_info != nullptr)
+            // If csrsv meta data is already available, re-use it
+            if(rocsparse_csrtr_match(info->csrsv_lower_info, m, nnz, hash) == true)
             {
+                rocsparse_csrtr_rebind(info->csrsv_lower_info, descr, csr_row_ptr, csr_col_ind);
+
                 return rocsparse_status_success;
             }
 
@@ -477,18 +711,34 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             rocsparse_csrtr_info reuse = nullptr;
 
             // csrilu0 meta data
-            if(info->csrilu0_info != nullptr)
+            if(rocsparse_csrtr_match(info->csrilu0_info, m, nnz, hash) == true)
             {
                 reuse = info->csrilu0_info;
             }
 
+            // csric0 meta data
+            if(reuse == nullptr && rocsparse_csrtr_match(info->csric0_info, m, nnz, hash) == true)
+            {
+                reuse = info->csric0_info;
+            }
+
             // TODO add more crossover data here
 
             // If data has been found, use it
             if(reuse != nullptr)
             {
+                // Clear csrsv info, unless it is shared
+                if(info->csrsv_lower_info != info->csrilu0_info
+                   && info->csrsv_lower_info != info->csric0_info)
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+                }
+
                 info->csrsv_lower_info = reuse;
 
+                rocsparse_csrtr_rebind(info->csrsv_lower_info, descr, csr_row_ptr, csr_col_ind);
+
                 return rocsparse_status_success;
             }
         }
@@ -496,8 +746,12 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
 
-        // Clear csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+        // Clear csrsv info, unless it is shared with csrilu0 or csric0
+        if(info->csrsv_lower_info != info->csrilu0_info
+           && info->csrsv_lower_info != info->csric0_info)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+        }
 
         // Create csrsv info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrsv_lower_info));
@@ -510,6 +764,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                            descr,
                                                            csr_row_ptr,
                                                            csr_col_ind,
+                                                           hash,
                                                            info->csrsv_lower_info,
                                                            temp_buffer));
     }
@@ -517,7 +772,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrsv_host_pointer(rocsparse_int m,
                             T             alpha,
@@ -527,6 +782,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                             const T* __restrict__ x,
                             T* __restrict__ y,
                             int* __restrict__ done_array,
+                            int           done_flag,
                             rocsparse_int* __restrict__ map,
                             rocsparse_int offset,
                             rocsparse_int* __restrict__ zero_pivot,
@@ -534,23 +790,24 @@ __launch_bounds__(BLOCKSIZE) __global__
                             rocsparse_fill_mode  fill_mode,
                             rocsparse_diag_type  diag_type)
 {
-    csrsv_device<T, BLOCKSIZE, WF_SIZE>(m,
-                                        alpha,
-                                        csr_row_ptr,
-                                        csr_col_ind,
-                                        csr_val,
-                                        x,
-                                        y,
-                                        done_array,
-                                        map,
-                                        offset,
-                                        zero_pivot,
-                                        idx_base,
-                                        fill_mode,
-                                        diag_type);
+    csrsv_device<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>(m,
+                                                   alpha,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csr_val,
+                                                   x,
+                                                   y,
+                                                   done_array,
+                                                   done_flag,
+                                                   map,
+                                                   offset,
+                                                   zero_pivot,
+                                                   idx_base,
+                                                   fill_mode,
+                                                   diag_type);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrsv_device_pointer(rocsparse_int m,
                               const T*      alpha,
@@ -560,6 +817,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                               const T* __restrict__ x,
                               T* __restrict__ y,
                               int* __restrict__ done_array,
+                              int           done_flag,
                               rocsparse_int* __restrict__ map,
                               rocsparse_int offset,
                               rocsparse_int* __restrict__ zero_pivot,
@@ -567,20 +825,307 @@ __launch_bounds__(BLOCKSIZE) __global__
                               rocsparse_fill_mode  fill_mode,
                               rocsparse_diag_type  diag_type)
 {
-    csrsv_device<T, BLOCKSIZE, WF_SIZE>(m,
-                                        *alpha,
-                                        csr_row_ptr,
-                                        csr_col_ind,
-                                        csr_val,
-                                        x,
-                                        y,
-                                        done_array,
-                                        map,
-                                        offset,
-                                        zero_pivot,
-                                        idx_base,
-                                        fill_mode,
-                                        diag_type);
+    csrsv_device<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>(m,
+                                                   *alpha,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csr_val,
+                                                   x,
+                                                   y,
+                                                   done_array,
+                                                   done_flag,
+                                                   map,
+                                                   offset,
+                                                   zero_pivot,
+                                                   idx_base,
+                                                   fill_mode,
+                                                   diag_type);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
+static void rocsparse_csrsv_launch(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             offset,
+                                   const T*                  alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_csrtr_info      csrsv,
+                                   const T*                  x,
+                                   T*                        y,
+                                   int*                      done_array,
+                                   int                       done_flag)
+{
+    dim3 csrsv_blocks((WF_SIZE * m - 1) / BLOCKSIZE + 1);
+    dim3 csrsv_threads(BLOCKSIZE);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrsv_device_pointer<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           done_array,
+                           done_flag,
+                           csrsv->row_map,
+                           offset,
+                           csrsv->zero_pivot,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrsv_host_pointer<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           done_array,
+                           done_flag,
+                           csrsv->row_map,
+                           offset,
+                           csrsv->zero_pivot,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+}
+
+// Solves all rows of the triangular part described by descr. Depending on the
+// analysis, this is done in a single spin loop kernel or level by level. In spin
+// loop mode, rows are flagged with done_flag in the done array, which must not hold
+// this value for any row on entry.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static void rocsparse_csrsv_sweep(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  const T*                  alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const T*                  csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_csrtr_info      csrsv,
+                                  const T*                  x,
+                                  T*                        y,
+                                  int*                      done_array,
+                                  int                       done_flag)
+{
+    if(csrsv->level_ptr.empty() == true)
+    {
+        // Solve all rows at once, waiting for dependencies in a spin loop
+        rocsparse_csrsv_launch<T, BLOCKSIZE, WF_SIZE, true>(handle,
+                                                            m,
+                                                            0,
+                                                            alpha,
+                                                            descr,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            csrsv,
+                                                            x,
+                                                            y,
+                                                            done_array,
+                                                            done_flag);
+    }
+    else
+    {
+        // Solve level by level, all dependencies of a level have been resolved by
+        // the previous launches
+        rocsparse_int num_levels = csrsv->level_ptr.size() - 1;
+
+        for(rocsparse_int i = 0; i < num_levels; ++i)
+        {
+            rocsparse_int offset = csrsv->level_ptr[i];
+            rocsparse_int rows   = csrsv->level_ptr[i + 1] - offset;
+
+            rocsparse_csrsv_launch<T, BLOCKSIZE, WF_SIZE, false>(handle,
+                                                                 rows,
+                                                                 offset,
+                                                                 alpha,
+                                                                 descr,
+                                                                 csr_val,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 csrsv,
+                                                                 x,
+                                                                 y,
+                                                                 done_array,
+                                                                 done_flag);
+        }
+    }
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_scale_host_pointer(rocsparse_int m,
+                                  T             alpha,
+                                  const T* __restrict__ x,
+                                  T* __restrict__ y)
+{
+    csrsv_scale_device<T, BLOCKSIZE>(m, alpha, x, y);
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_scale_device_pointer(rocsparse_int m,
+                                    const T*      alpha,
+                                    const T* __restrict__ x,
+                                    T* __restrict__ y)
+{
+    csrsv_scale_device<T, BLOCKSIZE>(m, *alpha, x, y);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_transpose_kernel(rocsparse_int m,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const T* __restrict__ csr_val,
+                                T* __restrict__ y,
+                                int* __restrict__ dep_count,
+                                const rocsparse_int* __restrict__ csr_diag_ind,
+                                const rocsparse_int* __restrict__ map,
+                                rocsparse_int offset,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base,
+                                rocsparse_fill_mode  fill_mode,
+                                rocsparse_diag_type  diag_type)
+{
+    csrsv_transpose_device<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>(m,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             csr_val,
+                                                             y,
+                                                             dep_count,
+                                                             csr_diag_ind,
+                                                             map,
+                                                             offset,
+                                                             zero_pivot,
+                                                             idx_base,
+                                                             fill_mode,
+                                                             diag_type);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static rocsparse_status rocsparse_csrsv_transpose_solve(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        const T*                  alpha,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_csrtr_info      csrsv,
+                                                        const T*                  x,
+                                                        T*                        y,
+                                                        int*                      dep_count)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // y accumulates the contributions of all rows, starting from alpha * x
+    dim3 scale_blocks((m - 1) / BLOCKSIZE + 1);
+    dim3 scale_threads(BLOCKSIZE);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrsv_scale_device_pointer<T, BLOCKSIZE>),
+                           scale_blocks,
+                           scale_threads,
+                           0,
+                           stream,
+                           m,
+                           alpha,
+                           x,
+                           y);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrsv_scale_host_pointer<T, BLOCKSIZE>),
+                           scale_blocks,
+                           scale_threads,
+                           0,
+                           stream,
+                           m,
+                           *alpha,
+                           x,
+                           y);
+    }
+
+    if(csrsv->level_ptr.empty() == true)
+    {
+        // Dependencies are resolved on a copy of the dependency count
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dep_count, csrsv->dep_count, sizeof(int) * m, hipMemcpyDeviceToDevice, stream));
+
+        // Solve all rows at once, waiting for dependencies in a spin loop
+        hipLaunchKernelGGL((csrsv_transpose_kernel<T, BLOCKSIZE, WF_SIZE, true>),
+                           dim3((WF_SIZE * m - 1) / BLOCKSIZE + 1),
+                           dim3(BLOCKSIZE),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           y,
+                           dep_count,
+                           csrsv->csr_diag_ind,
+                           csrsv->row_map,
+                           0,
+                           csrsv->zero_pivot,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+    else
+    {
+        // Solve level by level, all dependencies of a level have been resolved by
+        // the previous launches
+        rocsparse_int num_levels = csrsv->level_ptr.size() - 1;
+
+        for(rocsparse_int i = 0; i < num_levels; ++i)
+        {
+            rocsparse_int offset = csrsv->level_ptr[i];
+            rocsparse_int rows   = csrsv->level_ptr[i + 1] - offset;
+
+            hipLaunchKernelGGL((csrsv_transpose_kernel<T, BLOCKSIZE, WF_SIZE, false>),
+                               dim3((WF_SIZE * rows - 1) / BLOCKSIZE + 1),
+                               dim3(BLOCKSIZE),
+                               0,
+                               stream,
+                               rows,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               y,
+                               dep_count,
+                               csrsv->csr_diag_ind,
+                               csrsv->row_map,
+                               offset,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+    }
+
+    return rocsparse_status_success;
 }
 
 template <typename T>
@@ -669,6 +1214,12 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         return rocsparse_status_not_implemented;
     }
 
+    // Check operation
+    if(trans != rocsparse_operation_none && trans != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -726,12 +1277,18 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
     // done array
     int* done_array = reinterpret_cast<int*>(ptr);
 
-    // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
+    rocsparse_csrtr_info csrsv;
 
-    rocsparse_csrtr_info csrsv = (descr->fill_mode == rocsparse_fill_mode_upper)
-                                     ? info->csrsv_upper_info
-                                     : info->csrsv_lower_info;
+    if(trans == rocsparse_operation_none)
+    {
+        csrsv = (descr->fill_mode == rocsparse_fill_mode_upper) ? info->csrsv_upper_info
+                                                                : info->csrsv_lower_info;
+    }
+    else
+    {
+        csrsv = (descr->fill_mode == rocsparse_fill_mode_upper) ? info->csrsvt_upper_info
+                                                                : info->csrsvt_lower_info;
+    }
 
     if(csrsv == nullptr)
     {
@@ -750,55 +1307,38 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
     }
 
 #define CSRSV_DIM 1024
-    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
-    dim3 csrsv_threads(CSRSV_DIM);
-
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    if(trans != rocsparse_operation_none)
     {
-        // rocsparse_pointer_mode_device
+        // Solve the transposed system, driven by the CSR structure
         if(handle->wavefront_size == 32)
         {
-            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 32>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               y,
-                               done_array,
-                               csrsv->row_map,
-                               0,
-                               csrsv->zero_pivot,
-                               descr->base,
-                               descr->fill_mode,
-                               descr->diag_type);
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_csrsv_transpose_solve<T, CSRSV_DIM, 32>(handle,
+                                                                   m,
+                                                                   alpha,
+                                                                   descr,
+                                                                   csr_val,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   csrsv,
+                                                                   x,
+                                                                   y,
+                                                                   done_array)));
         }
         else if(handle->wavefront_size == 64)
         {
-            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 64>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               y,
-                               done_array,
-                               csrsv->row_map,
-                               0,
-                               csrsv->zero_pivot,
-                               descr->base,
-                               descr->fill_mode,
-                               descr->diag_type);
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_csrsv_transpose_solve<T, CSRSV_DIM, 64>(handle,
+                                                                   m,
+                                                                   alpha,
+                                                                   descr,
+                                                                   csr_val,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   csrsv,
+                                                                   x,
+                                                                   y,
+                                                                   done_array)));
         }
         else
         {
@@ -807,50 +1347,41 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
     }
     else
     {
-        // rocsparse_pointer_mode_host
+        // Initialize buffers
+        if(csrsv->level_ptr.empty() == true)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
+        }
+
         if(handle->wavefront_size == 32)
         {
-            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 32>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               *alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               y,
-                               done_array,
-                               csrsv->row_map,
-                               0,
-                               csrsv->zero_pivot,
-                               descr->base,
-                               descr->fill_mode,
-                               descr->diag_type);
+            rocsparse_csrsv_sweep<T, CSRSV_DIM, 32>(handle,
+                                                    m,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    csrsv,
+                                                    x,
+                                                    y,
+                                                    done_array,
+                                                    1);
         }
         else if(handle->wavefront_size == 64)
         {
-            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 64>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               *alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               y,
-                               done_array,
-                               csrsv->row_map,
-                               0,
-                               csrsv->zero_pivot,
-                               descr->base,
-                               descr->fill_mode,
-                               descr->diag_type);
+            rocsparse_csrsv_sweep<T, CSRSV_DIM, 64>(handle,
+                                                    m,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    csrsv,
+                                                    x,
+                                                    y,
+                                                    done_array,
+                                                    1);
         }
         else
         {
@@ -0,0 +1,257 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef ROCSPARSE_SELLCSMV_HPP
+#define ROCSPARSE_SELLCSMV_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "sellcsmv_device.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void sellcsmvn_kernel_host_pointer(rocsparse_int m,
+                                              rocsparse_int n,
+                                              T             alpha,
+                                              const rocsparse_int* __restrict__ slice_ptr,
+                                              const rocsparse_int* __restrict__ perm,
+                                              const rocsparse_int* __restrict__ sell_col_ind,
+                                              const T* __restrict__ sell_val,
+                                              const T* __restrict__ x,
+                                              T beta,
+                                              T* __restrict__ y,
+                                              rocsparse_index_base idx_base)
+{
+    sellcsmvn_device(m, n, alpha, slice_ptr, perm, sell_col_ind, sell_val, x, beta, y, idx_base);
+}
+
+template <typename T>
+__global__ void sellcsmvn_kernel_device_pointer(rocsparse_int m,
+                                                rocsparse_int n,
+                                                const T*      alpha,
+                                                const rocsparse_int* __restrict__ slice_ptr,
+                                                const rocsparse_int* __restrict__ perm,
+                                                const rocsparse_int* __restrict__ sell_col_ind,
+                                                const T* __restrict__ sell_val,
+                                                const T* __restrict__ x,
+                                                const T* beta,
+                                                T* __restrict__ y,
+                                                rocsparse_index_base idx_base)
+{
+    sellcsmvn_device(m, n, *alpha, slice_ptr, perm, sell_col_ind, sell_val, x, *beta, y, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_sellcsmv_template(rocsparse_handle           handle,
+                                             rocsparse_operation        trans,
+                                             const T*                   alpha,
+                                             const rocsparse_mat_descr  descr,
+                                             const rocsparse_sellcs_mat sell,
+                                             const T*                   x,
+                                             const T*                   beta,
+                                             T*                         y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xsellcsmv"),
+                  trans,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)sell,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f sellcsmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xsellcsmv"),
+                  trans,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)sell,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(sell->m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sell->n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sell->sell_nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(sell->m == 0 || sell->n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check SELL-C-sigma structure
+    if(sell->slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell->sigma > 1 && sell->perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell->sell_nnz > 0 && sell->col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell->sell_nnz > 0 && sell->val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different sellcsmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define SELLCSMVN_DIM 256
+        dim3 sellcsmvn_blocks((sell->m - 1) / SELLCSMVN_DIM + 1);
+        dim3 sellcsmvn_threads(SELLCSMVN_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((sellcsmvn_kernel_device_pointer<T>),
+                               sellcsmvn_blocks,
+                               sellcsmvn_threads,
+                               0,
+                               stream,
+                               sell->m,
+                               sell->n,
+                               alpha,
+                               sell->slice_ptr,
+                               sell->perm,
+                               sell->col_ind,
+                               (const T*)sell->val,
+                               x,
+                               beta,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            hipLaunchKernelGGL((sellcsmvn_kernel_host_pointer<T>),
+                               sellcsmvn_blocks,
+                               sellcsmvn_threads,
+                               0,
+                               stream,
+                               sell->m,
+                               sell->n,
+                               *alpha,
+                               sell->slice_ptr,
+                               sell->perm,
+                               sell->col_ind,
+                               (const T*)sell->val,
+                               x,
+                               *beta,
+                               y,
+                               descr->base);
+        }
+#undef SELLCSMVN_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_SELLCSMV_HPP
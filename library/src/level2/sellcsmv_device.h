@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef SELLCSMV_DEVICE_H
+#define SELLCSMV_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// SELL-C-sigma SpMV for general, non-transposed matrices. Each thread processes
+// one (sorted) row of a slice, accesses within a slice are coalesced.
+template <typename T>
+static __device__ void sellcsmvn_device(rocsparse_int        m,
+                                        rocsparse_int        n,
+                                        T                    alpha,
+                                        const rocsparse_int* slice_ptr,
+                                        const rocsparse_int* perm,
+                                        const rocsparse_int* sell_col_ind,
+                                        const T*             sell_val,
+                                        const T*             x,
+                                        T                    beta,
+                                        T*                   y,
+                                        rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockDim_x * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int slice  = ai / SELLCS_C;
+    rocsparse_int r      = ai % SELLCS_C;
+    rocsparse_int offset = slice_ptr[slice];
+    rocsparse_int width  = (slice_ptr[slice + 1] - offset) / SELLCS_C;
+
+    T sum = static_cast<T>(0);
+    for(rocsparse_int p = 0; p < width; ++p)
+    {
+        rocsparse_int idx = SELLCS_IND(offset, r, p);
+        rocsparse_int col = rocsparse_nontemporal_load(sell_col_ind + idx) - idx_base;
+
+        if(col >= 0 && col < n)
+        {
+            sum = rocsparse_fma(
+                rocsparse_nontemporal_load(sell_val + idx), rocsparse_ldg(x + col), sum);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Original row
+    rocsparse_int row = (perm != nullptr) ? perm[ai] : ai;
+
+    if(beta != static_cast<T>(0))
+    {
+        y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+    }
+    else
+    {
+        y[row] = alpha * sum;
+    }
+}
+
+#endif // SELLCSMV_DEVICE_H
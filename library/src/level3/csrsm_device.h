@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRSM_DEVICE_H
+#define CSRSM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Solves the rows given by map[offset, offset + m) for all right-hand sides. Each
+// wavefront processes a single row, where each lane accumulates one right-hand side.
+// The row is loaded in chunks of WF_SIZE entries into shared memory, such that
+// matrix entries are read and dependencies are waited for only once for up to
+// WF_SIZE right-hand sides. The entries of X that belong to a chunk are staged in
+// shared memory in tiles of XTILE entries, where consecutive lanes load consecutive
+// entries of the same right-hand side. If SPIN_LOOP is true, each row waits for its
+// dependencies by spinning on the done array. Otherwise, all dependencies must have
+// been resolved by previous kernel launches. Wavefronts of a block wait for
+// different rows, thus only the lanes of a wavefront are synchronized.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
+__device__ void csrsm_device(rocsparse_int m,
+                             rocsparse_int nrhs,
+                             T             alpha,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const T* __restrict__ csr_val,
+                             const T* __restrict__ B,
+                             rocsparse_int ldb,
+                             T* __restrict__ X,
+                             rocsparse_int ldx,
+                             int* __restrict__ done_array,
+                             const rocsparse_int* __restrict__ map,
+                             rocsparse_int offset,
+                             const rocsparse_int* __restrict__ csr_diag_ind,
+                             rocsparse_int* __restrict__ zero_pivot,
+                             rocsparse_index_base idx_base,
+                             rocsparse_fill_mode  fill_mode,
+                             rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Index into the row map
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Number of chunk entries of a tile of X, padded by one to avoid bank conflicts
+    static constexpr unsigned int XTILE = WF_SIZE / 4;
+
+    // Shared memory to hold a chunk of the current row and a tile of X
+    __shared__ rocsparse_int sdata_col[BLOCKSIZE];
+    __shared__ T             sdata_val[BLOCKSIZE];
+    __shared__ T             sdata_x[BLOCKSIZE * (XTILE + 1)];
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Shared memory of this wavefront
+    rocsparse_int* scol = sdata_col + wid * WF_SIZE;
+    T*             sval = sdata_val + wid * WF_SIZE;
+    T*             sx   = sdata_x + wid * WF_SIZE * (XTILE + 1);
+
+    // Get the row this wavefront will operate on
+    rocsparse_int row = map[idx + offset];
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Inverse of the diagonal entry
+    T diagonal = static_cast<T>(1);
+
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        rocsparse_int diag = csr_diag_ind[row];
+
+        // Structural zero pivots have been stored during analysis
+        if(diag != -1)
+        {
+            T diag_val = csr_val[diag];
+
+            // Check for numerical zero
+            if(diag_val == static_cast<T>(0))
+            {
+                // Numerical zero pivot found, avoid division by 0
+                // and store index for later use.
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+            }
+            else
+            {
+                diagonal = rocsparse_rcp(diag_val);
+            }
+        }
+    }
+
+    // Loop over blocks of right-hand sides, each lane processes one of them
+    for(rocsparse_int k_begin = 0; k_begin < nrhs; k_begin += WF_SIZE)
+    {
+        // Right-hand side this lane operates on
+        rocsparse_int k = k_begin + lid;
+
+        // Local summation variable
+        T local_sum = (k < nrhs) ? alpha * B[row + k * ldb] : static_cast<T>(0);
+
+        for(rocsparse_int j_begin = row_begin; j_begin < row_end; j_begin += WF_SIZE)
+        {
+            rocsparse_int j = j_begin + lid;
+
+            rocsparse_int local_col = -1;
+            T             local_val = static_cast<T>(0);
+
+            if(j < row_end)
+            {
+                local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+                local_val = rocsparse_nontemporal_load(csr_val + j);
+
+                // Ignore the diagonal and all entries of the other triangular part
+                if((fill_mode == rocsparse_fill_mode_lower && local_col >= row)
+                   || (fill_mode == rocsparse_fill_mode_upper && local_col <= row))
+                {
+                    local_col = -1;
+                }
+                else if(SPIN_LOOP && k_begin == 0)
+                {
+                    // Spin loop until dependency has been resolved. Dependencies hold
+                    // for all right-hand sides, thus we only wait once.
+                    while(!rocsparse_atomic_load(&done_array[local_col], __ATOMIC_ACQUIRE))
+                        ;
+                }
+            }
+
+            scol[lid] = local_col;
+            sval[lid] = local_val;
+
+            rocsparse_wavefront_barrier();
+
+            rocsparse_int chunk = min(static_cast<rocsparse_int>(WF_SIZE), row_end - j_begin);
+
+            for(rocsparse_int l_begin = 0; l_begin < chunk; l_begin += XTILE)
+            {
+                // Load the tile of X, the columns of a row are sorted, such that
+                // consecutive entries of the chunk are close to each other in X
+                for(unsigned int i = lid; i < XTILE * WF_SIZE; i += WF_SIZE)
+                {
+                    rocsparse_int l   = l_begin + i % XTILE;
+                    rocsparse_int kk  = k_begin + i / XTILE;
+                    rocsparse_int col = (l < chunk) ? scol[l] : -1;
+
+                    sx[(i / XTILE) * (XTILE + 1) + i % XTILE]
+                        = (col != -1 && kk < nrhs) ? X[col + kk * ldx] : static_cast<T>(0);
+                }
+
+                rocsparse_wavefront_barrier();
+
+                // Accumulate the tile for the right-hand side of this lane
+                if(k < nrhs)
+                {
+                    rocsparse_int tile
+                        = min(static_cast<rocsparse_int>(XTILE), chunk - l_begin);
+
+                    for(rocsparse_int l = 0; l < tile; ++l)
+                    {
+                        if(scol[l_begin + l] != -1)
+                        {
+                            local_sum = rocsparse_fma(
+                                -sval[l_begin + l], sx[lid * (XTILE + 1) + l], local_sum);
+                        }
+                    }
+                }
+
+                rocsparse_wavefront_barrier();
+            }
+        }
+
+        // Store the rows result in X
+        if(k < nrhs)
+        {
+            X[row + k * ldx] = local_sum * diagonal;
+        }
+    }
+
+    if(SPIN_LOOP)
+    {
+        // Make the results visible before setting the "row is done" flag
+        __threadfence();
+
+        if(lid == 0)
+        {
+            rocsparse_atomic_store(&done_array[row], 1, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+#endif // CSRSM_DEVICE_H
@@ -0,0 +1,507 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRSM_HPP
+#define ROCSPARSE_CSRSM_HPP
+
+#include "rocsparse.h"
+
+#include "csrsm_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <hip/hip_runtime.h>
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsm_host_pointer(rocsparse_int m,
+                            rocsparse_int nrhs,
+                            T             alpha,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            const rocsparse_int* __restrict__ csr_col_ind,
+                            const T* __restrict__ csr_val,
+                            const T* __restrict__ B,
+                            rocsparse_int ldb,
+                            T* __restrict__ X,
+                            rocsparse_int ldx,
+                            int* __restrict__ done_array,
+                            const rocsparse_int* __restrict__ map,
+                            rocsparse_int offset,
+                            const rocsparse_int* __restrict__ csr_diag_ind,
+                            rocsparse_int* __restrict__ zero_pivot,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode  fill_mode,
+                            rocsparse_diag_type  diag_type)
+{
+    csrsm_device<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>(m,
+                                                   nrhs,
+                                                   alpha,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csr_val,
+                                                   B,
+                                                   ldb,
+                                                   X,
+                                                   ldx,
+                                                   done_array,
+                                                   map,
+                                                   offset,
+                                                   csr_diag_ind,
+                                                   zero_pivot,
+                                                   idx_base,
+                                                   fill_mode,
+                                                   diag_type);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsm_device_pointer(rocsparse_int m,
+                              rocsparse_int nrhs,
+                              const T*      alpha,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              const T* __restrict__ csr_val,
+                              const T* __restrict__ B,
+                              rocsparse_int ldb,
+                              T* __restrict__ X,
+                              rocsparse_int ldx,
+                              int* __restrict__ done_array,
+                              const rocsparse_int* __restrict__ map,
+                              rocsparse_int offset,
+                              const rocsparse_int* __restrict__ csr_diag_ind,
+                              rocsparse_int* __restrict__ zero_pivot,
+                              rocsparse_index_base idx_base,
+                              rocsparse_fill_mode  fill_mode,
+                              rocsparse_diag_type  diag_type)
+{
+    csrsm_device<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>(m,
+                                                   nrhs,
+                                                   *alpha,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csr_val,
+                                                   B,
+                                                   ldb,
+                                                   X,
+                                                   ldx,
+                                                   done_array,
+                                                   map,
+                                                   offset,
+                                                   csr_diag_ind,
+                                                   zero_pivot,
+                                                   idx_base,
+                                                   fill_mode,
+                                                   diag_type);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SPIN_LOOP>
+static void rocsparse_csrsm_launch(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nrhs,
+                                   rocsparse_int             offset,
+                                   const T*                  alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_csrtr_info      csrsv,
+                                   const T*                  B,
+                                   rocsparse_int             ldb,
+                                   T*                        X,
+                                   rocsparse_int             ldx,
+                                   int*                      done_array)
+{
+    dim3 csrsm_blocks((WF_SIZE * m - 1) / BLOCKSIZE + 1);
+    dim3 csrsm_threads(BLOCKSIZE);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrsm_device_pointer<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>),
+                           csrsm_blocks,
+                           csrsm_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           nrhs,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           B,
+                           ldb,
+                           X,
+                           ldx,
+                           done_array,
+                           csrsv->row_map,
+                           offset,
+                           csrsv->csr_diag_ind,
+                           csrsv->zero_pivot,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrsm_host_pointer<T, BLOCKSIZE, WF_SIZE, SPIN_LOOP>),
+                           csrsm_blocks,
+                           csrsm_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           nrhs,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           B,
+                           ldb,
+                           X,
+                           ldx,
+                           done_array,
+                           csrsv->row_map,
+                           offset,
+                           csrsv->csr_diag_ind,
+                           csrsv->zero_pivot,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static void rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_csrtr_info      csrsv,
+                                           const T*                  B,
+                                           rocsparse_int             ldb,
+                                           T*                        X,
+                                           rocsparse_int             ldx,
+                                           int*                      done_array)
+{
+    if(csrsv->level_ptr.empty() == true)
+    {
+        // Solve all rows at once, waiting for dependencies in a spin loop
+        rocsparse_csrsm_launch<T, BLOCKSIZE, WF_SIZE, true>(handle,
+                                                            m,
+                                                            nrhs,
+                                                            0,
+                                                            alpha,
+                                                            descr,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            csrsv,
+                                                            B,
+                                                            ldb,
+                                                            X,
+                                                            ldx,
+                                                            done_array);
+    }
+    else
+    {
+        // Solve level by level, all dependencies of a level have been resolved by
+        // the previous launches
+        rocsparse_int num_levels = csrsv->level_ptr.size() - 1;
+
+        for(rocsparse_int i = 0; i < num_levels; ++i)
+        {
+            rocsparse_int offset = csrsv->level_ptr[i];
+            rocsparse_int rows   = csrsv->level_ptr[i + 1] - offset;
+
+            rocsparse_csrsm_launch<T, BLOCKSIZE, WF_SIZE, false>(handle,
+                                                                 rows,
+                                                                 nrhs,
+                                                                 offset,
+                                                                 alpha,
+                                                                 descr,
+                                                                 csr_val,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 csrsv,
+                                                                 B,
+                                                                 ldb,
+                                                                 X,
+                                                                 ldx,
+                                                                 done_array);
+        }
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nrhs,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const T*                  B,
+                                                rocsparse_int             ldb,
+                                                T*                        X,
+                                                rocsparse_int             ldx,
+                                                rocsparse_solve_policy    policy,
+                                                void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsm_solve"),
+                  trans,
+                  m,
+                  nrhs,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)X,
+                  ldx,
+                  policy,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrsm -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> ",
+                  "-n",
+                  nrhs,
+                  "--alpha",
+                  *alpha);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsm_solve"),
+                  trans,
+                  m,
+                  nrhs,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)X,
+                  ldx,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nrhs == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check leading dimensions
+    if(ldb < std::max(1, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldx < std::max(1, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(X == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+
+    // done array
+    int* done_array = reinterpret_cast<int*>(ptr);
+
+    // csrsm uses the meta data gathered by csrsv analysis
+    rocsparse_csrtr_info csrsv = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                     ? info->csrsv_upper_info
+                                     : info->csrsv_lower_info;
+
+    if(csrsv == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
+    {
+        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csrsv->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+        // Wait for device transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    // Initialize buffers
+    if(csrsv->level_ptr.empty() == true)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
+    }
+
+#define CSRSM_DIM 256
+    if(handle->wavefront_size == 32)
+    {
+        rocsparse_csrsm_solve_dispatch<T, CSRSM_DIM, 32>(handle,
+                                                         m,
+                                                         nrhs,
+                                                         alpha,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         csrsv,
+                                                         B,
+                                                         ldb,
+                                                         X,
+                                                         ldx,
+                                                         done_array);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        rocsparse_csrsm_solve_dispatch<T, CSRSM_DIM, 64>(handle,
+                                                         m,
+                                                         nrhs,
+                                                         alpha,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         csrsv,
+                                                         B,
+                                                         ldb,
+                                                         X,
+                                                         ldx,
+                                                         done_array);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRSM_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRSM_HPP
@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRCHEBY_DEVICE_H
+#define CSRCHEBY_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Epilogue of the CSR-Adaptive kernel for one step of the Chebyshev recurrence
+//   d := c1 * d + c2 * (r - A * z)
+//   z_next := z + d
+// The products of rows that are processed by CSR-LongRows are accumulated into w.
+template <typename T>
+struct csrcheby_epilogue
+{
+    T  beta;
+    T* y;
+
+    T        c1;
+    T        c2;
+    const T* r;
+    const T* z;
+    T*       d;
+    T*       z_next;
+
+    __device__ void operator()(rocsparse_int row, T sum) const
+    {
+        T dk = rocsparse_fma(c1, d[row], c2 * (r[row] - sum));
+
+        d[row]      = dk;
+        z_next[row] = z[row] + dk;
+    }
+};
+
+// First step of the Chebyshev recurrence with zero initial guess, d = z = r / theta
+template <typename T>
+__device__ void csrcheby_init_device(
+    rocsparse_int m, T inv_theta, const T* __restrict__ r, T* __restrict__ d, T* __restrict__ z)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    T dk = inv_theta * r[row];
+
+    d[row] = dk;
+    z[row] = dk;
+}
+
+#endif // CSRCHEBY_DEVICE_H
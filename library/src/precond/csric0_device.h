@@ -0,0 +1,365 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRIC0_DEVICE_H
+#define CSRIC0_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, unsigned int HASH>
+__global__ void csric0_hash_kernel(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   T* __restrict__ csr_val,
+                                   const rocsparse_int* __restrict__ csr_diag_ind,
+                                   int* __restrict__ done,
+                                   const rocsparse_int* __restrict__ map,
+                                   rocsparse_int* __restrict__ zero_pivot,
+                                   rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    __shared__ rocsparse_int stable[BLOCKSIZE * HASH];
+    __shared__ rocsparse_int sdata[BLOCKSIZE * HASH];
+
+    // Pointer to each wavefronts shared data
+    rocsparse_int* table = &stable[wid * WF_SIZE * HASH];
+    rocsparse_int* data  = &sdata[wid * WF_SIZE * HASH];
+
+    // Initialize hash table with -1
+    for(unsigned int j = lid; j < WF_SIZE * HASH; j += WF_SIZE)
+    {
+        table[j] = -1;
+    }
+
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag  = csr_diag_ind[row];
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+
+    // Structural zero pivot, has already been reported by the analysis
+    if(row_diag == -1)
+    {
+        if(lid == 0)
+        {
+            rocsparse_atomic_store(&done[row], 1, __ATOMIC_RELEASE);
+        }
+
+        return;
+    }
+
+    // Fill hash table
+    // Loop over the strictly lower part of the current row and fill hash table with
+    // row dependencies. Each lane processes one entry
+    for(rocsparse_int j = row_begin + lid; j < row_diag; j += WF_SIZE)
+    {
+        // Insert key into hash table
+        rocsparse_int key = csr_col_ind[j];
+        // Compute hash
+        rocsparse_int hash = (key * 103) & (WF_SIZE * HASH - 1);
+
+        // Hash operation
+        while(true)
+        {
+            if(table[hash] == key)
+            {
+                // key is already inserted, done
+                break;
+            }
+            else if(atomicCAS(&table[hash], -1, key) == -1)
+            {
+                // inserted key into the table, done
+                data[hash] = j;
+                break;
+            }
+            else
+            {
+                // collision, compute new hash
+                hash = (hash + 1) & (WF_SIZE * HASH - 1);
+            }
+        }
+    }
+
+    // Sum of squares of the strictly lower part of the current row
+    T row_sum = static_cast<T>(0);
+
+    // Loop over the strictly lower part of the current row
+    for(rocsparse_int j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+        // Begin of the row that corresponds to local_col
+        rocsparse_int local_begin = csr_row_ptr[local_col] - idx_base;
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Spin loop until dependency has been resolved
+        while(!rocsparse_atomic_load(&done[local_col], __ATOMIC_ACQUIRE))
+            ;
+
+        // Load diagonal entry, a structural zero is treated as numerical zero
+        T diag_val = (local_diag == -1) ? static_cast<T>(0) : csr_val[local_diag];
+
+        // Row has numerical zero diagonal
+        if(diag_val == static_cast<T>(0))
+        {
+            if(lid == 0)
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, local_col + idx_base);
+            }
+
+            // Skip this row if it has a zero pivot
+            break;
+        }
+
+        // Inner product of the current row and row local_col, restricted to the
+        // columns left of local_col. Each lane processes one entry
+        T local_sum = static_cast<T>(0);
+
+        for(rocsparse_int k = local_begin + lid; k < local_diag; k += WF_SIZE)
+        {
+            // Get value from hash table
+            rocsparse_int key = csr_col_ind[k];
+            // Compute hash
+            rocsparse_int hash = (key * 103) & (WF_SIZE * HASH - 1);
+
+            // Hash operation
+            while(true)
+            {
+                if(table[hash] == -1)
+                {
+                    // No entry for the key, done
+                    break;
+                }
+                else if(table[hash] == key)
+                {
+                    // Entry found, accumulate product
+                    local_sum = rocsparse_fma(csr_val[data[hash]], csr_val[k], local_sum);
+                    break;
+                }
+                else
+                {
+                    // Collision, compute new hash
+                    hash = (hash + 1) & (WF_SIZE * HASH - 1);
+                }
+            }
+        }
+
+        // Reduce and broadcast the inner product within the wavefront
+        local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+        local_sum = __shfl(local_sum, WF_SIZE - 1, WF_SIZE);
+
+        T local_val = (csr_val[j] - local_sum) / diag_val;
+        row_sum     = rocsparse_fma(local_val, local_val, row_sum);
+
+        if(lid == 0)
+        {
+            csr_val[j] = local_val;
+        }
+    }
+
+    if(lid == 0)
+    {
+        // Compute the diagonal entry
+        T diag_val = csr_val[row_diag] - row_sum;
+
+        // Matrix is not positive definite
+        if(diag_val <= static_cast<T>(0))
+        {
+            // We are looking for the first zero pivot
+            atomicMin(zero_pivot, row + idx_base);
+
+            diag_val = static_cast<T>(0);
+        }
+
+        csr_val[row_diag] = sqrt(diag_val);
+
+        // Lane 0 write "we are done" flag
+        rocsparse_atomic_store(&done[row], 1, __ATOMIC_RELEASE);
+    }
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csric0_binsearch_kernel(rocsparse_int m,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        T* __restrict__ csr_val,
+                                        const rocsparse_int* __restrict__ csr_diag_ind,
+                                        int* __restrict__ done,
+                                        const rocsparse_int* __restrict__ map,
+                                        rocsparse_int* __restrict__ zero_pivot,
+                                        rocsparse_index_base idx_base)
+{
+    int           tid = hipThreadIdx_x;
+    int           lid = tid & (WF_SIZE - 1);
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int idx = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag  = csr_diag_ind[row];
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+
+    // Structural zero pivot, has already been reported by the analysis
+    if(row_diag == -1)
+    {
+        if(lid == 0)
+        {
+            rocsparse_atomic_store(&done[row], 1, __ATOMIC_RELEASE);
+        }
+
+        return;
+    }
+
+    // Sum of squares of the strictly lower part of the current row
+    T row_sum = static_cast<T>(0);
+
+    // Loop over the strictly lower part of the current row
+    for(rocsparse_int j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+        // Begin of the row that corresponds to local_col
+        rocsparse_int local_begin = csr_row_ptr[local_col] - idx_base;
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Spin loop until dependency has been resolved
+        while(!rocsparse_atomic_load(&done[local_col], __ATOMIC_ACQUIRE))
+            ;
+
+        // Load diagonal entry, a structural zero is treated as numerical zero
+        T diag_val = (local_diag == -1) ? static_cast<T>(0) : csr_val[local_diag];
+
+        // Row has numerical zero diagonal
+        if(diag_val == static_cast<T>(0))
+        {
+            if(lid == 0)
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, local_col + idx_base);
+            }
+
+            // Skip this row if it has a zero pivot
+            break;
+        }
+
+        // Inner product of the current row and row local_col, restricted to the
+        // columns left of local_col. Each lane processes one entry
+        T local_sum = static_cast<T>(0);
+
+        // The first entry of the current row has no entries to its left
+        if(j > row_begin)
+        {
+            for(rocsparse_int k = local_begin + lid; k < local_diag; k += WF_SIZE)
+            {
+                // Perform a binary search to find matching columns
+                rocsparse_int l     = row_begin;
+                rocsparse_int r     = j - 1;
+                rocsparse_int m     = (r + l) >> 1;
+                rocsparse_int col_j = csr_col_ind[m];
+
+                rocsparse_int col_k = csr_col_ind[k];
+
+                // Binary search
+                while(l < r)
+                {
+                    if(col_j < col_k)
+                    {
+                        l = m + 1;
+                    }
+                    else
+                    {
+                        r = m;
+                    }
+
+                    m     = (r + l) >> 1;
+                    col_j = csr_col_ind[m];
+                }
+
+                // Check if a match has been found
+                if(col_j == col_k)
+                {
+                    // If a match has been found, accumulate product
+                    local_sum = rocsparse_fma(csr_val[l], csr_val[k], local_sum);
+                }
+            }
+        }
+
+        // Reduce and broadcast the inner product within the wavefront
+        local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+        local_sum = __shfl(local_sum, WF_SIZE - 1, WF_SIZE);
+
+        T local_val = (csr_val[j] - local_sum) / diag_val;
+        row_sum     = rocsparse_fma(local_val, local_val, row_sum);
+
+        if(lid == 0)
+        {
+            csr_val[j] = local_val;
+        }
+    }
+
+    if(lid == 0)
+    {
+        // Compute the diagonal entry
+        T diag_val = csr_val[row_diag] - row_sum;
+
+        // Matrix is not positive definite
+        if(diag_val <= static_cast<T>(0))
+        {
+            // We are looking for the first zero pivot
+            atomicMin(zero_pivot, row + idx_base);
+
+            diag_val = static_cast<T>(0);
+        }
+
+        csr_val[row_diag] = sqrt(diag_val);
+
+        // Lane 0 write "we are done" flag
+        rocsparse_atomic_store(&done[row], 1, __ATOMIC_RELEASE);
+    }
+}
+
+#endif // CSRIC0_DEVICE_H
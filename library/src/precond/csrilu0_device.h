@@ -29,6 +29,28 @@
 
 #include <hip/hip_runtime.h>
 
+// Replaces the diagonal entry of the current row by boost_val, if its magnitude does
+// not exceed boost_tol, and counts the number of boosted rows
+template <typename T>
+__device__ __forceinline__ void csrilu0_boost_pivot(T* __restrict__ csr_val,
+                                                    rocsparse_int row_diag,
+                                                    T             boost_tol,
+                                                    T             boost_val,
+                                                    rocsparse_int* __restrict__ boost_count)
+{
+    // Structural zero pivots cannot be boosted
+    if(row_diag == -1)
+    {
+        return;
+    }
+
+    if(rocsparse_abs(csr_val[row_diag]) <= boost_tol)
+    {
+        csr_val[row_diag] = boost_val;
+        atomicAdd(boost_count, 1);
+    }
+}
+
 template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, unsigned int HASH>
 __global__ void csrilu0_hash_kernel(rocsparse_int m,
                                     const rocsparse_int* __restrict__ csr_row_ptr,
@@ -38,6 +60,10 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
                                     int* __restrict__ done,
                                     const rocsparse_int* __restrict__ map,
                                     rocsparse_int* __restrict__ zero_pivot,
+                                    int boost,
+                                    T   boost_tol,
+                                    T   boost_val,
+                                    rocsparse_int* __restrict__ boost_count,
                                     rocsparse_index_base idx_base)
 {
     int lid = hipThreadIdx_x & (WF_SIZE - 1);
@@ -179,6 +205,12 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
 
     if(lid == 0)
     {
+        // Boost tiny pivot of the current row, if requested
+        if(boost)
+        {
+            csrilu0_boost_pivot(csr_val, row_diag, boost_tol, boost_val, boost_count);
+        }
+
         // Lane 0 write "we are done" flag
         rocsparse_atomic_store(&done[row], 1, __ATOMIC_RELEASE);
     }
@@ -193,6 +225,10 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
                                          int* __restrict__ done,
                                          const rocsparse_int* __restrict__ map,
                                          rocsparse_int* __restrict__ zero_pivot,
+                                         int boost,
+                                         T   boost_tol,
+                                         T   boost_val,
+                                         rocsparse_int* __restrict__ boost_count,
                                          rocsparse_index_base idx_base)
 {
     int           tid = hipThreadIdx_x;
@@ -292,9 +328,444 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
 
     if(lid == 0)
     {
+        // Boost tiny pivot of the current row, if requested
+        if(boost)
+        {
+            csrilu0_boost_pivot(csr_val, row_diag, boost_tol, boost_val, boost_count);
+        }
+
         // Lane 0 write "we are done" flag
         rocsparse_atomic_store(&done[row], 1, __ATOMIC_RELEASE);
     }
 }
 
+// Sparse inner product of the current row of L and column col of U, restricted to the
+// entries left of column limit
+template <typename T>
+__device__ __forceinline__ T csrilu0_iter_sum(rocsparse_int        row_begin,
+                                              rocsparse_int        row_end,
+                                              rocsparse_int        col,
+                                              rocsparse_int        limit,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              const T*             csr_val,
+                                              const rocsparse_int* csr_diag_ind,
+                                              rocsparse_index_base idx_base)
+{
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int k = row_begin; k < row_end; ++k)
+    {
+        rocsparse_int col_k = csr_col_ind[k] - idx_base;
+
+        // Only entries of L left of limit contribute
+        if(col_k >= limit)
+        {
+            break;
+        }
+
+        // Entry (col_k, col) of U is located in the upper part of row col_k
+        rocsparse_int l = csr_diag_ind[col_k];
+        rocsparse_int r = csr_row_ptr[col_k + 1] - idx_base - 1;
+
+        if(l == -1)
+        {
+            l = csr_row_ptr[col_k] - idx_base;
+        }
+
+        // Binary search
+        while(l < r)
+        {
+            rocsparse_int mid = (l + r) >> 1;
+
+            if(csr_col_ind[mid] - idx_base < col)
+            {
+                l = mid + 1;
+            }
+            else
+            {
+                r = mid;
+            }
+        }
+
+        // Check if a match has been found
+        if(l == r && csr_col_ind[l] - idx_base == col)
+        {
+            sum = rocsparse_fma(csr_val[k], csr_val[l], sum);
+        }
+    }
+
+    return sum;
+}
+
+// One asynchronous fixed-point sweep of the iterative incomplete LU factorization.
+// Each row is processed by WF_SIZE threads, where each thread updates a single entry
+// of L or U in place, using the most recent values of all other entries.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csrilu0_iter_kernel(rocsparse_int m,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const T* __restrict__ csr_val,
+                                    T*                   ilu0_val,
+                                    const rocsparse_int* __restrict__ csr_diag_ind,
+                                    rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int col_j = csr_col_ind[j] - idx_base;
+
+        T val = csr_val[j]
+                - csrilu0_iter_sum(row_begin,
+                                   row_end,
+                                   col_j,
+                                   min(row, col_j),
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   (const T*)ilu0_val,
+                                   csr_diag_ind,
+                                   idx_base);
+
+        // Entries of L are scaled by the diagonal entry of U
+        if(col_j < row)
+        {
+            rocsparse_int diag = csr_diag_ind[col_j];
+
+            // Keep the previous value, if the pivot is zero
+            if(diag == -1 || ilu0_val[diag] == static_cast<T>(0))
+            {
+                continue;
+            }
+
+            val /= ilu0_val[diag];
+        }
+
+        ilu0_val[j] = val;
+    }
+}
+
+// Computes the squared residual ||A - LU||_F of the current iterate, restricted to the
+// sparsity pattern of A. The partial sums of each block are stored in workspace.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csrilu0_iter_residual_part1(rocsparse_int m,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            const T* __restrict__ ilu0_val,
+                                            const rocsparse_int* __restrict__ csr_diag_ind,
+                                            T* __restrict__ workspace,
+                                            rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    int lid = tid & (WF_SIZE - 1);
+
+    __shared__ T sdata[BLOCKSIZE];
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + tid) / WF_SIZE; row < m;
+        row += hipGridDim_x * BLOCKSIZE / WF_SIZE)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col_j = csr_col_ind[j] - idx_base;
+
+            // Entry of LU, where L has unit diagonal
+            T lu = ilu0_val[j];
+
+            if(col_j < row)
+            {
+                rocsparse_int diag = csr_diag_ind[col_j];
+
+                lu *= (diag == -1) ? static_cast<T>(0) : ilu0_val[diag];
+            }
+
+            T res = csr_val[j] - lu
+                    - csrilu0_iter_sum(row_begin,
+                                       row_end,
+                                       col_j,
+                                       min(row, col_j),
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       ilu0_val,
+                                       csr_diag_ind,
+                                       idx_base);
+
+            sum = rocsparse_fma(res, res, sum);
+        }
+    }
+
+    sdata[tid] = sum;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrilu0_iter_residual_part2(rocsparse_int n, T* workspace, T* residual)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ T sdata[BLOCKSIZE];
+    sdata[tid] = static_cast<T>(0);
+
+    for(rocsparse_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        sdata[tid] += workspace[i];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        if(residual)
+        {
+            *residual = sqrt(sdata[0]);
+        }
+        else
+        {
+            workspace[0] = sqrt(sdata[0]);
+        }
+    }
+}
+
+// Reports numerical zero pivots of the iterative incomplete LU factorization
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrilu0_iter_pivot_kernel(rocsparse_int m,
+                                          const T* __restrict__ ilu0_val,
+                                          const rocsparse_int* __restrict__ csr_diag_ind,
+                                          rocsparse_int* __restrict__ zero_pivot,
+                                          rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int diag = csr_diag_ind[row];
+
+    // Structural zero pivots have already been reported by the analysis
+    if(diag != -1 && ilu0_val[diag] == static_cast<T>(0))
+    {
+        // We are looking for the first zero pivot
+        atomicMin(zero_pivot, row + idx_base);
+    }
+}
+
+// Computes the update lists of the csrilu0 refactorization. For each entry j of the
+// strictly lower part, all pairs (k, l) are collected, where entry k of the upper part
+// of row col(j) updates entry l of the current row. If FILL is false, only the number
+// of updates of entry j is computed and stored in update_ptr[j + 1].
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool FILL>
+__global__ void csrilu0_refactor_analysis_kernel(rocsparse_int m,
+                                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                                 const rocsparse_int* __restrict__ csr_diag_ind,
+                                                 rocsparse_int* __restrict__ update_ptr,
+                                                 rocsparse_int* __restrict__ update_src,
+                                                 rocsparse_int* __restrict__ update_dst,
+                                                 rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = csr_diag_ind[row];
+    rocsparse_int row_end  = csr_row_ptr[row + 1] - idx_base;
+
+    // Loop over the strictly lower part of the current row, rows with structural zero
+    // pivot are not processed. Each lane processes one entry
+    for(rocsparse_int j = csr_row_ptr[row] - idx_base + lid; j < row_diag; j += WF_SIZE)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+        // End of the row that corresponds to local_col
+        rocsparse_int local_end = csr_row_ptr[local_col + 1] - idx_base;
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, same treatment as in the factorization
+        if(local_diag == -1)
+        {
+            local_diag = local_end - 1;
+        }
+
+        rocsparse_int offset = FILL ? update_ptr[j] : 0;
+        rocsparse_int count  = 0;
+
+        // Columns of the upper part of row local_col are increasing, thus the search
+        // range of the current row can be narrowed down after each lookup
+        rocsparse_int l = j + 1;
+
+        for(rocsparse_int k = local_diag + 1; k < local_end; ++k)
+        {
+            rocsparse_int col_k = csr_col_ind[k];
+            rocsparse_int r     = row_end - 1;
+
+            // Binary search
+            while(l < r)
+            {
+                rocsparse_int mid = (l + r) >> 1;
+
+                if(csr_col_ind[mid] < col_k)
+                {
+                    l = mid + 1;
+                }
+                else
+                {
+                    r = mid;
+                }
+            }
+
+            // Check if a match has been found
+            if(l < row_end && csr_col_ind[l] == col_k)
+            {
+                if(FILL)
+                {
+                    update_src[offset + count] = k;
+                    update_dst[offset + count] = l;
+                }
+
+                ++count;
+            }
+        }
+
+        if(!FILL)
+        {
+            update_ptr[j + 1] = count;
+        }
+    }
+}
+
+// Numeric csrilu0 refactorization, using the update lists that have been computed by
+// the analysis. Rows flag their completion with the current epoch, such that the
+// done array does not need to be reset in between calls.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csrilu0_refactor_kernel(rocsparse_int m,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        T* __restrict__ csr_val,
+                                        const rocsparse_int* __restrict__ csr_diag_ind,
+                                        const rocsparse_int* __restrict__ update_ptr,
+                                        const rocsparse_int* __restrict__ update_src,
+                                        const rocsparse_int* __restrict__ update_dst,
+                                        int* __restrict__ done,
+                                        int epoch,
+                                        const rocsparse_int* __restrict__ map,
+                                        rocsparse_int* __restrict__ zero_pivot,
+                                        int boost,
+                                        T   boost_tol,
+                                        T   boost_val,
+                                        rocsparse_int* __restrict__ boost_count,
+                                        rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    rocsparse_int idx = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = csr_diag_ind[row];
+
+    // Loop over the strictly lower part of the current row
+    for(rocsparse_int j = csr_row_ptr[row] - idx_base; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, same treatment as in the factorization
+        if(local_diag == -1)
+        {
+            local_diag = csr_row_ptr[local_col + 1] - idx_base - 1;
+        }
+
+        // Spin loop until dependency has been resolved
+        while(rocsparse_atomic_load(&done[local_col], __ATOMIC_ACQUIRE) != epoch)
+            ;
+
+        // Load diagonal entry
+        T diag_val = csr_val[local_diag];
+
+        // Row has numerical zero diagonal
+        if(diag_val == static_cast<T>(0))
+        {
+            if(lid == 0)
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, local_col);
+            }
+
+            // Skip this row if it has a zero pivot
+            break;
+        }
+
+        T local_val = csr_val[j] / diag_val;
+
+        csr_val[j] = local_val;
+
+        // Gather and update. Each lane processes one update
+        for(rocsparse_int k = update_ptr[j] + lid; k < update_ptr[j + 1]; k += WF_SIZE)
+        {
+            rocsparse_int l = update_dst[k];
+
+            csr_val[l] = rocsparse_fma(-local_val, csr_val[update_src[k]], csr_val[l]);
+        }
+    }
+
+    if(lid == 0)
+    {
+        // Boost tiny pivot of the current row, if requested
+        if(boost)
+        {
+            csrilu0_boost_pivot(csr_val, row_diag, boost_tol, boost_val, boost_count);
+        }
+
+        // Lane 0 write "we are done" flag
+        rocsparse_atomic_store(&done[row], epoch, __ATOMIC_RELEASE);
+    }
+}
+
 #endif // CSRILU0_DEVICE_H
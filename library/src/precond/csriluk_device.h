@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRILUK_DEVICE_H
+#define CSRILUK_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Scatters the entries of A into the sparsity pattern of the factorized matrix. All
+// fill-in entries of the factorized matrix must be initialized with zero.
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_scatter_kernel(rocsparse_int nnz,
+                                const T* __restrict__ csr_val,
+                                const rocsparse_int* __restrict__ lu_map,
+                                T* __restrict__ lu_val)
+{
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(idx >= nnz)
+    {
+        return;
+    }
+
+    lu_val[lu_map[idx]] = csr_val[idx];
+}
+
+#endif // CSRILUK_DEVICE_H
@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRJACOBI_DEVICE_H
+#define CSRJACOBI_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Maximum dimension of the diagonal blocks of the block Jacobi smoother
+#define CSRJACOBI_MAX_BLOCK_DIM 8
+
+// Computes the inverse diagonal scaling of the point Jacobi smoother, or of the l1
+// Jacobi smoother, where each row is scaled by its l1 norm. Rows with vanishing
+// scaling are not updated by the smoother.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool L1>
+__global__ void csrjacobi_diag_kernel(rocsparse_int m,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const T* __restrict__ csr_val,
+                                      T* __restrict__ inv_diag,
+                                      rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    T diag = static_cast<T>(0);
+
+    // Each lane processes one entry
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        if(L1)
+        {
+            diag += rocsparse_abs(csr_val[j]);
+        }
+        else if(csr_col_ind[j] - idx_base == row)
+        {
+            diag += csr_val[j];
+        }
+    }
+
+    // Obtain scaling using parallel reduction
+    diag = rocsparse_wfreduce_sum<WF_SIZE>(diag);
+
+    // Last lane writes the inverse scaling
+    if(lid == WF_SIZE - 1)
+    {
+        inv_diag[row] = (diag != static_cast<T>(0)) ? static_cast<T>(1) / diag : static_cast<T>(0);
+    }
+}
+
+// Computes the inverse of each diagonal block of dimension BLOCKDIM of the block Jacobi
+// smoother, using Gauss-Jordan elimination with partial pivoting. Each thread processes
+// one block, where the trailing block is padded with the identity. Singular blocks are
+// set to zero, such that their rows are not updated by the smoother. The block
+// dimension is a template parameter, such that the blocks are kept in registers.
+template <typename T, unsigned int BLOCKSIZE, unsigned int BLOCKDIM>
+__global__ void csrjacobi_block_diag_kernel(rocsparse_int m,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            T* __restrict__ inv_block,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int block = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(block >= (m - 1) / BLOCKDIM + 1)
+    {
+        return;
+    }
+
+    T a[BLOCKDIM][BLOCKDIM];
+    T inv[BLOCKDIM][BLOCKDIM];
+
+    rocsparse_int offset = block * BLOCKDIM;
+
+    // Extract the diagonal block
+    for(rocsparse_int i = 0; i < BLOCKDIM; ++i)
+    {
+        for(rocsparse_int k = 0; k < BLOCKDIM; ++k)
+        {
+            a[i][k]   = static_cast<T>(0);
+            inv[i][k] = (i == k) ? static_cast<T>(1) : static_cast<T>(0);
+        }
+
+        rocsparse_int row = offset + i;
+
+        // Padding
+        if(row >= m)
+        {
+            a[i][i] = static_cast<T>(1);
+            continue;
+        }
+
+        rocsparse_int row_end = csr_row_ptr[row + 1] - idx_base;
+
+        for(rocsparse_int j = csr_row_ptr[row] - idx_base; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base - offset;
+
+            if(col >= 0 && col < BLOCKDIM)
+            {
+                a[i][col] += csr_val[j];
+            }
+        }
+    }
+
+    bool singular = false;
+
+    // Gauss-Jordan elimination
+    for(rocsparse_int k = 0; k < BLOCKDIM; ++k)
+    {
+        // Determine pivot
+        rocsparse_int p = k;
+
+        for(rocsparse_int i = k + 1; i < BLOCKDIM; ++i)
+        {
+            if(rocsparse_abs(a[i][k]) > rocsparse_abs(a[p][k]))
+            {
+                p = i;
+            }
+        }
+
+        if(a[p][k] == static_cast<T>(0))
+        {
+            singular = true;
+            break;
+        }
+
+        // Swap rows
+        if(p != k)
+        {
+            for(rocsparse_int l = 0; l < BLOCKDIM; ++l)
+            {
+                T tmp     = a[k][l];
+                a[k][l]   = a[p][l];
+                a[p][l]   = tmp;
+                tmp       = inv[k][l];
+                inv[k][l] = inv[p][l];
+                inv[p][l] = tmp;
+            }
+        }
+
+        // Scale pivot row
+        T scale = static_cast<T>(1) / a[k][k];
+
+        for(rocsparse_int l = 0; l < BLOCKDIM; ++l)
+        {
+            a[k][l] *= scale;
+            inv[k][l] *= scale;
+        }
+
+        // Eliminate column k in all other rows
+        for(rocsparse_int i = 0; i < BLOCKDIM; ++i)
+        {
+            if(i == k)
+            {
+                continue;
+            }
+
+            T factor = a[i][k];
+
+            for(rocsparse_int l = 0; l < BLOCKDIM; ++l)
+            {
+                a[i][l]   = rocsparse_fma(-factor, a[k][l], a[i][l]);
+                inv[i][l] = rocsparse_fma(-factor, inv[k][l], inv[i][l]);
+            }
+        }
+    }
+
+    // Write the inverse block in row major order
+    for(rocsparse_int i = 0; i < BLOCKDIM; ++i)
+    {
+        for(rocsparse_int k = 0; k < BLOCKDIM; ++k)
+        {
+            inv_block[(offset + i) * BLOCKDIM + k] = singular ? static_cast<T>(0) : inv[i][k];
+        }
+    }
+}
+
+// One sweep of the point or l1 Jacobi smoother
+//   y = x + omega * D^{-1} * (b - A * x)
+// where the residual is computed on the fly, such that no intermediate vector is
+// required. Each wavefront processes one row.
+template <typename T, unsigned int WF_SIZE>
+static __device__ void csrjacobi_device(rocsparse_int m,
+                                        T             omega,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        const T* __restrict__ csr_val,
+                                        const T* __restrict__ inv_diag,
+                                        const T* __restrict__ b,
+                                        const T* __restrict__ x,
+                                        T* __restrict__ y,
+                                        rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    rocsparse_int row = (hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x) / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    // Loop over non-zero elements
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        sum = rocsparse_fma(csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+    }
+
+    // Obtain row sum using parallel reduction
+    sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+    // Last lane of each wavefront updates the row
+    if(lid == WF_SIZE - 1)
+    {
+        y[row] = rocsparse_fma(omega * inv_diag[row], b[row] - sum, x[row]);
+    }
+}
+
+// One sweep of the block Jacobi smoother
+//   y = x + omega * D^{-1} * (b - A * x)
+// where D holds the diagonal blocks of dimension BLOCKDIM. Each wavefront processes
+// one block, the residual of the block is kept in registers of each lane.
+template <typename T, unsigned int BLOCKDIM, unsigned int WF_SIZE>
+static __device__ void csrjacobi_block_device(rocsparse_int m,
+                                              T             omega,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const T* __restrict__ csr_val,
+                                              const T* __restrict__ inv_block,
+                                              const T* __restrict__ b,
+                                              const T* __restrict__ x,
+                                              T* __restrict__ y,
+                                              rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    rocsparse_int block  = (hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x) / WF_SIZE;
+    rocsparse_int offset = block * BLOCKDIM;
+
+    // Do not run out of bounds
+    if(offset >= m)
+    {
+        return;
+    }
+
+    T res[BLOCKDIM];
+
+    // Compute the residual of each row of the block
+    for(rocsparse_int i = 0; i < BLOCKDIM; ++i)
+    {
+        rocsparse_int row = offset + i;
+
+        // Padding
+        if(row >= m)
+        {
+            res[i] = static_cast<T>(0);
+            continue;
+        }
+
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+        }
+
+        // Obtain row sum using parallel reduction and broadcast it to all lanes
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+        sum = __shfl(sum, WF_SIZE - 1, WF_SIZE);
+
+        res[i] = b[row] - sum;
+    }
+
+    // Each lane updates one row of the block
+    rocsparse_int row = offset + lid;
+
+    if(lid < BLOCKDIM && row < m)
+    {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int k = 0; k < BLOCKDIM; ++k)
+        {
+            sum = rocsparse_fma(inv_block[row * BLOCKDIM + k], res[k], sum);
+        }
+
+        y[row] = rocsparse_fma(omega, sum, x[row]);
+    }
+}
+
+#endif // CSRJACOBI_DEVICE_H
@@ -0,0 +1,512 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRCHEBY_HPP
+#define ROCSPARSE_CSRCHEBY_HPP
+
+#include "../level2/rocsparse_csrmv.hpp"
+#include "csrcheby_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void csrcheby_init_kernel(
+    rocsparse_int m, T inv_theta, const T* __restrict__ r, T* __restrict__ d, T* __restrict__ z)
+{
+    csrcheby_init_device(m, inv_theta, r, d, z);
+}
+
+template <typename T>
+__launch_bounds__(WG_SIZE) __global__
+    void csrcheby_kernel(unsigned long long* __restrict__ row_blocks,
+                         T c1,
+                         T c2,
+                         const rocsparse_int* __restrict__ csr_row_ptr,
+                         const rocsparse_int* __restrict__ csr_col_ind,
+                         const T* __restrict__ csr_val,
+                         const T* __restrict__ r,
+                         const T* __restrict__ z,
+                         T* __restrict__ d,
+                         T* __restrict__ w,
+                         T* __restrict__ z_next,
+                         rocsparse_index_base idx_base)
+{
+    csrcheby_epilogue<T> epilogue = {static_cast<T>(0), w, c1, c2, r, z, d, z_next};
+
+    csrmvn_adaptive_epilogue_device<T,
+                                    BLOCKSIZE,
+                                    BLOCK_MULTIPLIER,
+                                    ROWS_FOR_VECTOR,
+                                    WG_BITS,
+                                    ROW_BITS,
+                                    WG_SIZE>(
+        row_blocks, static_cast<T>(1), csr_row_ptr, csr_col_ind, csr_val, z, epilogue, idx_base);
+}
+
+// Applies the Chebyshev epilogue to all rows that have been processed by CSR-LongRows.
+// Each thread inspects one row block, where the first workgroup of a long row is
+// identified by an empty row range and a zero workgroup id.
+template <typename T>
+__global__ void csrcheby_long_rows_kernel(rocsparse_int nblocks,
+                                          const unsigned long long* __restrict__ row_blocks,
+                                          rocsparse_int m,
+                                          T             c1,
+                                          T             c2,
+                                          const T* __restrict__ r,
+                                          const T* __restrict__ z,
+                                          T* __restrict__ d,
+                                          T* __restrict__ w,
+                                          T* __restrict__ z_next)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= nblocks)
+    {
+        return;
+    }
+
+    rocsparse_int row = ((row_blocks[gid] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int stop_row
+        = ((row_blocks[gid + 1] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int wg = row_blocks[gid] & ((1ULL << WG_BITS) - 1ULL);
+
+    if(row == stop_row && wg == 0 && row < m)
+    {
+        csrcheby_epilogue<T> epilogue = {static_cast<T>(0), w, c1, c2, r, z, d, z_next};
+
+        epilogue(row, w[row]);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrcheby_buffer_size_template(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const T*                  csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrcheby_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Search direction, long row products and intermediate iterate
+    *buffer_size = sizeof(T) * ((m - 1) / 256 + 1) * 256 * 3;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrcheby_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_int             degree,
+                                             const T*                  lambda_min,
+                                             const T*                  lambda_max,
+                                             const T*                  r,
+                                             T*                        z,
+                                             void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrcheby"),
+                  m,
+                  nnz,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  degree,
+                  *lambda_min,
+                  *lambda_max,
+                  (const void*&)r,
+                  (const void*&)z,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrcheby -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *lambda_min,
+                  "--beta",
+                  *lambda_max,
+                  "-k",
+                  degree);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrcheby"),
+                  m,
+                  nnz,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  degree,
+                  (const void*&)lambda_min,
+                  (const void*&)lambda_max,
+                  (const void*&)r,
+                  (const void*&)z,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(degree < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || degree == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(lambda_min == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(lambda_max == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(r == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(z == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The row blocks of the csrmv analysis are required
+    rocsparse_csrmv_info csrmv_info = info->csrmv_info;
+
+    if(csrmv_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if csrmv info matches current matrix
+    if(csrmv_info->trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csrmv_info->m != m || csrmv_info->n != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv_info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv_info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csrmv_info->csr_row_ptr != csr_row_ptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrmv_info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Obtain spectral bounds
+    T lmin;
+    T lmax;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(&lmin, lambda_min, sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(&lmax, lambda_max, sizeof(T), hipMemcpyDeviceToHost));
+    }
+    else
+    {
+        lmin = *lambda_min;
+        lmax = *lambda_max;
+    }
+
+    // Check spectral bounds
+    if(lmin < static_cast<T>(0) || lmax <= lmin)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Make sure the number of row blocks is known
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_info_fetch_size(handle, csrmv_info));
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Search direction
+    T* d = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    // Products of rows that are processed by CSR-LongRows
+    T* w = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    // Intermediate iterate
+    T* t = reinterpret_cast<T*>(ptr);
+
+    // Center and half width of the spectral interval
+    T theta = (lmax + lmin) / static_cast<T>(2);
+    T delta = (lmax - lmin) / static_cast<T>(2);
+    T sigma = theta / delta;
+    T rho   = static_cast<T>(1) / sigma;
+
+#define CSRCHEBY_DIM 256
+    dim3 init_blocks((m - 1) / CSRCHEBY_DIM + 1);
+    dim3 init_threads(CSRCHEBY_DIM);
+
+    // First step with zero initial guess
+    hipLaunchKernelGGL((csrcheby_init_kernel<T>),
+                       init_blocks,
+                       init_threads,
+                       0,
+                       stream,
+                       m,
+                       static_cast<T>(1) / theta,
+                       r,
+                       d,
+                       z);
+
+    // Number of workgroups of the adaptive kernel
+    rocsparse_int nblocks = (csrmv_info->size / 2) - 1;
+
+    dim3 csrmvn_blocks(nblocks);
+    dim3 csrmvn_threads(WG_SIZE);
+    dim3 long_rows_blocks((nblocks - 1) / CSRCHEBY_DIM + 1);
+    dim3 long_rows_threads(CSRCHEBY_DIM);
+
+    // Long row products are accumulated, make sure the first step starts with valid data
+    if(degree > 1)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(w, 0, sizeof(T) * m, stream));
+    }
+
+    // Remaining steps, each computes the residual within the csrmv kernel and updates
+    // the search direction and the iterate in its epilogue
+    for(rocsparse_int k = 1; k < degree; ++k)
+    {
+        T rho_next = static_cast<T>(1) / (static_cast<T>(2) * sigma - rho);
+        T c1       = rho_next * rho;
+        T c2       = static_cast<T>(2) * rho_next / delta;
+
+        rho = rho_next;
+
+        const T* src = (k & 1) ? z : t;
+        T*       dst = (k & 1) ? t : z;
+
+        hipLaunchKernelGGL((csrcheby_kernel<T>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           stream,
+                           csrmv_info->row_blocks,
+                           c1,
+                           c2,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           r,
+                           src,
+                           d,
+                           w,
+                           dst,
+                           descr->base);
+
+        hipLaunchKernelGGL((csrcheby_long_rows_kernel<T>),
+                           long_rows_blocks,
+                           long_rows_threads,
+                           0,
+                           stream,
+                           nblocks,
+                           csrmv_info->row_blocks,
+                           m,
+                           c1,
+                           c2,
+                           r,
+                           src,
+                           d,
+                           w,
+                           dst);
+    }
+#undef CSRCHEBY_DIM
+
+    // Even number of steps, final iterate is stored in t
+    if((degree & 1) == 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(z, t, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRCHEBY_HPP
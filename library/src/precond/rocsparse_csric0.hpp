@@ -0,0 +1,577 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRIC0_HPP
+#define ROCSPARSE_CSRIC0_HPP
+
+#include "../level2/rocsparse_csrsv.hpp"
+#include "csric0_device.h"
+#include "definitions.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csric0_analysis_template(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    rocsparse_analysis_policy analysis,
+                                                    rocsparse_solve_policy    solve,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsric0_analysis"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              solve,
+              analysis);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check analysis policy
+    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check solve policy
+    if(solve != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Structural hash of the sparsity pattern, to identify meta data that can be
+    // re-used. A forced analysis always re-builds the meta data and skips the hash.
+    unsigned long long hash = 0;
+
+    if(analysis == rocsparse_analysis_policy_reuse)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, &hash));
+    }
+
+    // Differentiate the analysis policies
+    if(analysis == rocsparse_analysis_policy_reuse)
+    {
+        // We try to re-use already analyzed lower part, if available. Meta data is
+        // only re-used, if it has been gathered for the same sparsity pattern, which
+        // is identified by its structural hash.
+
+        // If csric0 meta data is already available, re-use it
+        if(rocsparse_csrtr_match(info->csric0_info, m, nnz, hash) == true)
+        {
+            rocsparse_csrtr_rebind(info->csric0_info, descr, csr_row_ptr, csr_col_ind);
+
+            return rocsparse_status_success;
+        }
+
+        // Check for other lower analysis meta data
+        rocsparse_csrtr_info reuse = nullptr;
+
+        // csrsv_lower meta data
+        if(rocsparse_csrtr_match(info->csrsv_lower_info, m, nnz, hash) == true)
+        {
+            reuse = info->csrsv_lower_info;
+        }
+
+        // csrilu0 meta data
+        if(reuse == nullptr && rocsparse_csrtr_match(info->csrilu0_info, m, nnz, hash) == true)
+        {
+            reuse = info->csrilu0_info;
+        }
+
+        // TODO add more crossover data here
+
+        // If data has been found, use it
+        if(reuse != nullptr)
+        {
+            // Clear csric0 info, unless it is shared
+            if(info->csric0_info != info->csrsv_lower_info
+               && info->csric0_info != info->csrilu0_info)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csric0_info));
+            }
+
+            info->csric0_info = reuse;
+
+            rocsparse_csrtr_rebind(info->csric0_info, descr, csr_row_ptr, csr_col_ind);
+
+            return rocsparse_status_success;
+        }
+    }
+
+    // User is explicitly asking to force a re-analysis, or no valid data has been
+    // found to be re-used.
+
+    // Clear csric0 info, unless it is shared with csrsv or csrilu0
+    if(info->csric0_info != info->csrsv_lower_info && info->csric0_info != info->csrilu0_info)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csric0_info));
+    }
+
+    // Create csric0 info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csric0_info));
+
+    // Perform analysis
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
+                                                       rocsparse_operation_none,
+                                                       m,
+                                                       nnz,
+                                                       descr,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       hash,
+                                                       info->csric0_info,
+                                                       temp_buffer));
+
+    return rocsparse_status_success;
+}
+
+// Computes the incomplete Cholesky factorization with 0 fill-ins of the lower part of
+// the sparsity pattern, that has been analysed by csrtr. The done array must be
+// initialized with zeros.
+template <typename T>
+static rocsparse_status rocsparse_csric0_factorize(rocsparse_handle     handle,
+                                                   rocsparse_int        m,
+                                                   rocsparse_index_base idx_base,
+                                                   T*                   csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_csrtr_info csrtr,
+                                                   int*                 d_done_array)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Max nnz per row
+    rocsparse_int max_nnz = csrtr->max_nnz;
+
+#define CSRIC0_DIM 256
+    dim3 csric0_blocks((m * handle->wavefront_size - 1) / CSRIC0_DIM + 1);
+    dim3 csric0_threads(CSRIC0_DIM);
+
+    if(handle->wavefront_size == 32)
+    {
+        if(max_nnz <= 32)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 32, 1>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else if(max_nnz <= 64)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 32, 2>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else if(max_nnz <= 128)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 32, 4>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else if(max_nnz <= 256)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 32, 8>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else if(max_nnz <= 512)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 32, 16>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csric0_binsearch_kernel<T, CSRIC0_DIM, 32>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        if(max_nnz <= 64)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 64, 1>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else if(max_nnz <= 128)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 64, 2>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else if(max_nnz <= 256)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 64, 4>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else if(max_nnz <= 512)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 64, 8>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else if(max_nnz <= 1024)
+        {
+            hipLaunchKernelGGL((csric0_hash_kernel<T, CSRIC0_DIM, 64, 16>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csric0_binsearch_kernel<T, CSRIC0_DIM, 64>),
+                               csric0_blocks,
+                               csric0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrtr->csr_diag_ind,
+                               d_done_array,
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               idx_base);
+        }
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRIC0_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           T*                        csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsric0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csric0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csric0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+
+    return rocsparse_csric0_factorize(handle,
+                                      m,
+                                      descr->base,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info->csric0_info,
+                                      d_done_array);
+}
+
+#endif // ROCSPARSE_CSRIC0_HPP
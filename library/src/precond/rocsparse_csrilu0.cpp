@@ -25,6 +25,8 @@
 #include "definitions.h"
 #include "rocsparse.h"
 
+#include <rocprim/rocprim.hpp>
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -142,7 +144,8 @@ extern "C" rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle   handle,
     log_trace(handle, "rocsparse_csrilu0_clear", (const void*&)info);
 
     // If meta data is shared, do not delete anything
-    if(info->csrilu0_info == info->csrsv_lower_info || info->csrilu0_info == info->csrsv_upper_info)
+    if(info->csrilu0_info == info->csrsv_lower_info || info->csrilu0_info == info->csrsv_upper_info
+       || info->csrilu0_info == info->csric0_info)
     {
         info->csrilu0_info = nullptr;
 
@@ -155,6 +158,26 @@ extern "C" rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle   handle,
     return rocsparse_status_success;
 }
 
+extern "C" rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                             rocsparse_mat_info info,
+                                                             int                enable_boost,
+                                                             const float*       boost_tol,
+                                                             const float*       boost_val)
+{
+    return rocsparse_csrilu0_numeric_boost_template<float>(
+        handle, info, enable_boost, boost_tol, boost_val);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                             rocsparse_mat_info info,
+                                                             int                enable_boost,
+                                                             const double*      boost_tol,
+                                                             const double*      boost_val)
+{
+    return rocsparse_csrilu0_numeric_boost_template<double>(
+        handle, info, enable_boost, boost_tol, boost_val);
+}
+
 extern "C" rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
                                                rocsparse_int             m,
                                                rocsparse_int             nnz,
@@ -185,6 +208,391 @@ extern "C" rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
         handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_scsrilu0_apply(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const float*              alpha,
+                                                     const rocsparse_mat_descr descr,
+                                                     const float*              csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info,
+                                                     const float*              x,
+                                                     float*                    y,
+                                                     rocsparse_solve_policy    policy,
+                                                     void*                     temp_buffer)
+{
+    return rocsparse_csrilu0_apply_template<float>(handle,
+                                                   m,
+                                                   nnz,
+                                                   alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   info,
+                                                   x,
+                                                   y,
+                                                   policy,
+                                                   temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_apply(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const double*             alpha,
+                                                     const rocsparse_mat_descr descr,
+                                                     const double*             csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info,
+                                                     const double*             x,
+                                                     double*                   y,
+                                                     rocsparse_solve_policy    policy,
+                                                     void*                     temp_buffer)
+{
+    return rocsparse_csrilu0_apply_template<double>(handle,
+                                                    m,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    info,
+                                                    x,
+                                                    y,
+                                                    policy,
+                                                    temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsrilu0_iter(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    rocsparse_int             sweeps,
+                                                    float*                    ilu0_val,
+                                                    float*                    residual)
+{
+    return rocsparse_csrilu0_iter_template<float>(handle,
+                                                  m,
+                                                  nnz,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  info,
+                                                  sweeps,
+                                                  ilu0_val,
+                                                  residual);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_iter(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const double*             csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    rocsparse_int             sweeps,
+                                                    double*                   ilu0_val,
+                                                    double*                   residual)
+{
+    return rocsparse_csrilu0_iter_template<double>(handle,
+                                                   m,
+                                                   nnz,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   info,
+                                                   sweeps,
+                                                   ilu0_val,
+                                                   residual);
+}
+
+extern "C" rocsparse_status rocsparse_csrilu0_refactor_analysis(rocsparse_handle          handle,
+                                                                rocsparse_int             m,
+                                                                rocsparse_int             nnz,
+                                                                const rocsparse_mat_descr descr,
+                                                                const rocsparse_int* csr_row_ptr,
+                                                                const rocsparse_int* csr_col_ind,
+                                                                rocsparse_mat_info   info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrilu0_refactor_analysis",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_csrtr_info csrtr = info->csrilu0_info;
+
+    // Clear previous refactorization meta data
+    if(csrtr->ilu0_update_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csrtr->ilu0_update_ptr));
+        csrtr->ilu0_update_ptr = nullptr;
+    }
+
+    if(csrtr->ilu0_update_src != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csrtr->ilu0_update_src));
+        csrtr->ilu0_update_src = nullptr;
+    }
+
+    if(csrtr->ilu0_update_dst != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csrtr->ilu0_update_dst));
+        csrtr->ilu0_update_dst = nullptr;
+    }
+
+    if(csrtr->ilu0_done != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csrtr->ilu0_done));
+        csrtr->ilu0_done = nullptr;
+    }
+
+    // Allocate update list pointers
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&csrtr->ilu0_update_ptr, sizeof(rocsparse_int) * (nnz + 1)));
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(csrtr->ilu0_update_ptr, 0, sizeof(rocsparse_int) * (nnz + 1), stream));
+
+#define CSRILU0_REFACTOR_DIM 256
+    dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_REFACTOR_DIM + 1);
+    dim3 csrilu0_threads(CSRILU0_REFACTOR_DIM);
+
+    // Count the updates of each entry
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrilu0_refactor_analysis_kernel<CSRILU0_REFACTOR_DIM, 32, false>),
+                           csrilu0_blocks,
+                           csrilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csrtr->csr_diag_ind,
+                           csrtr->ilu0_update_ptr,
+                           csrtr->ilu0_update_src,
+                           csrtr->ilu0_update_dst,
+                           descr->base);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        hipLaunchKernelGGL((csrilu0_refactor_analysis_kernel<CSRILU0_REFACTOR_DIM, 64, false>),
+                           csrilu0_blocks,
+                           csrilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csrtr->csr_diag_ind,
+                           csrtr->ilu0_update_ptr,
+                           csrtr->ilu0_update_src,
+                           csrtr->ilu0_update_dst,
+                           descr->base);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Inclusive sum on update list pointers
+    void*  d_temp_storage     = nullptr;
+    size_t temp_storage_bytes = 0;
+
+    // Obtain rocprim buffer size
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                csrtr->ilu0_update_ptr,
+                                                csrtr->ilu0_update_ptr,
+                                                nnz + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Allocate rocprim buffer
+    RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+
+    // Do inclusive sum
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                csrtr->ilu0_update_ptr,
+                                                csrtr->ilu0_update_ptr,
+                                                nnz + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Clear rocprim buffer
+    RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+
+    // Obtain total number of updates
+    rocsparse_int nupdates;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&nupdates,
+                                       csrtr->ilu0_update_ptr + nnz,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Fill the update lists
+    if(nupdates > 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&csrtr->ilu0_update_src, sizeof(rocsparse_int) * nupdates));
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&csrtr->ilu0_update_dst, sizeof(rocsparse_int) * nupdates));
+
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrilu0_refactor_analysis_kernel<CSRILU0_REFACTOR_DIM, 32, true>),
+                               csrilu0_blocks,
+                               csrilu0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csrtr->csr_diag_ind,
+                               csrtr->ilu0_update_ptr,
+                               csrtr->ilu0_update_src,
+                               csrtr->ilu0_update_dst,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrilu0_refactor_analysis_kernel<CSRILU0_REFACTOR_DIM, 64, true>),
+                               csrilu0_blocks,
+                               csrilu0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csrtr->csr_diag_ind,
+                               csrtr->ilu0_update_ptr,
+                               csrtr->ilu0_update_src,
+                               csrtr->ilu0_update_dst,
+                               descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRILU0_REFACTOR_DIM
+
+    // Allocate and initialize done flags
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrtr->ilu0_done, sizeof(int) * m));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(csrtr->ilu0_done, 0, sizeof(int) * m, stream));
+
+    csrtr->ilu0_epoch = 0;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsrilu0_refactor(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        float*                    csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        rocsparse_solve_policy    policy)
+{
+    return rocsparse_csrilu0_refactor_template<float>(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_refactor(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        double*                   csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        rocsparse_solve_policy    policy)
+{
+    return rocsparse_csrilu0_refactor_template<double>(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy);
+}
+
 extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
                                                          rocsparse_mat_info info,
                                                          rocsparse_int*     position)
@@ -278,3 +686,62 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   hand
 
     return rocsparse_status_success;
 }
+
+extern "C" rocsparse_status rocsparse_csrilu0_boost_count(rocsparse_handle   handle,
+                                                          rocsparse_mat_info info,
+                                                          rocsparse_int*     count)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrilu0_boost_count", (const void*&)info, (const void*&)count);
+
+    // Check pointer arguments
+    if(count == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If boosting has never been enabled, no row has been boosted
+    if(info->boost_count == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(count, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *count = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(count,
+                                           info->boost_count,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(count, info->boost_count, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    }
+
+    return rocsparse_status_success;
+}
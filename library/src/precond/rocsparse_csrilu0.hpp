@@ -130,16 +130,28 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
         return rocsparse_status_invalid_pointer;
     }
 
+    // Structural hash of the sparsity pattern, to identify meta data that can be
+    // re-used. A forced analysis always re-builds the meta data and skips the hash.
+    unsigned long long hash = 0;
+
+    if(analysis == rocsparse_analysis_policy_reuse)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, &hash));
+    }
+
     // Differentiate the analysis policies
     if(analysis == rocsparse_analysis_policy_reuse)
     {
-        // We try to re-use already analyzed lower part, if available.
-        // It is the user's responsibility that this data is still valid,
-        // since he passed the 'reuse' flag.
+        // We try to re-use already analyzed lower part, if available. Meta data is
+        // only re-used, if it has been gathered for the same sparsity pattern, which
+        // is identified by its structural hash.
 
-        // If csrilu0 meta data is already available, do nothing
-        if(info->csrilu0_info != nullptr)
+        // If csrilu0 meta data is already available, re-use it
+        if(rocsparse_csrtr_match(info->csrilu0_info, m, nnz, hash) == true)
         {
+            rocsparse_csrtr_rebind(info->csrilu0_info, descr, csr_row_ptr, csr_col_ind);
+
             return rocsparse_status_success;
         }
 
@@ -147,18 +159,33 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
         rocsparse_csrtr_info reuse = nullptr;
 
         // csrsv_lower meta data
-        if(info->csrsv_lower_info != nullptr)
+        if(rocsparse_csrtr_match(info->csrsv_lower_info, m, nnz, hash) == true)
         {
             reuse = info->csrsv_lower_info;
         }
 
+        // csric0 meta data
+        if(reuse == nullptr && rocsparse_csrtr_match(info->csric0_info, m, nnz, hash) == true)
+        {
+            reuse = info->csric0_info;
+        }
+
         // TODO add more crossover data here
 
         // If data has been found, use it
         if(reuse != nullptr)
         {
+            // Clear csrilu0 info, unless it is shared
+            if(info->csrilu0_info != info->csrsv_lower_info
+               && info->csrilu0_info != info->csric0_info)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+            }
+
             info->csrilu0_info = reuse;
 
+            rocsparse_csrtr_rebind(info->csrilu0_info, descr, csr_row_ptr, csr_col_ind);
+
             return rocsparse_status_success;
         }
     }
@@ -166,8 +193,11 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
     // User is explicitly asking to force a re-analysis, or no valid data has been
     // found to be re-used.
 
-    // Clear csrilu0 info
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+    // Clear csrilu0 info, unless it is shared with csrsv or csric0
+    if(info->csrilu0_info != info->csrsv_lower_info && info->csrilu0_info != info->csric0_info)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+    }
 
     // Create csrilu0 info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrilu0_info));
@@ -180,119 +210,35 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
                                                        descr,
                                                        csr_row_ptr,
                                                        csr_col_ind,
+                                                       hash,
                                                        info->csrilu0_info,
                                                        temp_buffer));
 
     return rocsparse_status_success;
 }
 
+// Computes the incomplete LU factorization with 0 fill-ins of the sparsity pattern,
+// that has been analysed by csrtr. The done array must be initialized with zeros.
+// If boost is set, tiny pivots are replaced on the fly and counted in boost_count.
 template <typename T>
-rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            T*                        csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_solve_policy    policy,
-                                            void*                     temp_buffer)
+static rocsparse_status rocsparse_csrilu0_factorize(rocsparse_handle     handle,
+                                                    rocsparse_int        m,
+                                                    rocsparse_index_base idx_base,
+                                                    T*                   csr_val,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    rocsparse_csrtr_info csrtr,
+                                                    int*                 d_done_array,
+                                                    int                  boost,
+                                                    T                    boost_tol,
+                                                    T                    boost_val,
+                                                    rocsparse_int*       boost_count)
 {
-    // Check for valid handle and matrix descriptor
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-    else if(descr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Logging
-    log_trace(handle,
-              replaceX<T>("rocsparse_Xcsrilu0"),
-              m,
-              nnz,
-              (const void*&)descr,
-              (const void*&)csr_val,
-              (const void*&)csr_row_ptr,
-              (const void*&)csr_col_ind,
-              (const void*&)info,
-              policy,
-              (const void*&)temp_buffer);
-
-    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
-
-    // Check index base
-    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
-    {
-        return rocsparse_status_invalid_value;
-    }
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
-
-    // Check sizes
-    if(m < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(nnz < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-
-    // Quick return if possible
-    if(m == 0 || nnz == 0)
-    {
-        return rocsparse_status_success;
-    }
-
-    // Check pointer arguments
-    if(csr_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_col_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(temp_buffer == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Check for analysis call
-    if(info->csrilu0_info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
     // Stream
     hipStream_t stream = handle->stream;
 
-    // Buffer
-    char* ptr = reinterpret_cast<char*>(temp_buffer);
-    ptr += 256;
-
-    // done array
-    int* d_done_array = reinterpret_cast<int*>(ptr);
-
-    // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
-
     // Max nnz per row
-    rocsparse_int max_nnz = info->csrilu0_info->max_nnz;
+    rocsparse_int max_nnz = csrtr->max_nnz;
 
 #define CSRILU0_DIM 256
     dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_DIM + 1);
@@ -311,11 +257,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else if(max_nnz <= 64)
         {
@@ -328,11 +278,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else if(max_nnz <= 128)
         {
@@ -345,11 +299,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else if(max_nnz <= 256)
         {
@@ -362,11 +320,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else if(max_nnz <= 512)
         {
@@ -379,11 +341,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else
         {
@@ -396,11 +362,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
     }
     else if(handle->wavefront_size == 64)
@@ -416,11 +386,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else if(max_nnz <= 128)
         {
@@ -433,11 +407,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else if(max_nnz <= 256)
         {
@@ -450,11 +428,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else if(max_nnz <= 512)
         {
@@ -467,11 +449,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else if(max_nnz <= 1024)
         {
@@ -484,11 +470,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
         else
         {
@@ -501,11 +491,15 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
+                               csrtr->csr_diag_ind,
                                d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               csrtr->row_map,
+                               csrtr->zero_pivot,
+                               boost,
+                               boost_tol,
+                               boost_val,
+                               boost_count,
+                               idx_base);
         }
     }
     else
@@ -517,4 +511,917 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csrilu0_numeric_boost_template(rocsparse_handle   handle,
+                                                          rocsparse_mat_info info,
+                                                          int                enable_boost,
+                                                          const T*           boost_tol,
+                                                          const T*           boost_val)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_numeric_boost"),
+              (const void*&)info,
+              enable_boost,
+              (const void*&)boost_tol,
+              (const void*&)boost_val);
+
+    // Disable boosting
+    if(enable_boost == 0)
+    {
+        info->boost_enable = 0;
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(boost_tol == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(boost_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Obtain boost parameters
+    T tol;
+    T val;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(&tol, boost_tol, sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(&val, boost_val, sizeof(T), hipMemcpyDeviceToHost));
+    }
+    else
+    {
+        tol = *boost_tol;
+        val = *boost_val;
+    }
+
+    // Check boost tolerance
+    if(tol < static_cast<T>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Allocate boost counter
+    if(info->boost_count == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->boost_count, sizeof(rocsparse_int)));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(info->boost_count, 0, sizeof(rocsparse_int), stream));
+    }
+
+    info->boost_enable = 1;
+    info->boost_tol    = tol;
+    info->boost_val    = val;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            T*                        csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+
+    // Reset boost counter
+    if(info->boost_enable)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(info->boost_count, 0, sizeof(rocsparse_int), stream));
+    }
+
+    return rocsparse_csrilu0_factorize(handle,
+                                       m,
+                                       descr->base,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info->csrilu0_info,
+                                       d_done_array,
+                                       info->boost_enable,
+                                       static_cast<T>(info->boost_tol),
+                                       static_cast<T>(info->boost_val),
+                                       info->boost_count);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_apply_template(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const T*                  alpha,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  const T*                  x,
+                                                  T*                        y,
+                                                  rocsparse_solve_policy    policy,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrilu0_apply"),
+                  m,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)y,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrilu0_apply"),
+                  m,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)y,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for csrsv analysis of both triangular factors
+    rocsparse_csrtr_info lower = info->csrsv_lower_info;
+    rocsparse_csrtr_info upper = info->csrsv_upper_info;
+
+    if(lower == nullptr || upper == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer, using the csrsv layout
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+
+    // done array
+    int* done_array = reinterpret_cast<int*>(ptr);
+    ptr += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+
+    // Intermediate vector z, stored in the two analysis workspaces that are not
+    // required by the solve. They follow the done array and hold one rocsparse_int
+    // and one int per row, see rocsparse_csrsv_buffer_size_template(), such that z
+    // only fits for types of at most 8 bytes.
+    static_assert(sizeof(T) <= sizeof(rocsparse_int) + sizeof(int),
+                  "csrilu0_apply intermediate vector exceeds the csrsv analysis workspace");
+
+    T* z = reinterpret_cast<T*>(ptr);
+
+    // Descriptors of the unit lower and the non-unit upper factor
+    _rocsparse_mat_descr descr_lower = *descr;
+    _rocsparse_mat_descr descr_upper = *descr;
+
+    descr_lower.fill_mode = rocsparse_fill_mode_lower;
+    descr_lower.diag_type = rocsparse_diag_type_unit;
+    descr_upper.fill_mode = rocsparse_fill_mode_upper;
+    descr_upper.diag_type = rocsparse_diag_type_non_unit;
+
+    // The upper sweep is not scaled
+    T        host_one = static_cast<T>(1);
+    const T* one      = &host_one;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        T* device_one;
+        rocsparse_one(handle, &device_one);
+        one = device_one;
+    }
+
+    // Initialize buffers. Both sweeps share the done array, rows of the lower sweep
+    // are flagged with 1 and rows of the upper sweep are flagged with 2.
+    if(lower->level_ptr.empty() == true || upper->level_ptr.empty() == true)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
+    }
+
+#define CSRILU0_APPLY_DIM 1024
+    if(handle->wavefront_size == 32)
+    {
+        // Solve L * z = alpha * x
+        rocsparse_csrsv_sweep<T, CSRILU0_APPLY_DIM, 32>(handle,
+                                                        m,
+                                                        alpha,
+                                                        &descr_lower,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        lower,
+                                                        x,
+                                                        z,
+                                                        done_array,
+                                                        1);
+
+        // Solve U * y = z
+        rocsparse_csrsv_sweep<T, CSRILU0_APPLY_DIM, 32>(handle,
+                                                        m,
+                                                        one,
+                                                        &descr_upper,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        upper,
+                                                        z,
+                                                        y,
+                                                        done_array,
+                                                        2);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        // Solve L * z = alpha * x
+        rocsparse_csrsv_sweep<T, CSRILU0_APPLY_DIM, 64>(handle,
+                                                        m,
+                                                        alpha,
+                                                        &descr_lower,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        lower,
+                                                        x,
+                                                        z,
+                                                        done_array,
+                                                        1);
+
+        // Solve U * y = z
+        rocsparse_csrsv_sweep<T, CSRILU0_APPLY_DIM, 64>(handle,
+                                                        m,
+                                                        one,
+                                                        &descr_upper,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        upper,
+                                                        z,
+                                                        y,
+                                                        done_array,
+                                                        2);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRILU0_APPLY_DIM
+
+    return rocsparse_status_success;
+}
+
+// Runs the fixed-point sweeps of the iterative incomplete LU factorization, using
+// WF_SIZE threads per row. If workspace is not a null pointer, the partial sums of the
+// residual of the final iterate are computed.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static void rocsparse_csrilu0_iter_sweeps(rocsparse_handle     handle,
+                                          rocsparse_int        m,
+                                          rocsparse_int        sweeps,
+                                          rocsparse_index_base idx_base,
+                                          const T*             csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const rocsparse_int* csr_diag_ind,
+                                          T*                   ilu0_val,
+                                          T*                   workspace)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dim3 iter_blocks((m * WF_SIZE - 1) / BLOCKSIZE + 1);
+    dim3 iter_threads(BLOCKSIZE);
+
+    for(rocsparse_int i = 0; i < sweeps; ++i)
+    {
+        hipLaunchKernelGGL((csrilu0_iter_kernel<T, BLOCKSIZE, WF_SIZE>),
+                           iter_blocks,
+                           iter_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           ilu0_val,
+                           csr_diag_ind,
+                           idx_base);
+    }
+
+    if(workspace != nullptr)
+    {
+        hipLaunchKernelGGL((csrilu0_iter_residual_part1<T, BLOCKSIZE, WF_SIZE>),
+                           dim3(BLOCKSIZE),
+                           iter_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           ilu0_val,
+                           csr_diag_ind,
+                           workspace,
+                           idx_base);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_iter_template(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 rocsparse_int             sweeps,
+                                                 T*                        ilu0_val,
+                                                 T*                        residual)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_iter"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              sweeps,
+              (const void*&)ilu0_val,
+              (const void*&)residual);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrilu0_iter -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "-k",
+              sweeps);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ilu0_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Initial guess, L and U are taken from the strictly lower and upper part of A
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(ilu0_val, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Get workspace for the residual from handle device buffer
+    T* workspace = (residual != nullptr) ? reinterpret_cast<T*>(handle->buffer) : nullptr;
+
+    // Diagonal entry points, obtained by the analysis
+    const rocsparse_int* csr_diag_ind = info->csrilu0_info->csr_diag_ind;
+
+#define CSRILU0_ITER_DIM 256
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        rocsparse_csrilu0_iter_sweeps<T, CSRILU0_ITER_DIM, 2>(handle,
+                                                              m,
+                                                              sweeps,
+                                                              descr->base,
+                                                              csr_val,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              csr_diag_ind,
+                                                              ilu0_val,
+                                                              workspace);
+    }
+    else if(nnz_per_row < 8)
+    {
+        rocsparse_csrilu0_iter_sweeps<T, CSRILU0_ITER_DIM, 4>(handle,
+                                                              m,
+                                                              sweeps,
+                                                              descr->base,
+                                                              csr_val,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              csr_diag_ind,
+                                                              ilu0_val,
+                                                              workspace);
+    }
+    else if(nnz_per_row < 16)
+    {
+        rocsparse_csrilu0_iter_sweeps<T, CSRILU0_ITER_DIM, 8>(handle,
+                                                              m,
+                                                              sweeps,
+                                                              descr->base,
+                                                              csr_val,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              csr_diag_ind,
+                                                              ilu0_val,
+                                                              workspace);
+    }
+    else if(nnz_per_row < 32)
+    {
+        rocsparse_csrilu0_iter_sweeps<T, CSRILU0_ITER_DIM, 16>(handle,
+                                                               m,
+                                                               sweeps,
+                                                               descr->base,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               csr_diag_ind,
+                                                               ilu0_val,
+                                                               workspace);
+    }
+    else
+    {
+        rocsparse_csrilu0_iter_sweeps<T, CSRILU0_ITER_DIM, 32>(handle,
+                                                               m,
+                                                               sweeps,
+                                                               descr->base,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               csr_diag_ind,
+                                                               ilu0_val,
+                                                               workspace);
+    }
+
+    // Report numerical zero pivots of the final iterate
+    hipLaunchKernelGGL((csrilu0_iter_pivot_kernel<T, CSRILU0_ITER_DIM>),
+                       dim3((m - 1) / CSRILU0_ITER_DIM + 1),
+                       dim3(CSRILU0_ITER_DIM),
+                       0,
+                       stream,
+                       m,
+                       ilu0_val,
+                       csr_diag_ind,
+                       info->csrilu0_info->zero_pivot,
+                       descr->base);
+
+    // Residual norm of the final iterate
+    if(residual != nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrilu0_iter_residual_part2<T, CSRILU0_ITER_DIM>),
+                               dim3(1),
+                               dim3(CSRILU0_ITER_DIM),
+                               0,
+                               stream,
+                               CSRILU0_ITER_DIM,
+                               workspace,
+                               residual);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrilu0_iter_residual_part2<T, CSRILU0_ITER_DIM>),
+                               dim3(1),
+                               dim3(CSRILU0_ITER_DIM),
+                               0,
+                               stream,
+                               CSRILU0_ITER_DIM,
+                               workspace,
+                               nullptr);
+
+            RETURN_IF_HIP_ERROR(hipMemcpy(residual, workspace, sizeof(T), hipMemcpyDeviceToHost));
+        }
+    }
+#undef CSRILU0_ITER_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_refactor_template(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     T*                        csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info,
+                                                     rocsparse_solve_policy    policy)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_refactor"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrilu0_refactor -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis and refactorization analysis call
+    if(info->csrilu0_info == nullptr || info->csrilu0_info->ilu0_update_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_csrtr_info csrtr = info->csrilu0_info;
+
+    // Each call uses a new epoch for the done flags, such that they only need to be
+    // reset when the epoch wraps around
+    if(csrtr->ilu0_epoch == std::numeric_limits<int>::max())
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(csrtr->ilu0_done, 0, sizeof(int) * m, stream));
+        csrtr->ilu0_epoch = 0;
+    }
+
+    ++csrtr->ilu0_epoch;
+
+    // Reset boost counter
+    if(info->boost_enable)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(info->boost_count, 0, sizeof(rocsparse_int), stream));
+    }
+
+#define CSRILU0_REFACTOR_DIM 256
+    dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_REFACTOR_DIM + 1);
+    dim3 csrilu0_threads(CSRILU0_REFACTOR_DIM);
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrilu0_refactor_kernel<T, CSRILU0_REFACTOR_DIM, 32>),
+                           csrilu0_blocks,
+                           csrilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           csrtr->csr_diag_ind,
+                           csrtr->ilu0_update_ptr,
+                           csrtr->ilu0_update_src,
+                           csrtr->ilu0_update_dst,
+                           csrtr->ilu0_done,
+                           csrtr->ilu0_epoch,
+                           csrtr->row_map,
+                           csrtr->zero_pivot,
+                           info->boost_enable,
+                           static_cast<T>(info->boost_tol),
+                           static_cast<T>(info->boost_val),
+                           info->boost_count,
+                           descr->base);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        hipLaunchKernelGGL((csrilu0_refactor_kernel<T, CSRILU0_REFACTOR_DIM, 64>),
+                           csrilu0_blocks,
+                           csrilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           csrtr->csr_diag_ind,
+                           csrtr->ilu0_update_ptr,
+                           csrtr->ilu0_update_src,
+                           csrtr->ilu0_update_dst,
+                           csrtr->ilu0_done,
+                           csrtr->ilu0_epoch,
+                           csrtr->row_map,
+                           csrtr->zero_pivot,
+                           info->boost_enable,
+                           static_cast<T>(info->boost_tol),
+                           static_cast<T>(info->boost_val),
+                           info->boost_count,
+                           descr->base);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRILU0_REFACTOR_DIM
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_CSRILU0_HPP
@@ -0,0 +1,487 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csriluk.hpp"
+#include "csr_hash.h"
+#include "definitions.h"
+#include "rocsparse.h"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int             fill_level,
+                                                       rocsparse_mat_info        info,
+                                                       rocsparse_int*            lu_nnz,
+                                                       void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_symbolic",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              fill_level,
+              (const void*&)info,
+              (const void*&)lu_nnz,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(fill_level < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check pointer arguments
+    if(lu_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(lu_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *lu_nnz = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Structural hash of the sparsity pattern, to identify a symbolic factorization
+    // that can be re-used. It is only computed, if the user asks for re-use.
+    unsigned long long hash = 0;
+
+    if(handle->analysis_policy == rocsparse_analysis_policy_reuse)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, &hash));
+    }
+
+    rocsparse_csriluk_info iluk = info->csriluk_info;
+
+    // Re-compute the symbolic factorization, unless re-use is requested and neither
+    // the sparsity pattern nor the level of fill has changed
+    if(iluk == nullptr || hash == 0 || iluk->hash != hash || iluk->m != m || iluk->nnz != nnz
+       || iluk->fill_level != fill_level || iluk->base != descr->base)
+    {
+        // Clear csriluk info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+        info->csriluk_info = nullptr;
+
+        // Create csriluk info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csriluk_info(&info->csriluk_info));
+        iluk = info->csriluk_info;
+
+        // The level of fill computation is inherently sequential, thus the
+        // sparsity pattern is processed on the host
+        std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind(nnz);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcsr_row_ptr.data(),
+                                           csr_row_ptr,
+                                           sizeof(rocsparse_int) * (m + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcsr_col_ind.data(),
+                                           csr_col_ind,
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        std::vector<rocsparse_int> hlu_row_ptr;
+        std::vector<rocsparse_int> hlu_col_ind;
+        std::vector<rocsparse_int> hlu_map;
+
+        rocsparse_csriluk_symbolic_host(m,
+                                        descr->base,
+                                        fill_level,
+                                        hcsr_row_ptr,
+                                        hcsr_col_ind,
+                                        hlu_row_ptr,
+                                        hlu_col_ind,
+                                        hlu_map);
+
+        iluk->fill_level = fill_level;
+        iluk->lu_nnz     = hlu_col_ind.size();
+        iluk->m          = m;
+        iluk->nnz        = nnz;
+        iluk->base       = descr->base;
+
+        // Upload the factorized sparsity pattern
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&iluk->lu_row_ptr, sizeof(rocsparse_int) * (m + 1)));
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&iluk->lu_col_ind, sizeof(rocsparse_int) * iluk->lu_nnz));
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&iluk->lu_map, sizeof(rocsparse_int) * nnz));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(iluk->lu_row_ptr,
+                                           hlu_row_ptr.data(),
+                                           sizeof(rocsparse_int) * (m + 1),
+                                           hipMemcpyHostToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(iluk->lu_col_ind,
+                                           hlu_col_ind.data(),
+                                           sizeof(rocsparse_int) * iluk->lu_nnz,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(iluk->lu_map,
+                                           hlu_map.data(),
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+        // The host arrays must outlive the device transfer
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // Structural hash of the factorized sparsity pattern, only computed if the
+        // user asks for re-use
+        unsigned long long lu_hash = 0;
+
+        if(handle->analysis_policy == rocsparse_analysis_policy_reuse)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_hash(
+                handle, m, iluk->lu_nnz, iluk->lu_row_ptr, iluk->lu_col_ind, &lu_hash));
+        }
+
+        // Level analysis of the factorized sparsity pattern
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&iluk->csrtr));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
+                                                           rocsparse_operation_none,
+                                                           m,
+                                                           iluk->lu_nnz,
+                                                           descr,
+                                                           iluk->lu_row_ptr,
+                                                           iluk->lu_col_ind,
+                                                           lu_hash,
+                                                           iluk->csrtr,
+                                                           temp_buffer));
+
+        // Store the hash of A last, such that a failing symbolic factorization is
+        // never re-used
+        iluk->hash = hash;
+    }
+
+    // Number of non-zero entries of the factorized matrix
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            lu_nnz, &iluk->lu_nnz, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+    }
+    else
+    {
+        *lu_nnz = iluk->lu_nnz;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_pattern(rocsparse_handle   handle,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_int*     lu_row_ptr,
+                                                      rocsparse_int*     lu_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_pattern",
+              (const void*&)info,
+              (const void*&)lu_row_ptr,
+              (const void*&)lu_col_ind);
+
+    // Quick return if possible
+    if(info->csriluk_info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(lu_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(lu_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_csriluk_info iluk = info->csriluk_info;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(lu_row_ptr,
+                                       iluk->lu_row_ptr,
+                                       sizeof(rocsparse_int) * (iluk->m + 1),
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(lu_col_ind,
+                                       iluk->lu_col_ind,
+                                       sizeof(rocsparse_int) * iluk->lu_nnz,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_clear(rocsparse_handle   handle,
+                                                    rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    info->csriluk_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               float*                    lu_val,
+                                               rocsparse_solve_policy    policy,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csriluk_template<float>(handle,
+                                             m,
+                                             nnz,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             info,
+                                             lu_val,
+                                             policy,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               double*                   lu_val,
+                                               rocsparse_solve_policy    policy,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csriluk_template<double>(handle,
+                                              m,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              lu_val,
+                                              policy,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_zero_pivot(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int*     position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    // In this case, always return -1.
+    if(info->csriluk_info == nullptr || info->csriluk_info->csrtr == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&pivot,
+                                           info->csriluk_info->csrtr->zero_pivot,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->csriluk_info->csrtr->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(hipMemcpy(position,
+                                      info->csriluk_info->csrtr->zero_pivot,
+                                      sizeof(rocsparse_int),
+                                      hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,320 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRILUK_HPP
+#define ROCSPARSE_CSRILUK_HPP
+
+#include "csriluk_device.h"
+#include "definitions.h"
+#include "rocsparse.h"
+#include "rocsparse_csrilu0.hpp"
+#include "utility.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+// Computes the sparsity pattern of the incomplete LU factorization with level of
+// fill fill_level, as well as the position of each entry of A in the factorized
+// pattern. The column indices of A have to be sorted.
+static void rocsparse_csriluk_symbolic_host(rocsparse_int                     m,
+                                            rocsparse_index_base              idx_base,
+                                            rocsparse_int                     fill_level,
+                                            const std::vector<rocsparse_int>& csr_row_ptr,
+                                            const std::vector<rocsparse_int>& csr_col_ind,
+                                            std::vector<rocsparse_int>&       lu_row_ptr,
+                                            std::vector<rocsparse_int>&       lu_col_ind,
+                                            std::vector<rocsparse_int>&       lu_map)
+{
+    // Level of fill of each entry of the factorized pattern
+    std::vector<rocsparse_int> lu_lev;
+
+    // Position of the first entry of each row that is not in the strict lower part
+    std::vector<rocsparse_int> lu_diag(m);
+
+    // Sorted linked list of the column indices of the current row. The list starts
+    // at next[m] and is terminated by m.
+    std::vector<rocsparse_int> next(m + 1);
+    std::vector<rocsparse_int> lev(m);
+
+    lu_row_ptr.resize(m + 1);
+    lu_row_ptr[0] = idx_base;
+
+    lu_col_ind.clear();
+    lu_map.resize(csr_col_ind.size());
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - idx_base;
+
+        // Entries of A have level 0
+        rocsparse_int last = m;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            next[last] = col;
+            lev[col]   = 0;
+            last       = col;
+        }
+
+        next[last] = m;
+
+        // Eliminate the strict lower part in increasing column order. Fill-in
+        // entries are inserted behind k and thus processed later on.
+        for(rocsparse_int k = next[m]; k < i; k = next[k])
+        {
+            rocsparse_int prev = k;
+
+            for(rocsparse_int p = lu_diag[k]; p < lu_row_ptr[k + 1] - idx_base; ++p)
+            {
+                rocsparse_int col = lu_col_ind[p] - idx_base;
+
+                // Skip the diagonal entry of row k
+                if(col == k)
+                {
+                    continue;
+                }
+
+                rocsparse_int level = lev[k] + lu_lev[p] + 1;
+
+                if(level > fill_level)
+                {
+                    continue;
+                }
+
+                // Column indices of row k are sorted, thus we can continue the
+                // search at the previous position
+                while(next[prev] < col)
+                {
+                    prev = next[prev];
+                }
+
+                if(next[prev] == col)
+                {
+                    lev[col] = std::min(lev[col], level);
+                }
+                else
+                {
+                    next[col]  = next[prev];
+                    next[prev] = col;
+                    lev[col]   = level;
+                }
+
+                prev = col;
+            }
+        }
+
+        // Store the row of the factorized pattern
+        lu_diag[i] = -1;
+
+        for(rocsparse_int col = next[m]; col < m; col = next[col])
+        {
+            if(col >= i && lu_diag[i] == -1)
+            {
+                lu_diag[i] = lu_col_ind.size();
+            }
+
+            lu_col_ind.push_back(col + idx_base);
+            lu_lev.push_back(lev[col]);
+        }
+
+        lu_row_ptr[i + 1] = lu_col_ind.size() + idx_base;
+
+        if(lu_diag[i] == -1)
+        {
+            lu_diag[i] = lu_row_ptr[i + 1] - idx_base;
+        }
+
+        // Position of the entries of A in the factorized pattern
+        rocsparse_int p = lu_row_ptr[i] - idx_base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            while(lu_col_ind[p] != csr_col_ind[j])
+            {
+                ++p;
+            }
+
+            lu_map[j] = p;
+        }
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csriluk_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            T*                        lu_val,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsriluk"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)lu_val,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csriluk -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(lu_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for symbolic factorization call
+    rocsparse_csriluk_info iluk = info->csriluk_info;
+
+    if(iluk == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The symbolic factorization must have been computed for the same matrix size
+    if(iluk->m != m || iluk->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+
+    // Scatter A into the factorized pattern, fill-in entries are zero
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(lu_val, 0, sizeof(T) * iluk->lu_nnz, stream));
+
+#define CSRILUK_DIM 512
+    dim3 csriluk_blocks((nnz - 1) / CSRILUK_DIM + 1);
+    dim3 csriluk_threads(CSRILUK_DIM);
+
+    hipLaunchKernelGGL((csriluk_scatter_kernel<T, CSRILUK_DIM>),
+                       csriluk_blocks,
+                       csriluk_threads,
+                       0,
+                       stream,
+                       nnz,
+                       csr_val,
+                       iluk->lu_map,
+                       lu_val);
+#undef CSRILUK_DIM
+
+    // Numeric factorization on the factorized pattern
+    return rocsparse_csrilu0_factorize(handle,
+                                       m,
+                                       descr->base,
+                                       lu_val,
+                                       iluk->lu_row_ptr,
+                                       iluk->lu_col_ind,
+                                       iluk->csrtr,
+                                       d_done_array,
+                                       0,
+                                       static_cast<T>(0),
+                                       static_cast<T>(0),
+                                       nullptr);
+}
+
+#endif // ROCSPARSE_CSRILUK_HPP
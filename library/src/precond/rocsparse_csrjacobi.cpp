@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrjacobi.hpp"
+#include "definitions.h"
+#include "rocsparse.h"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                             rocsparse_jacobi_type     type,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const float*              csr_val,
+                                                             const rocsparse_int*      csr_row_ptr,
+                                                             const rocsparse_int*      csr_col_ind,
+                                                             rocsparse_int             block_dim,
+                                                             size_t*                   buffer_size)
+{
+    return rocsparse_csrjacobi_buffer_size_template<float>(
+        handle, type, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                             rocsparse_jacobi_type     type,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const double*             csr_val,
+                                                             const rocsparse_int*      csr_row_ptr,
+                                                             const rocsparse_int*      csr_col_ind,
+                                                             rocsparse_int             block_dim,
+                                                             size_t*                   buffer_size)
+{
+    return rocsparse_csrjacobi_buffer_size_template<double>(
+        handle, type, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_scsrjacobi_analysis(rocsparse_handle          handle,
+                                                          rocsparse_jacobi_type     type,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const float*              csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          rocsparse_int             block_dim,
+                                                          void*                     temp_buffer)
+{
+    return rocsparse_csrjacobi_analysis_template<float>(
+        handle, type, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrjacobi_analysis(rocsparse_handle          handle,
+                                                          rocsparse_jacobi_type     type,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const double*             csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          rocsparse_int             block_dim,
+                                                          void*                     temp_buffer)
+{
+    return rocsparse_csrjacobi_analysis_template<double>(
+        handle, type, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsrjacobi(rocsparse_handle          handle,
+                                                 rocsparse_jacobi_type     type,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const float*              omega,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_int             block_dim,
+                                                 const float*              b,
+                                                 float*                    x,
+                                                 rocsparse_int             sweeps,
+                                                 void*                     temp_buffer)
+{
+    return rocsparse_csrjacobi_template<float>(handle,
+                                               type,
+                                               m,
+                                               nnz,
+                                               omega,
+                                               descr,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               block_dim,
+                                               b,
+                                               x,
+                                               sweeps,
+                                               temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrjacobi(rocsparse_handle          handle,
+                                                 rocsparse_jacobi_type     type,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const double*             omega,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_int             block_dim,
+                                                 const double*             b,
+                                                 double*                   x,
+                                                 rocsparse_int             sweeps,
+                                                 void*                     temp_buffer)
+{
+    return rocsparse_csrjacobi_template<double>(handle,
+                                                type,
+                                                m,
+                                                nnz,
+                                                omega,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                block_dim,
+                                                b,
+                                                x,
+                                                sweeps,
+                                                temp_buffer);
+}
@@ -0,0 +1,994 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRJACOBI_HPP
+#define ROCSPARSE_CSRJACOBI_HPP
+
+#include "csrjacobi_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, unsigned int WF_SIZE>
+__global__ void csrjacobi_kernel_host_scalar(rocsparse_int        m,
+                                             T                    omega,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             const T*             csr_val,
+                                             const T*             inv_diag,
+                                             const T*             b,
+                                             const T*             x,
+                                             T*                   y,
+                                             rocsparse_index_base idx_base)
+{
+    csrjacobi_device<T, WF_SIZE>(
+        m, omega, csr_row_ptr, csr_col_ind, csr_val, inv_diag, b, x, y, idx_base);
+}
+
+template <typename T, unsigned int WF_SIZE>
+__global__ void csrjacobi_kernel_device_scalar(rocsparse_int        m,
+                                               const T*             omega,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               const T*             csr_val,
+                                               const T*             inv_diag,
+                                               const T*             b,
+                                               const T*             x,
+                                               T*                   y,
+                                               rocsparse_index_base idx_base)
+{
+    csrjacobi_device<T, WF_SIZE>(
+        m, *omega, csr_row_ptr, csr_col_ind, csr_val, inv_diag, b, x, y, idx_base);
+}
+
+template <typename T, unsigned int BLOCKDIM, unsigned int WF_SIZE>
+__global__ void csrjacobi_block_kernel_host_scalar(rocsparse_int        m,
+                                                   T                    omega,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   const T*             csr_val,
+                                                   const T*             inv_block,
+                                                   const T*             b,
+                                                   const T*             x,
+                                                   T*                   y,
+                                                   rocsparse_index_base idx_base)
+{
+    csrjacobi_block_device<T, BLOCKDIM, WF_SIZE>(
+        m, omega, csr_row_ptr, csr_col_ind, csr_val, inv_block, b, x, y, idx_base);
+}
+
+template <typename T, unsigned int BLOCKDIM, unsigned int WF_SIZE>
+__global__ void csrjacobi_block_kernel_device_scalar(rocsparse_int        m,
+                                                     const T*             omega,
+                                                     const rocsparse_int* csr_row_ptr,
+                                                     const rocsparse_int* csr_col_ind,
+                                                     const T*             csr_val,
+                                                     const T*             inv_block,
+                                                     const T*             b,
+                                                     const T*             x,
+                                                     T*                   y,
+                                                     rocsparse_index_base idx_base)
+{
+    csrjacobi_block_device<T, BLOCKDIM, WF_SIZE>(
+        m, *omega, csr_row_ptr, csr_col_ind, csr_val, inv_block, b, x, y, idx_base);
+}
+
+// Runs the point or l1 Jacobi smoother sweeps, using WF_SIZE threads per row. The
+// iterates alternate between x and y.
+template <typename T, unsigned int WF_SIZE>
+static rocsparse_status rocsparse_csrjacobi_sweeps(rocsparse_handle     handle,
+                                                   rocsparse_int        m,
+                                                   rocsparse_int        sweeps,
+                                                   const T*             omega,
+                                                   rocsparse_index_base idx_base,
+                                                   const T*             csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   const T*             scale,
+                                                   const T*             b,
+                                                   T*                   x,
+                                                   T*                   y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRJACOBI_DIM 256
+    dim3 jacobi_blocks((m * WF_SIZE - 1) / CSRJACOBI_DIM + 1);
+    dim3 jacobi_threads(CSRJACOBI_DIM);
+
+    for(rocsparse_int i = 0; i < sweeps; ++i)
+    {
+        const T* src = (i & 1) ? y : x;
+        T*       dst = (i & 1) ? x : y;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrjacobi_kernel_device_scalar<T, WF_SIZE>),
+                               jacobi_blocks,
+                               jacobi_threads,
+                               0,
+                               stream,
+                               m,
+                               omega,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               scale,
+                               b,
+                               src,
+                               dst,
+                               idx_base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrjacobi_kernel_host_scalar<T, WF_SIZE>),
+                               jacobi_blocks,
+                               jacobi_threads,
+                               0,
+                               stream,
+                               m,
+                               *omega,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               scale,
+                               b,
+                               src,
+                               dst,
+                               idx_base);
+        }
+    }
+#undef CSRJACOBI_DIM
+
+    // Odd number of sweeps, final iterate is stored in y
+    if(sweeps & 1)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(x, y, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+// Runs the block Jacobi smoother sweeps, using WF_SIZE threads per block of BLOCKDIM
+// rows. The iterates alternate between x and y.
+template <typename T, unsigned int BLOCKDIM, unsigned int WF_SIZE>
+static rocsparse_status rocsparse_csrjacobi_block_sweeps(rocsparse_handle     handle,
+                                                         rocsparse_int        m,
+                                                         rocsparse_int        sweeps,
+                                                         const T*             omega,
+                                                         rocsparse_index_base idx_base,
+                                                         const T*             csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         const T*             scale,
+                                                         const T*             b,
+                                                         T*                   x,
+                                                         T*                   y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of blocks of rows, that are processed by the wavefronts
+    rocsparse_int nblocks = (m - 1) / BLOCKDIM + 1;
+
+#define CSRJACOBI_DIM 256
+    dim3 jacobi_blocks((nblocks * WF_SIZE - 1) / CSRJACOBI_DIM + 1);
+    dim3 jacobi_threads(CSRJACOBI_DIM);
+
+    for(rocsparse_int i = 0; i < sweeps; ++i)
+    {
+        const T* src = (i & 1) ? y : x;
+        T*       dst = (i & 1) ? x : y;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrjacobi_block_kernel_device_scalar<T, BLOCKDIM, WF_SIZE>),
+                               jacobi_blocks,
+                               jacobi_threads,
+                               0,
+                               stream,
+                               m,
+                               omega,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               scale,
+                               b,
+                               src,
+                               dst,
+                               idx_base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrjacobi_block_kernel_host_scalar<T, BLOCKDIM, WF_SIZE>),
+                               jacobi_blocks,
+                               jacobi_threads,
+                               0,
+                               stream,
+                               m,
+                               *omega,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               scale,
+                               b,
+                               src,
+                               dst,
+                               idx_base);
+        }
+    }
+#undef CSRJACOBI_DIM
+
+    // Odd number of sweeps, final iterate is stored in y
+    if(sweeps & 1)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(x, y, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+// Selects the number of threads per block of rows of the block Jacobi smoother, from
+// the average number of non-zeros per block of rows. Each row of the block requires
+// at least one lane.
+template <typename T, unsigned int BLOCKDIM>
+static rocsparse_status rocsparse_csrjacobi_block_dispatch(rocsparse_handle     handle,
+                                                           rocsparse_int        m,
+                                                           rocsparse_int        nnz,
+                                                           rocsparse_int        sweeps,
+                                                           const T*             omega,
+                                                           rocsparse_index_base idx_base,
+                                                           const T*             csr_val,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           const T*             scale,
+                                                           const T*             b,
+                                                           T*                   x,
+                                                           T*                   y)
+{
+    rocsparse_int nnz_per_block = nnz / m * BLOCKDIM;
+
+    if(nnz_per_block < 16)
+    {
+        return rocsparse_csrjacobi_block_sweeps<T, BLOCKDIM, 8>(
+            handle, m, sweeps, omega, idx_base, csr_val, csr_row_ptr, csr_col_ind, scale, b, x, y);
+    }
+    else if(nnz_per_block < 32)
+    {
+        return rocsparse_csrjacobi_block_sweeps<T, BLOCKDIM, 16>(
+            handle, m, sweeps, omega, idx_base, csr_val, csr_row_ptr, csr_col_ind, scale, b, x, y);
+    }
+    else
+    {
+        return rocsparse_csrjacobi_block_sweeps<T, BLOCKDIM, 32>(
+            handle, m, sweeps, omega, idx_base, csr_val, csr_row_ptr, csr_col_ind, scale, b, x, y);
+    }
+}
+
+// Launches the inversion of the diagonal blocks of dimension BLOCKDIM
+template <typename T, unsigned int BLOCKDIM>
+static void rocsparse_csrjacobi_block_diag(rocsparse_handle     handle,
+                                           rocsparse_int        m,
+                                           rocsparse_index_base idx_base,
+                                           const T*             csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           T*                   scale)
+{
+    rocsparse_int nblocks = (m - 1) / BLOCKDIM + 1;
+
+#define CSRJACOBI_DIAG_DIM 256
+    dim3 jacobi_blocks((nblocks - 1) / CSRJACOBI_DIAG_DIM + 1);
+    dim3 jacobi_threads(CSRJACOBI_DIAG_DIM);
+
+    hipLaunchKernelGGL((csrjacobi_block_diag_kernel<T, CSRJACOBI_DIAG_DIM, BLOCKDIM>),
+                       jacobi_blocks,
+                       jacobi_threads,
+                       0,
+                       handle->stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       scale,
+                       idx_base);
+#undef CSRJACOBI_DIAG_DIM
+}
+
+// Size of the inverse scaling, i.e. the inverse diagonal or the inverse diagonal blocks
+static inline size_t rocsparse_csrjacobi_scale_size(rocsparse_jacobi_type type,
+                                                    rocsparse_int         m,
+                                                    rocsparse_int         block_dim)
+{
+    if(type == rocsparse_jacobi_type_block)
+    {
+        return static_cast<size_t>((m - 1) / block_dim + 1) * block_dim * block_dim;
+    }
+
+    return m;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrjacobi_buffer_size_template(rocsparse_handle          handle,
+                                                          rocsparse_jacobi_type     type,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T*                  csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          rocsparse_int             block_dim,
+                                                          size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrjacobi_buffer_size"),
+              type,
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              block_dim,
+              (const void*&)buffer_size);
+
+    // Check smoother type
+    if(type != rocsparse_jacobi_type_point && type != rocsparse_jacobi_type_l1
+       && type != rocsparse_jacobi_type_block)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(type == rocsparse_jacobi_type_block
+            && (block_dim <= 0 || block_dim > CSRJACOBI_MAX_BLOCK_DIM))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    size_t nscale = rocsparse_csrjacobi_scale_size(type, m, block_dim);
+
+    // Inverse scaling
+    *buffer_size = sizeof(T) * ((nscale - 1) / 256 + 1) * 256;
+
+    // Intermediate iterate
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrjacobi_analysis_template(rocsparse_handle          handle,
+                                                       rocsparse_jacobi_type     type,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const T*                  csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int             block_dim,
+                                                       void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrjacobi_analysis"),
+              type,
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              block_dim,
+              (const void*&)temp_buffer);
+
+    // Check smoother type
+    if(type != rocsparse_jacobi_type_point && type != rocsparse_jacobi_type_l1
+       && type != rocsparse_jacobi_type_block)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(type == rocsparse_jacobi_type_block
+            && (block_dim <= 0 || block_dim > CSRJACOBI_MAX_BLOCK_DIM))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Inverse scaling is stored at the beginning of the buffer
+    T* scale = reinterpret_cast<T*>(temp_buffer);
+
+    if(type == rocsparse_jacobi_type_block)
+    {
+        // The diagonal blocks are kept in registers, thus the block dimension has to
+        // be known at compile time
+        switch(block_dim)
+        {
+        case 1:
+            rocsparse_csrjacobi_block_diag<T, 1>(
+                handle, m, descr->base, csr_val, csr_row_ptr, csr_col_ind, scale);
+            break;
+        case 2:
+            rocsparse_csrjacobi_block_diag<T, 2>(
+                handle, m, descr->base, csr_val, csr_row_ptr, csr_col_ind, scale);
+            break;
+        case 3:
+            rocsparse_csrjacobi_block_diag<T, 3>(
+                handle, m, descr->base, csr_val, csr_row_ptr, csr_col_ind, scale);
+            break;
+        case 4:
+            rocsparse_csrjacobi_block_diag<T, 4>(
+                handle, m, descr->base, csr_val, csr_row_ptr, csr_col_ind, scale);
+            break;
+        case 5:
+            rocsparse_csrjacobi_block_diag<T, 5>(
+                handle, m, descr->base, csr_val, csr_row_ptr, csr_col_ind, scale);
+            break;
+        case 6:
+            rocsparse_csrjacobi_block_diag<T, 6>(
+                handle, m, descr->base, csr_val, csr_row_ptr, csr_col_ind, scale);
+            break;
+        case 7:
+            rocsparse_csrjacobi_block_diag<T, 7>(
+                handle, m, descr->base, csr_val, csr_row_ptr, csr_col_ind, scale);
+            break;
+        case 8:
+            rocsparse_csrjacobi_block_diag<T, 8>(
+                handle, m, descr->base, csr_val, csr_row_ptr, csr_col_ind, scale);
+            break;
+        default:
+            return rocsparse_status_invalid_value;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Each row is processed by 8 threads
+#define CSRJACOBI_DIAG_DIM 256
+    dim3 jacobi_blocks((m * 8 - 1) / CSRJACOBI_DIAG_DIM + 1);
+    dim3 jacobi_threads(CSRJACOBI_DIAG_DIM);
+
+    if(type == rocsparse_jacobi_type_l1)
+    {
+        hipLaunchKernelGGL((csrjacobi_diag_kernel<T, CSRJACOBI_DIAG_DIM, 8, true>),
+                           jacobi_blocks,
+                           jacobi_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           scale,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrjacobi_diag_kernel<T, CSRJACOBI_DIAG_DIM, 8, false>),
+                           jacobi_blocks,
+                           jacobi_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           scale,
+                           descr->base);
+    }
+#undef CSRJACOBI_DIAG_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrjacobi_template(rocsparse_handle          handle,
+                                              rocsparse_jacobi_type     type,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const T*                  omega,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_int             block_dim,
+                                              const T*                  b,
+                                              T*                        x,
+                                              rocsparse_int             sweeps,
+                                              void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrjacobi"),
+                  type,
+                  m,
+                  nnz,
+                  *omega,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  block_dim,
+                  (const void*&)b,
+                  (const void*&)x,
+                  sweeps,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrjacobi -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *omega,
+                  "--jacobi",
+                  type,
+                  "--blockdim",
+                  block_dim,
+                  "-k",
+                  sweeps);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrjacobi"),
+                  type,
+                  m,
+                  nnz,
+                  (const void*&)omega,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  block_dim,
+                  (const void*&)b,
+                  (const void*&)x,
+                  sweeps,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check smoother type
+    if(type != rocsparse_jacobi_type_point && type != rocsparse_jacobi_type_l1
+       && type != rocsparse_jacobi_type_block)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(type == rocsparse_jacobi_type_block
+            && (block_dim <= 0 || block_dim > CSRJACOBI_MAX_BLOCK_DIM))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || sweeps == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(omega == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(b == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *omega == static_cast<T>(0))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    size_t nscale = rocsparse_csrjacobi_scale_size(type, m, block_dim);
+
+    // Inverse scaling
+    T* scale = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nscale - 1) / 256 + 1) * 256;
+
+    // Intermediate iterate
+    T* y = reinterpret_cast<T*>(ptr);
+
+    if(type == rocsparse_jacobi_type_block)
+    {
+        // The residual of a block is kept in registers, thus the block dimension has
+        // to be known at compile time
+        switch(block_dim)
+        {
+        case 1:
+            return rocsparse_csrjacobi_block_dispatch<T, 1>(handle,
+                                                            m,
+                                                            nnz,
+                                                            sweeps,
+                                                            omega,
+                                                            descr->base,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            scale,
+                                                            b,
+                                                            x,
+                                                            y);
+        case 2:
+            return rocsparse_csrjacobi_block_dispatch<T, 2>(handle,
+                                                            m,
+                                                            nnz,
+                                                            sweeps,
+                                                            omega,
+                                                            descr->base,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            scale,
+                                                            b,
+                                                            x,
+                                                            y);
+        case 3:
+            return rocsparse_csrjacobi_block_dispatch<T, 3>(handle,
+                                                            m,
+                                                            nnz,
+                                                            sweeps,
+                                                            omega,
+                                                            descr->base,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            scale,
+                                                            b,
+                                                            x,
+                                                            y);
+        case 4:
+            return rocsparse_csrjacobi_block_dispatch<T, 4>(handle,
+                                                            m,
+                                                            nnz,
+                                                            sweeps,
+                                                            omega,
+                                                            descr->base,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            scale,
+                                                            b,
+                                                            x,
+                                                            y);
+        case 5:
+            return rocsparse_csrjacobi_block_dispatch<T, 5>(handle,
+                                                            m,
+                                                            nnz,
+                                                            sweeps,
+                                                            omega,
+                                                            descr->base,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            scale,
+                                                            b,
+                                                            x,
+                                                            y);
+        case 6:
+            return rocsparse_csrjacobi_block_dispatch<T, 6>(handle,
+                                                            m,
+                                                            nnz,
+                                                            sweeps,
+                                                            omega,
+                                                            descr->base,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            scale,
+                                                            b,
+                                                            x,
+                                                            y);
+        case 7:
+            return rocsparse_csrjacobi_block_dispatch<T, 7>(handle,
+                                                            m,
+                                                            nnz,
+                                                            sweeps,
+                                                            omega,
+                                                            descr->base,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            scale,
+                                                            b,
+                                                            x,
+                                                            y);
+        case 8:
+            return rocsparse_csrjacobi_block_dispatch<T, 8>(handle,
+                                                            m,
+                                                            nnz,
+                                                            sweeps,
+                                                            omega,
+                                                            descr->base,
+                                                            csr_val,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            scale,
+                                                            b,
+                                                            x,
+                                                            y);
+        default:
+            return rocsparse_status_invalid_value;
+        }
+    }
+
+    // Average number of non-zeros per row
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        return rocsparse_csrjacobi_sweeps<T, 2>(handle,
+                                                m,
+                                                sweeps,
+                                                omega,
+                                                descr->base,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                scale,
+                                                b,
+                                                x,
+                                                y);
+    }
+    else if(nnz_per_row < 8)
+    {
+        return rocsparse_csrjacobi_sweeps<T, 4>(handle,
+                                                m,
+                                                sweeps,
+                                                omega,
+                                                descr->base,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                scale,
+                                                b,
+                                                x,
+                                                y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        return rocsparse_csrjacobi_sweeps<T, 8>(handle,
+                                                m,
+                                                sweeps,
+                                                omega,
+                                                descr->base,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                scale,
+                                                b,
+                                                x,
+                                                y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        return rocsparse_csrjacobi_sweeps<T, 16>(handle,
+                                                 m,
+                                                 sweeps,
+                                                 omega,
+                                                 descr->base,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 scale,
+                                                 b,
+                                                 x,
+                                                 y);
+    }
+    else
+    {
+        return rocsparse_csrjacobi_sweeps<T, 32>(handle,
+                                                 m,
+                                                 sweeps,
+                                                 omega,
+                                                 descr->base,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 scale,
+                                                 b,
+                                                 x,
+                                                 y);
+    }
+}
+
+#endif // ROCSPARSE_CSRJACOBI_HPP
@@ -114,6 +114,167 @@ rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle, rocsparse_p
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Indicates whether analysis meta data is computed on the host or device.
+ * Set analysis mode, can be host or device
+ *******************************************************************************/
+rocsparse_status rocsparse_set_analysis_mode(rocsparse_handle        handle,
+                                             rocsparse_analysis_mode mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(mode != rocsparse_analysis_mode_host && mode != rocsparse_analysis_mode_device)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    handle->analysis_mode = mode;
+    log_trace(handle, "rocsparse_set_analysis_mode", mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get analysis mode, can be host or device.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_analysis_mode(rocsparse_handle         handle,
+                                             rocsparse_analysis_mode* mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(mode == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    *mode = handle->analysis_mode;
+    log_trace(handle, "rocsparse_get_analysis_mode", *mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Indicates whether analysis functions without policy argument re-use meta data.
+ * Set analysis policy, can be reuse or force
+ *******************************************************************************/
+rocsparse_status rocsparse_set_analysis_policy(rocsparse_handle          handle,
+                                               rocsparse_analysis_policy policy)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(policy != rocsparse_analysis_policy_reuse && policy != rocsparse_analysis_policy_force)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    handle->analysis_policy = policy;
+    log_trace(handle, "rocsparse_set_analysis_policy", policy);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get analysis policy, can be reuse or force.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_analysis_policy(rocsparse_handle           handle,
+                                               rocsparse_analysis_policy* policy)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(policy == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    *policy = handle->analysis_policy;
+    log_trace(handle, "rocsparse_get_analysis_policy", *policy);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Indicates whether reductions return their host result asynchronously.
+ * Set result mode, can be blocking or async
+ *******************************************************************************/
+rocsparse_status rocsparse_set_result_mode(rocsparse_handle handle, rocsparse_result_mode mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(mode != rocsparse_result_mode_blocking && mode != rocsparse_result_mode_async)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    handle->result_mode = mode;
+    log_trace(handle, "rocsparse_set_result_mode", mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get result mode, can be blocking or async.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_result_mode(rocsparse_handle handle, rocsparse_result_mode* mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(mode == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    *mode = handle->result_mode;
+    log_trace(handle, "rocsparse_get_result_mode", *mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Indicates which csrmv algorithm is used without analysis meta data.
+ * Set csrmv algorithm, can be auto, row or merge
+ *******************************************************************************/
+rocsparse_status rocsparse_set_csrmv_alg(rocsparse_handle handle, rocsparse_csrmv_alg alg)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(alg != rocsparse_csrmv_alg_auto && alg != rocsparse_csrmv_alg_row
+       && alg != rocsparse_csrmv_alg_merge)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    handle->csrmv_alg = alg;
+    log_trace(handle, "rocsparse_set_csrmv_alg", alg);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get csrmv algorithm, can be auto, row or merge.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_csrmv_alg(rocsparse_handle handle, rocsparse_csrmv_alg* alg)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    if(alg == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    *alg = handle->csrmv_alg;
+    log_trace(handle, "rocsparse_get_csrmv_alg", *alg);
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -440,6 +601,154 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_create_csr5_mat is a structure holding the rocsparse CSR5
+ * matrix. It must be initialized using rocsparse_create_csr5_mat()
+ * and the returned handle must be passed to all subsequent library function
+ * calls that involve the CSR5 matrix.
+ * It should be destroyed at the end using rocsparse_destroy_csr5_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csr5_mat(rocsparse_csr5_mat* csr5)
+{
+    if(csr5 == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *csr5 = new _rocsparse_csr5_mat;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy CSR5 matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csr5_mat(rocsparse_csr5_mat csr5)
+{
+    if(csr5 == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Destruct
+    try
+    {
+        // Clean up CSR part
+        if(csr5->row_ptr != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(csr5->row_ptr));
+        }
+        if(csr5->col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(csr5->col_ind));
+        }
+        if(csr5->val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(csr5->val));
+        }
+
+        // Clean up tile descriptor
+        if(csr5->tile_ptr != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(csr5->tile_ptr));
+        }
+        if(csr5->tile_flag != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(csr5->tile_flag));
+        }
+        if(csr5->tile_offset != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(csr5->tile_offset));
+        }
+
+        delete csr5;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_sellcs_mat is a structure holding the rocsparse
+ * SELL-C-sigma matrix. It must be initialized using rocsparse_create_sellcs_mat()
+ * and the returned handle must be passed to all subsequent library function
+ * calls that involve the SELL-C-sigma matrix.
+ * It should be destroyed at the end using rocsparse_destroy_sellcs_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_sellcs_mat(rocsparse_sellcs_mat* sell)
+{
+    if(sell == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *sell = new _rocsparse_sellcs_mat;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy SELL-C-sigma matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_sellcs_mat(rocsparse_sellcs_mat sell)
+{
+    if(sell == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Destruct
+    try
+    {
+        // Clean up slices
+        if(sell->slice_ptr != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(sell->slice_ptr));
+        }
+        if(sell->col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(sell->col_ind));
+        }
+        if(sell->val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(sell->val));
+        }
+
+        // Clean up row permutation
+        if(sell->perm != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(sell->perm));
+        }
+
+        delete sell;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_mat_info is a structure holding the matrix info data that is
  * gathered during the analysis routines. It must be initialized by calling
@@ -480,11 +789,16 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
 
     // Uncouple shared meta data
     // TODO add more crossover data here
-    if(info->csrsv_lower_info == info->csrilu0_info)
+    if(info->csrsv_lower_info == info->csrilu0_info || info->csrsv_lower_info == info->csric0_info)
     {
         info->csrsv_lower_info = nullptr;
     }
 
+    if(info->csric0_info == info->csrilu0_info)
+    {
+        info->csric0_info = nullptr;
+    }
+
     // Clear csrmv info struct
     if(info->csrmv_info != nullptr)
     {
@@ -497,6 +811,12 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
     }
 
+    // Clear csric0 info struct
+    if(info->csric0_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csric0_info));
+    }
+
     // Clear csrsv upper info struct
     if(info->csrsv_upper_info != nullptr)
     {
@@ -509,6 +829,30 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
     }
 
+    // Clear transposed csrsv upper info struct
+    if(info->csrsvt_upper_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_upper_info));
+    }
+
+    // Clear transposed csrsv lower info struct
+    if(info->csrsvt_lower_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_lower_info));
+    }
+
+    // Clear csriluk info struct
+    if(info->csriluk_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    }
+
+    // Clear csrilu0 boost counter
+    if(info->boost_count != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->boost_count));
+    }
+
     // Destruct
     try
     {
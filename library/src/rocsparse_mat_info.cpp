@@ -0,0 +1,1093 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "csr_hash.h"
+#include "definitions.h"
+#include "handle.h"
+#include "level2/rocsparse_csrmv.hpp"
+#include "logging.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+// Serialized matrix info blob version, must be increased whenever the layout of
+// the blob or the meaning of the analysis meta data changes
+#define ROCSPARSE_MAT_INFO_BLOB_VERSION 5
+
+// Sections that are present in the serialized matrix info blob
+#define MAT_INFO_SECTION_CSRMV 1
+#define MAT_INFO_SECTION_CSRILU0 2
+#define MAT_INFO_SECTION_CSRSV_LOWER 4
+#define MAT_INFO_SECTION_CSRSV_UPPER 8
+#define MAT_INFO_SECTION_CSRSV_LOWER_SHARED 16
+#define MAT_INFO_SECTION_CSRSVT_LOWER 32
+#define MAT_INFO_SECTION_CSRSVT_UPPER 64
+
+static const char rocsparse_mat_info_magic[8] = {'R', 'S', 'P', 'M', 'A', 'T', 'I', 'F'};
+
+struct rocsparse_mat_info_blob_header
+{
+    char               magic[8];
+    uint32_t           version;
+    uint32_t           sections;
+    unsigned long long hash;
+    unsigned long long checksum;
+    rocsparse_int      m;
+    rocsparse_int      nnz;
+    int32_t            base;
+    int32_t            reserved;
+};
+
+struct rocsparse_mat_info_blob_csrmv
+{
+    int32_t            trans;
+    rocsparse_int      n;
+    unsigned long long entries;
+    int32_t            trans_alg;
+    int32_t            reserved;
+};
+
+struct rocsparse_mat_info_blob_csrtr
+{
+    rocsparse_int max_nnz;
+    rocsparse_int zero_pivot;
+    rocsparse_int level_ptr_size;
+    rocsparse_int dep_count_size;
+};
+
+// Size of a serialized csrtr section
+static size_t rocsparse_mat_info_csrtr_size(rocsparse_int m,
+                                            rocsparse_int level_ptr_size,
+                                            rocsparse_int dep_count_size)
+{
+    return sizeof(rocsparse_mat_info_blob_csrtr)
+           + sizeof(rocsparse_int) * (2 * m + level_ptr_size + dep_count_size);
+}
+
+// Number of serialized dependency counts, which are only present for transposed solves
+static rocsparse_int rocsparse_mat_info_dep_count_size(rocsparse_csrtr_info info)
+{
+    return (info->dep_count != nullptr) ? info->m : 0;
+}
+
+// Checks whether csrtr meta data belongs to the given matrix
+static bool rocsparse_mat_info_csrtr_match(rocsparse_csrtr_info info,
+                                           rocsparse_int        m,
+                                           rocsparse_int        nnz,
+                                           rocsparse_index_base base,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind)
+{
+    return info->m == m && info->nnz == nnz && info->descr->base == base
+           && info->csr_row_ptr == csr_row_ptr && info->csr_col_ind == csr_col_ind;
+}
+
+// Writes csrtr meta data into the blob
+static rocsparse_status rocsparse_mat_info_write_csrtr(hipStream_t          stream,
+                                                       rocsparse_csrtr_info info,
+                                                       char*                ptr)
+{
+    rocsparse_mat_info_blob_csrtr section;
+    section.max_nnz        = info->max_nnz;
+    section.level_ptr_size = info->level_ptr.size();
+    section.dep_count_size = rocsparse_mat_info_dep_count_size(info);
+
+    char* row_map      = ptr + sizeof(rocsparse_mat_info_blob_csrtr);
+    char* csr_diag_ind = row_map + sizeof(rocsparse_int) * info->m;
+    char* level_ptr    = csr_diag_ind + sizeof(rocsparse_int) * info->m;
+    char* dep_count    = level_ptr + sizeof(rocsparse_int) * section.level_ptr_size;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&section.zero_pivot,
+                                       info->zero_pivot,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        row_map, info->row_map, sizeof(rocsparse_int) * info->m, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_diag_ind,
+                                       info->csr_diag_ind,
+                                       sizeof(rocsparse_int) * info->m,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    if(section.dep_count_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dep_count,
+                                           info->dep_count,
+                                           sizeof(rocsparse_int) * section.dep_count_size,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+    }
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    std::memcpy(ptr, &section, sizeof(rocsparse_mat_info_blob_csrtr));
+    std::memcpy(
+        level_ptr, info->level_ptr.data(), sizeof(rocsparse_int) * section.level_ptr_size);
+
+    return rocsparse_status_success;
+}
+
+// FNV-1a checksum of the blob payload, to detect corrupt or truncated blobs
+static unsigned long long rocsparse_mat_info_checksum(const char* data, size_t size)
+{
+    unsigned long long checksum = 0xcbf29ce484222325ULL;
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        checksum ^= static_cast<unsigned char>(data[i]);
+        checksum *= 0x100000001b3ULL;
+    }
+
+    return checksum;
+}
+
+// Reads n rocsparse_int from a possibly unaligned position of the blob
+static std::vector<rocsparse_int> rocsparse_mat_info_read_array(const char* ptr, rocsparse_int n)
+{
+    std::vector<rocsparse_int> array(n);
+    std::memcpy(array.data(), ptr, sizeof(rocsparse_int) * n);
+
+    return array;
+}
+
+// Checks whether the serialized csrmv meta data can be safely used with a matrix
+// of m rows
+static bool rocsparse_mat_info_valid_csrmv(const rocsparse_mat_info_blob_csrmv& section,
+                                           rocsparse_int                        m,
+                                           const char*                          ptr)
+{
+    if(section.n <= 0)
+    {
+        return false;
+    }
+
+    // Transposed csrmv meta data does not contain any row blocks
+    if(section.trans != rocsparse_operation_none)
+    {
+        return true;
+    }
+
+    // Row blocks contain at least the first and the last row
+    if(section.entries < 2)
+    {
+        return false;
+    }
+
+    for(unsigned long long i = 0; i < section.entries; ++i)
+    {
+        unsigned long long block;
+        std::memcpy(&block, ptr + sizeof(unsigned long long) * i, sizeof(unsigned long long));
+
+        unsigned long long row = (block >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL);
+
+        if(row > static_cast<unsigned long long>(m))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Checks whether the serialized csrtr meta data can be safely used with the matrix,
+// given its maximum row length
+static bool rocsparse_mat_info_valid_csrtr(rocsparse_int        m,
+                                           rocsparse_int        nnz,
+                                           rocsparse_index_base base,
+                                           rocsparse_int        max_nnz,
+                                           const char*          ptr)
+{
+    rocsparse_mat_info_blob_csrtr section;
+    std::memcpy(&section, ptr, sizeof(rocsparse_mat_info_blob_csrtr));
+
+    ptr += sizeof(rocsparse_mat_info_blob_csrtr);
+
+    // The maximum row length selects the size of the csrilu0 hash tables
+    if(section.max_nnz != max_nnz)
+    {
+        return false;
+    }
+
+    // Zero pivot is either unset or a row index
+    if(section.zero_pivot != std::numeric_limits<rocsparse_int>::max()
+       && (section.zero_pivot < base || section.zero_pivot >= m + base))
+    {
+        return false;
+    }
+
+    // row_map is a permutation
+    std::vector<rocsparse_int> row_map = rocsparse_mat_info_read_array(ptr, m);
+    std::vector<bool>          visited(m, false);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        if(row_map[i] < 0 || row_map[i] >= m || visited[row_map[i]] == true)
+        {
+            return false;
+        }
+
+        visited[row_map[i]] = true;
+    }
+
+    ptr += sizeof(rocsparse_int) * m;
+
+    // Diagonal entries are either missing or point into the matrix
+    std::vector<rocsparse_int> csr_diag_ind = rocsparse_mat_info_read_array(ptr, m);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        if(csr_diag_ind[i] != -1 && (csr_diag_ind[i] < 0 || csr_diag_ind[i] >= nnz))
+        {
+            return false;
+        }
+    }
+
+    ptr += sizeof(rocsparse_int) * m;
+
+    // Levels partition row_map
+    if(section.level_ptr_size > 0)
+    {
+        std::vector<rocsparse_int> level_ptr
+            = rocsparse_mat_info_read_array(ptr, section.level_ptr_size);
+
+        if(level_ptr.front() != 0 || level_ptr.back() != m)
+        {
+            return false;
+        }
+
+        for(rocsparse_int i = 1; i < section.level_ptr_size; ++i)
+        {
+            if(level_ptr[i] < level_ptr[i - 1])
+            {
+                return false;
+            }
+        }
+    }
+
+    ptr += sizeof(rocsparse_int) * section.level_ptr_size;
+
+    // Each row depends on at most all other rows
+    if(section.dep_count_size > 0)
+    {
+        std::vector<rocsparse_int> dep_count = rocsparse_mat_info_read_array(ptr, m);
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            if(dep_count[i] < 0 || dep_count[i] > m)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Destroys all meta data of a matrix info structure that can be serialized
+static rocsparse_status rocsparse_mat_info_clear(rocsparse_mat_info info)
+{
+    // Uncouple shared meta data
+    if(info->csrsv_lower_info == info->csrilu0_info)
+    {
+        info->csrsv_lower_info = nullptr;
+    }
+
+    // csric0 meta data is not serialized, it is dropped unless it is shared
+    if(info->csric0_info == info->csrilu0_info || info->csric0_info == info->csrsv_lower_info)
+    {
+        info->csric0_info = nullptr;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csric0_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_lower_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsvt_upper_info));
+
+    info->csrmv_info        = nullptr;
+    info->csrilu0_info      = nullptr;
+    info->csric0_info       = nullptr;
+    info->csrsv_lower_info  = nullptr;
+    info->csrsv_upper_info  = nullptr;
+    info->csrsvt_lower_info = nullptr;
+    info->csrsvt_upper_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+// Creates csrtr meta data from the blob
+static rocsparse_status rocsparse_mat_info_read_csrtr(hipStream_t               stream,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      unsigned long long        hash,
+                                                      const char*               ptr,
+                                                      rocsparse_csrtr_info*     info)
+{
+    rocsparse_mat_info_blob_csrtr section;
+    std::memcpy(&section, ptr, sizeof(rocsparse_mat_info_blob_csrtr));
+
+    ptr += sizeof(rocsparse_mat_info_blob_csrtr);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(info));
+
+    rocsparse_csrtr_info csrtr = *info;
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrtr->row_map, sizeof(rocsparse_int) * m));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrtr->csr_diag_ind, sizeof(rocsparse_int) * m));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrtr->zero_pivot, sizeof(rocsparse_int)));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        csrtr->row_map, ptr, sizeof(rocsparse_int) * m, hipMemcpyHostToDevice, stream));
+
+    ptr += sizeof(rocsparse_int) * m;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        csrtr->csr_diag_ind, ptr, sizeof(rocsparse_int) * m, hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrtr->zero_pivot,
+                                       &section.zero_pivot,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyHostToDevice,
+                                       stream));
+
+    ptr += sizeof(rocsparse_int) * m;
+
+    csrtr->level_ptr.assign(reinterpret_cast<const rocsparse_int*>(ptr),
+                            reinterpret_cast<const rocsparse_int*>(ptr) + section.level_ptr_size);
+
+    ptr += sizeof(rocsparse_int) * section.level_ptr_size;
+
+    if(section.dep_count_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrtr->dep_count, sizeof(rocsparse_int) * m));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csrtr->dep_count, ptr, sizeof(rocsparse_int) * m, hipMemcpyHostToDevice, stream));
+    }
+
+    // Wait for device transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    csrtr->max_nnz     = section.max_nnz;
+    csrtr->hash        = hash;
+    csrtr->m           = m;
+    csrtr->nnz         = nnz;
+    csrtr->descr       = descr;
+    csrtr->csr_row_ptr = csr_row_ptr;
+    csrtr->csr_col_ind = csr_col_ind;
+
+    return rocsparse_status_success;
+}
+
+// Restores the meta data of all sections of a verified blob
+static rocsparse_status
+    rocsparse_mat_info_restore(hipStream_t                          stream,
+                               uint32_t                             sections,
+                               const rocsparse_mat_info_blob_csrmv& csrmv_section,
+                               rocsparse_int                        m,
+                               rocsparse_int                        nnz,
+                               const rocsparse_mat_descr            descr,
+                               const rocsparse_int*                 csr_row_ptr,
+                               const rocsparse_int*                 csr_col_ind,
+                               unsigned long long                   hash,
+                               const char*                          ptr,
+                               rocsparse_mat_info                   info)
+{
+    uint32_t csrtr_sections[5] = {MAT_INFO_SECTION_CSRILU0,
+                                  MAT_INFO_SECTION_CSRSV_LOWER,
+                                  MAT_INFO_SECTION_CSRSV_UPPER,
+                                  MAT_INFO_SECTION_CSRSVT_LOWER,
+                                  MAT_INFO_SECTION_CSRSVT_UPPER};
+
+    // csrmv row blocks
+    if(sections & MAT_INFO_SECTION_CSRMV)
+    {
+        ptr += sizeof(rocsparse_mat_info_blob_csrmv);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
+
+        rocsparse_csrmv_info csrmv = info->csrmv_info;
+
+        // We're multiplying the size by two because the extended precision form of
+        // CSR-Adaptive requires more space for the final global reduction.
+        csrmv->size = 2 * csrmv_section.entries;
+
+        // Transposed csrmv meta data does not contain any row blocks
+        if(csrmv_section.entries > 0)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMalloc((void**)&csrmv->row_blocks, sizeof(unsigned long long) * csrmv->size));
+
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrmv->row_blocks,
+                                               ptr,
+                                               sizeof(unsigned long long) * csrmv_section.entries,
+                                               hipMemcpyHostToDevice,
+                                               stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(csrmv->row_blocks + csrmv_section.entries,
+                                               0,
+                                               sizeof(unsigned long long) * csrmv_section.entries,
+                                               stream));
+
+            // Wait for device transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+
+        ptr += sizeof(unsigned long long) * csrmv_section.entries;
+
+        csrmv->trans       = static_cast<rocsparse_operation>(csrmv_section.trans);
+        csrmv->trans_alg   = static_cast<rocsparse_csrmvt_alg>(csrmv_section.trans_alg);
+        csrmv->m           = m;
+        csrmv->n           = csrmv_section.n;
+        csrmv->nnz         = nnz;
+        csrmv->descr       = descr;
+        csrmv->csr_row_ptr = csr_row_ptr;
+        csrmv->csr_col_ind = csr_col_ind;
+        csrmv->hash        = hash;
+    }
+
+    // csrilu0 and csrsv meta data
+    rocsparse_csrtr_info* csrtr_infos[5] = {&info->csrilu0_info,
+                                            &info->csrsv_lower_info,
+                                            &info->csrsv_upper_info,
+                                            &info->csrsvt_lower_info,
+                                            &info->csrsvt_upper_info};
+
+    for(int i = 0; i < 5; ++i)
+    {
+        if(!(sections & csrtr_sections[i]))
+        {
+            continue;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_read_csrtr(
+            stream, m, nnz, descr, csr_row_ptr, csr_col_ind, hash, ptr, csrtr_infos[i]));
+
+        ptr += rocsparse_mat_info_csrtr_size(m,
+                                             (*csrtr_infos[i])->level_ptr.size(),
+                                             rocsparse_mat_info_dep_count_size(*csrtr_infos[i]));
+    }
+
+    if(sections & MAT_INFO_SECTION_CSRSV_LOWER_SHARED)
+    {
+        info->csrsv_lower_info = info->csrilu0_info;
+    }
+
+    return rocsparse_status_success;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************************************************************************
+ * \brief rocsparse_csr_structure_hash computes the structural hash of a sparse
+ * CSR matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_csr_structure_hash(rocsparse_handle     handle,
+                                              rocsparse_int        m,
+                                              rocsparse_int        nnz,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              unsigned long long*  hash)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr_structure_hash",
+              m,
+              nnz,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)hash);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hash == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csr_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, hash);
+}
+
+/********************************************************************************
+ * \brief rocsparse_mat_info_serialize writes the analysis meta data of a matrix
+ * info structure into a versioned binary blob.
+ *******************************************************************************/
+rocsparse_status rocsparse_mat_info_serialize(rocsparse_handle         handle,
+                                              const rocsparse_mat_info info,
+                                              size_t*                  size,
+                                              void*                    blob)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_mat_info_serialize",
+              (const void*&)info,
+              (const void*&)size,
+              (const void*&)blob);
+
+    // Check pointer arguments
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_csrmv_info csrmv        = info->csrmv_info;
+    rocsparse_csrtr_info csrilu0      = info->csrilu0_info;
+    rocsparse_csrtr_info csrsv_lower  = info->csrsv_lower_info;
+    rocsparse_csrtr_info csrsv_upper  = info->csrsv_upper_info;
+    rocsparse_csrtr_info csrsvt_lower = info->csrsvt_lower_info;
+    rocsparse_csrtr_info csrsvt_upper = info->csrsvt_upper_info;
+
+    // The transposed triangle of symmetric csrmv meta data is not serialized, the
+    // csrmv section is omitted and csrmv_analysis has to be run again
+    if(csrmv != nullptr && csrmv->symm_col_ptr != nullptr)
+    {
+        csrmv = nullptr;
+    }
+
+    // Lower csrsv meta data might be shared with csrilu0
+    bool lower_shared = (csrsv_lower != nullptr && csrsv_lower == csrilu0);
+
+    if(lower_shared == true)
+    {
+        csrsv_lower = nullptr;
+    }
+
+    rocsparse_csrtr_info csrtr_infos[5]
+        = {csrilu0, csrsv_lower, csrsv_upper, csrsvt_lower, csrsvt_upper};
+    uint32_t csrtr_sections[5] = {MAT_INFO_SECTION_CSRILU0,
+                                  MAT_INFO_SECTION_CSRSV_LOWER,
+                                  MAT_INFO_SECTION_CSRSV_UPPER,
+                                  MAT_INFO_SECTION_CSRSVT_LOWER,
+                                  MAT_INFO_SECTION_CSRSVT_UPPER};
+
+    // All meta data must belong to the same matrix, we use the first available
+    // meta data as reference
+    rocsparse_int        m;
+    rocsparse_int        nnz;
+    rocsparse_index_base base;
+    const rocsparse_int* csr_row_ptr;
+    const rocsparse_int* csr_col_ind;
+
+    rocsparse_csrtr_info csrtr = nullptr;
+
+    for(int i = 0; i < 5 && csrtr == nullptr; ++i)
+    {
+        csrtr = csrtr_infos[i];
+    }
+
+    if(csrmv != nullptr)
+    {
+        m           = csrmv->m;
+        nnz         = csrmv->nnz;
+        base        = csrmv->descr->base;
+        csr_row_ptr = csrmv->csr_row_ptr;
+        csr_col_ind = csrmv->csr_col_ind;
+    }
+    else if(csrtr != nullptr)
+    {
+        m           = csrtr->m;
+        nnz         = csrtr->nnz;
+        base        = csrtr->descr->base;
+        csr_row_ptr = csrtr->csr_row_ptr;
+        csr_col_ind = csrtr->csr_col_ind;
+    }
+    else
+    {
+        // No analysis meta data available
+        return rocsparse_status_invalid_value;
+    }
+
+    // Compute required blob size
+    uint32_t sections  = 0;
+    size_t   blob_size = sizeof(rocsparse_mat_info_blob_header);
+
+    if(csrmv != nullptr)
+    {
+        // Row blocks that have been computed on the device need to be available
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_info_fetch_size(handle, csrmv));
+
+        sections |= MAT_INFO_SECTION_CSRMV;
+        blob_size += sizeof(rocsparse_mat_info_blob_csrmv)
+                     + sizeof(unsigned long long) * (csrmv->size / 2);
+    }
+
+    for(int i = 0; i < 5; ++i)
+    {
+        if(csrtr_infos[i] == nullptr)
+        {
+            continue;
+        }
+
+        if(rocsparse_mat_info_csrtr_match(csrtr_infos[i], m, nnz, base, csr_row_ptr, csr_col_ind)
+           == false)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        sections |= csrtr_sections[i];
+        blob_size += rocsparse_mat_info_csrtr_size(
+            m, csrtr_infos[i]->level_ptr.size(), rocsparse_mat_info_dep_count_size(csrtr_infos[i]));
+    }
+
+    if(lower_shared == true)
+    {
+        sections |= MAT_INFO_SECTION_CSRSV_LOWER_SHARED;
+    }
+
+    // Quick return if only the blob size is queried
+    if(blob == nullptr)
+    {
+        *size = blob_size;
+        return rocsparse_status_success;
+    }
+
+    if(*size < blob_size)
+    {
+        *size = blob_size;
+        return rocsparse_status_invalid_size;
+    }
+
+    *size = blob_size;
+
+    char* ptr = reinterpret_cast<char*>(blob);
+
+    // Header
+    rocsparse_mat_info_blob_header header;
+
+    std::memcpy(header.magic, rocsparse_mat_info_magic, sizeof(header.magic));
+    header.version  = ROCSPARSE_MAT_INFO_BLOB_VERSION;
+    header.sections = sections;
+    header.m        = m;
+    header.nnz      = nnz;
+    header.base     = base;
+    header.reserved = 0;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, &header.hash));
+
+    // The header is written last, once the checksum of the payload is known
+    ptr += sizeof(rocsparse_mat_info_blob_header);
+
+    // csrmv row blocks
+    if(csrmv != nullptr)
+    {
+        rocsparse_mat_info_blob_csrmv section;
+
+        section.trans     = csrmv->trans;
+        section.n         = csrmv->n;
+        section.entries   = csrmv->size / 2;
+        section.trans_alg = csrmv->trans_alg;
+        section.reserved  = 0;
+
+        std::vector<unsigned long long> row_blocks(section.entries);
+
+        // Transposed csrmv meta data does not contain any row blocks
+        if(section.entries > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_blocks.data(),
+                                               csrmv->row_blocks,
+                                               sizeof(unsigned long long) * section.entries,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
+
+        // Clear the long rows synchronization flag, such that the blob does not
+        // depend on the number of csrmv calls that have been performed
+        for(size_t i = 0; i < row_blocks.size(); ++i)
+        {
+            row_blocks[i] &= ~(1ULL << WG_BITS);
+        }
+
+        std::memcpy(ptr, &section, sizeof(rocsparse_mat_info_blob_csrmv));
+        ptr += sizeof(rocsparse_mat_info_blob_csrmv);
+
+        std::memcpy(ptr, row_blocks.data(), sizeof(unsigned long long) * section.entries);
+        ptr += sizeof(unsigned long long) * section.entries;
+    }
+
+    // csrilu0 and csrsv meta data
+    for(int i = 0; i < 5; ++i)
+    {
+        if(csrtr_infos[i] == nullptr)
+        {
+            continue;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_write_csrtr(stream, csrtr_infos[i], ptr));
+        ptr += rocsparse_mat_info_csrtr_size(m,
+                                             csrtr_infos[i]->level_ptr.size(),
+                                             rocsparse_mat_info_dep_count_size(csrtr_infos[i]));
+    }
+
+    header.checksum
+        = rocsparse_mat_info_checksum(reinterpret_cast<const char*>(blob)
+                                          + sizeof(rocsparse_mat_info_blob_header),
+                                      blob_size - sizeof(rocsparse_mat_info_blob_header));
+
+    std::memcpy(blob, &header, sizeof(rocsparse_mat_info_blob_header));
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_mat_info_deserialize restores the analysis meta data of a
+ * matrix info structure from a versioned binary blob.
+ *******************************************************************************/
+rocsparse_status rocsparse_mat_info_deserialize(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t                    size,
+                                                const void*               blob,
+                                                rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_mat_info_deserialize",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              size,
+              (const void*&)blob,
+              (const void*&)info);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(size < sizeof(rocsparse_mat_info_blob_header))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(blob == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    const char* ptr = reinterpret_cast<const char*>(blob);
+
+    // Header
+    rocsparse_mat_info_blob_header header;
+    std::memcpy(&header, ptr, sizeof(rocsparse_mat_info_blob_header));
+    ptr += sizeof(rocsparse_mat_info_blob_header);
+
+    if(std::memcmp(header.magic, rocsparse_mat_info_magic, sizeof(header.magic)) != 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(header.version != ROCSPARSE_MAT_INFO_BLOB_VERSION)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(header.base != descr->base)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(header.m != m || header.nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Verify the blob size, before touching any data
+    size_t blob_size = sizeof(rocsparse_mat_info_blob_header);
+
+    rocsparse_mat_info_blob_csrmv csrmv_section = {};
+
+    if(header.sections & MAT_INFO_SECTION_CSRMV)
+    {
+        if(size < blob_size + sizeof(rocsparse_mat_info_blob_csrmv))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        std::memcpy(&csrmv_section, ptr, sizeof(rocsparse_mat_info_blob_csrmv));
+
+        // Check operation and transposed algorithm
+        if(csrmv_section.trans != rocsparse_operation_none
+           && csrmv_section.trans != rocsparse_operation_transpose
+           && csrmv_section.trans != rocsparse_operation_conjugate_transpose)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        if(csrmv_section.trans_alg != rocsparse_csrmvt_alg_atomic
+           && csrmv_section.trans_alg != rocsparse_csrmvt_alg_lds)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        if(csrmv_section.entries > size / sizeof(unsigned long long))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        blob_size += sizeof(rocsparse_mat_info_blob_csrmv)
+                     + sizeof(unsigned long long) * csrmv_section.entries;
+    }
+
+    uint32_t csrtr_sections[5] = {MAT_INFO_SECTION_CSRILU0,
+                                  MAT_INFO_SECTION_CSRSV_LOWER,
+                                  MAT_INFO_SECTION_CSRSV_UPPER,
+                                  MAT_INFO_SECTION_CSRSVT_LOWER,
+                                  MAT_INFO_SECTION_CSRSVT_UPPER};
+
+    if(size < blob_size)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    for(int i = 0; i < 5; ++i)
+    {
+        if(!(header.sections & csrtr_sections[i]))
+        {
+            continue;
+        }
+
+        if(size < blob_size + sizeof(rocsparse_mat_info_blob_csrtr))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        rocsparse_mat_info_blob_csrtr csrtr_section;
+        std::memcpy(&csrtr_section,
+                    reinterpret_cast<const char*>(blob) + blob_size,
+                    sizeof(rocsparse_mat_info_blob_csrtr));
+
+        // There is at most one level per row
+        if(csrtr_section.level_ptr_size < 0 || csrtr_section.level_ptr_size > m + 1)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        // Dependency counts are either absent or given for each row
+        if(csrtr_section.dep_count_size != 0 && csrtr_section.dep_count_size != m)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        blob_size += rocsparse_mat_info_csrtr_size(
+            m, csrtr_section.level_ptr_size, csrtr_section.dep_count_size);
+
+        if(size < blob_size)
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+
+    // Shared lower csrsv meta data requires csrilu0 meta data
+    if((header.sections & MAT_INFO_SECTION_CSRSV_LOWER_SHARED)
+       && !(header.sections & MAT_INFO_SECTION_CSRILU0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Verify the integrity of the payload
+    if(rocsparse_mat_info_checksum(reinterpret_cast<const char*>(blob)
+                                       + sizeof(rocsparse_mat_info_blob_header),
+                                   blob_size - sizeof(rocsparse_mat_info_blob_header))
+       != header.checksum)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Verify the sparsity pattern
+    unsigned long long hash;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, &hash));
+
+    if(hash != header.hash)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Verify the meta data itself, before anything is uploaded to the device
+    const char* section_ptr = ptr;
+
+    if(header.sections & MAT_INFO_SECTION_CSRMV)
+    {
+        section_ptr += sizeof(rocsparse_mat_info_blob_csrmv);
+
+        if(rocsparse_mat_info_valid_csrmv(csrmv_section, m, section_ptr) == false)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        section_ptr += sizeof(unsigned long long) * csrmv_section.entries;
+    }
+
+    // Maximum row length, which is required to verify csrtr meta data
+    rocsparse_int max_nnz = 0;
+
+    if(header.sections
+       & (MAT_INFO_SECTION_CSRILU0 | MAT_INFO_SECTION_CSRSV_LOWER | MAT_INFO_SECTION_CSRSV_UPPER
+          | MAT_INFO_SECTION_CSRSVT_LOWER | MAT_INFO_SECTION_CSRSVT_UPPER))
+    {
+        std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcsr_row_ptr.data(),
+                                           csr_row_ptr,
+                                           sizeof(rocsparse_int) * (m + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            max_nnz = std::max(max_nnz, hcsr_row_ptr[i + 1] - hcsr_row_ptr[i]);
+        }
+    }
+
+    for(int i = 0; i < 5; ++i)
+    {
+        if(!(header.sections & csrtr_sections[i]))
+        {
+            continue;
+        }
+
+        if(rocsparse_mat_info_valid_csrtr(m, nnz, descr->base, max_nnz, section_ptr) == false)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        rocsparse_mat_info_blob_csrtr csrtr_section;
+        std::memcpy(&csrtr_section, section_ptr, sizeof(rocsparse_mat_info_blob_csrtr));
+
+        section_ptr += rocsparse_mat_info_csrtr_size(
+            m, csrtr_section.level_ptr_size, csrtr_section.dep_count_size);
+    }
+
+    // Clear existing meta data
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_clear(info));
+
+    // Restore the meta data. If this fails, no partially restored meta data is kept.
+    rocsparse_status status = rocsparse_mat_info_restore(stream,
+                                                         header.sections,
+                                                         csrmv_section,
+                                                         m,
+                                                         nnz,
+                                                         descr,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         hash,
+                                                         ptr,
+                                                         info);
+
+    if(status != rocsparse_status_success)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_clear(info));
+    }
+
+    return status;
+}
+
+#ifdef __cplusplus
+}
+#endif